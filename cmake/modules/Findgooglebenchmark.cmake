@@ -0,0 +1,72 @@
+#
+# Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+# Copyright Amazon.com Inc. or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+
+
+
+include(FetchContent)
+
+set(googlebenchmark_GIT_REPOSITORY "https://github.com/google/benchmark.git")
+set(googlebenchmark_GIT_TAG "v1.8.3")
+
+FetchContent_Declare(
+    googlebenchmark
+    GIT_REPOSITORY  ${googlebenchmark_GIT_REPOSITORY}
+    GIT_TAG         ${googlebenchmark_GIT_TAG}
+)
+# +--------------------------------------------------------------------------------------------------------------------+
+# Because we use FetchContent_Populate to specify a source directory other than the default we have
+# to manually manage the <lowercaseName>_POPULATED, <lowercaseName>_SOURCE_DIR, and <lowercaseName>_BINARY_DIR
+# variables normally set by this method.
+# See https://cmake.org/cmake/help/latest/module/FetchContent.html?highlight=fetchcontent#command:fetchcontent_populate
+# for more information.
+# This is not ideal, to copy-and-paste this code, but it is the only way to redirect fetch content to an in-source
+# directory. An upstream patch to cmake is needed to fix this.
+get_property(googlebenchmark_POPULATED GLOBAL PROPERTY googlebenchmark_POPULATED)
+
+if(NOT googlebenchmark_POPULATED)
+
+    cmake_path(APPEND CETLVAST_EXTERNAL_ROOT "googlebenchmark" OUTPUT_VARIABLE LOCAL_googlebenchmark_SOURCE_DIR)
+
+    if (NOT ${FETCHCONTENT_FULLY_DISCONNECTED})
+        FetchContent_Populate(
+            googlebenchmark
+            SOURCE_DIR      ${LOCAL_googlebenchmark_SOURCE_DIR}
+            GIT_REPOSITORY  ${googlebenchmark_GIT_REPOSITORY}
+            GIT_TAG         ${googlebenchmark_GIT_TAG}
+        )
+    else()
+        set(googlebenchmark_SOURCE_DIR ${LOCAL_googlebenchmark_SOURCE_DIR})
+    endif()
+
+    set_property(GLOBAL PROPERTY googlebenchmark_POPULATED true)
+
+endif()
+# +--------------------------------------------------------------------------------------------------------------------+
+
+
+if(NOT TARGET benchmark::benchmark)
+
+if (EXISTS ${googlebenchmark_SOURCE_DIR}/CMakeLists.txt)
+    set(googlebenchmark_FOUND TRUE)
+endif()
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(googlebenchmark
+    REQUIRED_VARS googlebenchmark_SOURCE_DIR googlebenchmark_FOUND
+)
+
+set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_WERROR OFF CACHE BOOL "" FORCE)
+
+add_subdirectory(${googlebenchmark_SOURCE_DIR} ${CMAKE_BINARY_DIR}/googlebenchmark EXCLUDE_FROM_ALL)
+
+# The library is third-party code, so it is built without our (very strict) warning flag set.
+set_target_properties(benchmark benchmark_main PROPERTIES COMPILE_OPTIONS "")
+
+endif()
@@ -0,0 +1,609 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef EXAMPLE_PLATFORM_LOG_KEY_VALUE_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_LOG_KEY_VALUE_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/common/crc.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace example
+{
+namespace platform
+{
+namespace storage
+{
+
+/// Defines a key-value storage backed by a single append-only (aka log-structured) file.
+///
+/// Every `put` or `drop` appends one record to the end of the file, so saving of many registers results in
+/// a sequence of small appends to an already open file (instead of creation of a file per key).
+/// The latest record of each key is located via an in-memory index, which is rebuilt on open by scanning the log.
+///
+/// Record layout (little-endian):
+/// ```
+/// +---------+------------+----------+------+----------+-----------+-------------+
+/// | crc: u64| value: u32 | key: u16 | kind | reserved | key bytes | value bytes |
+/// +---------+------------+----------+------+----------+-----------+-------------+
+/// ```
+/// The CRC-64-WE covers everything after the CRC field. A record is committed once it is fully written
+/// (and synced, see `Options::sync_on_put`). A torn or corrupted tail (f.e. after a power loss in the middle
+/// of an append) is detected by the CRC (or by unknown record kind) on the next open, and truncated away -
+/// so, either all or none of the data bytes of a `put` are stored. A log file which is too short to hold
+/// even the file magic is treated as an empty one.
+///
+/// Superseded and dropped records are garbage, which is reclaimed by compaction: live records are copied
+/// to a temporary file, which then atomically replaces the log via `rename`. Compaction is triggered
+/// automatically when garbage outweighs live data (see `Options`), or explicitly by `compact()`.
+///
+class LogKeyValue final : public libcyphal::platform::storage::IKeyValue
+{
+    using Error = libcyphal::platform::storage::Error;
+
+public:
+    struct Options final
+    {
+        /// Whether to `fdatasync` the log after every `put` and `drop`.
+        ///
+        /// Disable it for bulk updates (like `registry::save`), and call `sync()` once at the end.
+        ///
+        bool sync_on_put{true};
+
+        /// Automatic compaction is not attempted until the log file reaches this size.
+        ///
+        std::size_t compaction_min_size{64U * 1024U};
+
+        /// Automatic compaction is triggered when garbage is at least this many times bigger than live data.
+        ///
+        std::size_t compaction_garbage_ratio{1U};
+
+    };  // Options
+
+    /// Opens (or creates) the log file, and rebuilds the in-memory index from it.
+    ///
+    /// @param file_path Path to the log file. Its directory must exist.
+    /// @param options Extra options for the storage.
+    /// @return Either a new storage instance, or an error (`Error::Internal` if the file has unknown format).
+    ///
+    static auto make(std::string file_path, const Options& options)
+        -> libcyphal::Expected<std::unique_ptr<LogKeyValue>, Error>
+    {
+        // Leftover of an interrupted compaction (if any) is not needed - the original log is still intact.
+        (void) ::unlink(makeCompactionPath(file_path).c_str());
+
+        std::unique_ptr<LogKeyValue> storage{new LogKeyValue{std::move(file_path), options}};
+        if (const auto error = storage->open())
+        {
+            return *error;
+        }
+        return storage;
+    }
+
+    static auto make(std::string file_path) -> libcyphal::Expected<std::unique_ptr<LogKeyValue>, Error>
+    {
+        return make(std::move(file_path), Options{});
+    }
+
+    ~LogKeyValue()
+    {
+        closeFile();
+    }
+
+    LogKeyValue(const LogKeyValue&)                = delete;
+    LogKeyValue(LogKeyValue&&) noexcept            = delete;
+    LogKeyValue& operator=(const LogKeyValue&)     = delete;
+    LogKeyValue& operator=(LogKeyValue&&) noexcept = delete;
+
+    /// Gets total size of the log file, including garbage records.
+    ///
+    std::size_t fileSize() const noexcept
+    {
+        return static_cast<std::size_t>(file_size_);
+    }
+
+    /// Gets total size of the live records in the log file.
+    ///
+    std::size_t liveSize() const noexcept
+    {
+        return live_size_;
+    }
+
+    /// Flushes all appended records to the storage device.
+    ///
+    auto sync() -> cetl::optional<Error>
+    {
+        if (::fdatasync(fd_) != 0)
+        {
+            return Error::IO;
+        }
+        return cetl::nullopt;
+    }
+
+    /// Rewrites the log so that it contains only live records.
+    ///
+    /// On failure the original log is left intact.
+    ///
+    auto compact() -> cetl::optional<Error>
+    {
+        const auto compaction_path = makeCompactionPath(file_path_);
+        const int  new_fd = ::open(compaction_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);  // NOLINT
+        if (new_fd < 0)
+        {
+            return mapErrno(errno);
+        }
+
+        Index                   new_index;
+        Offset                  new_file_size = 0;
+        std::vector<std::uint8_t> value;
+        auto                    error = writeAll(new_fd, new_file_size, fileMagic().data(), fileMagic().size());
+        new_file_size += static_cast<Offset>(fileMagic().size());
+        for (auto it = index_.cbegin(); !error && (it != index_.cend()); ++it)
+        {
+            value.resize(it->second.value_size);
+            error = readAll(fd_, it->second.value_offset, value.data(), value.size());
+            if (!error)
+            {
+                const auto& key = it->first;
+                buildRecord(Kind::Put, key, {value.data(), value.size()});
+                error = writeAll(new_fd, new_file_size, record_.data(), record_.size());
+                if (!error)
+                {
+                    new_index[key] = {valueOffsetOf(new_file_size, key.size()), it->second.value_size};
+                    new_file_size += static_cast<Offset>(record_.size());
+                }
+            }
+        }
+        if (!error && (::fsync(new_fd) != 0))
+        {
+            error = Error::IO;
+        }
+        if (!error && (::rename(compaction_path.c_str(), file_path_.c_str()) != 0))
+        {
+            error = mapErrno(errno);
+        }
+        if (error)
+        {
+            (void) ::close(new_fd);
+            (void) ::unlink(compaction_path.c_str());
+            return error;
+        }
+
+        // The new log is in place - switch to it. Sync of the directory makes the rename itself durable.
+        syncDirectory();
+        closeFile();
+        fd_        = new_fd;
+        file_size_ = new_file_size;
+        index_     = std::move(new_index);
+        return cetl::nullopt;
+    }
+
+    // MARK: - libcyphal::platform::storage::IKeyValue
+
+    auto get(const cetl::string_view        key,
+             const cetl::span<std::uint8_t> data) const -> libcyphal::Expected<std::size_t, Error> override
+    {
+        const auto it = index_.find(std::string{key.cbegin(), key.cend()});
+        if (it == index_.cend())
+        {
+            return Error::Existence;
+        }
+
+        const auto data_size = std::min<std::size_t>(it->second.value_size, data.size());
+        if (const auto error = readAll(fd_, it->second.value_offset, data.data(), data_size))
+        {
+            return *error;
+        }
+        return data_size;
+    }
+
+    auto put(const cetl::string_view key, const cetl::span<const std::uint8_t> data)  //
+        -> cetl::optional<Error> override
+    {
+        if ((key.size() > MaxKeySize) || (data.size() > MaxValueSize))
+        {
+            return Error::API;
+        }
+
+        std::string key_str{key.cbegin(), key.cend()};
+        const auto  it = index_.find(key_str);
+        if ((it != index_.cend()) && isSameValue(it->second, data))
+        {
+            // Nothing to do - rewriting the same value would only wear out the storage.
+            return cetl::nullopt;
+        }
+
+        buildRecord(Kind::Put, key_str, data);
+        const Offset record_offset = file_size_;
+        if (const auto error = appendRecord())
+        {
+            return error;
+        }
+
+        const Slot new_slot{valueOffsetOf(record_offset, key_str.size()), static_cast<std::uint32_t>(data.size())};
+        if (it != index_.cend())
+        {
+            live_size_ -= recordSizeOf(key_str.size(), it->second.value_size);
+            it->second = new_slot;
+        }
+        else
+        {
+            index_.emplace(std::move(key_str), new_slot);
+        }
+        live_size_ += record_.size();
+
+        return compactIfNeeded();
+    }
+
+    auto drop(const cetl::string_view key) -> cetl::optional<Error> override
+    {
+        const auto it = index_.find(std::string{key.cbegin(), key.cend()});
+        if (it == index_.cend())
+        {
+            return Error::Existence;
+        }
+
+        buildRecord(Kind::Drop, it->first, {});
+        if (const auto error = appendRecord())
+        {
+            return error;
+        }
+
+        live_size_ -= recordSizeOf(it->first.size(), it->second.value_size);
+        index_.erase(it);
+
+        return compactIfNeeded();
+    }
+
+private:
+    using Offset = ::off_t;
+
+    enum class Kind : std::uint8_t
+    {
+        Put  = 0,
+        Drop = 1,
+    };
+
+    struct Slot final
+    {
+        Offset        value_offset;
+        std::uint32_t value_size;
+    };
+    using Index = std::unordered_map<std::string, Slot>;
+
+    static constexpr std::size_t CrcSize      = sizeof(std::uint64_t);
+    static constexpr std::size_t HeaderSize   = CrcSize + sizeof(std::uint32_t) + sizeof(std::uint16_t) + 2U;
+    static constexpr std::size_t MaxKeySize   = 0xFFFFU;
+    static constexpr std::size_t MaxValueSize = 0xFFFFFFFFU;
+
+    using Magic = std::array<char, 8>;
+
+    static const Magic& fileMagic() noexcept
+    {
+        static constexpr Magic magic_s{{'C', 'Y', 'K', 'V', 'L', 'O', 'G', '1'}};
+        return magic_s;
+    }
+
+    LogKeyValue(std::string file_path, const Options& options)
+        : file_path_{std::move(file_path)}
+        , options_{options}
+    {
+    }
+
+    static std::string makeCompactionPath(const std::string& file_path)
+    {
+        return file_path + ".compact";
+    }
+
+    static std::size_t recordSizeOf(const std::size_t key_size, const std::size_t value_size) noexcept
+    {
+        return HeaderSize + key_size + value_size;
+    }
+
+    static Offset valueOffsetOf(const Offset record_offset, const std::size_t key_size) noexcept
+    {
+        return record_offset + static_cast<Offset>(HeaderSize + key_size);
+    }
+
+    static Error mapErrno(const int err) noexcept
+    {
+        return ((err == ENOSPC) || (err == EFBIG) || (err == EDQUOT)) ? Error::Capacity : Error::IO;
+    }
+
+    template <typename T>
+    static void storeLe(std::uint8_t* const dst, const T value) noexcept
+    {
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            dst[i] = static_cast<std::uint8_t>(value >> (i * 8U));  // NOLINT
+        }
+    }
+
+    template <typename T>
+    static T loadLe(const std::uint8_t* const src) noexcept
+    {
+        T value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            value = static_cast<T>(value | (static_cast<T>(src[i]) << (i * 8U)));  // NOLINT
+        }
+        return value;
+    }
+
+    static auto readAll(const int fd, Offset offset, void* const data, std::size_t size) -> cetl::optional<Error>
+    {
+        auto* dst = static_cast<std::uint8_t*>(data);
+        while (size > 0)
+        {
+            const auto result = ::pread(fd, dst, size, offset);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return Error::IO;
+            }
+            if (result == 0)
+            {
+                return Error::Internal;  // Unexpected end of the log.
+            }
+            dst += result;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            offset += result;
+            size -= static_cast<std::size_t>(result);
+        }
+        return cetl::nullopt;
+    }
+
+    static auto writeAll(const int fd, Offset offset, const void* const data, std::size_t size)
+        -> cetl::optional<Error>
+    {
+        const auto* src = static_cast<const std::uint8_t*>(data);
+        while (size > 0)
+        {
+            const auto result = ::pwrite(fd, src, size, offset);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return mapErrno(errno);
+            }
+            src += result;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            offset += result;
+            size -= static_cast<std::size_t>(result);
+        }
+        return cetl::nullopt;
+    }
+
+    auto open() -> cetl::optional<Error>
+    {
+        fd_ = ::open(file_path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);  // NOLINT
+        if (fd_ < 0)
+        {
+            return mapErrno(errno);
+        }
+
+        struct stat file_stat{};
+        if (::fstat(fd_, &file_stat) != 0)
+        {
+            return Error::IO;
+        }
+        if (file_stat.st_size < static_cast<Offset>(fileMagic().size()))
+        {
+            // A brand-new log (or the one torn while being stamped) - just (re)stamp it with the magic.
+            if (const auto error = writeAll(fd_, 0, fileMagic().data(), fileMagic().size()))
+            {
+                return error;
+            }
+            file_size_ = static_cast<Offset>(fileMagic().size());
+            return sync();
+        }
+
+        Magic magic{};
+        if (const auto error = readAll(fd_, 0, magic.data(), magic.size()))
+        {
+            return error;
+        }
+        if (magic != fileMagic())
+        {
+            return Error::Internal;
+        }
+
+        return replay(file_stat.st_size);
+    }
+
+    /// Rebuilds the index by scanning all records of the log.
+    ///
+    /// Scanning stops at the first incomplete or corrupted record (including a record of unknown kind) -
+    /// it (and everything after it) is truncated.
+    ///
+    auto replay(const Offset total_size) -> cetl::optional<Error>
+    {
+        Offset offset = static_cast<Offset>(fileMagic().size());
+        while ((total_size - offset) >= static_cast<Offset>(HeaderSize))
+        {
+            record_.resize(HeaderSize);
+            if (const auto error = readAll(fd_, offset, record_.data(), HeaderSize))
+            {
+                return error;
+            }
+            const auto value_size  = loadLe<std::uint32_t>(&record_[CrcSize]);
+            const auto key_size    = loadLe<std::uint16_t>(&record_[CrcSize + 4U]);
+            const auto kind        = static_cast<Kind>(record_[CrcSize + 6U]);
+            const auto record_size = recordSizeOf(key_size, value_size);
+            if ((total_size - offset) < static_cast<Offset>(record_size))
+            {
+                break;  // Torn tail.
+            }
+
+            record_.resize(record_size);
+            if (const auto error = readAll(fd_, offset + static_cast<Offset>(HeaderSize), &record_[HeaderSize],  //
+                                           record_size - HeaderSize))
+            {
+                return error;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const libcyphal::common::CRC64WE crc{&record_[CrcSize], record_.data() + record_.size()};
+            if ((crc.get() != loadLe<std::uint64_t>(record_.data())) || ((kind != Kind::Put) && (kind != Kind::Drop)))
+            {
+                break;  // Corrupted record.
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto* const key_begin = reinterpret_cast<const char*>(&record_[HeaderSize]);
+            std::string       key{key_begin, key_size};
+            const auto        it = index_.find(key);
+            if (it != index_.end())
+            {
+                live_size_ -= recordSizeOf(key_size, it->second.value_size);
+                index_.erase(it);
+            }
+            if (kind == Kind::Put)
+            {
+                index_.emplace(std::move(key), Slot{valueOffsetOf(offset, key_size), value_size});
+                live_size_ += record_size;
+            }
+            offset += static_cast<Offset>(record_size);
+        }
+
+        file_size_ = offset;
+        if (offset != total_size)
+        {
+            // Discard the torn/corrupted tail, so that new records are appended right after the last good one.
+            if ((::ftruncate(fd_, offset) != 0) || (::fsync(fd_) != 0))
+            {
+                return Error::IO;
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    void buildRecord(const Kind kind, const std::string& key, const cetl::span<const std::uint8_t> value)
+    {
+        record_.resize(recordSizeOf(key.size(), value.size()));
+        storeLe(&record_[CrcSize], static_cast<std::uint32_t>(value.size()));
+        storeLe(&record_[CrcSize + 4U], static_cast<std::uint16_t>(key.size()));
+        record_[CrcSize + 6U] = static_cast<std::uint8_t>(kind);
+        record_[CrcSize + 7U] = 0;
+        std::copy(key.cbegin(), key.cend(), record_.begin() + static_cast<std::ptrdiff_t>(HeaderSize));
+        std::copy(value.begin(), value.end(), record_.begin() + static_cast<std::ptrdiff_t>(HeaderSize + key.size()));
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const libcyphal::common::CRC64WE crc{&record_[CrcSize], record_.data() + record_.size()};
+        storeLe(record_.data(), crc.get());
+    }
+
+    /// Appends the currently built record to the end of the log.
+    ///
+    /// On failure the log is truncated back, so no partial record is left behind.
+    ///
+    auto appendRecord() -> cetl::optional<Error>
+    {
+        auto error = writeAll(fd_, file_size_, record_.data(), record_.size());
+        if (!error && options_.sync_on_put)
+        {
+            error = sync();
+        }
+        if (error)
+        {
+            (void) ::ftruncate(fd_, file_size_);
+            return error;
+        }
+        file_size_ += static_cast<Offset>(record_.size());
+        return cetl::nullopt;
+    }
+
+    bool isSameValue(const Slot& slot, const cetl::span<const std::uint8_t> data)
+    {
+        if (slot.value_size != data.size())
+        {
+            return false;
+        }
+        value_buffer_.resize(data.size());
+        if (readAll(fd_, slot.value_offset, value_buffer_.data(), value_buffer_.size()))
+        {
+            return false;
+        }
+        return std::equal(value_buffer_.cbegin(), value_buffer_.cend(), data.begin());
+    }
+
+    auto compactIfNeeded() -> cetl::optional<Error>
+    {
+        const auto file_size = static_cast<std::size_t>(file_size_);
+        if (file_size < options_.compaction_min_size)
+        {
+            return cetl::nullopt;
+        }
+        const auto garbage_size = file_size - fileMagic().size() - live_size_;
+        if (garbage_size < (live_size_ * options_.compaction_garbage_ratio))
+        {
+            return cetl::nullopt;
+        }
+
+        // Failed compaction is not an error of the current operation - the record is already committed,
+        // and compaction will be retried on the next modification.
+        (void) compact();
+        return cetl::nullopt;
+    }
+
+    void syncDirectory() const
+    {
+        const auto        slash = file_path_.find_last_of('/');
+        const std::string dir_path =
+            (slash == std::string::npos) ? "." : file_path_.substr(0, std::max<std::size_t>(slash, 1));
+        const int dir_fd = ::open(dir_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);  // NOLINT
+        if (dir_fd >= 0)
+        {
+            (void) ::fsync(dir_fd);
+            (void) ::close(dir_fd);
+        }
+    }
+
+    void closeFile() noexcept
+    {
+        if (fd_ >= 0)
+        {
+            (void) ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    // MARK: Data members:
+
+    const std::string         file_path_;
+    const Options             options_;
+    int                       fd_{-1};
+    Offset                    file_size_{0};
+    std::size_t               live_size_{0};
+    Index                     index_;
+    std::vector<std::uint8_t> record_;
+    std::vector<std::uint8_t> value_buffer_;
+
+};  // LogKeyValue
+
+}  // namespace storage
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_LOG_KEY_VALUE_HPP_INCLUDED
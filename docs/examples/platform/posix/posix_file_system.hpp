@@ -0,0 +1,272 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_POSIX_FILE_SYSTEM_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_POSIX_FILE_SYSTEM_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/platform/file_system.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace example
+{
+namespace platform
+{
+namespace posix
+{
+
+/// Defines a read-only file system which serves files of a root directory by mapping them into memory.
+///
+/// Mapped files allow the file server to send file data straight from the OS page cache (without copying it
+/// into intermediate buffers), and the OS takes care of reading ahead (see `MADV_SEQUENTIAL`).
+/// Files which can't be mapped (f.e. special ones) are read with `pread` instead.
+///
+class PosixFileSystem final : public libcyphal::platform::file_system::IFileSystem
+{
+    using Error = libcyphal::platform::file_system::Error;
+    using IFile = libcyphal::platform::file_system::IFile;
+    using Info  = libcyphal::platform::file_system::Info;
+
+public:
+    /// Constructs the file system.
+    ///
+    /// @param memory The memory resource to allocate open file objects.
+    /// @param root_path The root directory of served files. Cyphal paths are relative to it.
+    ///
+    PosixFileSystem(cetl::pmr::memory_resource& memory, std::string root_path)
+        : memory_{memory}
+        , root_path_{std::move(root_path)}
+    {
+    }
+
+    ~PosixFileSystem() = default;
+
+    PosixFileSystem(const PosixFileSystem&)                = delete;
+    PosixFileSystem(PosixFileSystem&&) noexcept            = delete;
+    PosixFileSystem& operator=(const PosixFileSystem&)     = delete;
+    PosixFileSystem& operator=(PosixFileSystem&&) noexcept = delete;
+
+    // MARK: IFileSystem
+
+    auto getInfo(const cetl::string_view path) const -> libcyphal::Expected<Info, Error> override
+    {
+        std::string full_path;
+        if (!makeFullPath(path, full_path))
+        {
+            return Error::InvalidValue;
+        }
+
+        struct stat st{};
+        if (::lstat(full_path.c_str(), &st) != 0)
+        {
+            return toError(errno);
+        }
+
+        Info info{};
+        info.is_link = S_ISLNK(st.st_mode);
+        if (info.is_link && (::stat(full_path.c_str(), &st) != 0))
+        {
+            return toError(errno);
+        }
+        info.size                                = static_cast<std::uint64_t>(st.st_size);
+        info.unix_timestamp_of_last_modification = static_cast<std::uint64_t>(st.st_mtime);
+        info.is_file_not_directory               = !S_ISDIR(st.st_mode);
+        info.is_readable                         = ::access(full_path.c_str(), R_OK) == 0;
+        info.is_writeable                        = ::access(full_path.c_str(), W_OK) == 0;
+        return info;
+    }
+
+    auto open(const cetl::string_view path) -> libcyphal::Expected<libcyphal::UniquePtr<IFile>, Error> override
+    {
+        std::string full_path;
+        if (!makeFullPath(path, full_path))
+        {
+            return Error::InvalidValue;
+        }
+
+        const int fd = ::open(full_path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT(*-vararg)
+        if (fd < 0)
+        {
+            return toError(errno);
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            const int err = errno;
+            (void) ::close(fd);
+            return toError(err);
+        }
+        if (S_ISDIR(st.st_mode))
+        {
+            (void) ::close(fd);
+            return Error::IsDirectory;
+        }
+
+        const auto size = static_cast<std::uint64_t>(st.st_size);
+        if (size > std::numeric_limits<std::size_t>::max())
+        {
+            (void) ::close(fd);
+            return Error::FileTooLarge;
+        }
+
+        auto file = libcyphal::makeUniquePtr<IFile, MappedFile>(memory_, fd, size);
+        if (!file)
+        {
+            return Error::IO;
+        }
+        return file;
+    }
+
+private:
+    /// Defines a file which is mapped into memory (if possible).
+    ///
+    /// The file descriptor is kept open only if the file couldn't be mapped.
+    ///
+    class MappedFile final : public IFile
+    {
+    public:
+        MappedFile(const int fd, const std::uint64_t size)
+            : fd_{fd}
+            , size_{size}
+        {
+            if (size_ > 0)
+            {
+                void* const addr = ::mmap(nullptr, static_cast<std::size_t>(size_), PROT_READ, MAP_SHARED, fd_, 0);
+                if (addr != MAP_FAILED)  // NOLINT(*-cstyle-cast, performance-no-int-to-ptr)
+                {
+                    // Files are served mostly sequentially, so let the OS read ahead aggressively.
+                    (void) ::madvise(addr, static_cast<std::size_t>(size_), MADV_SEQUENTIAL);
+                    (void) ::madvise(addr, static_cast<std::size_t>(size_), MADV_WILLNEED);
+                    mapped_ = {static_cast<const cetl::byte*>(addr), static_cast<std::size_t>(size_)};
+
+                    (void) ::close(std::exchange(fd_, -1));
+                }
+            }
+        }
+
+        ~MappedFile()
+        {
+            if (!mapped_.empty())
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+                (void) ::munmap(const_cast<cetl::byte*>(mapped_.data()), mapped_.size());
+            }
+            if (fd_ >= 0)
+            {
+                (void) ::close(fd_);
+            }
+        }
+
+        MappedFile(const MappedFile&)                = delete;
+        MappedFile(MappedFile&&) noexcept            = delete;
+        MappedFile& operator=(const MappedFile&)     = delete;
+        MappedFile& operator=(MappedFile&&) noexcept = delete;
+
+        // MARK: IFile
+
+        std::uint64_t getSize() const noexcept override
+        {
+            return size_;
+        }
+
+        cetl::span<const cetl::byte> getMapped() const noexcept override
+        {
+            return mapped_;
+        }
+
+        auto read(const std::uint64_t offset, const cetl::span<cetl::byte> buffer) const
+            -> libcyphal::Expected<std::size_t, Error> override
+        {
+            if (offset >= size_)
+            {
+                return static_cast<std::size_t>(0);
+            }
+            const auto size = static_cast<std::size_t>(std::min<std::uint64_t>(buffer.size(), size_ - offset));
+
+            if (!mapped_.empty())
+            {
+                (void) std::memcpy(buffer.data(), mapped_.data() + offset, size);  // NOLINT(*-pointer-arithmetic)
+                return size;
+            }
+
+            const ssize_t result = ::pread(fd_, buffer.data(), size, static_cast<off_t>(offset));
+            if (result < 0)
+            {
+                return toError(errno);
+            }
+            return static_cast<std::size_t>(result);
+        }
+
+    private:
+        int                          fd_;
+        const std::uint64_t          size_;
+        cetl::span<const cetl::byte> mapped_;
+
+    };  // MappedFile
+
+    bool makeFullPath(const cetl::string_view path, std::string& out_full_path) const
+    {
+        // Paths are not allowed to escape the root directory.
+        if (path.empty() || (path.find("..") != cetl::string_view::npos))
+        {
+            return false;
+        }
+
+        out_full_path = root_path_;
+        if (path.front() != '/')
+        {
+            out_full_path += '/';
+        }
+        out_full_path.append(path.data(), path.size());
+        return true;
+    }
+
+    static Error toError(const int err) noexcept
+    {
+        switch (err)
+        {
+        case ENOENT:
+        case ENOTDIR:
+            return Error::NotFound;
+        case EACCES:
+        case EPERM:
+            return Error::AccessDenied;
+        case EISDIR:
+            return Error::IsDirectory;
+        case EFBIG:
+        case EOVERFLOW:
+            return Error::FileTooLarge;
+        default:
+            return Error::IO;
+        }
+    }
+
+    cetl::pmr::memory_resource& memory_;
+    const std::string           root_path_;
+
+};  // PosixFileSystem
+
+}  // namespace posix
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_POSIX_FILE_SYSTEM_HPP_INCLUDED
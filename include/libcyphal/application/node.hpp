@@ -8,8 +8,10 @@
 
 #include "libcyphal/presentation/presentation.hpp"
 #include "libcyphal/types.hpp"
+#include "node/error_handler.hpp"
 #include "node/get_info_provider.hpp"
 #include "node/heartbeat_producer.hpp"
+#include "node/heartbeat_scheduler.hpp"
 #include "node/registry_provider.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
@@ -45,21 +47,22 @@ public:
     ///
     static Expected<Node, MakeFailure> make(presentation::Presentation& presentation)
     {
-        auto maybe_heartbeat_producer = node::HeartbeatProducer::make(presentation);
-        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_heartbeat_producer))
-        {
-            return std::move(*failure);
-        }
-
-        auto maybe_get_info_provider = node::GetInfoProvider::make(presentation);
-        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_get_info_provider))
-        {
-            return std::move(*failure);
-        }
+        return make(presentation, node::HeartbeatProducer::make(presentation));
+    }
 
-        return Node{presentation,
-                    cetl::get<node::GetInfoProvider>(std::move(maybe_get_info_provider)),
-                    cetl::get<node::HeartbeatProducer>(std::move(maybe_heartbeat_producer))};
+    /// @brief Factory method to create a Node instance which heartbeat is driven by a shared scheduler.
+    ///
+    /// Useful when a single process brings up many nodes (f.e. simulated ones) - instead of having
+    /// a separate heartbeat timer per node, all of them are phase spread by the shared scheduler.
+    ///
+    /// @param presentation The presentation layer instance (see the other `make` overload).
+    /// @param heartbeat_scheduler The shared heartbeat scheduler. Should outlive the node.
+    /// @return The Node instance or a failure.
+    ///
+    static Expected<Node, MakeFailure> make(presentation::Presentation& presentation,
+                                            node::HeartbeatScheduler&   heartbeat_scheduler)
+    {
+        return make(presentation, node::HeartbeatProducer::make(presentation, heartbeat_scheduler));
     }
 
     /// @brief Gets reference to the 'GetInfo' provider component.
@@ -80,6 +83,25 @@ public:
         return heartbeat_producer_;
     }
 
+    /// @brief Sets the node error handler for all node components (including the registry provider, if any).
+    ///
+    /// The handler is also applied to the registry provider made later (see `makeRegistryProvider`).
+    /// Use `node::ErrorHandler::getHealth` (f.e. from the heartbeat update callback) to derive node health
+    /// from the reported failures - the heartbeat producer does it automatically.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the node.
+    ///
+    void setErrorHandler(node::ErrorHandler* const error_handler) noexcept
+    {
+        error_handler_ = error_handler;
+        get_info_provider_.setErrorHandler(error_handler);
+        heartbeat_producer_.setErrorHandler(error_handler);
+        if (registry_provider_.has_value())
+        {
+            registry_provider_->setErrorHandler(error_handler);
+        }
+    }
+
     /// @brief Gets reference to the optional 'RegistryProvider' component.
     ///
     /// By default, node does not create the registry provider (`cetl::nullopt`).
@@ -112,10 +134,31 @@ public:
         }
 
         (void) registry_provider_.emplace(cetl::get<node::RegistryProvider>(std::move(maybe_provider)));
+        registry_provider_->setErrorHandler(error_handler_);
         return cetl::nullopt;
     }
 
 private:
+    static Expected<Node, MakeFailure> make(
+        presentation::Presentation&                                                  presentation,
+        Expected<node::HeartbeatProducer, presentation::Presentation::MakeFailure>&& maybe_heartbeat_producer)
+    {
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_heartbeat_producer))
+        {
+            return std::move(*failure);
+        }
+
+        auto maybe_get_info_provider = node::GetInfoProvider::make(presentation);
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_get_info_provider))
+        {
+            return std::move(*failure);
+        }
+
+        return Node{presentation,
+                    cetl::get<node::GetInfoProvider>(std::move(maybe_get_info_provider)),
+                    cetl::get<node::HeartbeatProducer>(std::move(maybe_heartbeat_producer))};
+    }
+
     Node(presentation::Presentation& presentation,
          node::GetInfoProvider&&     get_info_provider,
          node::HeartbeatProducer&&   heartbeat_producer) noexcept
@@ -131,6 +174,7 @@ private:
     node::GetInfoProvider                  get_info_provider_;
     node::HeartbeatProducer                heartbeat_producer_;
     cetl::optional<node::RegistryProvider> registry_provider_;
+    node::ErrorHandler*                    error_handler_{nullptr};
 
 };  // Node
 
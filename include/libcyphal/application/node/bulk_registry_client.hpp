@@ -0,0 +1,443 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_BULK_REGISTRY_CLIENT_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_BULK_REGISTRY_CLIENT_HPP_INCLUDED
+
+#include "libcyphal/application/registry/register.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/client.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/response_promise.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <libcyphal_ext/_register/BulkAccess_0_1.hpp>
+#include <libcyphal_ext/_register/Entry_0_1.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines client side helper of the non-standard `libcyphal_ext.register.BulkAccess` service.
+///
+/// The helper reads (or writes) many registers of a remote node (see `BulkRegistryProvider`) by issuing
+/// several concurrent (aka pipelined) requests, so that the per-request round trip latency is hidden:
+/// - Reading (of all registers) splits the whole registry index range into consecutive ranges of `MAX_ENTRIES`
+///   indices, which are requested concurrently until the provider reports the end of its registry.
+/// - Reading by a name prefix can't be split in advance (it's unknown how many registers of a range match),
+///   so the rest of the index range is requested one request at a time, each continuing from the `next_index`
+///   of the previous response - so that sparse matches don't cost a request per every `MAX_ENTRIES` indices.
+/// - Writing splits the given entries into chunks of `MAX_ENTRIES` entries, which are sent concurrently.
+///
+/// Received entries are delivered to the entry callback in order of response arrival (which might differ
+/// from the registry order), and the end of the whole operation (either successful or not) is reported to
+/// the completion callback. Both callbacks (and the very first requests as well) are called/sent on
+/// the executor spins, so an operation could be started from anywhere (including the completion callback).
+///
+/// The helper is neither copyable nor movable - its callbacks capture `this` pointer.
+///
+class BulkRegistryClient final
+{
+public:
+    /// @brief Defines the service type of the client.
+    ///
+    using Service = libcyphal_ext::_register::BulkAccess_0_1;
+
+    /// @brief Defines the register entry type (of both requests and responses).
+    ///
+    using Entry = libcyphal_ext::_register::Entry_0_1;
+
+    /// @brief Defines the underlying RPC client type.
+    ///
+    using Client = presentation::ServiceClient<Service>;
+
+    /// @brief Defines the failure type of the bulk operation.
+    ///
+    /// Could be either a failure of issuing a request, or a failure of receiving its response (f.e. timeout).
+    ///
+    using Failure = cetl::variant<Client::Failure, presentation::ResponsePromiseFailure>;
+
+    /// @brief Defines the maximum pipeline depth (number of concurrent requests).
+    ///
+    static constexpr std::size_t MaxPipelineDepth = config::Application::Node::BulkRegistryClient_MaxPipelineDepth();
+
+    /// @brief Umbrella type for received register entry notification entities.
+    ///
+    struct EntryCallback
+    {
+        /// @brief Defines standard arguments for the entry callback.
+        ///
+        struct Arg
+        {
+            /// Holds the received register entry (read, or read back after write).
+            const Entry& entry;
+
+            /// Holds the approximate time when the containing response has been received.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the entry callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Node::BulkRegistryClient_EntryCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Umbrella type for operation completion notification entities.
+    ///
+    struct CompletionCallback
+    {
+        /// @brief Defines standard arguments for the completion callback.
+        ///
+        struct Arg
+        {
+            /// Holds the failure (if any) which has terminated the operation.
+            /// In case of failure, all still pending requests are canceled.
+            cetl::optional<Failure> failure;
+
+            /// Holds the approximate time when the operation has been completed.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the completion callback function.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Node::BulkRegistryClient_CompletionCallback_FunctionSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Constructs a new bulk registry client.
+    ///
+    /// @param presentation The presentation layer instance. In use for the executor and memory resource.
+    /// @param client The RPC client bound to the remote node 'BulkAccess' service (see `Presentation::makeClient`).
+    /// @param pipeline_depth Number of concurrent requests. Limited by `MaxPipelineDepth` (which is the default).
+    ///
+    BulkRegistryClient(presentation::Presentation& presentation,
+                       Client                      client,
+                       const std::size_t           pipeline_depth = MaxPipelineDepth)
+        : executor_{presentation.executor()}
+        , client_{std::move(client)}
+        , pipeline_depth_{clampPipelineDepth(pipeline_depth)}
+        , request_{Service::Request::allocator_type{&presentation.memory()}}
+    {
+        refill_cb_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            refill(arg.approx_now);
+        });
+    }
+
+    ~BulkRegistryClient() = default;
+
+    BulkRegistryClient(const BulkRegistryClient&)                = delete;
+    BulkRegistryClient(BulkRegistryClient&&) noexcept            = delete;
+    BulkRegistryClient& operator=(const BulkRegistryClient&)     = delete;
+    BulkRegistryClient& operator=(BulkRegistryClient&&) noexcept = delete;
+
+    /// @brief Starts reading of all remote registers which names start with the given prefix.
+    ///
+    /// @param prefix The prefix of the register names to read. Empty prefix reads all registers (pipelined).
+    /// @param timeout The timeout of every single request (and its response).
+    /// @param entry_callback_fn The function to call for every received register entry.
+    /// @param completion_callback_fn The function to call once the whole operation is completed.
+    /// @return `false` if there is already an operation in progress (see `isBusy`).
+    ///
+    bool read(const registry::IRegister::Name prefix,
+              const Duration                  timeout,
+              EntryCallback::Function&&       entry_callback_fn,
+              CompletionCallback::Function&&  completion_callback_fn)
+    {
+        if (isBusy())
+        {
+            return false;
+        }
+
+        registry::assignRegisterName(request_.prefix, prefix);
+        request_.writes.clear();
+        next_start_index_    = 0;
+        awaiting_next_index_ = false;
+        return start(Mode::Read, timeout, std::move(entry_callback_fn), std::move(completion_callback_fn));
+    }
+
+    /// @brief Starts writing of the given remote registers.
+    ///
+    /// The entries are read back by the provider, and delivered to the entry callback.
+    ///
+    /// @param entries The register entries to write. Should stay valid until completion of the operation.
+    /// @param timeout The timeout of every single request (and its response).
+    /// @param entry_callback_fn The function to call for every read back register entry.
+    /// @param completion_callback_fn The function to call once the whole operation is completed.
+    /// @return `false` if there is already an operation in progress (see `isBusy`).
+    ///
+    bool write(const cetl::span<const Entry>  entries,
+               const Duration                 timeout,
+               EntryCallback::Function&&      entry_callback_fn,
+               CompletionCallback::Function&& completion_callback_fn)
+    {
+        if (isBusy())
+        {
+            return false;
+        }
+
+        request_.prefix.name.clear();
+        writes_     = entries;
+        next_write_ = 0;
+        return start(Mode::Write, timeout, std::move(entry_callback_fn), std::move(completion_callback_fn));
+    }
+
+    /// @brief Checks whether there is an operation in progress.
+    ///
+    bool isBusy() const noexcept
+    {
+        return mode_ != Mode::Idle;
+    }
+
+    /// @brief Cancels the current operation (if any) - pending requests are dropped, and no callbacks are called.
+    ///
+    void cancel()
+    {
+        mode_                = Mode::Idle;
+        awaiting_next_index_ = false;
+        releaseSlots(true);
+        entry_callback_fn_      = {};
+        completion_callback_fn_ = {};
+        failure_.reset();
+    }
+
+private:
+    using Promise = presentation::ResponsePromise<Service::Response>;
+
+    enum class Mode : std::uint8_t
+    {
+        Idle,
+        Read,
+        Write,
+    };
+
+    static std::size_t clampPipelineDepth(const std::size_t pipeline_depth) noexcept
+    {
+        constexpr std::size_t MaxValue = MaxPipelineDepth;
+        return std::max<std::size_t>(1, std::min(pipeline_depth, MaxValue));
+    }
+
+    bool start(const Mode                     mode,
+               const Duration                 timeout,
+               EntryCallback::Function&&      entry_callback_fn,
+               CompletionCallback::Function&& completion_callback_fn)
+    {
+        mode_                   = mode;
+        timeout_                = timeout;
+        entry_callback_fn_      = std::move(entry_callback_fn);
+        completion_callback_fn_ = std::move(completion_callback_fn);
+        scheduleRefill(executor_.now());
+        return true;
+    }
+
+    void scheduleRefill(const TimePoint exec_time)
+    {
+        const auto result = refill_cb_.schedule(IExecutor::Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    bool hasMoreRequests() const noexcept
+    {
+        switch (mode_)
+        {
+        case Mode::Read:
+            return !awaiting_next_index_ && (next_start_index_ < Service::Request::INDEX_END);
+        case Mode::Write:
+            return next_write_ < writes_.size();
+        case Mode::Idle:
+            break;
+        }
+        return false;
+    }
+
+    /// Releases promises of completed requests (or all of them),
+    /// and returns the number of still pending requests.
+    ///
+    std::size_t releaseSlots(const bool all)
+    {
+        std::size_t pending = 0;
+        for (std::size_t i = 0; i < pipeline_depth_; ++i)
+        {
+            if (slots_[i] && (all || slot_done_[i]))  // NOLINT(*-pro-bounds-constant-array-index)
+            {
+                slots_[i].reset();      // NOLINT(*-pro-bounds-constant-array-index)
+                slot_done_[i] = false;  // NOLINT(*-pro-bounds-constant-array-index)
+            }
+            pending += slots_[i] ? 1U : 0U;  // NOLINT(*-pro-bounds-constant-array-index)
+        }
+        return pending;
+    }
+
+    void refill(const TimePoint approx_now)
+    {
+        if (!isBusy())
+        {
+            return;
+        }
+
+        // Promises can't be released from within their own callbacks, so it's done here (on the next spin).
+        std::size_t pending = releaseSlots(false);
+
+        for (std::size_t i = 0; (i < pipeline_depth_) && !failure_ && hasMoreRequests(); ++i)
+        {
+            if (!slots_[i])  // NOLINT(*-pro-bounds-constant-array-index)
+            {
+                pending += issueRequest(i, approx_now) ? 1U : 0U;
+            }
+        }
+
+        if (failure_)
+        {
+            (void) releaseSlots(true);
+            complete(approx_now);
+        }
+        else if ((pending == 0) && !hasMoreRequests())
+        {
+            complete(approx_now);
+        }
+    }
+
+    bool issueRequest(const std::size_t slot_index, const TimePoint approx_now)
+    {
+        if (mode_ == Mode::Read)
+        {
+            constexpr std::uint32_t IndexEnd   = Service::Request::INDEX_END;
+            constexpr std::uint32_t MaxEntries = Service::Request::MAX_ENTRIES;
+
+            request_.start_index = static_cast<std::uint16_t>(next_start_index_);
+            if (request_.prefix.name.empty())
+            {
+                const std::uint32_t end_index = std::min(next_start_index_ + MaxEntries, IndexEnd);
+                request_.end_index            = static_cast<std::uint16_t>(end_index);
+                next_start_index_             = end_index;
+            }
+            else
+            {
+                // The next request will continue from the `next_index` of this one response.
+                request_.end_index   = Service::Request::INDEX_END;
+                awaiting_next_index_ = true;
+            }
+        }
+        else
+        {
+            constexpr std::size_t MaxEntries = Service::Request::MAX_ENTRIES;
+
+            const std::size_t count = std::min(writes_.size() - next_write_, MaxEntries);
+            request_.writes.clear();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                request_.writes.push_back(writes_[next_write_ + i]);
+            }
+            next_write_ += count;
+        }
+
+        auto maybe_promise = client_.request(approx_now + timeout_, request_);
+        if (auto* const failure = cetl::get_if<Client::Failure>(&maybe_promise))
+        {
+            failure_.emplace(std::move(*failure));
+            return false;
+        }
+
+        auto& slot = slots_[slot_index];  // NOLINT(*-pro-bounds-constant-array-index)
+        slot.emplace(cetl::get<Promise>(std::move(maybe_promise)));
+        slot->setCallback([this, slot_index](const auto& arg) {
+            //
+            onResponse(slot_index, arg.result, arg.approx_now);
+        });
+        return true;
+    }
+
+    void onResponse(const std::size_t slot_index, const Promise::Result& result, const TimePoint approx_now)
+    {
+        slot_done_[slot_index] = true;  // NOLINT(*-pro-bounds-constant-array-index)
+
+        if (const auto* const success = cetl::get_if<Promise::Success>(&result))
+        {
+            const auto& response = success->response;
+            if ((mode_ == Mode::Read) && awaiting_next_index_)
+            {
+                // Continue the prefix read from where the provider has stopped (guarded against no progress).
+                awaiting_next_index_ = false;
+                next_start_index_    = (response.next_index > next_start_index_) ? response.next_index  //
+                                                                                 : Service::Request::INDEX_END;
+            }
+            else if ((mode_ == Mode::Read) && (response.next_index == Service::Request::INDEX_END))
+            {
+                // The provider has reached the end of its registry - no need to request further ranges.
+                next_start_index_ = Service::Request::INDEX_END;
+            }
+            if (entry_callback_fn_)
+            {
+                for (const auto& entry : response.entries)
+                {
+                    entry_callback_fn_(EntryCallback::Arg{entry, approx_now});
+                }
+            }
+        }
+        else if (!failure_)
+        {
+            failure_.emplace(cetl::get<presentation::ResponsePromiseFailure>(result));
+        }
+
+        scheduleRefill(approx_now);
+    }
+
+    void complete(const TimePoint approx_now)
+    {
+        mode_ = Mode::Idle;
+        entry_callback_fn_ = {};
+
+        // Callback is released before the call, so that a new operation could be started from within it.
+        const auto completion_callback_fn = std::exchange(completion_callback_fn_, nullptr);
+        const CompletionCallback::Arg arg{std::exchange(failure_, cetl::nullopt), approx_now};
+        if (completion_callback_fn)
+        {
+            completion_callback_fn(arg);
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                                            executor_;
+    Client                                                client_;
+    const std::size_t                                     pipeline_depth_;
+    Service::Request                                      request_;
+    Mode                                                  mode_{Mode::Idle};
+    Duration                                              timeout_{};
+    std::uint32_t                                         next_start_index_{0};
+    bool                                                  awaiting_next_index_{false};
+    cetl::span<const Entry>                               writes_;
+    std::size_t                                           next_write_{0};
+    std::array<cetl::optional<Promise>, MaxPipelineDepth> slots_;
+    std::array<bool, MaxPipelineDepth>                    slot_done_{};
+    cetl::optional<Failure>                               failure_;
+    EntryCallback::Function                               entry_callback_fn_;
+    CompletionCallback::Function                          completion_callback_fn_;
+    IExecutor::Callback::Any                              refill_cb_;
+
+};  // BulkRegistryClient
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_BULK_REGISTRY_CLIENT_HPP_INCLUDED
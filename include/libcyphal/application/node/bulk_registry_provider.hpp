@@ -0,0 +1,266 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_BULK_REGISTRY_PROVIDER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_BULK_REGISTRY_PROVIDER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/application/registry/register.hpp"
+#include "libcyphal/application/registry/registry.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/server.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <libcyphal_ext/_register/BulkAccess_0_1.hpp>
+#include <libcyphal_ext/_register/Entry_0_1.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Bulk Registry' provider component for the application node.
+///
+/// Internally, it uses the non-standard `libcyphal_ext.register.BulkAccess` service server to handle
+/// incoming requests. It's an optional extension of the standard `RegistryProvider` - it allows reading
+/// (or writing) up to `BulkAccess::Request::MAX_ENTRIES` registers per single request,
+/// so configuration of a node with many registers doesn't take one request/response per register.
+/// See the service DSDL definition for the details of the protocol, and `BulkRegistryClient` for its client side.
+///
+/// Registers are selected by the same registry index as `uavcan.register.List` uses, and their values
+/// are read with `IRegistry::getInto` into the response, which is reused between requests.
+/// Response entries which are not needed for the current response are spared (instead of being destroyed),
+/// so that the next responses reuse them together with their array capacities.
+/// Note that only the first `INDEX_END` registers of the registry are reachable by the service.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the request callback,
+/// but at the destructor level, we don't need to do anything.
+///
+class BulkRegistryProvider final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the service type of the provider.
+    ///
+    using Service = libcyphal_ext::_register::BulkAccess_0_1;
+
+    /// @brief Factory method to create a BulkRegistryProvider instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'BulkAccess' service server.
+    /// @param registry Interface to the registry to be exposed by this provider.
+    /// @param service_id The service ID of the 'BulkAccess' server (there is no fixed one).
+    /// @return The BulkRegistryProvider instance or a failure.
+    ///
+    static auto make(presentation::Presentation&        presentation,
+                     registry::IIntrospectableRegistry& registry,
+                     const transport::PortId            service_id)
+        -> Expected<BulkRegistryProvider, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_bulk_srv = presentation.makeServer<Service>(service_id);
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_bulk_srv))
+        {
+            return std::move(*failure);
+        }
+
+        return BulkRegistryProvider{presentation,
+                                    registry,
+                                    service_id,
+                                    cetl::get<BulkServer>(std::move(maybe_bulk_srv))};
+    }
+
+    BulkRegistryProvider(BulkRegistryProvider&& other) noexcept
+        : registry_{other.registry_}
+        , service_id_{other.service_id_}
+        , bulk_srv_{std::move(other.bulk_srv_)}
+        , response_timeout_{other.response_timeout_}
+        , response_{std::move(other.response_)}
+        , spare_entries_{std::move(other.spare_entries_)}
+        , error_reporter_{other.error_reporter_}
+    {
+        setupOnRequestCallback();
+    }
+
+    ~BulkRegistryProvider() = default;
+
+    BulkRegistryProvider(const BulkRegistryProvider&)                = delete;
+    BulkRegistryProvider& operator=(const BulkRegistryProvider&)     = delete;
+    BulkRegistryProvider& operator=(BulkRegistryProvider&&) noexcept = delete;
+
+    /// @brief Sets the response transmission timeout (default is 1s).
+    ///
+    /// @param timeout Duration of the response transmission timeout. Applied for the next response transmission.
+    ///
+    void setResponseTimeout(const Duration& timeout) noexcept
+    {
+        response_timeout_ = timeout;
+    }
+
+    /// @brief Sets the node error handler, which is notified about response transmission failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the provider.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+private:
+    using Name       = registry::IRegister::Name;
+    using Entry      = libcyphal_ext::_register::Entry_0_1;
+    using Entries    = Service::Response::_traits_::TypeOf::entries;
+    using BulkServer = presentation::ServiceServer<Service>;
+
+    BulkRegistryProvider(presentation::Presentation&        presentation,
+                         registry::IIntrospectableRegistry& registry,
+                         const transport::PortId            service_id,
+                         BulkServer&&                       bulk_srv)
+        : registry_{registry}
+        , service_id_{service_id}
+        , bulk_srv_{std::move(bulk_srv)}
+        , response_timeout_{std::chrono::seconds{1}}
+        , response_{Service::Response::allocator_type{&presentation.memory()}}
+        , spare_entries_{Entries::allocator_type{&presentation.memory()}}
+    {
+        // We have to set up request callback again (b/c it captures its own `this` pointer),
+        setupOnRequestCallback();
+    }
+
+    void setupOnRequestCallback()
+    {
+        bulk_srv_.setOnRequestCallback([this](const auto& arg, auto continuation) {
+            //
+            if (arg.request.writes.empty())
+            {
+                handleRead(arg.request);
+            }
+            else
+            {
+                handleWrite(arg.request);
+            }
+
+            // There is nothing we can do about possible continuation failures - we just report them.
+            error_reporter_.report(continuation(arg.approx_now + response_timeout_, response_),
+                                   ErrorHandler::Origin::Response,
+                                   service_id_);
+        });
+    }
+
+    void handleRead(const Service::Request& request)
+    {
+        const Name prefix = registry::makeStringView(request.prefix.name);
+
+        // Registers at `INDEX_END` and beyond can't be addressed by the service (neither as start nor as next index).
+        const std::size_t reachable_size = std::min<std::size_t>(registry_.size(), Service::Request::INDEX_END);
+        const std::size_t end_index      = std::min<std::size_t>(request.end_index, reachable_size);
+
+        std::size_t count = 0;
+        std::size_t index = request.start_index;
+        for (; (index < end_index) && (count < Service::Request::MAX_ENTRIES); ++index)
+        {
+            const Name name = registry_.index(index);
+            if (name.substr(0, prefix.size()) == prefix)
+            {
+                readEntry(nextEntry(count), name);
+            }
+        }
+        truncateEntries(count);
+
+        // Note that the end of the requested range is not the end of the registry -
+        // so that pipelining clients could find out where the registry ends.
+        // The `index` is always less than `INDEX_END` here, so it doesn't collide with it.
+        response_.next_index = (index < reachable_size) ? static_cast<std::uint16_t>(index)  //
+                                                        : Service::Request::INDEX_END;
+    }
+
+    void handleWrite(const Service::Request& request)
+    {
+        std::size_t count = 0;
+        for (const auto& write : request.writes)
+        {
+            const Name name = registry::makeStringView(write.name.name);
+            if (!write.value.is_empty())
+            {
+                (void) registry_.set(name, write.value);
+            }
+            readEntry(nextEntry(count), name);
+        }
+        truncateEntries(count);
+        response_.next_index = Service::Request::INDEX_END;
+    }
+
+    /// Gets the next response entry - existing (or spared) entries are reused together with their array capacities.
+    ///
+    Entry& nextEntry(std::size_t& count)
+    {
+        if (count == response_.entries.size())
+        {
+            if (spare_entries_.empty())
+            {
+                response_.entries.emplace_back();
+            }
+            else
+            {
+                response_.entries.push_back(std::move(spare_entries_.back()));
+                spare_entries_.pop_back();
+            }
+        }
+        return response_.entries[count++];
+    }
+
+    /// Truncates the response to the first `count` entries - the rest are spared for the next responses.
+    ///
+    void truncateEntries(const std::size_t count)
+    {
+        while (response_.entries.size() > count)
+        {
+            spare_entries_.push_back(std::move(response_.entries.back()));
+            response_.entries.pop_back();
+        }
+    }
+
+    void readEntry(Entry& entry, const Name name) const
+    {
+        registry::assignRegisterName(entry.name, name);
+        if (const auto flags = registry_.getInto(name, entry.value))
+        {
+            entry._mutable   = flags->_mutable;
+            entry.persistent = flags->persistent;
+        }
+        else
+        {
+            entry.value.set_empty();
+            entry._mutable   = false;
+            entry.persistent = false;
+        }
+    }
+
+    // MARK: Data members:
+
+    registry::IIntrospectableRegistry& registry_;
+    transport::PortId                  service_id_;
+    BulkServer                         bulk_srv_;
+    Duration                           response_timeout_;
+    Service::Response                  response_;
+    Entries                            spare_entries_;
+    ErrorReporter                      error_reporter_;
+
+};  // BulkRegistryProvider
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_BULK_REGISTRY_PROVIDER_HPP_INCLUDED
@@ -0,0 +1,657 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_DIAGNOSTIC_LOGGER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_DIAGNOSTIC_LOGGER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/diagnostic/Record_1_1.hpp>
+#include <uavcan/diagnostic/Severity_1_0.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// Internal implementation details of the application node components.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines bounded lock-free ring buffer of diagnostic records.
+///
+/// The ring supports multiple concurrent producers (any thread, including ISRs where atomics are lock-free)
+/// and a single consumer (the executor thread). It's the classic bounded queue by Dmitry Vyukov - every slot
+/// has its own sequence number, so producers only contend on the single "enqueue position" CAS, and a slot
+/// is published to the consumer by the release store of its sequence number. No memory allocation is involved.
+///
+/// Records which don't fit into the (full) ring are dropped, but accounted - see `takeDropped`.
+///
+class DiagnosticRecordRing final
+{
+public:
+    static constexpr std::size_t Capacity     = config::Application::Node::DiagnosticLogger_RingCapacity();
+    static constexpr std::size_t TextCapacity = config::Application::Node::DiagnosticLogger_TextCapacity();
+    static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1U)) == 0), "Capacity must be a power of two.");
+    static_assert(TextCapacity <= 255U, "`uavcan.diagnostic.Record.1.1` text is limited to 255 bytes.");
+
+    struct Record final
+    {
+        std::uint64_t                  timestamp_us;
+        std::uint8_t                   severity;
+        std::uint8_t                   text_size;
+        std::array<char, TextCapacity> text;
+
+        cetl::string_view getText() const noexcept
+        {
+            return {text.data(), text_size};
+        }
+    };
+
+    DiagnosticRecordRing() noexcept
+        : enqueue_pos_{0}
+        , dequeue_pos_{0}
+        , dropped_count_{0}
+        , dropped_severities_{0}
+    {
+        for (std::size_t i = 0; i < Capacity; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~DiagnosticRecordRing() = default;
+
+    DiagnosticRecordRing(const DiagnosticRecordRing&)                = delete;
+    DiagnosticRecordRing(DiagnosticRecordRing&&) noexcept            = delete;
+    DiagnosticRecordRing& operator=(const DiagnosticRecordRing&)     = delete;
+    DiagnosticRecordRing& operator=(DiagnosticRecordRing&&) noexcept = delete;
+
+    /// Tries to put a new record into the ring. Safe to call concurrently from multiple threads.
+    ///
+    /// @return `false` if the ring is full - the record is dropped (and accounted).
+    ///
+    bool tryPush(const std::uint8_t severity, const cetl::string_view text, const std::uint64_t timestamp_us) noexcept
+    {
+        Slot*       slot = nullptr;
+        std::size_t pos  = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot                = &slots_[pos & (Capacity - 1U)];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer hasn't released this slot yet, so the ring is full.
+                dropped_count_.fetch_add(1U, std::memory_order_relaxed);
+                dropped_severities_.fetch_or(severityBit(severity), std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        constexpr std::size_t MaxTextSize = TextCapacity;
+
+        auto& record        = slot->record;
+        record.timestamp_us = timestamp_us;
+        record.severity     = severity;
+        record.text_size    = static_cast<std::uint8_t>(std::min(text.size(), MaxTextSize));
+        std::copy_n(text.data(), record.text_size, record.text.begin());
+
+        slot->sequence.store(pos + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /// Tries to take the oldest record from the ring. Should be called from the single consumer only.
+    ///
+    bool tryPop(Record& out_record) noexcept
+    {
+        auto&      slot     = slots_[dequeue_pos_ & (Capacity - 1U)];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != (dequeue_pos_ + 1U))
+        {
+            return false;
+        }
+
+        out_record = slot.record;
+        slot.sequence.store(dequeue_pos_ + Capacity, std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+    /// Takes (and resets) accounting of records dropped because of the full ring.
+    ///
+    /// @param out_severities Bit mask of severities of the dropped records (bit N is set for severity N).
+    /// @return Number of the dropped records.
+    ///
+    std::uint32_t takeDropped(std::uint8_t& out_severities) noexcept
+    {
+        // Severities are taken after the count, so a concurrently dropped record may only make
+        // the mask a bit "ahead" of the count (but never leave a counted record without its severity).
+        const auto count = dropped_count_.exchange(0U, std::memory_order_relaxed);
+        out_severities   = dropped_severities_.exchange(0U, std::memory_order_relaxed);
+        return count;
+    }
+
+    static std::uint8_t severityBit(const std::uint8_t severity) noexcept
+    {
+        return static_cast<std::uint8_t>(1U << std::min<std::uint8_t>(severity, 7U));
+    }
+
+private:
+    struct Slot final
+    {
+        std::atomic<std::size_t> sequence;
+        Record                   record;
+    };
+
+    // MARK: Data members:
+
+    std::array<Slot, Capacity> slots_;
+    std::atomic<std::size_t>   enqueue_pos_;
+    std::size_t                dequeue_pos_;
+    std::atomic<std::uint32_t> dropped_count_;
+    std::atomic<std::uint8_t>  dropped_severities_;
+
+};  // DiagnosticRecordRing
+
+}  // namespace detail
+
+/// @brief Defines 'Diagnostic Logger' component for the application node.
+///
+/// Publishes `uavcan.diagnostic.Record.1.1` messages via a single publisher. Records are logged (see `log`)
+/// into a lock-free ring buffer, so logging is cheap, never blocks, never allocates memory, and could be done
+/// from any thread. The ring is periodically drained by the executor, and records are:
+/// - deduplicated - a record identical (by severity and text) to the previous one is not published again,
+///   but counted, and later reported by a single "previous record repeated N times" summary record
+///   (either when a different record arrives, or when the repeat flush timeout expires);
+/// - rate limited - by a token bucket of the configured budget (sustained rate and burst size).
+///   Part of the bucket is reserved for records of higher severities, so that a flood of lower severity records
+///   can't starve errors. Records which don't fit into the budget (or into the ring) are suppressed,
+///   and later reported by a single "N records suppressed" summary record (of the highest suppressed severity).
+///
+/// All methods except `log` should be called from the executor thread only. Construction, move and destruction
+/// of the logger should not be done concurrently with logging.
+///
+class DiagnosticLogger final
+{
+public:
+    /// @brief Defines the message type for the diagnostic records.
+    ///
+    using Message = uavcan::diagnostic::Record_1_1;
+
+    /// @brief Defines the severity type (and its standard constants, like `Severity::WARNING`).
+    ///
+    using Severity = uavcan::diagnostic::Severity_1_0;
+
+    /// @brief Defines tuning options of the logger.
+    ///
+    struct Options
+    {
+        /// Transfer priority of the published records.
+        transport::Priority priority{transport::Priority::Low};
+
+        /// Sustained budget of published records (including summary ones) per second. Must be non-zero.
+        std::uint16_t records_per_second{10};
+
+        /// Max number of records which could be published back-to-back (size of the token bucket).
+        std::uint16_t burst_records{20};
+
+        /// Number of records (out of `burst_records`) reserved for records of `reserved_severity` or higher.
+        std::uint16_t reserved_records{10};
+
+        /// Minimal severity of records which are allowed to use the reserved part of the budget.
+        std::uint8_t reserved_severity{Severity::WARNING};
+
+        /// Period of draining the ring buffer of logged records.
+        Duration drain_period{std::chrono::milliseconds{10}};
+
+        /// Max time to hold a "repeated N times" summary of deduplicated records.
+        Duration repeat_flush_timeout{std::chrono::seconds{1}};
+
+        /// Max time to keep a record in the transport TX queue.
+        Duration tx_timeout{std::chrono::seconds{1}};
+    };
+
+    /// @brief Defines accumulated counters of the logger.
+    ///
+    struct Statistics
+    {
+        /// Number of published records (including summary ones).
+        std::uint32_t published{0};
+
+        /// Number of records (including summary ones) which have failed to be published (f.e. b/c of transport).
+        /// Such records still consume the budget, and they are not retried.
+        std::uint32_t failed{0};
+
+        /// Number of records which were not published b/c they are repeated.
+        std::uint32_t deduplicated{0};
+
+        /// Number of records which were not published b/c of exceeded budget.
+        std::uint32_t suppressed{0};
+
+        /// Number of records which were dropped b/c of the full ring buffer.
+        std::uint32_t dropped{0};
+    };
+
+    /// @brief Factory method to create a DiagnosticLogger instance with default options.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Record' publisher.
+    /// @return The DiagnosticLogger instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<DiagnosticLogger, presentation::Presentation::MakeFailure>
+    {
+        return make(presentation, Options{});
+    }
+
+    /// @brief Factory method to create a DiagnosticLogger instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Record' publisher.
+    /// @param options The tuning options of the logger.
+    /// @return The DiagnosticLogger instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, const Options& options)
+        -> Expected<DiagnosticLogger, presentation::Presentation::MakeFailure>
+    {
+        CETL_DEBUG_ASSERT(options.records_per_second > 0, "");
+        CETL_DEBUG_ASSERT(options.reserved_records <= options.burst_records, "");
+
+        auto ring = makeUniquePtr<Ring, Ring>(presentation.memory());
+        if (!ring)
+        {
+            return MemoryError{};
+        }
+
+        auto maybe_publisher = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_publisher))
+        {
+            return std::move(*failure);
+        }
+
+        return DiagnosticLogger{presentation,
+                                options,
+                                cetl::get<Publisher>(std::move(maybe_publisher)),
+                                std::move(ring)};
+    }
+
+    DiagnosticLogger(DiagnosticLogger&& other) noexcept
+        : presentation_{other.presentation_}
+        , options_{other.options_}
+        , publisher_{std::move(other.publisher_)}
+        , message_{std::move(other.message_)}
+        , ring_{std::move(other.ring_)}
+        , record_{other.record_}
+        , last_record_{other.last_record_}
+        , has_last_record_{other.has_last_record_}
+        , repeat_count_{other.repeat_count_}
+        , repeat_since_{other.repeat_since_}
+        , suppressed_count_{other.suppressed_count_}
+        , suppressed_severities_{other.suppressed_severities_}
+        , credit_{other.credit_}
+        , credit_time_{other.credit_time_}
+        , statistics_{other.statistics_}
+        , next_exec_time_{other.next_exec_time_}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move `periodic_cb_` callback (b/c it captures its own `this` pointer),
+        // so we need to stop it in the moved-from object, and start in the new one.
+        other.periodic_cb_.reset();
+
+        startDraining();
+    }
+
+    ~DiagnosticLogger() = default;
+
+    DiagnosticLogger(const DiagnosticLogger&)                = delete;
+    DiagnosticLogger& operator=(const DiagnosticLogger&)     = delete;
+    DiagnosticLogger& operator=(DiagnosticLogger&&) noexcept = delete;
+
+    /// @brief Logs a new diagnostic record.
+    ///
+    /// Could be called from any thread (concurrently). Never blocks and never allocates memory.
+    ///
+    /// @param severity The severity of the record, f.e. `Severity::WARNING`.
+    /// @param text The text of the record. Truncated to `DiagnosticLogger_TextCapacity` bytes.
+    /// @param synchronized_time The (optional) synchronized network time of the event.
+    ///                          Default (zero) value means that the time is unknown.
+    /// @return `false` if the record was dropped b/c the ring buffer is full.
+    ///
+    bool log(const std::uint8_t       severity,
+             const cetl::string_view text,
+             const TimePoint         synchronized_time = TimePoint{}) const noexcept
+    {
+        CETL_DEBUG_ASSERT(ring_ != nullptr, "");
+
+        const auto timestamp_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(synchronized_time.time_since_epoch()).count();
+        return ring_->tryPush(severity, text, static_cast<std::uint64_t>(timestamp_us));
+    }
+
+    /// @brief Gets accumulated counters of the logger.
+    ///
+    /// Records which are still in the ring buffer are not reflected yet.
+    ///
+    const Statistics& getStatistics() const noexcept
+    {
+        return statistics_;
+    }
+
+    /// @brief Sets the node error handler, which is notified about publication failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the logger.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+private:
+    using Callback  = IExecutor::Callback;
+    using Publisher = presentation::Publisher<Message>;
+    using Ring      = detail::DiagnosticRecordRing;
+    using Record    = Ring::Record;
+
+    /// Max length of summary records text, like "previous record repeated 4294967295 times".
+    static constexpr std::size_t SummaryTextCapacity = 48;
+    static_assert(Ring::TextCapacity >= SummaryTextCapacity, "Text capacity is too small for summary records.");
+
+    DiagnosticLogger(presentation::Presentation& presentation,
+                     const Options&              options,
+                     Publisher&&                 publisher,
+                     UniquePtr<Ring>&&           ring)
+        : presentation_{presentation}
+        , options_{options}
+        , publisher_{std::move(publisher)}
+        , message_{Message::allocator_type{&presentation.memory()}}
+        , ring_{std::move(ring)}
+        , record_{}
+        , last_record_{}
+        , has_last_record_{false}
+        , repeat_count_{0}
+        , suppressed_count_{0}
+        , suppressed_severities_{0}
+        , credit_{getRecordCost() * options.burst_records}
+        , credit_time_{presentation.executor().now()}
+        , next_exec_time_{credit_time_ + options.drain_period}
+    {
+        publisher_.setPriority(options_.priority);
+
+        // Reserve text capacity upfront, so that publishing doesn't allocate memory.
+        message_.text.reserve(Ring::TextCapacity);
+
+        startDraining();
+    }
+
+    Duration getRecordCost() const noexcept
+    {
+        return std::chrono::duration_cast<Duration>(std::chrono::seconds{1}) / options_.records_per_second;
+    }
+
+    void startDraining()
+    {
+        periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            // We keep track of the next execution time to allow
+            // smooth rescheduling to the new instance in the move constructor.
+            next_exec_time_ = arg.exec_time + options_.drain_period;
+
+            drain(arg.approx_now);
+        });
+
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, options_.drain_period});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void drain(const TimePoint now)
+    {
+        refillCredit(now);
+
+        while (ring_->tryPop(record_))
+        {
+            processRecord(record_, now);
+        }
+
+        std::uint8_t dropped_severities = 0;
+        if (const auto dropped_count = ring_->takeDropped(dropped_severities))
+        {
+            statistics_.dropped += dropped_count;
+            suppressed_count_ += dropped_count;
+            suppressed_severities_ |= dropped_severities;
+        }
+
+        if ((repeat_count_ > 0) && ((now - repeat_since_) >= options_.repeat_flush_timeout))
+        {
+            flushRepeats(now);
+        }
+        flushSuppressed(now);
+    }
+
+    void processRecord(const Record& record, const TimePoint now)
+    {
+        if (has_last_record_ && isSameRecord(record, last_record_))
+        {
+            if (repeat_count_ == 0)
+            {
+                repeat_since_ = now;
+            }
+            ++repeat_count_;
+            ++statistics_.deduplicated;
+            return;
+        }
+
+        // A different record ends the sequence of repeated ones (if any).
+        flushRepeats(now);
+
+        last_record_     = record;
+        has_last_record_ = true;
+
+        if (!publishRecord(record.severity, record.getText(), record.timestamp_us, now))
+        {
+            suppress(record.severity, 1U);
+        }
+    }
+
+    void flushRepeats(const TimePoint now)
+    {
+        if (repeat_count_ == 0)
+        {
+            return;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+        std::array<char, SummaryTextCapacity> text_buffer;
+        const auto text = formatSummary(text_buffer, "previous record repeated ", repeat_count_, " times");
+        if (!publishRecord(last_record_.severity, text, 0, now))
+        {
+            // No budget for the summary, so the repeated records become just suppressed ones.
+            suppress(last_record_.severity, repeat_count_);
+        }
+        repeat_count_ = 0;
+    }
+
+    void flushSuppressed(const TimePoint now)
+    {
+        if (suppressed_count_ == 0)
+        {
+            return;
+        }
+
+        // The summary is of the highest severity among suppressed records.
+        std::uint8_t severity = 7U;
+        while ((severity > 0) && ((suppressed_severities_ & Ring::severityBit(severity)) == 0))
+        {
+            --severity;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+        std::array<char, SummaryTextCapacity> text_buffer;
+        const auto text = formatSummary(text_buffer, "", suppressed_count_, " records suppressed");
+        if (publishRecord(severity, text, 0, now))
+        {
+            suppressed_count_      = 0;
+            suppressed_severities_ = 0;
+        }
+    }
+
+    void suppress(const std::uint8_t severity, const std::uint32_t count)
+    {
+        statistics_.suppressed += count;
+        suppressed_count_ += count;
+        suppressed_severities_ |= Ring::severityBit(severity);
+    }
+
+    bool publishRecord(const std::uint8_t       severity,
+                       const cetl::string_view text,
+                       const std::uint64_t     timestamp_us,
+                       const TimePoint         now)
+    {
+        if (!tryConsumeCredit(severity))
+        {
+            return false;
+        }
+
+        message_.timestamp.microsecond = timestamp_us;
+        message_.severity.value        = severity;
+        message_.text.clear();
+        for (const char ch : text)
+        {
+            message_.text.push_back(static_cast<std::uint8_t>(ch));
+        }
+
+        // There is nothing else we can do about possible publishing failures - just report them.
+        const auto failure = publisher_.publish(now + options_.tx_timeout, message_);
+        error_reporter_.report(failure, ErrorHandler::Origin::Publication, Message::_traits_::FixedPortId);
+        if (failure)
+        {
+            ++statistics_.failed;
+        }
+        else
+        {
+            ++statistics_.published;
+        }
+        return true;
+    }
+
+    void refillCredit(const TimePoint now)
+    {
+        const auto max_credit = getRecordCost() * options_.burst_records;
+        credit_               = std::min(credit_ + (now - credit_time_), max_credit);
+        credit_time_          = now;
+    }
+
+    bool tryConsumeCredit(const std::uint8_t severity)
+    {
+        const auto cost     = getRecordCost();
+        auto       required = cost;
+        if (severity < options_.reserved_severity)
+        {
+            required += cost * options_.reserved_records;
+        }
+
+        if (credit_ < required)
+        {
+            return false;
+        }
+        credit_ -= cost;
+        return true;
+    }
+
+    static bool isSameRecord(const Record& lhs, const Record& rhs) noexcept
+    {
+        return (lhs.severity == rhs.severity) && (lhs.getText() == rhs.getText());
+    }
+
+    static cetl::string_view formatSummary(std::array<char, SummaryTextCapacity>& buffer,
+                                           const cetl::string_view                prefix,
+                                           std::uint32_t                          count,
+                                           const cetl::string_view                suffix)
+    {
+        std::size_t size = 0;
+        const auto  append = [&buffer, &size](const cetl::string_view str) {
+            //
+            const auto length = std::min(str.size(), buffer.size() - size);
+            std::copy_n(str.data(), length, buffer.begin() + static_cast<std::ptrdiff_t>(size));
+            size += length;
+        };
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+        std::array<char, 10> digits;
+        std::size_t          digits_count = 0;
+        do
+        {
+            digits[digits_count++] = static_cast<char>('0' + (count % 10U));  // NOLINT(*-magic-numbers)
+            count /= 10U;                                                       // NOLINT(*-magic-numbers)
+        } while (count > 0);
+        std::reverse(digits.begin(), digits.begin() + static_cast<std::ptrdiff_t>(digits_count));
+
+        append(prefix);
+        append({digits.data(), digits_count});
+        append(suffix);
+        return {buffer.data(), size};
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    const Options               options_;
+    Publisher                   publisher_;
+    Message                     message_;
+    UniquePtr<Ring>             ring_;
+    Record                      record_;
+    Record                      last_record_;
+    bool                        has_last_record_;
+    std::uint32_t               repeat_count_;
+    TimePoint                   repeat_since_;
+    std::uint32_t               suppressed_count_;
+    std::uint8_t                suppressed_severities_;
+    Duration                    credit_;
+    TimePoint                   credit_time_;
+    Statistics                  statistics_;
+    TimePoint                   next_exec_time_;
+    ErrorReporter               error_reporter_;
+    Callback::Any               periodic_cb_;
+
+};  // DiagnosticLogger
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_DIAGNOSTIC_LOGGER_HPP_INCLUDED
@@ -0,0 +1,469 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_ERROR_HANDLER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_ERROR_HANDLER_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/platform/storage.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/node/Health_1_0.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines node-level error handler - the aggregation point of failures which node components can't handle.
+///
+/// Node components (like `HeartbeatProducer` or `RegistryProvider`) can't do much about their publishing or
+/// responding failures (f.e. TX queue overflow) - so they just report them to the handler (if any is set via their
+/// `setErrorHandler` method), and carry on. The handler:
+/// - counts failures per kind (see `Kind`), and per port (for the first `ErrorHandler_PortCapacity` ports);
+/// - calls the optional report callback, but not more often than once per `Options::report_interval` -
+///   reports in between are suppressed, and only their number is passed to the next callback;
+/// - maintains the node health (see `getHealth`), which is in use by the `HeartbeatProducer`,
+///   so that overload of the node is visible on the bus.
+///
+/// Transient media failures are not visible to the application layer, so they should be reported by the
+/// transport's transient error handler (see f.e. `ICanTransport::setTransientErrorHandler`) with `Origin::Media`.
+///
+/// The handler is neither copyable nor movable - node components keep a pointer to it.
+///
+class ErrorHandler final
+{
+public:
+    /// @brief Defines kind of reported failure (mostly mirrors alternatives of `transport::AnyFailure`).
+    ///
+    enum class Kind : std::uint8_t
+    {
+        Anonymous,
+        Argument,
+        Memory,
+        Capacity,
+        Platform,
+        AlreadyExists,
+        Serialization,
+        Storage,
+        Other,
+    };
+    static constexpr std::size_t KindCount = static_cast<std::size_t>(Kind::Other) + 1U;
+
+    /// @brief Defines origin of reported failure.
+    ///
+    enum class Origin : std::uint8_t
+    {
+        /// Failure to publish a message (port id is a subject id).
+        Publication,
+        /// Failure to send a service request (port id is a service id).
+        Request,
+        /// Failure to send a service response (port id is a service id).
+        Response,
+        /// Transient media failure (see `ICanTransport::TransientErrorHandler` and its UDP counterpart).
+        Media,
+        /// Internal failure of a node component (f.e. out of memory or storage failure).
+        Internal,
+    };
+
+    /// @brief Defines the port id value which means "no port" (f.e. for media failures).
+    ///
+    static constexpr transport::PortId NoPortId = std::numeric_limits<transport::PortId>::max();
+
+    /// @brief Defines a single failure report.
+    ///
+    struct Report
+    {
+        Kind              kind;
+        Origin            origin;
+        transport::PortId port_id;
+    };
+
+    /// @brief Defines handler options.
+    ///
+    struct Options
+    {
+        /// Defines duration of a single health evaluation window.
+        Duration window{std::chrono::seconds{1}};
+
+        /// Defines number of consecutive windows with failures, which are considered as sustained failures.
+        /// Sustained failures (as well as any memory failure) degrade the node health to `CAUTION`;
+        /// otherwise, a recent failure makes it `ADVISORY`.
+        std::uint8_t sustained_windows{3};
+
+        /// Defines minimal interval between two consecutive calls of the report callback.
+        Duration report_interval{std::chrono::seconds{1}};
+    };
+
+    /// @brief Umbrella type for failure report entities.
+    ///
+    struct ReportCallback
+    {
+        /// @brief Defines standard arguments for the report callback.
+        ///
+        struct Arg
+        {
+            /// Holds the most recent failure report.
+            const Report& report;
+
+            /// Holds number of reports suppressed (by the rate limiting) since the previous callback.
+            std::uint32_t suppressed;
+
+            /// Holds the approximate time when the failure has been reported.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the report callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Node::ErrorHandler_ReportCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Constructs a new error handler with default options.
+    ///
+    /// @param executor The executor in use as the source of time.
+    ///
+    explicit ErrorHandler(IExecutor& executor)
+        : ErrorHandler{executor, Options{}}
+    {
+    }
+
+    /// @brief Constructs a new error handler.
+    ///
+    /// @param executor The executor in use as the source of time.
+    /// @param options The handler options.
+    ///
+    ErrorHandler(IExecutor& executor, const Options& options)
+        : executor_{executor}
+        , options_{options}
+        , window_end_{executor.now() + options.window}
+    {
+    }
+
+    ~ErrorHandler() = default;
+
+    ErrorHandler(const ErrorHandler&)                = delete;
+    ErrorHandler(ErrorHandler&&) noexcept            = delete;
+    ErrorHandler& operator=(const ErrorHandler&)     = delete;
+    ErrorHandler& operator=(ErrorHandler&&) noexcept = delete;
+
+    /// @brief Sets the report callback (rate limited by the `Options::report_interval`).
+    ///
+    void setReportCallback(ReportCallback::Function&& report_callback_fn)
+    {
+        report_callback_fn_ = std::move(report_callback_fn);
+    }
+
+    /// @brief Reports a failure.
+    ///
+    /// @param failure The failure itself - either a single error (like `CapacityError`), or a variant of them.
+    /// @param origin The origin of the failure.
+    /// @param port_id The subject or service id (depending on the origin) of the failed port (if any).
+    ///
+    template <typename Failure>
+    void report(const Failure& failure, const Origin origin, const transport::PortId port_id = NoPortId)
+    {
+        report(Report{kindOf(failure), origin, port_id});
+    }
+
+    /// @brief Reports a failure.
+    ///
+    void report(const Report& report)
+    {
+        const TimePoint now = executor_.now();
+        advance(now);
+
+        ++kind_counts_[static_cast<std::size_t>(report.kind)];  // NOLINT(*-pro-bounds-constant-array-index)
+        countPort(report);
+
+        ++window_failures_;
+        if (report.kind == Kind::Memory)
+        {
+            ++window_memory_failures_;
+        }
+
+        if (report_callback_fn_)
+        {
+            if (last_callback_time_ && ((now - *last_callback_time_) < options_.report_interval))
+            {
+                ++suppressed_;
+                return;
+            }
+            last_callback_time_ = now;
+            report_callback_fn_(ReportCallback::Arg{report, std::exchange(suppressed_, 0U), now});
+        }
+    }
+
+    /// @brief Gets total number of reported failures of the given kind.
+    ///
+    std::uint32_t getFailures(const Kind kind) const noexcept
+    {
+        return kind_counts_[static_cast<std::size_t>(kind)];  // NOLINT(*-pro-bounds-constant-array-index)
+    }
+
+    /// @brief Gets total number of reported failures (of all kinds).
+    ///
+    std::uint32_t getTotalFailures() const noexcept
+    {
+        std::uint32_t total = 0;
+        for (const auto count : kind_counts_)
+        {
+            total += count;
+        }
+        return total;
+    }
+
+    /// @brief Gets number of reported failures of the given publication subject.
+    ///
+    std::uint32_t getSubjectFailures(const transport::PortId subject_id) const noexcept
+    {
+        return getPortFailures(subject_id, false);
+    }
+
+    /// @brief Gets number of reported failures (requests and responses) of the given service.
+    ///
+    std::uint32_t getServiceFailures(const transport::PortId service_id) const noexcept
+    {
+        return getPortFailures(service_id, true);
+    }
+
+    /// @brief Gets number of port failures which were not counted per port (b/c of the port table capacity).
+    ///
+    std::uint32_t getUntrackedPortFailures() const noexcept
+    {
+        return untracked_port_failures_;
+    }
+
+    /// @brief Gets the current node health (see `uavcan.node.Health.1.0`) derived from the recent failures.
+    ///
+    /// - `CAUTION` if there were memory failures in the current or the previous window,
+    ///   or if failures have been sustained for `Options::sustained_windows` consecutive windows;
+    /// - `ADVISORY` if there were any failures in the current or the previous window;
+    /// - `NOMINAL` otherwise.
+    ///
+    /// @param now The current time.
+    ///
+    std::uint8_t getHealth(const TimePoint now)
+    {
+        advance(now);
+
+        const std::size_t streak = failure_streak_ + ((window_failures_ > 0) ? 1U : 0U);
+        if ((window_memory_failures_ > 0) || had_memory_failures_ || (streak >= options_.sustained_windows))
+        {
+            return Health::CAUTION;
+        }
+        if ((window_failures_ > 0) || had_failures_)
+        {
+            return Health::ADVISORY;
+        }
+        return Health::NOMINAL;
+    }
+
+private:
+    using Health = uavcan::node::Health_1_0;
+
+    static constexpr std::size_t PortCapacity = config::Application::Node::ErrorHandler_PortCapacity();
+
+    struct PortCounter
+    {
+        transport::PortId port_id;
+        bool              is_service;
+        std::uint32_t     count;
+    };
+
+    // MARK: Failure kinds:
+
+    static Kind kindOf(const transport::AnonymousError&) noexcept
+    {
+        return Kind::Anonymous;
+    }
+    static Kind kindOf(const ArgumentError&) noexcept
+    {
+        return Kind::Argument;
+    }
+    static Kind kindOf(const MemoryError&) noexcept
+    {
+        return Kind::Memory;
+    }
+    static Kind kindOf(const transport::CapacityError&) noexcept
+    {
+        return Kind::Capacity;
+    }
+    static Kind kindOf(const transport::PlatformError&) noexcept
+    {
+        return Kind::Platform;
+    }
+    static Kind kindOf(const transport::AlreadyExistsError&) noexcept
+    {
+        return Kind::AlreadyExists;
+    }
+    static Kind kindOf(const nunavut::support::Error&) noexcept
+    {
+        return Kind::Serialization;
+    }
+    static Kind kindOf(const platform::storage::Error&) noexcept
+    {
+        return Kind::Storage;
+    }
+    template <typename... Failures>
+    static Kind kindOf(const cetl::variant<Failures...>& failure)
+    {
+        return cetl::visit([](const auto& alternative) { return ErrorHandler::kindOf(alternative); }, failure);
+    }
+    template <typename Failure>
+    static Kind kindOf(const Failure&) noexcept
+    {
+        return Kind::Other;
+    }
+
+    /// Closes the current health window (if it's over).
+    ///
+    void advance(const TimePoint now)
+    {
+        if (now < window_end_)
+        {
+            return;
+        }
+
+        // A whole window without any reports in between breaks the streak (and the previous window is clean).
+        const bool is_contiguous = (now - window_end_) < options_.window;
+        had_failures_            = is_contiguous && (window_failures_ > 0);
+        had_memory_failures_     = is_contiguous && (window_memory_failures_ > 0);
+        failure_streak_          = had_failures_ ? (failure_streak_ + 1U) : 0U;
+
+        window_failures_        = 0;
+        window_memory_failures_ = 0;
+        window_end_             = now + options_.window;
+    }
+
+    void countPort(const Report& report)
+    {
+        if (report.port_id == NoPortId)
+        {
+            return;
+        }
+        const bool is_service = (report.origin == Origin::Request) || (report.origin == Origin::Response);
+
+        for (std::size_t index = 0; index < ports_size_; ++index)
+        {
+            PortCounter& port = ports_[index];  // NOLINT(*-pro-bounds-constant-array-index)
+            if ((port.port_id == report.port_id) && (port.is_service == is_service))
+            {
+                ++port.count;
+                return;
+            }
+        }
+        if (ports_size_ < PortCapacity)
+        {
+            ports_[ports_size_++] = PortCounter{report.port_id, is_service, 1U};  // NOLINT(*-constant-array-index)
+            return;
+        }
+        ++untracked_port_failures_;
+    }
+
+    std::uint32_t getPortFailures(const transport::PortId port_id, const bool is_service) const noexcept
+    {
+        for (std::size_t index = 0; index < ports_size_; ++index)
+        {
+            const PortCounter& port = ports_[index];  // NOLINT(*-pro-bounds-constant-array-index)
+            if ((port.port_id == port_id) && (port.is_service == is_service))
+            {
+                return port.count;
+            }
+        }
+        return 0;
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                            executor_;
+    const Options                         options_;
+    std::array<std::uint32_t, KindCount>  kind_counts_{};
+    std::array<PortCounter, PortCapacity> ports_{};
+    std::size_t                           ports_size_{0};
+    std::uint32_t                         untracked_port_failures_{0};
+    TimePoint                             window_end_;
+    std::uint32_t                         window_failures_{0};
+    std::uint32_t                         window_memory_failures_{0};
+    bool                                  had_failures_{false};
+    bool                                  had_memory_failures_{false};
+    std::size_t                           failure_streak_{0};
+    cetl::optional<TimePoint>             last_callback_time_;
+    std::uint32_t                         suppressed_{0};
+    ReportCallback::Function              report_callback_fn_;
+
+};  // ErrorHandler
+
+/// @brief Defines a lightweight (copyable) link from a node component to the node error handler.
+///
+/// Does nothing if the handler is not set, so components may report their failures unconditionally.
+///
+class ErrorReporter final
+{
+public:
+    void setHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_handler_ = error_handler;
+    }
+
+    ErrorHandler* getHandler() const noexcept
+    {
+        return error_handler_;
+    }
+
+    /// @brief Reports the failure (if any) to the handler (if any).
+    ///
+    template <typename Failure>
+    void report(const cetl::optional<Failure>& failure,
+                const ErrorHandler::Origin     origin,
+                const transport::PortId        port_id = ErrorHandler::NoPortId) const
+    {
+        if ((error_handler_ != nullptr) && failure.has_value())
+        {
+            error_handler_->report(*failure, origin, port_id);
+        }
+    }
+
+    /// @brief Reports the failure to the handler (if any).
+    ///
+    void report(const ErrorHandler::Kind   kind,
+                const ErrorHandler::Origin origin,
+                const transport::PortId    port_id = ErrorHandler::NoPortId) const
+    {
+        if (error_handler_ != nullptr)
+        {
+            error_handler_->report(ErrorHandler::Report{kind, origin, port_id});
+        }
+    }
+
+private:
+    // MARK: Data members:
+
+    ErrorHandler* error_handler_{nullptr};
+
+};  // ErrorReporter
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_ERROR_HANDLER_HPP_INCLUDED
@@ -0,0 +1,420 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_EXECUTE_COMMAND_PROVIDER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_EXECUTE_COMMAND_PROVIDER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "file_read_client.hpp"
+#include "libcyphal/application/registry/deferred_saver.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/server.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <uavcan/node/ExecuteCommand_1_3.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'ExecuteCommand' provider component for the application node.
+///
+/// Internally, it uses the 'ExecuteCommand' service server to handle incoming requests.
+/// Every request is responded immediately (from within the request reception), and the response status only
+/// tells whether the command has been accepted. The actual execution of long-running commands is dispatched to
+/// background work, so that it never stalls RX processing of the executor:
+/// - `COMMAND_RESTART` - the restart callback (see `setRestartCallback`) is called by the executor once the
+///   response transmission deadline has passed, so that the response has a chance to reach the client.
+/// - `COMMAND_STORE_PERSISTENT_STATES` - a save round of the registry deferred saver (see `setPersistentStatesSaver`)
+///   is expedited, so dirty registers are stored on the next executor spins (chunked by the saver time budget).
+/// - `COMMAND_BEGIN_SOFTWARE_UPDATE` - the image file (the request parameter is its path) is read from the
+///   requesting node (which, per the standard, is the file server) by the pipelined file read client. The data
+///   is delivered to the software update callbacks (see `setSoftwareUpdateCallbacks`) chunk by chunk.
+///
+/// All other commands (and the above ones if not configured) are passed to the custom command callback
+/// (see `setCommandCallback`). The callback is called from within the request reception, so it should
+/// not block - long-running work should be scheduled on the executor instead.
+///
+class ExecuteCommandProvider final
+{
+    using Service = uavcan::node::ExecuteCommand_1_3;
+
+public:
+    /// @brief Defines the request type for the ExecuteCommand provider.
+    ///
+    using Request = Service::Request;
+
+    /// @brief Defines the response type for the ExecuteCommand provider.
+    ///
+    using Response = Service::Response;
+
+    /// @brief Umbrella type for custom command handling entities.
+    ///
+    struct CommandCallback
+    {
+        /// @brief Defines standard arguments for the command callback.
+        ///
+        struct Arg
+        {
+            /// Holds the request (including the command code and its parameter).
+            const Request& request;
+
+            /// Holds the node ID of the client which has sent the command.
+            transport::NodeId remote_node_id;
+
+            /// Holds the approximate time when the request has been received.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the command callback function.
+        ///
+        /// The function returns response status, f.e. `Response::STATUS_SUCCESS` or `Response::STATUS_BAD_COMMAND`.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Node::ExecuteCommandProvider_CommandCallback_FunctionSize();
+        using Function = cetl::pmr::function<std::uint8_t(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Umbrella type for restart entities.
+    ///
+    struct RestartCallback
+    {
+        /// @brief Defines standard arguments for the restart callback.
+        ///
+        struct Arg
+        {
+            /// Holds the approximate time when the restart has been initiated.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the restart callback function.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Node::ExecuteCommandProvider_RestartCallback_FunctionSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Factory method to create a ExecuteCommand provider instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'ExecuteCommand' service server,
+    ///                     and 'Read' service clients for software updates.
+    /// @return The ExecuteCommand provider instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<ExecuteCommandProvider, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_srv = presentation.makeServer<Service>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_srv))
+        {
+            return std::move(*failure);
+        }
+
+        return ExecuteCommandProvider{presentation, cetl::get<Server>(std::move(maybe_srv))};
+    }
+
+    ExecuteCommandProvider(ExecuteCommandProvider&& other) noexcept
+        : presentation_{other.presentation_}
+        , server_{std::move(other.server_)}
+        , response_{std::move(other.response_)}
+        , response_timeout_{other.response_timeout_}
+        , command_cb_fn_{std::move(other.command_cb_fn_)}
+        , restart_cb_fn_{std::move(other.restart_cb_fn_)}
+        , saver_{other.saver_}
+        , updater_{std::move(other.updater_)}
+        , is_restart_pending_{std::exchange(other.is_restart_pending_, false)}
+        , restart_time_{other.restart_time_}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and set up again in the new one.
+        other.restart_cb_.reset();
+
+        setupCallbacks();
+        if (is_restart_pending_)
+        {
+            scheduleRestart(restart_time_);
+        }
+    }
+
+    ~ExecuteCommandProvider() = default;
+
+    ExecuteCommandProvider(const ExecuteCommandProvider&)                = delete;
+    ExecuteCommandProvider& operator=(const ExecuteCommandProvider&)     = delete;
+    ExecuteCommandProvider& operator=(ExecuteCommandProvider&&) noexcept = delete;
+
+    /// @brief Sets the response transmission timeout (default is 1s).
+    ///
+    /// The restart (if requested) is postponed by the same timeout.
+    ///
+    /// @param timeout Duration of the response transmission timeout. Applied for the next response transmission.
+    /// @return Reference to self for method chaining.
+    ///
+    ExecuteCommandProvider& setResponseTimeout(const Duration& timeout) noexcept
+    {
+        response_timeout_ = timeout;
+        return *this;
+    }
+
+    /// @brief Sets the function which handles custom (non-standard, or not configured standard) commands.
+    ///
+    /// Without the callback such commands are responded with `Response::STATUS_BAD_COMMAND`.
+    ///
+    ExecuteCommandProvider& setCommandCallback(CommandCallback::Function&& command_cb_fn)
+    {
+        command_cb_fn_ = std::move(command_cb_fn);
+        return *this;
+    }
+
+    /// @brief Sets the function which performs the node restart (`COMMAND_RESTART`).
+    ///
+    /// The function is called by the executor once the response transmission deadline has passed.
+    ///
+    ExecuteCommandProvider& setRestartCallback(RestartCallback::Function&& restart_cb_fn)
+    {
+        restart_cb_fn_ = std::move(restart_cb_fn);
+        return *this;
+    }
+
+    /// @brief Sets the registry saver which stores persistent states (`COMMAND_STORE_PERSISTENT_STATES`).
+    ///
+    /// @param saver The deferred saver of the node registry. Should outlive the provider. `nullptr` to unset.
+    ///
+    ExecuteCommandProvider& setPersistentStatesSaver(registry::DeferredSaver* const saver) noexcept
+    {
+        saver_ = saver;
+        return *this;
+    }
+
+    /// @brief Sets the node error handler, which is notified about response transmission failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the provider.
+    ///
+    ExecuteCommandProvider& setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+        return *this;
+    }
+
+    /// @brief Sets functions which receive the software image (`COMMAND_BEGIN_SOFTWARE_UPDATE`).
+    ///
+    /// The image is read by the pipelined file read client - see `FileReadClient` for details on the callbacks.
+    /// While an update is in progress, subsequent update commands are responded with `Response::STATUS_BAD_STATE`.
+    ///
+    /// @return `MemoryError` if there is not enough memory for the software update state.
+    ///
+    auto setSoftwareUpdateCallbacks(FileReadClient::DataCallback::Function&&       data_cb_fn,
+                                    FileReadClient::CompletionCallback::Function&& completion_cb_fn)
+        -> cetl::optional<MemoryError>
+    {
+        if (!updater_)
+        {
+            updater_ = makeUniquePtr<SoftwareUpdater, SoftwareUpdater>(presentation_.memory());
+            if (!updater_)
+            {
+                return MemoryError{};
+            }
+        }
+        updater_->data_cb_fn       = std::move(data_cb_fn);
+        updater_->completion_cb_fn = std::move(completion_cb_fn);
+        return cetl::nullopt;
+    }
+
+    /// @brief Checks whether there is a software update (reading of the image) in progress.
+    ///
+    bool isSoftwareUpdateInProgress() const noexcept
+    {
+        return updater_ && updater_->reader && updater_->reader->isBusy();
+    }
+
+private:
+    using Server = presentation::ServiceServer<Service>;
+
+    /// Holds state of the software update.
+    ///
+    /// It's allocated separately from the provider, so that the file read client (which is not movable)
+    /// and its callbacks stay in place when the provider itself is moved.
+    ///
+    struct SoftwareUpdater final
+    {
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        FileReadClient::DataCallback::Function       data_cb_fn;
+        FileReadClient::CompletionCallback::Function completion_cb_fn;
+        transport::NodeId                            server_node_id{0};
+        cetl::optional<FileReadClient>               reader;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+    };
+
+    ExecuteCommandProvider(presentation::Presentation& presentation, Server&& server)
+        : presentation_{presentation}
+        , server_{std::move(server)}
+        , response_{Response::allocator_type{&presentation.memory()}}
+        , response_timeout_{std::chrono::seconds{1}}
+        , saver_{nullptr}
+        , is_restart_pending_{false}
+    {
+        setupCallbacks();
+    }
+
+    void setupCallbacks()
+    {
+        server_.setOnRequestCallback([this](const auto& arg, auto continuation) {
+            //
+            response_.status = executeCommand(arg.request, arg.metadata.remote_node_id, arg.approx_now);
+
+            // There is nothing we can do about possible continuation failures - we just report them.
+            error_reporter_.report(continuation(arg.approx_now + response_timeout_, response_),
+                                   ErrorHandler::Origin::Response,
+                                   Service::Request::_traits_::FixedPortId);
+        });
+
+        restart_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            is_restart_pending_ = false;
+            if (restart_cb_fn_)
+            {
+                restart_cb_fn_(RestartCallback::Arg{arg.approx_now});
+            }
+        });
+    }
+
+    std::uint8_t executeCommand(const Request&          request,
+                                const transport::NodeId remote_node_id,
+                                const TimePoint         approx_now)
+    {
+        switch (request.command)
+        {
+        case Request::COMMAND_RESTART:
+            if (restart_cb_fn_)
+            {
+                is_restart_pending_ = true;
+                restart_time_       = approx_now + response_timeout_;
+                scheduleRestart(restart_time_);
+                return Response::STATUS_SUCCESS;
+            }
+            break;
+
+        case Request::COMMAND_STORE_PERSISTENT_STATES:
+            if (saver_ != nullptr)
+            {
+                saver_->expedite();
+                return Response::STATUS_SUCCESS;
+            }
+            break;
+
+        case Request::COMMAND_BEGIN_SOFTWARE_UPDATE:
+            if (updater_)
+            {
+                return beginSoftwareUpdate(request, remote_node_id);
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (command_cb_fn_)
+        {
+            return command_cb_fn_(CommandCallback::Arg{request, remote_node_id, approx_now});
+        }
+        return Response::STATUS_BAD_COMMAND;
+    }
+
+    std::uint8_t beginSoftwareUpdate(const Request& request, const transport::NodeId server_node_id)
+    {
+        if (request.parameter.empty())
+        {
+            return Response::STATUS_BAD_PARAMETER;
+        }
+        if (isSoftwareUpdateInProgress())
+        {
+            return Response::STATUS_BAD_STATE;
+        }
+
+        // The reader is bound to the file server node, so a new one is needed for another server.
+        auto& updater = *updater_;
+        if (updater.reader && (updater.server_node_id != server_node_id))
+        {
+            updater.reader.reset();
+        }
+        if (!updater.reader)
+        {
+            auto maybe_client = presentation_.makeClient<FileReadClient::Service>(server_node_id);
+            auto* const client = cetl::get_if<FileReadClient::Client>(&maybe_client);
+            if (client == nullptr)
+            {
+                return Response::STATUS_INTERNAL_ERROR;
+            }
+            updater.reader.emplace(presentation_, std::move(*client));
+            updater.server_node_id = server_node_id;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const cetl::string_view path{reinterpret_cast<const char*>(request.parameter.data()),  // NOSONAR cpp:S3630
+                                     request.parameter.size()};
+        auto* const updater_ptr = &updater;
+        const bool  is_started  = updater.reader->read(  //
+            path,
+            0,
+            [updater_ptr](const auto& arg) {
+                //
+                if (updater_ptr->data_cb_fn)
+                {
+                    updater_ptr->data_cb_fn(arg);
+                }
+            },
+            [updater_ptr](const auto& arg) {
+                //
+                if (updater_ptr->completion_cb_fn)
+                {
+                    updater_ptr->completion_cb_fn(arg);
+                }
+            });
+        return is_started ? Response::STATUS_SUCCESS : Response::STATUS_BAD_PARAMETER;
+    }
+
+    void scheduleRestart(const TimePoint exec_time)
+    {
+        const auto result = restart_cb_.schedule(IExecutor::Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Server                      server_;
+    Response                    response_;
+    Duration                    response_timeout_;
+    CommandCallback::Function   command_cb_fn_;
+    RestartCallback::Function   restart_cb_fn_;
+    registry::DeferredSaver*    saver_;
+    UniquePtr<SoftwareUpdater>  updater_;
+    bool                        is_restart_pending_;
+    TimePoint                   restart_time_;
+    IExecutor::Callback::Any    restart_cb_;
+    ErrorReporter               error_reporter_;
+
+};  // ExecuteCommandProvider
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_EXECUTE_COMMAND_PROVIDER_HPP_INCLUDED
@@ -0,0 +1,601 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_FILE_READ_CLIENT_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_FILE_READ_CLIENT_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/client.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/response_promise.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <uavcan/file/Error_1_0.hpp>
+#include <uavcan/file/Path_2_0.hpp>
+#include <uavcan/file/Read_1_1.hpp>
+#include <uavcan/primitive/Unstructured_1_0.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines client side helper which reads a whole (remote) file with the `uavcan.file.Read` service.
+///
+/// The service is strictly one request per (up to) 256-byte chunk, so reading one chunk at a time makes
+/// throughput latency-bound (one chunk per round trip). Instead, the client keeps a sliding window of
+/// outstanding requests at increasing offsets:
+/// - Responses might arrive (or time out) out of order, so every window slot buffers its chunk until all
+///   previous chunks are delivered - the data callback is called strictly in order of file offsets.
+///   A timed out request is re-issued (at the same offset) up to `Options::max_attempts` times.
+/// - The window is limited by half of the transport transfer ID modulo. Responses are paired with requests
+///   by transfer IDs only, so an ID must not be reused while a late response to it could still be in flight.
+/// - The window is adapted to the network conditions: it grows by one slot per response while measured
+///   round trip time stays close to the minimal observed one (aka there is no queueing), and it's halved on
+///   timeouts. The request timeout itself follows smoothed round trip time and its variation (like TCP does).
+///
+/// The end of file is detected by a chunk shorter than 256 bytes. Requests beyond it are canceled.
+/// All callbacks (and the very first requests as well) are called/sent on the executor spins, so a read
+/// could be started from anywhere (including the completion callback).
+///
+/// The helper is neither copyable nor movable - its callbacks capture `this` pointer.
+///
+class FileReadClient final
+{
+public:
+    /// @brief Defines the service type of the client.
+    ///
+    using Service = uavcan::file::Read_1_1;
+
+    /// @brief Defines the underlying RPC client type.
+    ///
+    using Client = presentation::ServiceClient<Service>;
+
+    /// @brief Defines the file error type (as reported by the server).
+    ///
+    using FileError = uavcan::file::Error_1_0;
+
+    /// @brief Defines the failure type of the read operation.
+    ///
+    /// Could be either a failure of issuing a request, a failure of receiving its response
+    /// (f.e. timeout after all attempts), or a non-OK error reported by the server.
+    ///
+    using Failure = cetl::variant<Client::Failure, presentation::ResponsePromiseFailure, FileError>;
+
+    /// @brief Defines the maximum size of the sliding window (number of outstanding requests).
+    ///
+    static constexpr std::size_t MaxWindowSize = config::Application::Node::FileReadClient_MaxWindowSize();
+
+    /// @brief Defines the maximum size of a file data chunk.
+    ///
+    static constexpr std::size_t ChunkCapacity = uavcan::primitive::Unstructured_1_0::_traits_::ArrayCapacity::value;
+
+    /// @brief Defines tuning options of the client.
+    ///
+    struct Options
+    {
+        /// Initial number of outstanding requests (and the window size after a timeout is at least one).
+        std::size_t initial_window_size{2};
+
+        /// Upper limit of the window size. Limited by `MaxWindowSize` (and by the transfer ID space).
+        std::size_t max_window_size{MaxWindowSize};
+
+        /// Request timeout to use until the first round trip time is measured.
+        Duration initial_timeout{std::chrono::seconds{1}};
+
+        /// Lower limit of the adaptive request timeout.
+        Duration min_timeout{std::chrono::milliseconds{50}};
+
+        /// Upper limit of the adaptive request timeout.
+        Duration max_timeout{std::chrono::seconds{5}};
+
+        /// Number of attempts to request a chunk before failing the whole read.
+        std::uint8_t max_attempts{3};
+    };
+
+    /// @brief Umbrella type for received file data notification entities.
+    ///
+    struct DataCallback
+    {
+        /// @brief Defines standard arguments for the data callback.
+        ///
+        struct Arg
+        {
+            /// Holds the file offset of the data.
+            std::uint64_t offset;
+
+            /// Holds the file data - valid only during the callback.
+            cetl::span<const std::uint8_t> data;
+
+            /// Holds the approximate time when the data has been delivered.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the data callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Node::FileReadClient_DataCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Umbrella type for read completion notification entities.
+    ///
+    struct CompletionCallback
+    {
+        /// @brief Defines standard arguments for the completion callback.
+        ///
+        struct Arg
+        {
+            /// Holds the failure (if any) which has terminated the read.
+            /// In case of failure, all still pending requests are canceled.
+            cetl::optional<Failure> failure;
+
+            /// Holds the total number of delivered data bytes.
+            std::uint64_t size;
+
+            /// Holds the approximate time when the read has been completed.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the completion callback function.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Node::FileReadClient_CompletionCallback_FunctionSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Constructs a new file read client with default options.
+    ///
+    /// @param presentation The presentation layer instance. In use for the executor, memory resource and
+    ///                     the transport protocol parameters (transfer ID modulo).
+    /// @param client The RPC client bound to the remote node 'Read' service (see `Presentation::makeClient`).
+    ///
+    FileReadClient(presentation::Presentation& presentation, Client client)
+        : FileReadClient{presentation, std::move(client), Options{}}
+    {
+    }
+
+    /// @brief Constructs a new file read client.
+    ///
+    /// @param presentation The presentation layer instance. In use for the executor, memory resource and
+    ///                     the transport protocol parameters (transfer ID modulo).
+    /// @param client The RPC client bound to the remote node 'Read' service (see `Presentation::makeClient`).
+    /// @param options The tuning options of the client.
+    ///
+    FileReadClient(presentation::Presentation& presentation, Client client, const Options& options)
+        : executor_{presentation.executor()}
+        , client_{std::move(client)}
+        , options_{options}
+        , max_window_size_{clampMaxWindowSize(options.max_window_size,
+                                              presentation.transport().getProtocolParams().transfer_id_modulo)}
+        , request_{Service::Request::allocator_type{&presentation.memory()}}
+        , window_size_{clampWindowSize(options.initial_window_size)}
+        , timeout_{options.initial_timeout}
+    {
+        refill_cb_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            refill(arg.approx_now);
+        });
+    }
+
+    ~FileReadClient() = default;
+
+    FileReadClient(const FileReadClient&)                = delete;
+    FileReadClient(FileReadClient&&) noexcept            = delete;
+    FileReadClient& operator=(const FileReadClient&)     = delete;
+    FileReadClient& operator=(FileReadClient&&) noexcept = delete;
+
+    /// @brief Starts reading of the remote file from the given offset till its end.
+    ///
+    /// Measured round trip time, current window size and timeout are kept from a previous read,
+    /// so that consecutive reads from the same server start already tuned.
+    ///
+    /// @param path The path of the remote file.
+    /// @param offset The file offset to start reading from.
+    /// @param data_callback_fn The function to call (in order of file offsets) for every received data chunk.
+    /// @param completion_callback_fn The function to call once the whole read is completed.
+    /// @return `false` if there is already a read in progress (see `isBusy`), or the path is too long.
+    ///
+    bool read(const cetl::string_view        path,
+              const std::uint64_t            offset,
+              DataCallback::Function&&       data_callback_fn,
+              CompletionCallback::Function&& completion_callback_fn)
+    {
+        constexpr std::size_t PathCapacity = uavcan::file::Path_2_0::_traits_::ArrayCapacity::path;
+        if (isBusy() || (path.size() > PathCapacity))
+        {
+            return false;
+        }
+
+        request_.path.path.clear();
+        (void) std::copy(path.begin(), path.end(), std::back_inserter(request_.path.path));
+
+        is_busy_                = true;
+        next_request_offset_    = offset;
+        next_delivery_offset_   = offset;
+        end_offset_             = std::numeric_limits<std::uint64_t>::max();
+        delivered_size_         = 0;
+        data_callback_fn_       = std::move(data_callback_fn);
+        completion_callback_fn_ = std::move(completion_callback_fn);
+        scheduleRefill(executor_.now());
+        return true;
+    }
+
+    /// @brief Checks whether there is a read in progress.
+    ///
+    bool isBusy() const noexcept
+    {
+        return is_busy_;
+    }
+
+    /// @brief Cancels the current read (if any) - pending requests are dropped, and no callbacks are called.
+    ///
+    void cancel()
+    {
+        is_busy_ = false;
+        for (auto& slot : slots_)
+        {
+            slot.release();
+        }
+        data_callback_fn_       = {};
+        completion_callback_fn_ = {};
+        failure_.reset();
+    }
+
+    /// @brief Gets the current size of the sliding window.
+    ///
+    std::size_t getWindowSize() const noexcept
+    {
+        return window_size_;
+    }
+
+    /// @brief Gets the current (adaptive) request timeout.
+    ///
+    Duration getTimeout() const noexcept
+    {
+        return timeout_;
+    }
+
+    /// @brief Gets the smoothed round trip time (or zero if there were no measurements yet).
+    ///
+    Duration getSmoothedRtt() const noexcept
+    {
+        return srtt_;
+    }
+
+private:
+    using Promise = presentation::ResponsePromise<Service::Response>;
+
+    /// Holds state of a window slot - an outstanding request and its (not yet delivered) response.
+    ///
+    struct Slot
+    {
+        enum class State : std::uint8_t
+        {
+            Free,
+            Pending,
+            Received,
+            Expired,
+        };
+
+        void release()
+        {
+            promise.reset();
+            chunk.reset();
+            state    = State::Free;
+            attempts = 0;
+        }
+
+        // MARK: Data members:
+
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        State                             state{State::Free};
+        std::uint8_t                      attempts{0};
+        std::uint64_t                     offset{0};
+        TimePoint                         sent_at{};
+        TimePoint                         deadline{};
+        cetl::optional<Promise>           promise;
+        cetl::optional<Service::Response> chunk;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+    };
+
+    static std::size_t clampMaxWindowSize(const std::size_t max_window_size, const transport::TransferId modulo)
+    {
+        constexpr std::size_t MaxValue = MaxWindowSize;
+
+        // Half of the transfer ID space guarantees that an ID is not reused while a late response could arrive.
+        const auto half_modulo = static_cast<std::size_t>(std::min<transport::TransferId>(modulo / 2, MaxValue));
+        return std::max<std::size_t>(1, std::min(max_window_size, half_modulo));
+    }
+
+    std::size_t clampWindowSize(const std::size_t window_size) const noexcept
+    {
+        return std::max<std::size_t>(1, std::min(window_size, max_window_size_));
+    }
+
+    void scheduleRefill(const TimePoint exec_time)
+    {
+        const auto result = refill_cb_.schedule(IExecutor::Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void refill(const TimePoint approx_now)
+    {
+        if (!isBusy())
+        {
+            return;
+        }
+
+        // Promises can't be released from within their own callbacks, so it's done here (on the next spin).
+        for (auto& slot : slots_)
+        {
+            if ((slot.state == Slot::State::Received) || (slot.state == Slot::State::Expired))
+            {
+                slot.promise.reset();
+            }
+        }
+
+        deliverInOrder(approx_now);
+        if (!isBusy())
+        {
+            // The read has been canceled from within the data callback.
+            return;
+        }
+
+        std::size_t occupied = 0;
+        for (auto& slot : slots_)
+        {
+            if ((slot.state != Slot::State::Free) && (slot.offset >= end_offset_))
+            {
+                // Beyond the end of file - nothing to wait for.
+                slot.release();
+            }
+            else if (!failure_ && (slot.state == Slot::State::Expired))
+            {
+                reissueRequest(slot, approx_now);
+            }
+            occupied += (slot.state != Slot::State::Free) ? 1U : 0U;
+        }
+
+        for (auto& slot : slots_)
+        {
+            if (failure_ || (occupied >= window_size_) || (next_request_offset_ >= end_offset_))
+            {
+                break;
+            }
+            if ((slot.state == Slot::State::Free) && issueRequest(slot, next_request_offset_, approx_now))
+            {
+                next_request_offset_ += ChunkCapacity;
+                ++occupied;
+            }
+        }
+
+        if (failure_ || (next_delivery_offset_ >= end_offset_))
+        {
+            complete(approx_now);
+        }
+    }
+
+    /// Delivers buffered chunks which are next in order of file offsets.
+    ///
+    void deliverInOrder(const TimePoint approx_now)
+    {
+        bool is_delivered = true;
+        while (is_delivered && isBusy() && !failure_ && (next_delivery_offset_ < end_offset_))
+        {
+            is_delivered = false;
+            for (auto& slot : slots_)
+            {
+                if ((slot.state != Slot::State::Received) || (slot.offset != next_delivery_offset_))
+                {
+                    continue;
+                }
+
+                const auto& data = slot.chunk->data.value;
+                if (!data.empty() && data_callback_fn_)
+                {
+                    data_callback_fn_(DataCallback::Arg{slot.offset, {data.data(), data.size()}, approx_now});
+                }
+                next_delivery_offset_ += data.size();
+                delivered_size_ += data.size();
+                slot.release();
+                is_delivered = true;
+                break;
+            }
+        }
+    }
+
+    bool issueRequest(Slot& slot, const std::uint64_t offset, const TimePoint approx_now)
+    {
+        request_.offset     = offset;
+        const auto deadline = approx_now + timeout_;
+
+        auto maybe_promise = client_.request(deadline, request_);
+        if (auto* const failure = cetl::get_if<Client::Failure>(&maybe_promise))
+        {
+            // Running out of transfer IDs (f.e. b/c of other requests to the same server) is not fatal
+            // while there are other outstanding requests - their responses will trigger another refill.
+            const bool has_pending = std::any_of(slots_.begin(), slots_.end(), [](const Slot& other) {
+                return other.state != Slot::State::Free;
+            });
+            if (!has_pending || (cetl::get_if<Client::TooManyPendingRequestsError>(failure) == nullptr))
+            {
+                failure_.emplace(std::move(*failure));
+            }
+            return false;
+        }
+
+        slot.state    = Slot::State::Pending;
+        slot.offset   = offset;
+        slot.sent_at  = approx_now;
+        slot.deadline = deadline;
+        ++slot.attempts;
+        slot.promise.emplace(cetl::get<Promise>(std::move(maybe_promise)));
+        slot.promise->setCallback([this, &slot](const auto& arg) {
+            //
+            onResponse(slot, std::move(arg.result), arg.approx_now);
+        });
+        return true;
+    }
+
+    void reissueRequest(Slot& slot, const TimePoint approx_now)
+    {
+        if (slot.attempts >= options_.max_attempts)
+        {
+            failure_.emplace(presentation::ResponsePromiseFailure{presentation::ResponsePromiseExpired{slot.deadline}});
+            return;
+        }
+
+        slot.state = Slot::State::Free;
+        if (!issueRequest(slot, slot.offset, approx_now))
+        {
+            // Try again on the next refill.
+            slot.state = Slot::State::Expired;
+        }
+    }
+
+    void onResponse(Slot& slot, Promise::Result&& result, const TimePoint approx_now)
+    {
+        if (auto* const success = cetl::get_if<Promise::Success>(&result))
+        {
+            if (slot.attempts == 1)
+            {
+                // Only responses to not repeated requests are unambiguous for the round trip time (Karn's rule).
+                onRoundTripTime(approx_now - slot.sent_at);
+            }
+
+            slot.state = Slot::State::Received;
+            if (success->response._error.value != FileError::OK)
+            {
+                if (!failure_)
+                {
+                    failure_.emplace(success->response._error);
+                }
+            }
+            else
+            {
+                // A short chunk marks the end of file, so there is no need to request anything beyond it.
+                const auto size = success->response.data.value.size();
+                if (size < ChunkCapacity)
+                {
+                    end_offset_ = std::min(end_offset_, slot.offset + size);
+                }
+                slot.chunk.emplace(std::move(success->response));
+            }
+        }
+        else if (cetl::get_if<presentation::ResponsePromiseExpired>(
+                     &cetl::get<presentation::ResponsePromiseFailure>(result)) != nullptr)
+        {
+            slot.state = Slot::State::Expired;
+            onTimeout();
+        }
+        else if (!failure_)
+        {
+            slot.state = Slot::State::Received;
+            failure_.emplace(cetl::get<presentation::ResponsePromiseFailure>(std::move(result)));
+        }
+
+        scheduleRefill(approx_now);
+    }
+
+    /// Updates the smoothed round trip time, its variation and the timeout (see RFC 6298),
+    /// and grows the window unless the round trip time indicates queueing somewhere on the way.
+    ///
+    void onRoundTripTime(const Duration rtt)
+    {
+        if ((srtt_ == Duration::zero()) || (rtt < min_rtt_))
+        {
+            min_rtt_ = rtt;
+        }
+        if (srtt_ == Duration::zero())
+        {
+            srtt_   = rtt;
+            rttvar_ = rtt / 2;
+        }
+        else
+        {
+            const auto delta = (srtt_ > rtt) ? (srtt_ - rtt) : (rtt - srtt_);
+            rttvar_          = (rttvar_ * 3 + delta) / 4;
+            srtt_            = (srtt_ * 7 + rtt) / 8;
+        }
+        timeout_ = std::max(options_.min_timeout, std::min(options_.max_timeout, srtt_ + rttvar_ * 4));
+
+        if (rtt <= min_rtt_ * 2)
+        {
+            window_size_ = clampWindowSize(window_size_ + 1);
+        }
+    }
+
+    void onTimeout()
+    {
+        window_size_ = clampWindowSize(window_size_ / 2);
+        timeout_     = std::min(options_.max_timeout, timeout_ * 2);
+    }
+
+    void complete(const TimePoint approx_now)
+    {
+        is_busy_ = false;
+        for (auto& slot : slots_)
+        {
+            slot.release();
+        }
+        data_callback_fn_ = {};
+
+        // Callback is released before the call, so that a new read could be started from within it.
+        const auto completion_callback_fn = std::exchange(completion_callback_fn_, nullptr);
+        const CompletionCallback::Arg arg{std::exchange(failure_, cetl::nullopt), delivered_size_, approx_now};
+        if (completion_callback_fn)
+        {
+            completion_callback_fn(arg);
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                      executor_;
+    Client                          client_;
+    const Options                   options_;
+    const std::size_t               max_window_size_;
+    Service::Request                request_;
+    bool                            is_busy_{false};
+    std::uint64_t                   next_request_offset_{0};
+    std::uint64_t                   next_delivery_offset_{0};
+    std::uint64_t                   end_offset_{0};
+    std::uint64_t                   delivered_size_{0};
+    std::size_t                     window_size_;
+    Duration                        timeout_;
+    Duration                        srtt_{};
+    Duration                        rttvar_{};
+    Duration                        min_rtt_{};
+    std::array<Slot, MaxWindowSize> slots_;
+    cetl::optional<Failure>         failure_;
+    DataCallback::Function          data_callback_fn_;
+    CompletionCallback::Function    completion_callback_fn_;
+    IExecutor::Callback::Any        refill_cb_;
+
+};  // FileReadClient
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_FILE_READ_CLIENT_HPP_INCLUDED
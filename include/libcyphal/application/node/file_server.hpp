@@ -0,0 +1,656 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_FILE_SERVER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_FILE_SERVER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/platform/file_system.hpp"
+#include "libcyphal/presentation/common_helpers.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/server.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <uavcan/file/Error_1_0.hpp>
+#include <uavcan/file/GetInfo_0_2.hpp>
+#include <uavcan/file/Path_2_0.hpp>
+#include <uavcan/file/Read_1_1.hpp>
+#include <uavcan/primitive/Unstructured_1_0.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'File' server component for the application node.
+///
+/// Serves `uavcan.file.Read` and `uavcan.file.GetInfo` requests from a pluggable file system backend
+/// (see `platform::file_system::IFileSystem`). Typical use is a gateway which updates firmware of many nodes
+/// at once - so the server is optimized for many clients concurrently reading the same file(s):
+///
+/// - Recently used files are kept open (up to `MaxOpenFiles`), and are closed after a period of inactivity.
+/// - If the backend maps a file into memory, then response chunks are sent straight from the mapped memory -
+///   response is passed to the transport as two payload fragments (a tiny header and the file data),
+///   so file data is not copied into an intermediate `Read.Response` object, nor serialized.
+/// - Otherwise, the file is read in `CacheBlockSize` blocks into a per-file read-ahead cache, which is shared
+///   by all clients, so that one backend read serves many `Read` requests. Least recently used blocks are reused.
+///   Chunks are sent straight from the cache blocks as well.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the callbacks, and the destructor closes all open files.
+///
+class FileServer final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the 'Read' service type of the server.
+    ///
+    using ReadService = uavcan::file::Read_1_1;
+
+    /// @brief Defines the 'GetInfo' service type of the server.
+    ///
+    using GetInfoService = uavcan::file::GetInfo_0_2;
+
+    /// @brief Defines max number of simultaneously open files.
+    ///
+    static constexpr std::size_t MaxOpenFiles = config::Application::Node::FileServer_MaxOpenFiles();
+
+    /// @brief Defines size of a read-ahead cache block.
+    ///
+    static constexpr std::size_t CacheBlockSize = config::Application::Node::FileServer_CacheBlockSize();
+
+    /// @brief Defines number of read-ahead cache blocks per an open file.
+    ///
+    static constexpr std::size_t CacheBlockCount = config::Application::Node::FileServer_CacheBlockCount();
+
+    /// @brief Factory method to create a file server instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Read' and 'GetInfo' service servers.
+    /// @param file_system The file system backend to serve files from. Should outlive the server.
+    /// @return The file server instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, platform::file_system::IFileSystem& file_system)
+        -> Expected<FileServer, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_read_srv = presentation.makeServer(ReadService::Request::_traits_::FixedPortId,
+                                                      ReadService::Request::_traits_::ExtentBytes);
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_read_srv))
+        {
+            return std::move(*failure);
+        }
+
+        auto maybe_get_info_srv = presentation.makeServer<GetInfoService>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_get_info_srv))
+        {
+            return std::move(*failure);
+        }
+
+        return FileServer{presentation,
+                          file_system,
+                          cetl::get<ReadServer>(std::move(maybe_read_srv)),
+                          cetl::get<GetInfoServer>(std::move(maybe_get_info_srv))};
+    }
+
+    FileServer(FileServer&& other) noexcept
+        : presentation_{other.presentation_}
+        , file_system_{other.file_system_}
+        , read_srv_{std::move(other.read_srv_)}
+        , get_info_srv_{std::move(other.get_info_srv_)}
+        , open_files_{std::move(other.open_files_)}
+        , open_files_count_{std::exchange(other.open_files_count_, 0)}
+        , access_counter_{other.access_counter_}
+        , response_timeout_{other.response_timeout_}
+        , idle_timeout_{other.idle_timeout_}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move executor callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start (if needed) in the new one.
+        other.sweep_cb_.reset();
+
+        setupCallbacks();
+        if (open_files_count_ > 0)
+        {
+            scheduleSweep(presentation_.executor().now());
+        }
+    }
+
+    ~FileServer()
+    {
+        while (auto* const open_file = open_files_.min())
+        {
+            closeFile(*open_file);
+        }
+    }
+
+    FileServer(const FileServer&)                = delete;
+    FileServer& operator=(const FileServer&)     = delete;
+    FileServer& operator=(FileServer&&) noexcept = delete;
+
+    /// @brief Sets the response transmission timeout (default is 1s).
+    ///
+    /// @return Reference to self for method chaining.
+    ///
+    FileServer& setResponseTimeout(const Duration timeout) noexcept
+    {
+        response_timeout_ = timeout;
+        return *this;
+    }
+
+    /// @brief Sets the node error handler, which is notified about response transmission failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the server.
+    /// @return Reference to self for method chaining.
+    ///
+    FileServer& setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+        return *this;
+    }
+
+    /// @brief Sets duration of inactivity after which an open file is closed (default is 5s).
+    ///
+    /// @return Reference to self for method chaining.
+    ///
+    FileServer& setIdleTimeout(const Duration timeout) noexcept
+    {
+        idle_timeout_ = timeout;
+        return *this;
+    }
+
+    /// @brief Gets number of currently open files.
+    ///
+    std::size_t getOpenFilesCount() const noexcept
+    {
+        return open_files_count_;
+    }
+
+private:
+    using ReadServer    = presentation::RawServiceServer;
+    using GetInfoServer = presentation::ServiceServer<GetInfoService>;
+    using FileError     = uavcan::file::Error_1_0;
+    using Path          = uavcan::file::Path_2_0::_traits_::TypeOf::path;
+
+    static constexpr std::size_t PathCapacity  = uavcan::file::Path_2_0::_traits_::ArrayCapacity::path;
+    static constexpr std::size_t ChunkCapacity = uavcan::primitive::Unstructured_1_0::_traits_::ArrayCapacity::value;
+
+    /// Size of the 'Read' response header, which precedes the chunk data (see `respondRead` for the layout).
+    ///
+    static constexpr std::size_t ReadResponseHeaderSize = 4;
+    static_assert(ReadService::Response::_traits_::SerializationBufferSizeBytes ==
+                      ReadResponseHeaderSize + ChunkCapacity,
+                  "The 'Read' response layout is expected to be the header followed by the chunk data.");
+    static_assert(CacheBlockCount >= 2, "A chunk could span two blocks, so both of them have to be in the cache.");
+    static_assert(CacheBlockSize >= ChunkCapacity, "A chunk should not span more than two blocks.");
+
+    /// Holds a part of a file which has been read in advance.
+    ///
+    struct CacheBlock
+    {
+        std::unique_ptr<cetl::byte, PmrRawBytesDeleter> buffer;
+        std::uint64_t                                   offset{0};
+        std::size_t                                     size{0};
+        std::uint64_t                                   last_access{0};
+        bool                                            is_loaded{false};
+    };
+
+    /// Holds an open file and its read-ahead cache.
+    ///
+    struct OpenFile final : common::cavl::Node<OpenFile>
+    {
+        OpenFile(const cetl::string_view path, UniquePtr<platform::file_system::IFile>&& opened_file)
+            : path_size{static_cast<std::uint8_t>((path.size() < PathCapacity) ? path.size() : PathCapacity)}
+            , file{std::move(opened_file)}
+            , mapped{file->getMapped()}
+        {
+            (void) std::copy_n(path.begin(), path_size, path_chars.begin());
+        }
+
+        cetl::string_view getPath() const noexcept
+        {
+            return {path_chars.data(), path_size};
+        }
+
+        std::int32_t compareByPath(const cetl::string_view path) const noexcept
+        {
+            return path.compare(getPath());
+        }
+
+        // MARK: Data members:
+
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        std::array<char, PathCapacity>          path_chars{};
+        std::uint8_t                            path_size;
+        UniquePtr<platform::file_system::IFile> file;
+        cetl::span<const cetl::byte>            mapped;
+        TimePoint                               last_access_time{};
+        std::array<CacheBlock, CacheBlockCount> blocks{};
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+    };
+
+    /// Holds up to two fragments of a chunk (it could span two cache blocks).
+    ///
+    struct Chunk
+    {
+        std::array<cetl::span<const cetl::byte>, 2> parts{};
+        std::size_t                                 parts_count{0};
+
+        void append(const cetl::span<const cetl::byte> part) noexcept
+        {
+            if (!part.empty())
+            {
+                parts[parts_count++] = part;  // NOLINT(*-pro-bounds-constant-array-index)
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return parts[0].size() + parts[1].size();
+        }
+    };
+
+    FileServer(presentation::Presentation&         presentation,
+               platform::file_system::IFileSystem& file_system,
+               ReadServer&&                        read_srv,
+               GetInfoServer&&                     get_info_srv)
+        : presentation_{presentation}
+        , file_system_{file_system}
+        , read_srv_{std::move(read_srv)}
+        , get_info_srv_{std::move(get_info_srv)}
+    {
+        setupCallbacks();
+    }
+
+    void setupCallbacks()
+    {
+        read_srv_.setOnRequestCallback([this](const auto& arg, auto continuation) {
+            //
+            onReadRequest(arg, std::move(continuation));
+        });
+        get_info_srv_.setOnRequestCallback([this](const auto& arg, auto continuation) {
+            //
+            onGetInfoRequest(arg, std::move(continuation));
+        });
+        sweep_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            closeIdleFiles(arg.approx_now);
+        });
+    }
+
+    void onReadRequest(const ReadServer::OnRequestCallback::Arg&   arg,
+                       ReadServer::OnRequestCallback::Continuation continuation)
+    {
+        ReadService::Request request{ReadService::Request::allocator_type{&presentation_.memory()}};
+        if (presentation::detail::tryDeserializePayload(arg.raw_request, presentation_.memory(), request))
+        {
+            // Malformed (or out of memory) request - there is nothing to respond with.
+            return;
+        }
+
+        // Used only if there is no memory for cache blocks - the chunk is read directly then.
+        // Next nolint b/c the buffer is filled by the file read, so no need to zero it.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+        std::array<cetl::byte, ChunkCapacity> fallback_buffer;
+
+        Chunk         chunk{};
+        std::uint16_t error = FileError::OK;
+        if (OpenFile* const open_file = findOrOpenFile(makePath(request.path.path), arg.approx_now, error))
+        {
+            error = readChunk(*open_file, request.offset, fallback_buffer, chunk);
+        }
+
+        // There is nothing we can do about possible continuation failures - we just report them.
+        error_reporter_.report(respondRead(continuation, arg.approx_now + response_timeout_, error, chunk),
+                               ErrorHandler::Origin::Response,
+                               ReadService::Request::_traits_::FixedPortId);
+    }
+
+    /// Sends the 'Read' response with the chunk data passed as is (without copying).
+    ///
+    /// Both `uavcan.file.Error.1.0` and `uavcan.primitive.Unstructured.1.0` are sealed, so the serialized
+    /// response is just the error code (`uint16`), the chunk length (`uint16`) and the chunk bytes.
+    ///
+    static auto respondRead(ReadServer::OnRequestCallback::Continuation& continuation,
+                            const TimePoint                              deadline,
+                            const std::uint16_t                          error,
+                            const Chunk&                                 chunk)
+        -> cetl::optional<ReadServer::Failure>
+    {
+        const auto chunk_size = static_cast<std::uint16_t>(chunk.size());
+
+        const std::array<cetl::byte, ReadResponseHeaderSize> header{
+            static_cast<cetl::byte>(error & 0xFFU),
+            static_cast<cetl::byte>(error >> 8U),
+            static_cast<cetl::byte>(chunk_size & 0xFFU),
+            static_cast<cetl::byte>(chunk_size >> 8U),
+        };
+        const std::array<cetl::span<const cetl::byte>, 3> fragments{header, chunk.parts[0], chunk.parts[1]};
+
+        return continuation(deadline, transport::PayloadFragments{fragments.data(), 1 + chunk.parts_count});
+    }
+
+    void onGetInfoRequest(const GetInfoServer::OnRequestCallback::Arg&   arg,
+                          GetInfoServer::OnRequestCallback::Continuation continuation) const
+    {
+        GetInfoService::Response response{GetInfoService::Response::allocator_type{&presentation_.memory()}};
+
+        auto maybe_info = file_system_.getInfo(makePath(arg.request.path.path));
+        if (const auto* const info = cetl::get_if<platform::file_system::Info>(&maybe_info))
+        {
+            response.size                                = info->size;
+            response.unix_timestamp_of_last_modification = info->unix_timestamp_of_last_modification;
+            response.is_file_not_directory               = info->is_file_not_directory;
+            response.is_link                             = info->is_link;
+            response.is_readable                         = info->is_readable;
+            response.is_writeable                        = info->is_writeable;
+        }
+        else
+        {
+            response._error.value = toFileError(cetl::get<platform::file_system::Error>(maybe_info));
+        }
+
+        // There is nothing we can do about possible continuation failures - we just report them.
+        error_reporter_.report(continuation(arg.approx_now + response_timeout_, response),
+                               ErrorHandler::Origin::Response,
+                               GetInfoService::Request::_traits_::FixedPortId);
+    }
+
+    std::uint16_t readChunk(OpenFile&                              open_file,
+                            const std::uint64_t                    offset,
+                            std::array<cetl::byte, ChunkCapacity>& fallback_buffer,
+                            Chunk&                                 chunk)
+    {
+        const std::uint64_t file_size = open_file.file->getSize();
+        if (offset >= file_size)
+        {
+            // Reading beyond the end of file gives an empty chunk.
+            return FileError::OK;
+        }
+        constexpr std::uint64_t MaxChunkSize = ChunkCapacity;
+        const auto chunk_size = static_cast<std::size_t>(std::min(MaxChunkSize, file_size - offset));
+
+        // 1. The fastest path - straight from the mapped memory.
+        if (!open_file.mapped.empty())
+        {
+            chunk.append(open_file.mapped.subspan(static_cast<std::size_t>(offset), chunk_size));
+            return FileError::OK;
+        }
+
+        // 2. From the read-ahead cache - the chunk could span two consecutive blocks.
+        std::uint64_t chunk_offset = offset;
+        while (chunk.size() < chunk_size)
+        {
+            const std::uint64_t block_offset = chunk_offset - (chunk_offset % CacheBlockSize);
+
+            CacheBlock* const block = findOrLoadBlock(open_file, block_offset);
+            if (block == nullptr)
+            {
+                break;
+            }
+            if (!block->is_loaded)
+            {
+                return FileError::IO_ERROR;
+            }
+
+            const auto block_pos = static_cast<std::size_t>(chunk_offset - block_offset);
+            if (block_pos >= block->size)
+            {
+                // The file became shorter since it was opened.
+                return FileError::OK;
+            }
+            const auto part_size = std::min(chunk_size - chunk.size(), block->size - block_pos);
+            chunk.append({block->buffer.get() + block_pos, part_size});  // NOLINT(*-pro-bounds-pointer-arithmetic)
+            chunk_offset += part_size;
+        }
+        if (chunk.size() == chunk_size)
+        {
+            return FileError::OK;
+        }
+
+        // 3. No memory for the cache - so read the chunk directly (but only for this request).
+        chunk = {};
+        auto maybe_size = open_file.file->read(offset, {fallback_buffer.data(), chunk_size});
+        if (const auto* const size = cetl::get_if<std::size_t>(&maybe_size))
+        {
+            chunk.append({fallback_buffer.data(), *size});
+            return FileError::OK;
+        }
+        return toFileError(cetl::get<platform::file_system::Error>(maybe_size));
+    }
+
+    /// Finds the cache block at the given offset, or (re)loads the least recently used block with it.
+    ///
+    /// @return Pointer to the block (its `is_loaded` is `false` if the file read has failed),
+    ///         or `nullptr` if there is no memory for the block buffer.
+    ///
+    CacheBlock* findOrLoadBlock(OpenFile& open_file, const std::uint64_t block_offset)
+    {
+        ++access_counter_;
+
+        CacheBlock* lru_block = &open_file.blocks.front();
+        for (auto& block : open_file.blocks)
+        {
+            if (block.is_loaded && (block.offset == block_offset))
+            {
+                block.last_access = access_counter_;
+                return &block;
+            }
+            if (block.last_access < lru_block->last_access)
+            {
+                lru_block = &block;
+            }
+        }
+
+        CacheBlock& block = *lru_block;
+        if (!block.buffer)
+        {
+            auto& memory = presentation_.memory();
+            block.buffer = {static_cast<cetl::byte*>(memory.allocate(CacheBlockSize)),  // NOSONAR cpp:S5356 cpp:S5357
+                            {CacheBlockSize, &memory}};
+            if (!block.buffer)
+            {
+                return nullptr;
+            }
+        }
+
+        block.offset      = block_offset;
+        block.last_access = access_counter_;
+        block.size        = 0;
+        block.is_loaded   = false;
+
+        auto maybe_size = open_file.file->read(block_offset, {block.buffer.get(), CacheBlockSize});
+        if (const auto* const size = cetl::get_if<std::size_t>(&maybe_size))
+        {
+            block.size      = *size;
+            block.is_loaded = true;
+        }
+        return &block;
+    }
+
+    /// Finds already open file, or opens it (closing the least recently used one if there are too many open).
+    ///
+    /// @return Pointer to the open file, or `nullptr` (with `out_error` set) in case of failure.
+    ///
+    OpenFile* findOrOpenFile(const cetl::string_view path, const TimePoint now, std::uint16_t& out_error)
+    {
+        if (path.size() > PathCapacity)
+        {
+            out_error = FileError::INVALID_VALUE;
+            return nullptr;
+        }
+
+        if (OpenFile* const open_file = open_files_.search([path](const OpenFile& other) {  //
+                return other.compareByPath(path);
+            }))
+        {
+            open_file->last_access_time = now;
+            return open_file;
+        }
+
+        auto maybe_file = file_system_.open(path);
+        if (auto* const failure = cetl::get_if<platform::file_system::Error>(&maybe_file))
+        {
+            out_error = toFileError(*failure);
+            return nullptr;
+        }
+
+        if (open_files_count_ >= MaxOpenFiles)
+        {
+            closeFile(findLeastRecentlyUsedFile());
+        }
+
+        libcyphal::detail::PmrAllocator<OpenFile> allocator{&presentation_.memory()};
+        OpenFile* const open_file = allocator.allocate(1);
+        if (open_file == nullptr)
+        {
+            out_error = FileError::OUT_OF_SPACE;
+            return nullptr;
+        }
+        allocator.construct(open_file, path, cetl::get<UniquePtr<platform::file_system::IFile>>(std::move(maybe_file)));
+        open_file->last_access_time = now;
+
+        const auto open_file_existing = open_files_.search(
+            [path](const OpenFile& other) {  //
+                return other.compareByPath(path);
+            },
+            [open_file]() { return open_file; });
+        CETL_DEBUG_ASSERT(!std::get<1>(open_file_existing), "The file should not be open yet.");
+        (void) open_file_existing;
+
+        if (open_files_count_++ == 0)
+        {
+            scheduleSweep(now + idle_timeout_);
+        }
+        return open_file;
+    }
+
+    OpenFile& findLeastRecentlyUsedFile()
+    {
+        OpenFile* lru_file = nullptr;
+        open_files_.traverseInOrder([&lru_file](OpenFile& open_file) {
+            //
+            if ((lru_file == nullptr) || (open_file.last_access_time < lru_file->last_access_time))
+            {
+                lru_file = &open_file;
+            }
+        });
+        CETL_DEBUG_ASSERT(lru_file != nullptr, "There should be at least one open file.");
+        return *lru_file;
+    }
+
+    void closeFile(OpenFile& open_file)
+    {
+        open_file.remove();
+        --open_files_count_;
+
+        // No Sonar
+        // - cpp:S3432   "Destructors should not be called explicitly"
+        // - cpp:M23_329 "Advanced memory management" shall not be used"
+        // b/c we do our own low-level PMR management here.
+        open_file.~OpenFile();  // NOSONAR cpp:S3432 cpp:M23_329
+        libcyphal::detail::PmrAllocator<OpenFile>{&presentation_.memory()}.deallocate(&open_file, 1);
+    }
+
+    /// Closes files which were not accessed for the idle timeout, and re-arms the sweep for the rest of them.
+    ///
+    void closeIdleFiles(const TimePoint approx_now)
+    {
+        // There are just few open files, so it's fine to find the least recently used one repeatedly.
+        while (open_files_count_ > 0)
+        {
+            OpenFile& lru_file = findLeastRecentlyUsedFile();
+            if (approx_now < lru_file.last_access_time + idle_timeout_)
+            {
+                scheduleSweep(lru_file.last_access_time + idle_timeout_);
+                break;
+            }
+            closeFile(lru_file);
+        }
+    }
+
+    void scheduleSweep(const TimePoint exec_time)
+    {
+        const auto result = sweep_cb_.schedule(IExecutor::Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    static cetl::string_view makePath(const Path& path)
+    {
+        // No Lint and Sonar cpp:S3630 "reinterpret_cast" should not be used" b/c we need to access path raw data.
+        // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+        return {reinterpret_cast<cetl::string_view::const_pointer>(path.data()), path.size()};  // NOSONAR
+    }
+
+    static std::uint16_t toFileError(const platform::file_system::Error error) noexcept
+    {
+        using Error = platform::file_system::Error;
+
+        std::uint16_t file_error = FileError::UNKNOWN_ERROR;
+        switch (error)
+        {
+        case Error::NotFound:
+            file_error = FileError::NOT_FOUND;
+            break;
+        case Error::IO:
+            file_error = FileError::IO_ERROR;
+            break;
+        case Error::AccessDenied:
+            file_error = FileError::ACCESS_DENIED;
+            break;
+        case Error::IsDirectory:
+            file_error = FileError::IS_DIRECTORY;
+            break;
+        case Error::InvalidValue:
+            file_error = FileError::INVALID_VALUE;
+            break;
+        case Error::FileTooLarge:
+            file_error = FileError::FILE_TOO_LARGE;
+            break;
+        case Error::NotSupported:
+            file_error = FileError::NOT_SUPPORTED;
+            break;
+        }
+        return file_error;
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&         presentation_;
+    platform::file_system::IFileSystem& file_system_;
+    ReadServer                          read_srv_;
+    GetInfoServer                       get_info_srv_;
+    common::cavl::Tree<OpenFile>        open_files_;
+    std::size_t                         open_files_count_{0};
+    std::uint64_t                       access_counter_{0};
+    Duration                            response_timeout_{std::chrono::seconds{1}};
+    Duration                            idle_timeout_{std::chrono::seconds{5}};
+    ErrorReporter                       error_reporter_;
+    IExecutor::Callback::Any            sweep_cb_;
+
+};  // FileServer
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_FILE_SERVER_HPP_INCLUDED
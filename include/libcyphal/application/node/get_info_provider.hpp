@@ -6,6 +6,7 @@
 #ifndef LIBCYPHAL_APPLICATION_NODE_GETINFO_PROVIDER_HPP_INCLUDED
 #define LIBCYPHAL_APPLICATION_NODE_GETINFO_PROVIDER_HPP_INCLUDED
 
+#include "error_handler.hpp"
 #include "libcyphal/presentation/presentation.hpp"
 #include "libcyphal/presentation/server.hpp"
 #include "libcyphal/types.hpp"
@@ -67,6 +68,7 @@ public:
         , server_{std::move(other.server_)}
         , response_{std::move(other.response_)}
         , response_timeout_{other.response_timeout_}
+        , error_reporter_{other.error_reporter_}
     {
         // We have to set up request callback again (b/c it captures its own `this` pointer),
         setupOnRequestCallback();
@@ -99,6 +101,17 @@ public:
         return *this;
     }
 
+    /// @brief Sets the node error handler, which is notified about response transmission failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the provider.
+    /// @return Reference to self for method chaining.
+    ///
+    GetInfoProvider& setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+        return *this;
+    }
+
     /// @brief Sets the node unique 128-bit id in the GetInfo response.
     ///
     /// Default is all zeros.
@@ -220,9 +233,10 @@ private:
     {
         server_.setOnRequestCallback([this](const auto& arg, auto continuation) {
             //
-            // There is nothing we can do about possible continuation failures - we just ignore them.
-            // TODO: Introduce error handler at the node level.
-            (void) continuation(arg.approx_now + response_timeout_, response_);
+            // There is nothing we can do about possible continuation failures - we just report them.
+            error_reporter_.report(continuation(arg.approx_now + response_timeout_, response_),
+                                   ErrorHandler::Origin::Response,
+                                   Service::Request::_traits_::FixedPortId);
         });
     }
 
@@ -242,6 +256,7 @@ private:
     Server                      server_;
     Response                    response_;
     Duration                    response_timeout_;
+    ErrorReporter               error_reporter_;
 
 };  // GetInfoProvider
 
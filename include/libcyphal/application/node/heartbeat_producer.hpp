@@ -6,6 +6,8 @@
 #ifndef LIBCYPHAL_APPLICATION_NODE_HEARTBEAT_PRODUCER_HPP_INCLUDED
 #define LIBCYPHAL_APPLICATION_NODE_HEARTBEAT_PRODUCER_HPP_INCLUDED
 
+#include "error_handler.hpp"
+#include "heartbeat_scheduler.hpp"
 #include "libcyphal/config.hpp"
 #include "libcyphal/executor.hpp"
 #include "libcyphal/presentation/presentation.hpp"
@@ -33,6 +35,8 @@ namespace node
 /// @brief Defines 'Heartbeat' producer component for the application node.
 ///
 /// Internally, it uses the 'Heartbeat' message publisher to periodically publish heartbeat messages.
+/// By default, the producer has its own executor callback, but it could also be driven by a shared
+/// `HeartbeatScheduler` (f.e. when a single process simulates many nodes).
 ///
 /// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
 /// We need custom move constructor to reset up the publishing callback,
@@ -59,7 +63,28 @@ public:
             return std::move(*failure);
         }
 
-        return HeartbeatProducer{presentation, cetl::get<Publisher>(std::move(maybe_heartbeat_pub))};
+        return HeartbeatProducer{presentation, cetl::get<Publisher>(std::move(maybe_heartbeat_pub)), nullptr};
+    }
+
+    /// @brief Factory method to create a Heartbeat instance driven by a shared scheduler.
+    ///
+    /// Such producer doesn't have its own executor callback - instead, it joins the scheduler, which triggers
+    /// publication once per the scheduler period (see `HeartbeatScheduler::getPeriod`).
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Heartbeat' publisher.
+    /// @param scheduler The shared heartbeat scheduler. Should outlive the producer.
+    /// @return The Heartbeat instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, HeartbeatScheduler& scheduler)
+        -> Expected<HeartbeatProducer, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_heartbeat_pub = presentation.makePublisher<Publisher::Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_heartbeat_pub))
+        {
+            return std::move(*failure);
+        }
+
+        return HeartbeatProducer{presentation, cetl::get<Publisher>(std::move(maybe_heartbeat_pub)), &scheduler};
     }
 
     HeartbeatProducer(HeartbeatProducer&& other) noexcept
@@ -68,11 +93,15 @@ public:
         , publisher_{other.publisher_}
         , message_{other.message_}
         , update_callback_fn_{std::move(other.update_callback_fn_)}
+        , error_reporter_{other.error_reporter_}
         , next_exec_time_{other.next_exec_time_}
-
+        , period_{other.period_}
+        , scheduler_{other.scheduler_}
+        , scheduler_member_{std::move(other.scheduler_member_)}
     {
         // We can't move `periodic_cb_` callback (b/c it captures its own `this` pointer),
         // so we need to stop it in the moved-from object, and start in the new one.
+        // The scheduler member is moved as is (so it keeps its phase slot), but its callback has to be replaced.
         other.stopPublishing();
         startPublishing();
     }
@@ -131,37 +160,96 @@ public:
         update_callback_fn_ = std::move(update_callback_fn);
     }
 
+    /// @brief Sets the node error handler.
+    ///
+    /// Publishing failures are reported to the handler. In addition, the handler drives `Message.health` field -
+    /// it's updated from the handler's health before each publication (so it overrides whatever was set via
+    /// `message()`), but the update callback (if any) is still able to modify it.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the producer.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+    /// @brief Gets the current publication period.
+    ///
+    /// For a producer driven by a shared scheduler, it's the scheduler period.
+    ///
+    Duration getPeriod() const noexcept
+    {
+        return (scheduler_ != nullptr) ? scheduler_->getPeriod() : period_;
+    }
+
+    /// @brief Sets a new publication period (default is `Heartbeat.1.0.MAX_PUBLICATION_PERIOD`, which is 1s).
+    ///
+    /// The already planned next heartbeat is published as scheduled, and the new period applies after it.
+    /// Note that the Cyphal specification requires heartbeats to be published at least once per second.
+    /// Has no effect on a producer driven by a shared scheduler - use `HeartbeatScheduler::setPeriod` instead.
+    ///
+    /// @param period The new positive period.
+    ///
+    void setPeriod(const Duration period)
+    {
+        CETL_DEBUG_ASSERT(period > Duration::zero(), "");
+
+        period_ = period;
+        if (scheduler_ == nullptr)
+        {
+            const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, period_});
+            CETL_DEBUG_ASSERT(result, "");
+            (void) result;
+        }
+    }
+
 private:
     using Callback  = IExecutor::Callback;
     using Publisher = presentation::Publisher<Message>;
 
-    HeartbeatProducer(presentation::Presentation& presentation, Publisher&& publisher)
+    HeartbeatProducer(presentation::Presentation& presentation,
+                      Publisher&&                 publisher,
+                      HeartbeatScheduler* const   scheduler)
         : presentation_{presentation}
         , startup_time_{presentation.executor().now()}
         , publisher_{std::move(publisher)}
         , message_{Message::allocator_type{&presentation.memory()}}
         , next_exec_time_{startup_time_}
+        , period_{std::chrono::seconds{1}}
+        , scheduler_{scheduler}
     {
         startPublishing();
     }
 
-    static constexpr Duration getPeriod()
-    {
-        return std::chrono::seconds(1);
-    }
-
     void startPublishing()
     {
+        if (scheduler_ != nullptr)
+        {
+            auto member_callback_fn = [this](const auto& arg) {
+                //
+                publishMessage(arg.approx_now);
+            };
+            if (scheduler_member_)
+            {
+                scheduler_member_->setCallback(std::move(member_callback_fn));
+            }
+            else
+            {
+                scheduler_member_.emplace(scheduler_->join(std::move(member_callback_fn)));
+            }
+            return;
+        }
+
         periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
             //
             // We keep track of the next execution time to allow
             // smooth rescheduling to the new instance in the move constructor.
-            next_exec_time_ = arg.exec_time + getPeriod();
+            next_exec_time_ = arg.exec_time + period_;
 
             publishMessage(arg.approx_now);
         });
 
-        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, getPeriod()});
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, period_});
         CETL_DEBUG_ASSERT(result, "");
         (void) result;
     }
@@ -179,32 +267,42 @@ private:
         //
         const auto uptime_in_secs = std::chrono::duration_cast<std::chrono::seconds>(approx_now - startup_time_);
         message_.uptime           = static_cast<std::uint32_t>(uptime_in_secs.count());
+        if (ErrorHandler* const error_handler = error_reporter_.getHandler())
+        {
+            message_.health.value = error_handler->getHealth(approx_now);
+        }
         if (update_callback_fn_)
         {
             update_callback_fn_(UpdateCallback::Arg{message_, approx_now});
         }
 
-        // Deadline for the next publication is the current time plus 1s publication period -
+        // Deadline for the next publication is the current time plus the publication period -
         // it has no sense to keep the message in the queue for longer than that.
-        // There is nothing we can do about possible publishing failures - we just ignore them.
-        // TODO: Introduce error handler at the node level.
-        (void) publisher_.publish(approx_now + getPeriod(), message_);
+        // There is nothing we can do about possible publishing failures - we just report them.
+        error_reporter_.report(publisher_.publish(approx_now + getPeriod(), message_),
+                               ErrorHandler::Origin::Publication,
+                               Message::_traits_::FixedPortId);
     }
 
     void stopPublishing()
     {
         periodic_cb_.reset();
+        scheduler_member_.reset();
     }
 
     // MARK: Data members:
 
-    presentation::Presentation& presentation_;
-    const TimePoint             startup_time_;
-    const Publisher             publisher_;
-    Callback::Any               periodic_cb_;
-    Message                     message_;
-    UpdateCallback::Function    update_callback_fn_;
-    TimePoint                   next_exec_time_;
+    presentation::Presentation&                presentation_;
+    const TimePoint                            startup_time_;
+    const Publisher                            publisher_;
+    Callback::Any                              periodic_cb_;
+    Message                                    message_;
+    UpdateCallback::Function                   update_callback_fn_;
+    ErrorReporter                              error_reporter_;
+    TimePoint                                  next_exec_time_;
+    Duration                                   period_;
+    HeartbeatScheduler*                        scheduler_;
+    cetl::optional<HeartbeatScheduler::Member> scheduler_member_;
 
 };  // HeartbeatProducer
 
@@ -0,0 +1,248 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_HEARTBEAT_SCHEDULER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_HEARTBEAT_SCHEDULER_HPP_INCLUDED
+
+#include "libcyphal/common/intrusive_list.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines a scheduler which drives multiple heartbeat producers from a single executor callback.
+///
+/// Normally, every `HeartbeatProducer` registers its own repeating executor callback. This is fine for a regular
+/// application with a single node, but a process which simulates hundreds of nodes (f.e. for scale tests) ends up
+/// with hundreds of timers firing out of phase. Instead, producers could be made with a shared scheduler
+/// (see `HeartbeatProducer::make`), which:
+/// - registers just one repeating executor callback, which fires `HeartbeatScheduler_SlotCount` times per period;
+/// - spreads its members evenly among the slots (every new member joins the least populated slot),
+///   so that every tick triggers only a fraction of all members, and the bus load is spread over the period.
+///
+/// Creation, destruction and triggering of members don't allocate memory. Note that members are not allowed
+/// to be created or destroyed from within the member callbacks.
+///
+/// The scheduler is neither copyable nor movable - its callback captures `this` pointer.
+///
+class HeartbeatScheduler final
+{
+public:
+    /// @brief Defines number of phase slots per period.
+    ///
+    static constexpr std::size_t SlotCount = config::Application::Node::HeartbeatScheduler_SlotCount();
+
+    /// @brief Umbrella type for scheduler member entities.
+    ///
+    struct MemberCallback
+    {
+        /// @brief Defines standard arguments for the member callback.
+        ///
+        struct Arg
+        {
+            /// Holds the current period of the scheduler.
+            Duration period;
+
+            /// Holds the approximate time when the member has been triggered.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the member callback function.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Node::HeartbeatScheduler_MemberCallback_FunctionSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Defines a scheduler member.
+    ///
+    /// Member is triggered once per period (in its phase slot) as long as it is alive. It can be moved
+    /// (f.e. to be stored as a member of some application component), but it should not outlive its scheduler.
+    ///
+    /// No Sonar cpp:S4963 b/c `Member` supports move operation.
+    ///
+    class Member final : public common::IntrusiveListNode<Member>  // NOSONAR cpp:S4963
+    {
+    public:
+        ~Member() = default;
+
+        Member(Member&& other) noexcept            = default;
+        Member(const Member&)                      = delete;
+        Member& operator=(const Member&)           = delete;
+        Member& operator=(Member&& other) noexcept = delete;
+
+        /// Gets index of the phase slot of the member.
+        ///
+        std::size_t getSlot() const noexcept
+        {
+            return slot_;
+        }
+
+        /// Replaces the member callback (f.e. after moving of its owner).
+        ///
+        void setCallback(MemberCallback::Function&& callback_fn)
+        {
+            callback_fn_ = std::move(callback_fn);
+        }
+
+    private:
+        friend class HeartbeatScheduler;
+
+        Member(common::IntrusiveList<Member>& slot_list, const std::size_t slot, MemberCallback::Function&& callback_fn)
+            : slot_{slot}
+            , callback_fn_{std::move(callback_fn)}
+        {
+            slot_list.pushBack(*this);
+        }
+
+        // MARK: Data members:
+
+        std::size_t              slot_;
+        MemberCallback::Function callback_fn_;
+
+    };  // Member
+
+    /// @brief Constructs a new scheduler with the standard 1s period (`Heartbeat.1.0.MAX_PUBLICATION_PERIOD`).
+    ///
+    /// @param executor The executor to schedule the ticks on. Should outlive the scheduler.
+    ///
+    explicit HeartbeatScheduler(IExecutor& executor)
+        : HeartbeatScheduler{executor, std::chrono::seconds{1}}
+    {
+    }
+
+    /// @brief Constructs a new scheduler.
+    ///
+    /// @param executor The executor to schedule the ticks on. Should outlive the scheduler.
+    /// @param period The positive period of members triggering.
+    ///
+    HeartbeatScheduler(IExecutor& executor, const Duration period)
+        : executor_{executor}
+        , period_{period}
+    {
+        CETL_DEBUG_ASSERT(period > Duration::zero(), "");
+
+        tick_cb_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            tick(arg.approx_now);
+        });
+        schedule(executor_.now());
+    }
+
+    ~HeartbeatScheduler() = default;
+
+    HeartbeatScheduler(const HeartbeatScheduler&)                = delete;
+    HeartbeatScheduler(HeartbeatScheduler&&) noexcept            = delete;
+    HeartbeatScheduler& operator=(const HeartbeatScheduler&)     = delete;
+    HeartbeatScheduler& operator=(HeartbeatScheduler&&) noexcept = delete;
+
+    /// @brief Gets the current period of members triggering.
+    ///
+    Duration getPeriod() const noexcept
+    {
+        return period_;
+    }
+
+    /// @brief Sets a new period of members triggering.
+    ///
+    /// The new period takes effect from the next tick (which is rescheduled accordingly).
+    /// Note that the Cyphal specification requires heartbeats to be published at least once per second.
+    ///
+    /// @param period The new positive period.
+    ///
+    void setPeriod(const Duration period)
+    {
+        CETL_DEBUG_ASSERT(period > Duration::zero(), "");
+
+        period_ = period;
+        schedule(executor_.now() + getTickPeriod());
+    }
+
+    /// @brief Gets total number of members.
+    ///
+    std::size_t getMembersCount() const noexcept
+    {
+        std::size_t count = 0;
+        for (const auto& slot_list : slots_)
+        {
+            count += slot_list.size();
+        }
+        return count;
+    }
+
+    /// @brief Creates a new member, which joins the least populated phase slot.
+    ///
+    /// @param member_callback_fn The function to call once per period (from the executor spin context).
+    ///
+    CETL_NODISCARD Member join(MemberCallback::Function&& member_callback_fn)
+    {
+        std::size_t slot = 0;
+        for (std::size_t index = 1; index < SlotCount; ++index)
+        {
+            if (slots_[index].size() < slots_[slot].size())  // NOLINT(*-pro-bounds-constant-array-index)
+            {
+                slot = index;
+            }
+        }
+        return Member{slots_[slot], slot, std::move(member_callback_fn)};  // NOLINT(*-pro-bounds-constant-array-index)
+    }
+
+private:
+    Duration getTickPeriod() const noexcept
+    {
+        return period_ / static_cast<Duration::rep>(SlotCount);
+    }
+
+    void schedule(const TimePoint first_tick_time)
+    {
+        const auto result = tick_cb_.schedule(IExecutor::Callback::Schedule::Repeat{first_tick_time, getTickPeriod()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void tick(const TimePoint approx_now)
+    {
+        const MemberCallback::Arg arg{period_, approx_now};
+
+        slots_[next_slot_].traverse([&arg](const Member& member) {  // NOLINT(*-pro-bounds-constant-array-index)
+            //
+            if (member.callback_fn_)
+            {
+                member.callback_fn_(arg);
+            }
+        });
+        next_slot_ = (next_slot_ + 1U) % SlotCount;
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                                           executor_;
+    Duration                                             period_;
+    std::array<common::IntrusiveList<Member>, SlotCount> slots_;
+    std::size_t                                          next_slot_{0};
+    IExecutor::Callback::Any                             tick_cb_;
+
+};  // HeartbeatScheduler
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_HEARTBEAT_SCHEDULER_HPP_INCLUDED
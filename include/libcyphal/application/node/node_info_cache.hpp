@@ -0,0 +1,638 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_NODE_INFO_CACHE_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_NODE_INFO_CACHE_HPP_INCLUDED
+
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/client.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/response_promise.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+#include "node_tracker.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <uavcan/node/GetInfo_1_0.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines an application level cache of remote nodes' 'GetInfo' metadata.
+///
+/// The cache queries `uavcan.node.GetInfo` of requested nodes (see `query`, or feed it with `NodeTracker` events
+/// via `onNodeEvent`), and keeps their responses. Queries are queued, and only a limited number of them
+/// (see `config::Application::Node::NodeInfoCache_MaxConcurrency()`) is in flight at any time, so that
+/// discovery of a whole network doesn't flood the bus (and doesn't exhaust transfer IDs). Failed queries are
+/// retried (with linearly increasing delay) up to the configured number of attempts.
+///
+/// Responses are stored compactly: per node only its unique ID is kept, while the rest of the metadata (versions,
+/// VCS revision, image CRC and name) is stored in a shared descriptor, which is deduplicated across nodes
+/// (it's common to have many nodes of the same kind and firmware on the same network).
+/// Certificate of authenticity is not kept.
+///
+/// The cache is neither copyable nor movable - its callbacks capture `this` pointer.
+///
+class NodeInfoCache final
+{
+public:
+    /// @brief Defines the service type of the cache queries.
+    ///
+    using Service = uavcan::node::GetInfo_1_0;
+
+    /// @brief Defines a compact version (major and minor numbers).
+    ///
+    struct Version
+    {
+        std::uint8_t major{0};
+        std::uint8_t minor{0};
+    };
+
+    /// @brief Defines metadata which is shared between nodes with identical software and hardware.
+    ///
+    struct Descriptor
+    {
+        Version                       protocol_version;
+        Version                       hardware_version;
+        Version                       software_version;
+        std::uint64_t                 software_vcs_revision_id{0};
+        cetl::optional<std::uint64_t> software_image_crc;
+
+        /// Gets the node name.
+        ///
+        cetl::string_view getName() const noexcept
+        {
+            // No Sonar cpp:S5356 b/c we need to access the raw name bytes as characters.
+            return {name_chars_.data(), name_size_};  // NOSONAR cpp:S5356
+        }
+
+    private:
+        friend class NodeInfoCache;
+
+        std::array<char, Service::Response::_traits_::ArrayCapacity::name> name_chars_{};
+        std::uint8_t                                                     name_size_{0};
+    };
+
+    /// @brief Defines cached information about a node.
+    ///
+    struct Info
+    {
+        transport::NodeId            node_id{};
+        std::array<std::uint8_t, 16> unique_id{};
+        const Descriptor*            descriptor{nullptr};
+    };
+
+    /// @brief Umbrella type for node info notification entities.
+    ///
+    struct InfoCallback
+    {
+        /// @brief Defines standard arguments for the info callback.
+        ///
+        struct Arg
+        {
+            /// Holds ID of the queried node.
+            transport::NodeId node_id;
+
+            /// Holds the received information, or `nullptr` if all query attempts have failed.
+            const Info* info;
+
+            /// Holds the approximate time when the query has been completed.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the info callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Node::NodeInfoCache_InfoCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Defines the maximum number of concurrent queries.
+    ///
+    static constexpr std::size_t MaxConcurrency = config::Application::Node::NodeInfoCache_MaxConcurrency();
+
+    /// @brief Constructs a new node info cache.
+    ///
+    /// @param presentation The presentation layer instance. In use to make 'GetInfo' clients, and for memory.
+    /// @param concurrency Number of concurrent queries. Limited by `MaxConcurrency` (which is the default).
+    ///
+    explicit NodeInfoCache(presentation::Presentation& presentation, const std::size_t concurrency = MaxConcurrency)
+        : presentation_{presentation}
+        , concurrency_{clampConcurrency(concurrency)}
+        , request_{Service::Request::allocator_type{&presentation.memory()}}
+    {
+        pump_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            pump(arg.approx_now);
+        });
+    }
+
+    ~NodeInfoCache()
+    {
+        for (auto& slot : slots_)
+        {
+            releaseSlot(slot);
+        }
+        while (auto* const node_record = node_records_.min())
+        {
+            node_record->remove();
+            releaseInfo(*node_record);
+            destroyRecord(node_record);
+        }
+        CETL_DEBUG_ASSERT(descriptor_count_ == 0, "All descriptors should be released with their nodes.");
+    }
+
+    NodeInfoCache(const NodeInfoCache&)                = delete;
+    NodeInfoCache(NodeInfoCache&&) noexcept            = delete;
+    NodeInfoCache& operator=(const NodeInfoCache&)     = delete;
+    NodeInfoCache& operator=(NodeInfoCache&&) noexcept = delete;
+
+    /// @brief Sets the info callback, which is called on completion of every query.
+    ///
+    void setInfoCallback(InfoCallback::Function&& info_callback_fn)
+    {
+        info_callback_fn_ = std::move(info_callback_fn);
+    }
+
+    /// @brief Sets timeout of a single 'GetInfo' request (default is 1s).
+    ///
+    void setRequestTimeout(const Duration timeout) noexcept
+    {
+        request_timeout_ = timeout;
+    }
+
+    /// @brief Sets the retry policy (default is 3 attempts, with 1s delay increment between them).
+    ///
+    /// @param max_attempts Maximum number of attempts of a query (including the very first one).
+    /// @param retry_delay Delay before the 2nd attempt; the delay before every next attempt grows by this value.
+    ///
+    void setRetryPolicy(const std::uint8_t max_attempts, const Duration retry_delay) noexcept
+    {
+        max_attempts_ = std::max<std::uint8_t>(1, max_attempts);
+        retry_delay_  = retry_delay;
+    }
+
+    /// @brief Queues a 'GetInfo' query of the given node.
+    ///
+    /// Does nothing if the node is already queued or being queried. Already cached info (if any) stays
+    /// available until it's replaced by the query result.
+    ///
+    /// @return `false` if there is no memory to track the node.
+    ///
+    bool query(const transport::NodeId node_id)
+    {
+        auto* const node_record = findOrCreateRecord(node_id);
+        if (node_record == nullptr)
+        {
+            return false;
+        }
+
+        switch (node_record->state)
+        {
+        case State::Queued:
+        case State::InFlight:
+            break;
+        case State::Idle:
+            node_record->attempts = 0;
+            enqueue(*node_record, presentation_.executor().now());
+            schedulePump(presentation_.executor().now());
+            break;
+        }
+        return true;
+    }
+
+    /// @brief Forgets cached info of the given node (f.e. b/c the node has been restarted).
+    ///
+    /// If the node is being queried at the moment, the query result is discarded, and the node is queried again.
+    ///
+    void invalidate(const transport::NodeId node_id)
+    {
+        auto* const node_record = findRecord(node_id);
+        if (node_record == nullptr)
+        {
+            return;
+        }
+
+        releaseInfo(*node_record);
+        node_record->is_stale = (node_record->state == State::InFlight);
+    }
+
+    /// @brief Handles a node change event of the `NodeTracker`.
+    ///
+    /// Queries info of new online nodes, and re-queries it for restarted ones.
+    ///
+    void onNodeEvent(const NodeTracker::EventCallback::Arg& event)
+    {
+        if ((event.changes & NodeTracker::Change::Restarted) != 0)
+        {
+            invalidate(event.node.node_id);
+        }
+        if (event.node.is_online && (findInfo(event.node.node_id) == nullptr))
+        {
+            (void) query(event.node.node_id);
+        }
+    }
+
+    /// @brief Finds cached info of the given node.
+    ///
+    /// @return Pointer to the info, or `nullptr` if there is no info (yet) about the node.
+    ///
+    const Info* findInfo(const transport::NodeId node_id) const
+    {
+        const auto* const node_record = findRecord(node_id);
+        return ((node_record != nullptr) && (node_record->info.descriptor != nullptr)) ? &node_record->info : nullptr;
+    }
+
+    /// @brief Gets number of distinct descriptors (aka kinds of nodes) currently in use.
+    ///
+    std::size_t getDescriptorCount() const noexcept
+    {
+        return descriptor_count_;
+    }
+
+private:
+    using Client  = presentation::ServiceClient<Service>;
+    using Promise = presentation::ResponsePromise<Service::Response>;
+
+    enum class State : std::uint8_t
+    {
+        Idle,
+        Queued,
+        InFlight,
+    };
+
+    struct DescriptorRecord final : common::cavl::Node<DescriptorRecord>
+    {
+        explicit DescriptorRecord(const Descriptor& descriptor)
+            : descriptor{descriptor}
+        {
+        }
+
+        // MARK: Data members:
+
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        Descriptor  descriptor;
+        std::size_t ref_count{1};
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+    };
+
+    struct NodeRecord final : common::cavl::Node<NodeRecord>
+    {
+        explicit NodeRecord(const transport::NodeId node_id)
+        {
+            info.node_id = node_id;
+        }
+
+        std::int32_t compareByNodeId(const transport::NodeId node_id) const noexcept
+        {
+            return static_cast<std::int32_t>(node_id) - static_cast<std::int32_t>(info.node_id);
+        }
+
+        // MARK: Data members:
+
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        Info         info;
+        State        state{State::Idle};
+        bool         is_stale{false};
+        std::uint8_t attempts{0};
+        TimePoint    next_attempt_time{};
+        NodeRecord*  next_queued{nullptr};
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+    };
+
+    struct Slot
+    {
+        NodeRecord*             node_record{nullptr};
+        cetl::optional<Client>  client;
+        cetl::optional<Promise> promise;
+        bool                    is_done{false};
+    };
+
+    static std::size_t clampConcurrency(const std::size_t concurrency) noexcept
+    {
+        constexpr std::size_t MaxValue = MaxConcurrency;
+        return std::max<std::size_t>(1, std::min(concurrency, MaxValue));
+    }
+
+    /// Releases done slots, and issues queued queries (which are due) into free slots.
+    ///
+    void pump(const TimePoint approx_now)
+    {
+        for (std::size_t i = 0; i < concurrency_; ++i)
+        {
+            Slot& slot = slots_[i];  // NOLINT(*-pro-bounds-constant-array-index)
+            if (slot.is_done)
+            {
+                // Promises can't be released from within their own callbacks, so it's done here (on the next spin).
+                releaseSlot(slot);
+            }
+            if ((slot.node_record == nullptr) && (queue_head_ != nullptr) &&
+                (queue_head_->next_attempt_time <= approx_now))
+            {
+                NodeRecord& node_record = *queue_head_;
+                queue_head_             = node_record.next_queued;
+                node_record.next_queued = nullptr;
+                issueQuery(slot, node_record, approx_now);
+            }
+        }
+
+        // Retries are delayed - so the pump has to be repeated when the earliest one is due.
+        if ((queue_head_ != nullptr) && (queue_head_->next_attempt_time > approx_now))
+        {
+            schedulePump(queue_head_->next_attempt_time);
+        }
+    }
+
+    void issueQuery(Slot& slot, NodeRecord& node_record, const TimePoint approx_now)
+    {
+        auto maybe_client = presentation_.makeClient<Service>(node_record.info.node_id);
+        if (auto* const client = cetl::get_if<Client>(&maybe_client))
+        {
+            slot.client.emplace(std::move(*client));
+
+            auto maybe_promise = slot.client->request(approx_now + request_timeout_, request_);
+            if (auto* const promise = cetl::get_if<Promise>(&maybe_promise))
+            {
+                node_record.state = State::InFlight;
+                slot.node_record  = &node_record;
+                slot.promise.emplace(std::move(*promise));
+                slot.promise->setCallback([this, &slot](const auto& arg) {
+                    //
+                    onResponse(slot, arg.result, arg.approx_now);
+                });
+                return;
+            }
+            slot.client.reset();
+        }
+
+        // Failure to even start a query is treated as a failed attempt.
+        onFailure(node_record, approx_now);
+    }
+
+    void onResponse(Slot& slot, const Promise::Result& result, const TimePoint approx_now)
+    {
+        slot.is_done = true;
+        schedulePump(approx_now);
+
+        NodeRecord& node_record = *slot.node_record;
+        node_record.state       = State::Idle;
+        if (node_record.is_stale)
+        {
+            // The node has been invalidated while the query was in flight - the result can't be trusted.
+            node_record.is_stale = false;
+            node_record.attempts = 0;
+            enqueue(node_record, approx_now);
+            return;
+        }
+
+        if (const auto* const success = cetl::get_if<Promise::Success>(&result))
+        {
+            if (storeInfo(node_record, success->response))
+            {
+                node_record.attempts = 0;
+                notify(node_record.info.node_id, &node_record.info, approx_now);
+                return;
+            }
+        }
+        onFailure(node_record, approx_now);
+    }
+
+    void onFailure(NodeRecord& node_record, const TimePoint approx_now)
+    {
+        node_record.state = State::Idle;
+        ++node_record.attempts;
+        if (node_record.attempts < max_attempts_)
+        {
+            enqueue(node_record, approx_now + retry_delay_ * node_record.attempts);
+            return;
+        }
+
+        node_record.attempts = 0;
+        notify(node_record.info.node_id, nullptr, approx_now);
+    }
+
+    void notify(const transport::NodeId node_id, const Info* const info, const TimePoint approx_now) const
+    {
+        if (info_callback_fn_)
+        {
+            info_callback_fn_(InfoCallback::Arg{node_id, info, approx_now});
+        }
+    }
+
+    /// Inserts the node into the queue, which is ordered by the attempt time.
+    ///
+    /// Insertion is linear, but the queue is expected to be short (retries are rare, and new nodes go to its end).
+    ///
+    void enqueue(NodeRecord& node_record, const TimePoint attempt_time)
+    {
+        node_record.state             = State::Queued;
+        node_record.next_attempt_time = attempt_time;
+
+        NodeRecord** link = &queue_head_;
+        while ((*link != nullptr) && ((*link)->next_attempt_time <= attempt_time))
+        {
+            link = &(*link)->next_queued;
+        }
+        node_record.next_queued = *link;
+        *link                   = &node_record;
+    }
+
+    void schedulePump(const TimePoint exec_time)
+    {
+        const auto result = pump_cb_.schedule(IExecutor::Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void releaseSlot(Slot& slot)
+    {
+        slot.promise.reset();
+        slot.client.reset();
+        slot.node_record = nullptr;
+        slot.is_done     = false;
+    }
+
+    bool storeInfo(NodeRecord& node_record, const Service::Response& response)
+    {
+        Descriptor descriptor{};
+        descriptor.protocol_version         = {response.protocol_version.major, response.protocol_version.minor};
+        descriptor.hardware_version         = {response.hardware_version.major, response.hardware_version.minor};
+        descriptor.software_version         = {response.software_version.major, response.software_version.minor};
+        descriptor.software_vcs_revision_id = response.software_vcs_revision_id;
+        if (!response.software_image_crc.empty())
+        {
+            descriptor.software_image_crc = response.software_image_crc.front();
+        }
+        descriptor.name_size_ = static_cast<std::uint8_t>(std::min(response.name.size(), descriptor.name_chars_.size()));
+        (void) std::copy_n(response.name.begin(), descriptor.name_size_, descriptor.name_chars_.begin());
+
+        const Descriptor* const shared_descriptor = acquireDescriptor(descriptor);
+        if (shared_descriptor == nullptr)
+        {
+            return false;
+        }
+
+        releaseInfo(node_record);
+        node_record.info.unique_id  = response.unique_id;
+        node_record.info.descriptor = shared_descriptor;
+        return true;
+    }
+
+    void releaseInfo(NodeRecord& node_record)
+    {
+        if (const auto* const descriptor = std::exchange(node_record.info.descriptor, nullptr))
+        {
+            auto* const descriptor_record = descriptor_records_.search([descriptor](const DescriptorRecord& other) {
+                //
+                return compare(*descriptor, other.descriptor);
+            });
+            CETL_DEBUG_ASSERT(descriptor_record != nullptr, "");
+            if ((descriptor_record != nullptr) && (--descriptor_record->ref_count == 0))
+            {
+                descriptor_record->remove();
+                destroyRecord(descriptor_record);
+                --descriptor_count_;
+            }
+        }
+    }
+
+    const Descriptor* acquireDescriptor(const Descriptor& descriptor)
+    {
+        const auto descriptor_existing = descriptor_records_.search(
+            [&descriptor](const DescriptorRecord& other) {
+                //
+                return compare(descriptor, other.descriptor);
+            },
+            [this, &descriptor]() { return createRecord<DescriptorRecord>(descriptor); });
+
+        auto* const descriptor_record = std::get<0>(descriptor_existing);
+        if (descriptor_record == nullptr)
+        {
+            return nullptr;
+        }
+        if (std::get<1>(descriptor_existing))
+        {
+            ++descriptor_record->ref_count;
+        }
+        else
+        {
+            ++descriptor_count_;
+        }
+        return &descriptor_record->descriptor;
+    }
+
+    /// Orders descriptors by all their fields - in use to find (and so deduplicate) identical descriptors.
+    ///
+    static std::int32_t compare(const Descriptor& lhs, const Descriptor& rhs) noexcept
+    {
+        const auto key = [](const Descriptor& desc) {
+            //
+            return std::make_tuple(desc.protocol_version.major,
+                                   desc.protocol_version.minor,
+                                   desc.hardware_version.major,
+                                   desc.hardware_version.minor,
+                                   desc.software_version.major,
+                                   desc.software_version.minor,
+                                   desc.software_vcs_revision_id,
+                                   desc.software_image_crc.has_value(),
+                                   desc.software_image_crc.value_or(0),
+                                   desc.name_size_);
+        };
+        const auto lhs_key = key(lhs);
+        const auto rhs_key = key(rhs);
+        if (lhs_key != rhs_key)
+        {
+            return (lhs_key < rhs_key) ? -1 : +1;
+        }
+        return std::memcmp(lhs.name_chars_.data(), rhs.name_chars_.data(), lhs.name_size_);
+    }
+
+    NodeRecord* findRecord(const transport::NodeId node_id) const
+    {
+        // No Sonar cpp:S859 "A cast shall not remove any const or volatile qualification..."
+        // B/c records are owned by this cache, and const-ness of the lookup doesn't matter.
+        return const_cast<NodeRecord*>(  // NOSONAR cpp:S859
+            node_records_.search([node_id](const NodeRecord& other) {
+                //
+                return other.compareByNodeId(node_id);
+            }));
+    }
+
+    NodeRecord* findOrCreateRecord(const transport::NodeId node_id)
+    {
+        const auto node_existing = node_records_.search(
+            [node_id](const NodeRecord& other) {
+                //
+                return other.compareByNodeId(node_id);
+            },
+            [this, node_id]() { return createRecord<NodeRecord>(node_id); });
+
+        return std::get<0>(node_existing);
+    }
+
+    template <typename Record, typename... Args>
+    Record* createRecord(Args&&... args)
+    {
+        libcyphal::detail::PmrAllocator<Record> allocator{&presentation_.memory()};
+
+        auto* const record = allocator.allocate(1);
+        if (record != nullptr)
+        {
+            allocator.construct(record, std::forward<Args>(args)...);
+        }
+        return record;
+    }
+
+    template <typename Record>
+    void destroyRecord(Record* const record)
+    {
+        // No Sonar
+        // - cpp:S3432   "Destructors should not be called explicitly"
+        // - cpp:M23_329 "Advanced memory management" shall not be used"
+        // b/c we do our own low-level PMR management here.
+        record->~Record();  // NOSONAR cpp:S3432 cpp:M23_329
+        libcyphal::detail::PmrAllocator<Record>{&presentation_.memory()}.deallocate(record, 1);
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&          presentation_;
+    const std::size_t                    concurrency_;
+    const Service::Request               request_;
+    Duration                             request_timeout_{std::chrono::seconds{1}};
+    Duration                             retry_delay_{std::chrono::seconds{1}};
+    std::uint8_t                         max_attempts_{3};
+    common::cavl::Tree<NodeRecord>       node_records_;
+    common::cavl::Tree<DescriptorRecord> descriptor_records_;
+    std::size_t                          descriptor_count_{0};
+    NodeRecord*                          queue_head_{nullptr};
+    std::array<Slot, MaxConcurrency>     slots_;
+    InfoCallback::Function               info_callback_fn_;
+    IExecutor::Callback::Any             pump_cb_;
+
+};  // NodeInfoCache
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_NODE_INFO_CACHE_HPP_INCLUDED
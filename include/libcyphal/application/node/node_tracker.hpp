@@ -0,0 +1,593 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_NODE_TRACKER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_NODE_TRACKER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <uavcan/node/Heartbeat_1_0.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Node Tracker' component for the application node.
+///
+/// The tracker is the consumer side counterpart of the `HeartbeatProducer` - it subscribes to 'Heartbeat' messages,
+/// and keeps track of the remote nodes state (last seen time, health, mode, uptime, restarts and online status).
+///
+/// Implementation notes:
+/// - States of nodes with IDs below `config::Application::Node::NodeTracker_FlatCapacity()` (the whole CAN range
+///   by default) are kept in a flat array indexed by node ID, so that they are found in O(1) without any allocation.
+///   States of nodes with bigger IDs (UDP) are allocated on the first heartbeat, and kept in an AVL tree.
+///   Once known, a node state is kept until the tracker is destroyed (even if the node goes offline).
+/// - Online nodes are linked in the "least recently seen first" order, so offline detection is done by a single
+///   executor callback, which is scheduled to the deadline of the least recently seen node only -
+///   there is no timer per node, and a heartbeat just relinks its node to the end of the list.
+/// - Node changes are not reported immediately from the heartbeat reception, but accumulated, and reported
+///   in a batch on the next executor spin. Multiple changes of the same node in between are merged into
+///   a single event (with combined change flags).
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the callbacks,
+/// and custom destructor to release states of nodes allocated on demand.
+///
+class NodeTracker final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the Heartbeat.
+    ///
+    using Message = uavcan::node::Heartbeat_1_0;
+
+    /// @brief Defines flags of node changes reported by the event callback.
+    ///
+    struct Change
+    {
+        /// The node has become online (either for the first time, or after being offline).
+        static constexpr std::uint8_t Online = 1U << 0U;
+
+        /// The node has not published heartbeats for the offline timeout.
+        static constexpr std::uint8_t Offline = 1U << 1U;
+
+        /// The node uptime has gone backwards, so the node has been restarted.
+        static constexpr std::uint8_t Restarted = 1U << 2U;
+
+        /// The node health has changed.
+        static constexpr std::uint8_t Health = 1U << 3U;
+
+        /// The node mode has changed.
+        static constexpr std::uint8_t Mode = 1U << 4U;
+    };
+
+    /// @brief Defines the tracked state of a remote node.
+    ///
+    struct NodeState
+    {
+        /// Holds the node ID.
+        transport::NodeId node_id{};
+
+        /// Holds reception time of the latest heartbeat.
+        TimePoint last_seen{};
+
+        /// Holds the node uptime (in seconds) from the latest heartbeat.
+        std::uint32_t uptime{0};
+
+        /// Holds the `uavcan.node.Health.1.0` value from the latest heartbeat.
+        std::uint8_t health{0};
+
+        /// Holds the `uavcan.node.Mode.1.0` value from the latest heartbeat.
+        std::uint8_t mode{0};
+
+        /// Holds the vendor specific status code from the latest heartbeat.
+        std::uint8_t vendor_specific_status_code{0};
+
+        /// Holds the online status of the node.
+        bool is_online{false};
+
+        /// Holds the number of detected restarts of the node.
+        std::uint32_t restart_count{0};
+    };
+
+    /// @brief Umbrella type for node change event entities.
+    ///
+    struct EventCallback
+    {
+        /// @brief Defines standard arguments for node change event callback.
+        ///
+        struct Arg
+        {
+            /// Holds the current (latest) state of the changed node.
+            const NodeState& node;
+
+            /// Holds combination of `Change` flags accumulated since the previous event of the node.
+            /// Note that opposite flags (like `Online | Offline`) are possible - the `node` state tells the final one.
+            std::uint8_t changes;
+
+            /// Holds the approximate time when the batch of events is reported.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the node change event callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Node::NodeTracker_EventCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Factory method to create a NodeTracker instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Heartbeat' subscriber.
+    /// @return The NodeTracker instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<NodeTracker, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_heartbeat_sub = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_heartbeat_sub))
+        {
+            return std::move(*failure);
+        }
+
+        return NodeTracker{presentation, cetl::get<Subscriber>(std::move(maybe_heartbeat_sub))};
+    }
+
+    NodeTracker(NodeTracker&& other) noexcept
+        : presentation_{other.presentation_}
+        , subscriber_{std::move(other.subscriber_)}
+        , offline_timeout_{other.offline_timeout_}
+        , flat_entries_{other.flat_entries_}
+        , tree_entries_{std::move(other.tree_entries_)}
+        , online_list_{other.online_list_}
+        , changed_list_{other.changed_list_}
+        , online_count_{other.online_count_}
+        , event_callback_fn_{std::move(other.event_callback_fn_)}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move executor callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start (if needed) in the new one.
+        other.sweep_cb_.reset();
+        other.flush_cb_.reset();
+        other.online_list_  = {};
+        other.changed_list_ = {};
+        other.online_count_ = 0;
+
+        setupCallbacks();
+        if (online_list_.head != InvalidNodeId)
+        {
+            scheduleSweep(entryAt(online_list_.head).state.last_seen + offline_timeout_);
+        }
+        if (changed_list_.head != InvalidNodeId)
+        {
+            scheduleFlush();
+        }
+    }
+
+    ~NodeTracker()
+    {
+        while (auto* const tree_entry = tree_entries_.min())
+        {
+            tree_entry->remove();
+
+            // No Sonar
+            // - cpp:S3432   "Destructors should not be called explicitly"
+            // - cpp:M23_329 "Advanced memory management" shall not be used"
+            // b/c we do our own low-level PMR management here.
+            tree_entry->~TreeEntry();  // NOSONAR cpp:S3432 cpp:M23_329
+            TreeEntryAllocator{&presentation_.memory()}.deallocate(tree_entry, 1);
+        }
+    }
+
+    NodeTracker(const NodeTracker&)                = delete;
+    NodeTracker& operator=(const NodeTracker&)     = delete;
+    NodeTracker& operator=(NodeTracker&&) noexcept = delete;
+
+    /// @brief Sets the node change event callback.
+    ///
+    /// @param event_callback_fn The function to call (on the next executor spin) for every changed node.
+    ///
+    void setEventCallback(EventCallback::Function&& event_callback_fn)
+    {
+        event_callback_fn_ = std::move(event_callback_fn);
+    }
+
+    /// @brief Sets the offline timeout (default is `Heartbeat.1.0.OFFLINE_TIMEOUT`, which is 3s).
+    ///
+    /// @param timeout Duration without heartbeats after which a node is considered offline.
+    ///                Applied to the next offline check.
+    ///
+    void setOfflineTimeout(const Duration timeout) noexcept
+    {
+        offline_timeout_ = timeout;
+    }
+
+    /// @brief Sets the node error handler, which is notified about nodes which can't be tracked (out of memory).
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the tracker.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+    /// @brief Finds state of the given node.
+    ///
+    /// @return Pointer to the node state, or `nullptr` if the node has never been seen.
+    ///
+    const NodeState* findNode(const transport::NodeId node_id) const
+    {
+        const Entry* const entry = findEntry(node_id);
+        return (entry != nullptr) ? &entry->state : nullptr;
+    }
+
+    /// @brief Gets number of currently online nodes.
+    ///
+    std::size_t getOnlineCount() const noexcept
+    {
+        return online_count_;
+    }
+
+    /// @brief Visits all currently online nodes - from the least recently seen to the most recently seen one.
+    ///
+    /// @param visitor The visitor to call with every online node state (as `const NodeState&`).
+    ///
+    template <typename Visitor>
+    void visitOnlineNodes(const Visitor& visitor) const
+    {
+        for (auto node_id = online_list_.head; node_id != InvalidNodeId;)
+        {
+            const Entry& entry = entryAt(node_id);
+            node_id            = entry.next_online;
+            visitor(entry.state);
+        }
+    }
+
+private:
+    using Callback   = IExecutor::Callback;
+    using Subscriber = presentation::Subscriber<Message>;
+
+    struct TreeEntry;
+    using TreeEntryAllocator = libcyphal::detail::PmrAllocator<TreeEntry>;
+
+    static constexpr transport::NodeId InvalidNodeId = std::numeric_limits<transport::NodeId>::max();
+    static constexpr std::size_t       FlatCapacity  = config::Application::Node::NodeTracker_FlatCapacity();
+
+    /// Holds node state, and links of the node in the online (doubly linked) and changed (singly linked) lists.
+    ///
+    /// Links are node IDs (rather than pointers), so that the flat array of entries could be moved together
+    /// with the tracker.
+    ///
+    struct Entry
+    {
+        NodeState         state;
+        bool              is_known{false};
+        std::uint8_t      changes{0};
+        transport::NodeId prev_online{InvalidNodeId};
+        transport::NodeId next_online{InvalidNodeId};
+        transport::NodeId next_changed{InvalidNodeId};
+    };
+
+    struct TreeEntry final : common::cavl::Node<TreeEntry>
+    {
+        explicit TreeEntry(const transport::NodeId node_id)
+        {
+            entry.state.node_id = node_id;
+        }
+
+        std::int32_t compareByNodeId(const transport::NodeId node_id) const noexcept
+        {
+            return static_cast<std::int32_t>(node_id) - static_cast<std::int32_t>(entry.state.node_id);
+        }
+
+        // MARK: Data members:
+
+        Entry entry;  // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    struct List
+    {
+        transport::NodeId head{InvalidNodeId};
+        transport::NodeId tail{InvalidNodeId};
+    };
+
+    NodeTracker(presentation::Presentation& presentation, Subscriber&& subscriber)
+        : presentation_{presentation}
+        , subscriber_{std::move(subscriber)}
+        , offline_timeout_{getDefaultOfflineTimeout()}
+    {
+        for (std::size_t index = 0; index < FlatCapacity; ++index)
+        {
+            flat_entries_[index].state.node_id = static_cast<transport::NodeId>(index);  // NOLINT
+        }
+
+        setupCallbacks();
+    }
+
+    static constexpr Duration getDefaultOfflineTimeout()
+    {
+        constexpr std::uint16_t OfflineTimeoutSecs = Message::OFFLINE_TIMEOUT;
+        return std::chrono::seconds{OfflineTimeoutSecs};
+    }
+
+    void setupCallbacks()
+    {
+        subscriber_.setOnReceiveCallback([this](const auto& arg) {
+            //
+            // Anonymous nodes can't be tracked.
+            if (arg.metadata.publisher_node_id)
+            {
+                onHeartbeat(*arg.metadata.publisher_node_id, arg.message, arg.metadata.rx_meta.timestamp);
+            }
+        });
+
+        sweep_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            sweepOfflineNodes(arg.approx_now);
+        });
+        flush_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            flushChanges(arg.approx_now);
+        });
+    }
+
+    void onHeartbeat(const transport::NodeId node_id, const Message& message, const TimePoint timestamp)
+    {
+        Entry* const entry = findOrCreateEntry(node_id);
+        if (entry == nullptr)
+        {
+            // Out of memory - the node can't be tracked (until the next heartbeat).
+            error_reporter_.report(ErrorHandler::Kind::Memory, ErrorHandler::Origin::Internal);
+            return;
+        }
+        NodeState& state = entry->state;
+
+        std::uint8_t changes = 0;
+        if (entry->is_known && (message.uptime < state.uptime))
+        {
+            changes |= Change::Restarted;
+            ++state.restart_count;
+        }
+        if (state.is_online)
+        {
+            changes |= (message.health.value != state.health) ? Change::Health : 0U;
+            changes |= (message.mode.value != state.mode) ? Change::Mode : 0U;
+            unlinkOnline(*entry);
+        }
+        else
+        {
+            changes |= Change::Online;
+            state.is_online = true;
+            ++online_count_;
+        }
+        entry->is_known = true;
+
+        state.last_seen                   = timestamp;
+        state.uptime                      = message.uptime;
+        state.health                      = message.health.value;
+        state.mode                        = message.mode.value;
+        state.vendor_specific_status_code = message.vendor_specific_status_code;
+
+        // The least recently seen node defines when the next offline check should happen. So, only if this node
+        // is the only online one, the check has to be rescheduled - otherwise it's already scheduled earlier.
+        appendOnline(*entry);
+        if (online_list_.head == node_id)
+        {
+            scheduleSweep(timestamp + offline_timeout_);
+        }
+
+        addChanges(*entry, changes);
+    }
+
+    void sweepOfflineNodes(const TimePoint approx_now)
+    {
+        while (online_list_.head != InvalidNodeId)
+        {
+            Entry&          entry    = entryAt(online_list_.head);
+            const TimePoint deadline = entry.state.last_seen + offline_timeout_;
+            if (deadline > approx_now)
+            {
+                scheduleSweep(deadline);
+                break;
+            }
+
+            unlinkOnline(entry);
+            entry.state.is_online = false;
+            --online_count_;
+            addChanges(entry, Change::Offline);
+        }
+    }
+
+    void flushChanges(const TimePoint approx_now)
+    {
+        while (changed_list_.head != InvalidNodeId)
+        {
+            Entry& entry       = entryAt(changed_list_.head);
+            changed_list_.head = entry.next_changed;
+            entry.next_changed = InvalidNodeId;
+            const auto changes = std::exchange(entry.changes, 0);
+            if (event_callback_fn_)
+            {
+                event_callback_fn_(EventCallback::Arg{entry.state, changes, approx_now});
+            }
+        }
+        changed_list_.tail = InvalidNodeId;
+    }
+
+    void addChanges(Entry& entry, const std::uint8_t changes)
+    {
+        if (changes == 0)
+        {
+            return;
+        }
+
+        // Not yet reported changes of the same node are merged.
+        if (entry.changes == 0)
+        {
+            if (changed_list_.tail == InvalidNodeId)
+            {
+                changed_list_.head = entry.state.node_id;
+                scheduleFlush();
+            }
+            else
+            {
+                entryAt(changed_list_.tail).next_changed = entry.state.node_id;
+            }
+            changed_list_.tail = entry.state.node_id;
+        }
+        entry.changes |= changes;
+    }
+
+    void appendOnline(Entry& entry)
+    {
+        entry.prev_online = online_list_.tail;
+        entry.next_online = InvalidNodeId;
+        if (online_list_.tail == InvalidNodeId)
+        {
+            online_list_.head = entry.state.node_id;
+        }
+        else
+        {
+            entryAt(online_list_.tail).next_online = entry.state.node_id;
+        }
+        online_list_.tail = entry.state.node_id;
+    }
+
+    void unlinkOnline(Entry& entry)
+    {
+        if (entry.prev_online == InvalidNodeId)
+        {
+            online_list_.head = entry.next_online;
+        }
+        else
+        {
+            entryAt(entry.prev_online).next_online = entry.next_online;
+        }
+        if (entry.next_online == InvalidNodeId)
+        {
+            online_list_.tail = entry.prev_online;
+        }
+        else
+        {
+            entryAt(entry.next_online).prev_online = entry.prev_online;
+        }
+        entry.prev_online = InvalidNodeId;
+        entry.next_online = InvalidNodeId;
+    }
+
+    void scheduleSweep(const TimePoint exec_time)
+    {
+        const auto result = sweep_cb_.schedule(Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void scheduleFlush()
+    {
+        const auto result = flush_cb_.schedule(Callback::Schedule::Once{presentation_.executor().now()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    const Entry* findEntry(const transport::NodeId node_id) const
+    {
+        if (node_id < FlatCapacity)
+        {
+            const Entry& entry = flat_entries_[node_id];  // NOLINT(*-pro-bounds-constant-array-index)
+            return entry.is_known ? &entry : nullptr;
+        }
+
+        const auto* const tree_entry = tree_entries_.search([node_id](const TreeEntry& other) {
+            //
+            return other.compareByNodeId(node_id);
+        });
+        return (tree_entry != nullptr) ? &tree_entry->entry : nullptr;
+    }
+
+    /// Gets entry of a node which is known to be linked into one of the lists.
+    ///
+    Entry& entryAt(const transport::NodeId node_id)
+    {
+        // No Sonar cpp:S859 "A cast shall not remove any const or volatile qualification..."
+        // B/c the entry is owned by this (non-const) tracker.
+        return const_cast<Entry&>(static_cast<const NodeTracker*>(this)->entryAt(node_id));  // NOSONAR cpp:S859
+    }
+
+    const Entry& entryAt(const transport::NodeId node_id) const
+    {
+        const Entry* const entry = findEntry(node_id);
+        CETL_DEBUG_ASSERT(entry != nullptr, "Linked node entry is expected to exist.");
+        return *entry;  // NOLINT(clang-analyzer-core.NullDereference)
+    }
+
+    Entry* findOrCreateEntry(const transport::NodeId node_id)
+    {
+        if (node_id < FlatCapacity)
+        {
+            return &flat_entries_[node_id];  // NOLINT(*-pro-bounds-constant-array-index)
+        }
+
+        const auto tree_entry_existing = tree_entries_.search(
+            [node_id](const TreeEntry& other) {
+                //
+                return other.compareByNodeId(node_id);
+            },
+            [this, node_id]() -> TreeEntry* {
+                //
+                TreeEntryAllocator allocator{&presentation_.memory()};
+                auto* const        tree_entry = allocator.allocate(1);
+                if (tree_entry != nullptr)
+                {
+                    allocator.construct(tree_entry, node_id);
+                }
+                return tree_entry;
+            });
+
+        auto* const tree_entry = std::get<0>(tree_entry_existing);
+        return (tree_entry != nullptr) ? &tree_entry->entry : nullptr;
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&     presentation_;
+    Subscriber                      subscriber_;
+    Duration                        offline_timeout_;
+    std::array<Entry, FlatCapacity> flat_entries_{};
+    common::cavl::Tree<TreeEntry>   tree_entries_;
+    List                            online_list_;
+    List                            changed_list_;
+    std::size_t                     online_count_{0};
+    EventCallback::Function         event_callback_fn_;
+    ErrorReporter                   error_reporter_;
+    Callback::Any                   sweep_cb_;
+    Callback::Any                   flush_cb_;
+
+};  // NodeTracker
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_NODE_TRACKER_HPP_INCLUDED
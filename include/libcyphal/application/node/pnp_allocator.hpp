@@ -0,0 +1,551 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_PNP_ALLOCATOR_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_PNP_ALLOCATOR_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/platform/storage.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/pnp/NodeIDAllocationData_1_0.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Plug-and-Play Node ID Allocator' component for the application node.
+///
+/// The allocator serves `uavcan.pnp.NodeIDAllocationData.1.0` requests of anonymous nodes: every unique ID hash
+/// gets its own node ID, which stays the same for all subsequent requests (even after restart of the allocator).
+/// Node IDs are allocated from the top of the range down, as recommended by the specification.
+///
+/// Implementation notes:
+/// - Allocations are kept in a flat table indexed by node ID, plus an open addressing hash index (twice as big as
+///   the table) keyed by unique ID hash. So, a request is served in O(1) without any memory allocation,
+///   regardless of the number of already allocated nodes. Allocations are never released, so the index
+///   doesn't need tombstones.
+/// - Every allocation is persisted as a separate key-value storage entry (keyed by node ID), so only new
+///   allocations are written. The whole table is loaded once by the factory method.
+/// - Responses are not published immediately from the request reception, but queued, and published in batches
+///   (at most `Options::max_batch_size` per `Options::batch_period`) on the executor spins. Repeated requests
+///   of the same node are merged into a single response. New allocations of a batch are persisted before
+///   their responses are published, so a node ID is never announced before it's stored.
+///   Shall storage fail, the batch is retried after `Options::batch_period`.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the callbacks.
+///
+class PnpAllocator final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the PnP node ID allocation (both requests and responses).
+    ///
+    using Message = uavcan::pnp::NodeIDAllocationData_1_0;
+
+    /// @brief Defines mask of the significant (lower 48) bits of the unique ID hash.
+    ///
+    static constexpr std::uint64_t UniqueIdHashMask = (1ULL << 48U) - 1U;
+
+    /// @brief Defines tuning options of the allocator.
+    ///
+    struct Options
+    {
+        /// The lowest node ID which could be allocated.
+        transport::NodeId min_node_id{1};
+
+        /// The highest node ID which could be allocated. Limited by `PnpAllocator_Capacity - 1`.
+        /// By default, CAN node IDs 126 and 127 are excluded (reserved for diagnostic and debugging tools).
+        transport::NodeId max_node_id{125};
+
+        /// Max number of responses published per batch.
+        std::size_t max_batch_size{16};
+
+        /// Delay between consecutive batches (and between retries of a failed storage write).
+        Duration batch_period{std::chrono::milliseconds{10}};
+
+        /// Timeout of a response publication.
+        Duration response_timeout{std::chrono::seconds{1}};
+    };
+
+    /// @brief Factory method to create a PnpAllocator instance with default options.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'NodeIDAllocationData'
+    ///                     publisher and subscriber.
+    /// @param key_value The key-value storage to load and persist allocations.
+    ///                  Should outlive the allocator. Its blocking `put` is called once per new allocation.
+    /// @return The PnpAllocator instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, platform::storage::IKeyValue& key_value)
+        -> Expected<PnpAllocator, presentation::Presentation::MakeFailure>
+    {
+        return make(presentation, key_value, Options{});
+    }
+
+    /// @brief Factory method to create a PnpAllocator instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'NodeIDAllocationData'
+    ///                     publisher and subscriber.
+    /// @param key_value The key-value storage to load and persist allocations.
+    ///                  Should outlive the allocator. Its blocking `put` is called once per new allocation.
+    /// @param options The tuning options of the allocator.
+    /// @return The PnpAllocator instance or a failure.
+    ///
+    static auto make(presentation::Presentation&   presentation,
+                     platform::storage::IKeyValue& key_value,
+                     const Options&                options)
+        -> Expected<PnpAllocator, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_subscriber = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_subscriber))
+        {
+            return std::move(*failure);
+        }
+        auto maybe_publisher = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_publisher))
+        {
+            return std::move(*failure);
+        }
+
+        return PnpAllocator{presentation,
+                            key_value,
+                            options,
+                            cetl::get<Subscriber>(std::move(maybe_subscriber)),
+                            cetl::get<Publisher>(std::move(maybe_publisher))};
+    }
+
+    PnpAllocator(PnpAllocator&& other) noexcept
+        : presentation_{other.presentation_}
+        , key_value_{other.key_value_}
+        , options_{other.options_}
+        , subscriber_{std::move(other.subscriber_)}
+        , publisher_{std::move(other.publisher_)}
+        , message_{std::move(other.message_)}
+        , entries_{other.entries_}
+        , hash_index_{other.hash_index_}
+        , pending_list_{other.pending_list_}
+        , next_candidate_{other.next_candidate_}
+        , allocated_count_{other.allocated_count_}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move executor callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start (if needed) in the new one.
+        other.flush_cb_.reset();
+        other.pending_list_ = {};
+
+        setupCallbacks();
+        if (pending_list_.head != InvalidNodeId)
+        {
+            scheduleFlush(presentation_.executor().now());
+        }
+    }
+
+    ~PnpAllocator() = default;
+
+    PnpAllocator(const PnpAllocator&)                = delete;
+    PnpAllocator& operator=(const PnpAllocator&)     = delete;
+    PnpAllocator& operator=(PnpAllocator&&) noexcept = delete;
+
+    /// @brief Finds node ID allocated to the given unique ID hash.
+    ///
+    /// @param unique_id_hash The unique ID hash (only lower 48 bits are significant).
+    /// @return The allocated node ID, or `cetl::nullopt` if there is no such allocation.
+    ///
+    cetl::optional<transport::NodeId> findNodeId(const std::uint64_t unique_id_hash) const noexcept
+    {
+        const auto node_id = findIndexed(unique_id_hash & UniqueIdHashMask);
+        if (node_id == InvalidNodeId)
+        {
+            return cetl::nullopt;
+        }
+        return node_id;
+    }
+
+    /// @brief Gets number of allocated node IDs (including the ones loaded from the storage).
+    ///
+    std::size_t getAllocatedCount() const noexcept
+    {
+        return allocated_count_;
+    }
+
+    /// @brief Excludes the given node ID from allocation.
+    ///
+    /// In use for node IDs which are known to be taken by other means - f.e. statically configured nodes,
+    /// or nodes discovered by their heartbeats (see `NodeTracker`). The local node ID is reserved automatically.
+    /// Already allocated (or out of the table capacity) node IDs are ignored.
+    ///
+    void reserveNodeId(const transport::NodeId node_id) noexcept
+    {
+        if (node_id < Capacity)
+        {
+            Entry& entry = entries_[node_id];  // NOLINT(*-pro-bounds-constant-array-index)
+            if (entry.state == State::Free)
+            {
+                entry.state = State::Reserved;
+            }
+        }
+    }
+
+    /// @brief Sets the node error handler, which is notified about exhaustion of the node ID range,
+    /// as well as about storage and publication failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the allocator.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+private:
+    using Callback   = IExecutor::Callback;
+    using Subscriber = presentation::Subscriber<Message>;
+    using Publisher  = presentation::Publisher<Message>;
+
+    static constexpr transport::NodeId InvalidNodeId = std::numeric_limits<transport::NodeId>::max();
+    static constexpr std::size_t       Capacity      = config::Application::Node::PnpAllocator_Capacity();
+    static constexpr std::size_t       IndexCapacity = Capacity * 2;
+
+    /// Persisted allocation is the unique ID hash (48 bits, little-endian) under "uavcan.pnp.<node_id>" key.
+    static constexpr std::size_t StoredHashSize = 6;
+    static constexpr std::size_t KeyCapacity    = 24;
+
+    enum class State : std::uint8_t
+    {
+        Free,
+        Reserved,
+        Allocated,
+    };
+
+    /// Holds allocation state of a node ID, and its link in the pending responses (singly linked) list.
+    ///
+    /// Links are node IDs (rather than pointers), so that the flat table could be moved together
+    /// with the allocator.
+    ///
+    struct Entry
+    {
+        std::uint64_t     unique_id_hash{0};
+        State             state{State::Free};
+        bool              is_dirty{false};
+        bool              is_pending{false};
+        transport::NodeId next_pending{InvalidNodeId};
+    };
+
+    struct List
+    {
+        transport::NodeId head{InvalidNodeId};
+        transport::NodeId tail{InvalidNodeId};
+    };
+
+    PnpAllocator(presentation::Presentation&   presentation,
+                 platform::storage::IKeyValue& key_value,
+                 const Options&                options,
+                 Subscriber&&                  subscriber,
+                 Publisher&&                   publisher)
+        : presentation_{presentation}
+        , key_value_{key_value}
+        , options_{options}
+        , subscriber_{std::move(subscriber)}
+        , publisher_{std::move(publisher)}
+        , message_{Message::allocator_type{&presentation.memory()}}
+    {
+        constexpr auto MaxNodeId = static_cast<transport::NodeId>(Capacity - 1);
+        if (options_.max_node_id > MaxNodeId)
+        {
+            options_.max_node_id = MaxNodeId;
+        }
+        next_candidate_ = options_.max_node_id;
+
+        // Local copy b/c `fill` would ODR-use the static constant (which is a problem in C++14).
+        constexpr auto EmptySlot = InvalidNodeId;
+        hash_index_.fill(EmptySlot);
+
+        loadAllocations();
+        if (const auto local_node_id = presentation.transport().getLocalNodeId())
+        {
+            reserveNodeId(*local_node_id);
+        }
+
+        setupCallbacks();
+    }
+
+    void setupCallbacks()
+    {
+        subscriber_.setOnReceiveCallback([this](const auto& arg) {
+            //
+            // Only requests of anonymous nodes are served. Responses of other allocators (if any) are ignored.
+            if (!arg.metadata.publisher_node_id && arg.message.allocated_node_id.empty())
+            {
+                onRequest(arg.message.unique_id_hash & UniqueIdHashMask);
+            }
+        });
+
+        flush_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            flushResponses(arg.approx_now);
+        });
+    }
+
+    void loadAllocations()
+    {
+        std::array<char, KeyCapacity>            key_buffer{};
+        std::array<std::uint8_t, StoredHashSize> value{};
+        for (std::int32_t node_id = options_.min_node_id; node_id <= options_.max_node_id; ++node_id)
+        {
+            Entry&     entry  = entries_[static_cast<std::size_t>(node_id)];  // NOLINT
+            const auto result = key_value_.get(makeKey(node_id, key_buffer), value);
+            if (const auto* const size = cetl::get_if<std::size_t>(&result))
+            {
+                std::uint64_t unique_id_hash = 0;
+                for (std::size_t i = StoredHashSize; i > 0; --i)
+                {
+                    unique_id_hash = (unique_id_hash << 8U) | value[i - 1];  // NOLINT
+                }
+                if ((*size == StoredHashSize) && (findIndexed(unique_id_hash) == InvalidNodeId))
+                {
+                    entry.state          = State::Allocated;
+                    entry.unique_id_hash = unique_id_hash;
+                    insertIndexed(static_cast<transport::NodeId>(node_id), unique_id_hash);
+                    ++allocated_count_;
+                    continue;
+                }
+            }
+            else if (cetl::get<platform::storage::Error>(result) == platform::storage::Error::Existence)
+            {
+                continue;
+            }
+
+            // Corrupted (or unreadable) allocation - the node ID might be in use, so it's never reallocated.
+            entry.state = State::Reserved;
+        }
+    }
+
+    void onRequest(const std::uint64_t unique_id_hash)
+    {
+        auto node_id = findIndexed(unique_id_hash);
+        if (node_id == InvalidNodeId)
+        {
+            node_id = allocateNodeId();
+            if (node_id == InvalidNodeId)
+            {
+                // The whole range is already allocated - there is nothing we can do.
+                error_reporter_.report(ErrorHandler::Kind::Capacity, ErrorHandler::Origin::Internal);
+                return;
+            }
+
+            Entry& entry         = entries_[node_id];  // NOLINT(*-pro-bounds-constant-array-index)
+            entry.state          = State::Allocated;
+            entry.unique_id_hash = unique_id_hash;
+            entry.is_dirty       = true;
+            insertIndexed(node_id, unique_id_hash);
+            ++allocated_count_;
+        }
+
+        enqueueResponse(node_id);
+    }
+
+    /// Finds the highest free node ID. Allocations are never released, so the search never goes back up.
+    ///
+    transport::NodeId allocateNodeId()
+    {
+        while (next_candidate_ >= options_.min_node_id)
+        {
+            const auto node_id = static_cast<transport::NodeId>(next_candidate_--);
+            if (entries_[node_id].state == State::Free)  // NOLINT(*-pro-bounds-constant-array-index)
+            {
+                return node_id;
+            }
+        }
+        return InvalidNodeId;
+    }
+
+    void enqueueResponse(const transport::NodeId node_id)
+    {
+        // Not yet published responses of the same node are merged.
+        Entry& entry = entries_[node_id];  // NOLINT(*-pro-bounds-constant-array-index)
+        if (entry.is_pending)
+        {
+            return;
+        }
+        entry.is_pending   = true;
+        entry.next_pending = InvalidNodeId;
+
+        // Non-empty list means that its flush is already scheduled (maybe to a later batch).
+        if (pending_list_.tail == InvalidNodeId)
+        {
+            pending_list_.head = node_id;
+            scheduleFlush(presentation_.executor().now());
+        }
+        else
+        {
+            entries_[pending_list_.tail].next_pending = node_id;  // NOLINT(*-pro-bounds-constant-array-index)
+        }
+        pending_list_.tail = node_id;
+    }
+
+    void flushResponses(const TimePoint approx_now)
+    {
+        for (std::size_t count = 0; (count < options_.max_batch_size) && (pending_list_.head != InvalidNodeId);
+             ++count)
+        {
+            const auto node_id = pending_list_.head;
+            Entry&     entry   = entries_[node_id];  // NOLINT(*-pro-bounds-constant-array-index)
+            if (entry.is_dirty)
+            {
+                if (!storeAllocation(node_id, entry.unique_id_hash))
+                {
+                    // The response will be retried (together with the rest of the list) on the next batch.
+                    error_reporter_.report(ErrorHandler::Kind::Storage, ErrorHandler::Origin::Internal);
+                    break;
+                }
+                entry.is_dirty = false;
+            }
+
+            pending_list_.head = entry.next_pending;
+            entry.next_pending = InvalidNodeId;
+            entry.is_pending   = false;
+
+            publishResponse(node_id, entry.unique_id_hash, approx_now);
+        }
+
+        if (pending_list_.head == InvalidNodeId)
+        {
+            pending_list_.tail = InvalidNodeId;
+            return;
+        }
+        scheduleFlush(approx_now + options_.batch_period);
+    }
+
+    bool storeAllocation(const transport::NodeId node_id, const std::uint64_t unique_id_hash)
+    {
+        std::array<char, KeyCapacity>            key_buffer{};
+        std::array<std::uint8_t, StoredHashSize> value{};
+        for (std::size_t i = 0; i < StoredHashSize; ++i)
+        {
+            value[i] = static_cast<std::uint8_t>(unique_id_hash >> (i * 8U));  // NOLINT
+        }
+        return !key_value_.put(makeKey(node_id, key_buffer), value).has_value();
+    }
+
+    void publishResponse(const transport::NodeId node_id, const std::uint64_t unique_id_hash, const TimePoint now)
+    {
+        message_.unique_id_hash = unique_id_hash;
+        message_.allocated_node_id.clear();
+        message_.allocated_node_id.emplace_back();
+        message_.allocated_node_id.back().value = node_id;
+
+        // There is nothing we can do about possible publishing failures - the node will just repeat its request.
+        error_reporter_.report(publisher_.publish(now + options_.response_timeout, message_),
+                               ErrorHandler::Origin::Publication,
+                               Message::_traits_::FixedPortId);
+    }
+
+    void scheduleFlush(const TimePoint exec_time)
+    {
+        const auto result = flush_cb_.schedule(Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    static std::size_t indexOf(const std::uint64_t unique_id_hash) noexcept
+    {
+        // Fibonacci hashing - the upper bits of the product are well mixed even for sequential hashes.
+        constexpr std::uint64_t Multiplier = 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>((unique_id_hash * Multiplier) >> 32U) % IndexCapacity;
+    }
+
+    /// The index is never full (it's twice as big as the table), so linear probing always hits an empty slot.
+    ///
+    transport::NodeId findIndexed(const std::uint64_t unique_id_hash) const noexcept
+    {
+        for (auto index = indexOf(unique_id_hash);; index = (index + 1) % IndexCapacity)
+        {
+            const auto node_id = hash_index_[index];  // NOLINT(*-pro-bounds-constant-array-index)
+            if (node_id == InvalidNodeId)
+            {
+                return InvalidNodeId;
+            }
+            if (entries_[node_id].unique_id_hash == unique_id_hash)  // NOLINT(*-pro-bounds-constant-array-index)
+            {
+                return node_id;
+            }
+        }
+    }
+
+    void insertIndexed(const transport::NodeId node_id, const std::uint64_t unique_id_hash) noexcept
+    {
+        auto index = indexOf(unique_id_hash);
+        while (hash_index_[index] != InvalidNodeId)  // NOLINT(*-pro-bounds-constant-array-index)
+        {
+            index = (index + 1) % IndexCapacity;
+        }
+        hash_index_[index] = node_id;  // NOLINT(*-pro-bounds-constant-array-index)
+    }
+
+    static cetl::string_view makeKey(const std::int32_t node_id, std::array<char, KeyCapacity>& buffer) noexcept
+    {
+        const cetl::string_view Prefix{"uavcan.pnp."};
+        std::size_t             size = 0;
+        for (const char ch : Prefix)
+        {
+            buffer[size++] = ch;  // NOLINT(*-pro-bounds-constant-array-index)
+        }
+
+        std::array<char, 5> digits{};  // enough for any 16-bit node ID
+        std::size_t         digits_count = 0;
+        auto                value        = static_cast<std::uint32_t>(node_id);
+        do
+        {
+            digits[digits_count++] = static_cast<char>('0' + (value % 10U));  // NOLINT
+            value /= 10U;
+        } while (value > 0U);
+        while (digits_count > 0)
+        {
+            buffer[size++] = digits[--digits_count];  // NOLINT(*-pro-bounds-constant-array-index)
+        }
+        return {buffer.data(), size};
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&                  presentation_;
+    platform::storage::IKeyValue&                key_value_;
+    Options                                      options_;
+    Subscriber                                   subscriber_;
+    Publisher                                    publisher_;
+    Message                                      message_;
+    std::array<Entry, Capacity>                  entries_{};
+    std::array<transport::NodeId, IndexCapacity> hash_index_{};
+    List                                         pending_list_;
+    std::int32_t                                 next_candidate_{0};
+    std::size_t                                  allocated_count_{0};
+    ErrorReporter                                error_reporter_;
+    Callback::Any                                flush_cb_;
+
+};  // PnpAllocator
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_PNP_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,346 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_PNP_CLIENT_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_PNP_CLIENT_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/common/crc.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <uavcan/pnp/NodeIDAllocationData_1_0.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Plug-and-Play Node ID Client' component for the (anonymous) application node.
+///
+/// The client repeatedly publishes `uavcan.pnp.NodeIDAllocationData.1.0` requests (with the hash of the node
+/// unique ID) until an allocator responds with the allocated node ID. The node ID is reported via the allocation
+/// callback - it's up to the user to assign it to the transport (see `ITransport::setLocalNodeId`).
+///
+/// Requests are repeated with randomized exponential backoff: delay before the N-th request is a random value
+/// in the `[D/2, D]` range, where `D = min(initial_delay * 2^N, max_delay)`. So, after a power loss, all anonymous
+/// nodes booting at once spread their requests over time (and back off further while the allocator is busy),
+/// instead of saturating the bus. The pseudo-random sequence is seeded by the unique ID, so it differs per node.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the callbacks.
+///
+class PnpClient final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the PnP node ID allocation (both requests and responses).
+    ///
+    using Message = uavcan::pnp::NodeIDAllocationData_1_0;
+
+    /// @brief Defines the unique ID type of the node (see `uavcan.node.GetInfo.1.0`).
+    ///
+    using UniqueId = std::array<std::uint8_t, 16>;
+
+    /// @brief Defines mask of the significant (lower 48) bits of the unique ID hash.
+    ///
+    static constexpr std::uint64_t UniqueIdHashMask = (1ULL << 48U) - 1U;
+
+    /// @brief Defines tuning options of the client.
+    ///
+    struct Options
+    {
+        /// Upper bound of the delay before the very first request.
+        Duration initial_delay{std::chrono::seconds{1}};
+
+        /// Upper bound of the delay between requests (the backoff stops growing at this value).
+        Duration max_delay{std::chrono::seconds{16}};
+
+        /// Timeout of a request publication.
+        Duration request_timeout{std::chrono::seconds{1}};
+    };
+
+    /// @brief Umbrella type for allocation notification entities.
+    ///
+    struct AllocationCallback
+    {
+        /// @brief Defines standard arguments for the allocation callback.
+        ///
+        struct Arg
+        {
+            /// Holds the allocated node ID.
+            transport::NodeId node_id;
+
+            /// Holds the approximate time when the allocation has been received.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the allocation callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Node::PnpClient_AllocationCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Computes 48-bit hash of the unique ID (lower bits of its CRC-64-WE).
+    ///
+    static std::uint64_t computeUniqueIdHash(const UniqueId& unique_id) noexcept
+    {
+        const common::CRC64WE crc64{unique_id.data(), unique_id.data() + unique_id.size()};
+        return crc64.get() & UniqueIdHashMask;
+    }
+
+    /// @brief Factory method to create a PnpClient instance with default options.
+    ///
+    /// Requesting starts immediately (after the first randomized delay).
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'NodeIDAllocationData'
+    ///                     publisher and subscriber.
+    /// @param unique_id The unique ID of the local node.
+    /// @return The PnpClient instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, const UniqueId& unique_id)
+        -> Expected<PnpClient, presentation::Presentation::MakeFailure>
+    {
+        return make(presentation, unique_id, Options{});
+    }
+
+    /// @brief Factory method to create a PnpClient instance.
+    ///
+    /// Requesting starts immediately (after the first randomized delay).
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'NodeIDAllocationData'
+    ///                     publisher and subscriber.
+    /// @param unique_id The unique ID of the local node.
+    /// @param options The tuning options of the client.
+    /// @return The PnpClient instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, const UniqueId& unique_id, const Options& options)
+        -> Expected<PnpClient, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_subscriber = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_subscriber))
+        {
+            return std::move(*failure);
+        }
+        auto maybe_publisher = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_publisher))
+        {
+            return std::move(*failure);
+        }
+
+        return PnpClient{presentation,
+                         computeUniqueIdHash(unique_id),
+                         options,
+                         cetl::get<Subscriber>(std::move(maybe_subscriber)),
+                         cetl::get<Publisher>(std::move(maybe_publisher))};
+    }
+
+    PnpClient(PnpClient&& other) noexcept
+        : presentation_{other.presentation_}
+        , unique_id_hash_{other.unique_id_hash_}
+        , options_{other.options_}
+        , subscriber_{std::move(other.subscriber_)}
+        , publisher_{std::move(other.publisher_)}
+        , message_{std::move(other.message_)}
+        , random_state_{other.random_state_}
+        , max_delay_{other.max_delay_}
+        , next_request_time_{other.next_request_time_}
+        , allocated_node_id_{other.allocated_node_id_}
+        , allocation_callback_fn_{std::move(other.allocation_callback_fn_)}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move executor callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start (if needed) in the new one.
+        other.request_cb_.reset();
+
+        setupCallbacks();
+        if (!allocated_node_id_)
+        {
+            scheduleRequest(next_request_time_);
+        }
+    }
+
+    ~PnpClient() = default;
+
+    PnpClient(const PnpClient&)                = delete;
+    PnpClient& operator=(const PnpClient&)     = delete;
+    PnpClient& operator=(PnpClient&&) noexcept = delete;
+
+    /// @brief Sets the allocation callback.
+    ///
+    /// @param allocation_callback_fn The function to call (once) when the node ID has been allocated.
+    ///
+    void setAllocationCallback(AllocationCallback::Function&& allocation_callback_fn)
+    {
+        allocation_callback_fn_ = std::move(allocation_callback_fn);
+    }
+
+    /// @brief Sets the node error handler, which is notified about request publication failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the client.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+    /// @brief Gets the allocated node ID (if any yet).
+    ///
+    cetl::optional<transport::NodeId> getAllocatedNodeId() const noexcept
+    {
+        return allocated_node_id_;
+    }
+
+    /// @brief Gets the unique ID hash which is sent in requests.
+    ///
+    std::uint64_t getUniqueIdHash() const noexcept
+    {
+        return unique_id_hash_;
+    }
+
+private:
+    using Callback   = IExecutor::Callback;
+    using Subscriber = presentation::Subscriber<Message>;
+    using Publisher  = presentation::Publisher<Message>;
+
+    PnpClient(presentation::Presentation& presentation,
+              const std::uint64_t         unique_id_hash,
+              const Options&              options,
+              Subscriber&&                subscriber,
+              Publisher&&                 publisher)
+        : presentation_{presentation}
+        , unique_id_hash_{unique_id_hash}
+        , options_{options}
+        , subscriber_{std::move(subscriber)}
+        , publisher_{std::move(publisher)}
+        , message_{Message::allocator_type{&presentation.memory()}}
+        , random_state_{seedRandom(unique_id_hash, presentation.executor().now())}
+        , max_delay_{std::min(options.initial_delay, options.max_delay)}
+    {
+        message_.unique_id_hash = unique_id_hash_;
+
+        setupCallbacks();
+        next_request_time_ = presentation_.executor().now() + nextDelay();
+        scheduleRequest(next_request_time_);
+    }
+
+    void setupCallbacks()
+    {
+        subscriber_.setOnReceiveCallback([this](const auto& arg) {
+            //
+            // Only responses of allocators (which are never anonymous) to our own requests are interesting.
+            if (arg.metadata.publisher_node_id && !arg.message.allocated_node_id.empty() &&
+                ((arg.message.unique_id_hash & UniqueIdHashMask) == unique_id_hash_))
+            {
+                onAllocation(arg.message.allocated_node_id.front().value, arg.approx_now);
+            }
+        });
+
+        request_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            publishRequest(arg.approx_now);
+        });
+    }
+
+    void publishRequest(const TimePoint approx_now)
+    {
+        // There is nothing we can do about possible publishing failures - the request will be repeated anyway.
+        error_reporter_.report(publisher_.publish(approx_now + options_.request_timeout, message_),
+                               ErrorHandler::Origin::Publication,
+                               Message::_traits_::FixedPortId);
+
+        max_delay_         = std::min(max_delay_ * 2, options_.max_delay);
+        next_request_time_ = approx_now + nextDelay();
+        scheduleRequest(next_request_time_);
+    }
+
+    void onAllocation(const transport::NodeId node_id, const TimePoint approx_now)
+    {
+        // Repeated responses (f.e. to our earlier requests) are ignored.
+        if (allocated_node_id_)
+        {
+            return;
+        }
+        allocated_node_id_ = node_id;
+        request_cb_.reset();
+
+        if (allocation_callback_fn_)
+        {
+            allocation_callback_fn_(AllocationCallback::Arg{node_id, approx_now});
+        }
+    }
+
+    void scheduleRequest(const TimePoint exec_time)
+    {
+        const auto result = request_cb_.schedule(Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    /// Gets random delay in the `[max_delay_ / 2, max_delay_]` range.
+    ///
+    Duration nextDelay() noexcept
+    {
+        const auto half_range = static_cast<std::uint64_t>(max_delay_.count() / 2);
+        const auto jitter     = (half_range > 0U) ? (nextRandom() % (half_range + 1U)) : 0U;
+        return max_delay_ - Duration{static_cast<Duration::rep>(jitter)};
+    }
+
+    static std::uint64_t seedRandom(const std::uint64_t unique_id_hash, const TimePoint now) noexcept
+    {
+        // Xorshift state must never be zero.
+        const auto seed = unique_id_hash ^ static_cast<std::uint64_t>(now.time_since_epoch().count());
+        return (seed != 0U) ? seed : 1U;
+    }
+
+    /// Xorshift64* pseudo-random generator - good enough for backoff jitter, and doesn't need any dependencies.
+    ///
+    std::uint64_t nextRandom() noexcept
+    {
+        random_state_ ^= random_state_ >> 12U;
+        random_state_ ^= random_state_ << 25U;
+        random_state_ ^= random_state_ >> 27U;
+        return random_state_ * 0x2545F4914F6CDD1DULL;  // NOLINT(*-magic-numbers)
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&       presentation_;
+    const std::uint64_t               unique_id_hash_;
+    const Options                     options_;
+    Subscriber                        subscriber_;
+    Publisher                         publisher_;
+    Message                           message_;
+    std::uint64_t                     random_state_;
+    Duration                          max_delay_;
+    TimePoint                         next_request_time_;
+    cetl::optional<transport::NodeId> allocated_node_id_;
+    AllocationCallback::Function      allocation_callback_fn_;
+    ErrorReporter                     error_reporter_;
+    Callback::Any                     request_cb_;
+
+};  // PnpClient
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_PNP_CLIENT_HPP_INCLUDED
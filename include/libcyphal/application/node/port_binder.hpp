@@ -0,0 +1,491 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_PORT_BINDER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_PORT_BINDER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/application/registry/change_notifier.hpp"
+#include "libcyphal/application/registry/register.hpp"
+#include "libcyphal/application/registry/register_impl.hpp"
+#include "libcyphal/application/registry/registry_impl.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines a context of register-driven ports (see `PublisherPort` and `SubscriberPort`).
+///
+/// The binder just ties together the presentation layer (to make actual publishers and subscribers),
+/// the registry (to expose the standard port registers), and the registry change notifier (to observe
+/// changes of the port id registers). All of them should outlive the binder and its ports.
+///
+class PortBinder final
+{
+public:
+    /// @brief Defines the value of a port id register which means "not configured" (so the port is not bound).
+    ///
+    static constexpr transport::PortId UnsetPortId = std::numeric_limits<transport::PortId>::max();
+
+    PortBinder(presentation::Presentation& presentation,
+               registry::Registry&         registry,
+               registry::ChangeNotifier&   change_notifier) noexcept
+        : presentation_{presentation}
+        , registry_{registry}
+        , change_notifier_{change_notifier}
+    {
+    }
+
+    ~PortBinder() = default;
+
+    PortBinder(const PortBinder&)                = delete;
+    PortBinder(PortBinder&&) noexcept            = delete;
+    PortBinder& operator=(const PortBinder&)     = delete;
+    PortBinder& operator=(PortBinder&&) noexcept = delete;
+
+    presentation::Presentation& getPresentation() const noexcept
+    {
+        return presentation_;
+    }
+
+    registry::Registry& getRegistry() const noexcept
+    {
+        return registry_;
+    }
+
+    registry::ChangeNotifier& getChangeNotifier() const noexcept
+    {
+        return change_notifier_;
+    }
+
+    /// @brief Sets the node error handler, which is notified about failures to (re)bind the ports.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the binder.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+    const ErrorReporter& getErrorReporter() const noexcept
+    {
+        return error_reporter_;
+    }
+
+private:
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    registry::Registry&         registry_;
+    registry::ChangeNotifier&   change_notifier_;
+    ErrorReporter               error_reporter_;
+
+};  // PortBinder
+
+/// Internal implementation details of the Application layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines common part of register-driven ports - the standard port registers, and their observing.
+///
+/// The following registers are exposed (where `<kind>` is either `pub` or `sub`):
+/// - `uavcan.<kind>.<port_name>.id` - persistent mutable `natural16[1]` subject id of the port;
+/// - `uavcan.<kind>.<port_name>.type` - immutable `string` full name and version of the port message type.
+///
+/// The base is neither copyable nor movable - its registers and observer capture `this` pointer.
+///
+class BoundPortBase
+{
+public:
+    BoundPortBase(const BoundPortBase&)                = delete;
+    BoundPortBase(BoundPortBase&&) noexcept            = delete;
+    BoundPortBase& operator=(const BoundPortBase&)     = delete;
+    BoundPortBase& operator=(BoundPortBase&&) noexcept = delete;
+
+    /// @brief Gets subject id the port is currently bound to (if any).
+    ///
+    /// Note that the bound id might temporarily differ from the id register value - the register changes are
+    /// applied on the next executor spin (see `registry::ChangeNotifier`).
+    ///
+    cetl::optional<transport::PortId> getSubjectId() const noexcept
+    {
+        if (bound_id_ == PortBinder::UnsetPortId)
+        {
+            return cetl::nullopt;
+        }
+        return bound_id_;
+    }
+
+    /// @brief Checks whether both port registers were successfully appended to the registry.
+    ///
+    /// Registers are not appended if the registry already has registers with the same names.
+    ///
+    bool isExposed() const noexcept
+    {
+        return id_register_.isLinked() && type_register_.isLinked();
+    }
+
+protected:
+    using Name        = registry::IRegister::Name;
+    using MakeFailure = presentation::Presentation::MakeFailure;
+
+    BoundPortBase(PortBinder&             binder,
+                  const Name              kind,
+                  const Name              port_name,
+                  const Name              type_name,
+                  const transport::PortId default_id)
+        : binder_{binder}
+        , configured_id_{default_id}
+        , type_name_{type_name}
+        , id_register_{binder.getRegistry().route(makeName(id_name_buffer_, kind, port_name, ".id"),
+                                                  IdGetter{this},
+                                                  IdSetter{this},
+                                                  registry::IRegister::Options{true})}
+        , type_register_{binder.getRegistry().route(makeName(type_name_buffer_, kind, port_name, ".type"),
+                                                    TypeGetter{this})}
+        , id_observer_{binder.getChangeNotifier().observe(id_register_.getName(), [this](const auto&) {
+            //
+            bindConfigured();
+        })}
+    {
+    }
+
+    ~BoundPortBase() = default;
+
+    presentation::Presentation& presentation() const noexcept
+    {
+        return binder_.getPresentation();
+    }
+
+    /// @brief Binds the port to the configured subject id (if it differs from the currently bound one).
+    ///
+    /// Called on every change of the id register, and once by the derived constructor (for the default id).
+    /// If rebinding fails, the port stays bound to its previous subject (if any), the id register is reverted
+    /// to the bound id, and the failure is reported to the binder error handler (if any).
+    ///
+    void bindConfigured()
+    {
+        if (configured_id_ == bound_id_)
+        {
+            return;
+        }
+        const auto failure = rebind(configured_id_);
+        if (!failure.has_value())
+        {
+            bound_id_ = configured_id_;
+            return;
+        }
+
+        binder_.getErrorReporter().report(failure, ErrorHandler::Origin::Internal, configured_id_);
+        configured_id_ = bound_id_;
+        (void) binder_.getRegistry().markDirty(id_register_.getName());
+    }
+
+    /// @brief Rebinds the port to a new subject id.
+    ///
+    /// Implementations should make the new port first, and only then release the previous one -
+    /// so that the port stays bound to its previous subject in case of failure.
+    ///
+    /// @param subject_id The new subject id, or `PortBinder::UnsetPortId` to unbind the port.
+    /// @return `nullopt` on success, or the failure if the new port could not be made.
+    ///
+    virtual cetl::optional<MakeFailure> rebind(const transport::PortId subject_id) = 0;
+
+private:
+    static constexpr std::size_t NameCapacity = config::Application::Node::PortBinder_NameCapacity();
+
+    using NameBuffer = std::array<char, NameCapacity>;
+
+    struct IdGetter
+    {
+        transport::PortId operator()() const noexcept
+        {
+            return self->configured_id_;
+        }
+
+        BoundPortBase* self;
+    };
+
+    struct IdSetter
+    {
+        cetl::optional<registry::SetError> operator()(const registry::IRegister::Value& value) const
+        {
+            const auto* const natural16 = value.get_natural16_if();
+            if ((natural16 == nullptr) || (natural16->value.size() != 1))
+            {
+                return registry::SetError::Semantics;
+            }
+            self->configured_id_ = natural16->value[0];
+            return cetl::nullopt;
+        }
+
+        BoundPortBase* self;
+    };
+
+    struct TypeGetter
+    {
+        cetl::string_view operator()() const noexcept
+        {
+            return self->type_name_;
+        }
+
+        const BoundPortBase* self;
+    };
+
+    /// Composes `uavcan.<kind>.<port_name><suffix>` register name in the given buffer.
+    ///
+    /// Too long port name is truncated, so that the suffix is always preserved.
+    ///
+    static Name makeName(NameBuffer& buffer, const Name kind, const Name port_name, const Name suffix) noexcept
+    {
+        std::size_t size   = 0;
+        const auto  append = [&buffer, &size](const Name part, const std::size_t limit) {
+            //
+            const std::size_t part_size = std::min(part.size(), limit - std::min(size, limit));
+            (void) std::memcpy(buffer.data() + size, part.data(), part_size);  // NOLINT
+            size += part_size;
+        };
+        const std::size_t tail_size = suffix.size();
+        const std::size_t head_size = (NameCapacity > tail_size) ? (NameCapacity - tail_size) : 0U;
+        append("uavcan.", head_size);
+        append(kind, head_size);
+        append(".", head_size);
+        append(port_name, head_size);
+        append(suffix, NameCapacity);
+        return Name{buffer.data(), size};
+    }
+
+    // MARK: Data members:
+
+    PortBinder&                                binder_;
+    transport::PortId                          configured_id_;
+    transport::PortId                          bound_id_{PortBinder::UnsetPortId};
+    const Name                                 type_name_;
+    NameBuffer                                 id_name_buffer_{};
+    NameBuffer                                 type_name_buffer_{};
+    registry::RegisterImpl<IdGetter, IdSetter> id_register_;
+    registry::RegisterImpl<TypeGetter, void>   type_register_;
+    registry::ChangeNotifier::Observer         id_observer_;
+
+};  // BoundPortBase
+
+}  // namespace detail
+
+/// @brief Defines a register-driven message publisher.
+///
+/// The publisher subject id is taken from the standard `uavcan.pub.<port_name>.id` register (see `BoundPortBase`),
+/// and the port is rebound in place whenever the register is changed - there is no need to recreate the port
+/// (and so to re-register it with the rest of the application). Messages already queued for transmission are not
+/// affected by rebinding - they are kept by the transport until sent (or expired), regardless of the publisher
+/// (and its TX session) lifetime. Priority of the publisher is also kept across rebinds.
+///
+/// The port is neither copyable nor movable, and should not outlive its binder.
+///
+/// @tparam Message DSDL compiled (aka Nunavut generated) type of the message to publish.
+///
+template <typename Message>
+class PublisherPort final : public detail::BoundPortBase
+{
+public:
+    /// @brief Defines a failure type of the publish operation.
+    ///
+    /// In addition to the regular publisher failures, `ArgumentError` is returned if the port is not bound.
+    ///
+    using Failure = typename presentation::Publisher<Message>::Failure;
+
+    /// @brief Constructs a new publisher port, exposes its registers, and binds it to the default subject id.
+    ///
+    /// The default id is overridden by the id register value whenever it is set (f.e. by loading of the
+    /// persistent registers, or by a remote `uavcan.register.Access` request).
+    ///
+    /// @param binder The binder context. Should outlive the port.
+    /// @param port_name The port name in the standard register names (like `uavcan.pub.<port_name>.id`).
+    ///                  The name is copied, so it doesn't have to outlive the port.
+    /// @param default_id The initial subject id. By default, the port is not bound until its id register is set.
+    ///
+    PublisherPort(PortBinder&             binder,
+                  const Name              port_name,
+                  const transport::PortId default_id = PortBinder::UnsetPortId)
+        : BoundPortBase{binder, "pub", port_name, Message::_traits_::FullNameAndVersion(), default_id}
+    {
+        bindConfigured();
+    }
+
+    ~PublisherPort() = default;
+
+    PublisherPort(const PublisherPort&)                = delete;
+    PublisherPort(PublisherPort&&) noexcept            = delete;
+    PublisherPort& operator=(const PublisherPort&)     = delete;
+    PublisherPort& operator=(PublisherPort&&) noexcept = delete;
+
+    transport::Priority getPriority() const noexcept
+    {
+        return priority_;
+    }
+
+    void setPriority(const transport::Priority priority) noexcept
+    {
+        priority_ = priority;
+        if (publisher_)
+        {
+            publisher_->setPriority(priority);
+        }
+    }
+
+    /// @brief Publishes the message on the currently bound subject.
+    ///
+    /// @return `ArgumentError` if the port is not bound; otherwise the same as `Publisher::publish`.
+    ///
+    template <std::size_t BufferSize = Message::_traits_::SerializationBufferSizeBytes>
+    cetl::optional<Failure> publish(const TimePoint deadline, const Message& message) const
+    {
+        if (!publisher_)
+        {
+            return Failure{ArgumentError{}};
+        }
+        return publisher_->template publish<BufferSize>(deadline, message);
+    }
+
+private:
+    // MARK: BoundPortBase
+
+    cetl::optional<MakeFailure> rebind(const transport::PortId subject_id) override
+    {
+        if (subject_id == PortBinder::UnsetPortId)
+        {
+            publisher_.reset();
+            return cetl::nullopt;
+        }
+
+        auto maybe_publisher = presentation().template makePublisher<Message>(subject_id);
+        if (auto* const publisher = cetl::get_if<presentation::Publisher<Message>>(&maybe_publisher))
+        {
+            publisher->setPriority(priority_);
+            publisher_.emplace(std::move(*publisher));
+            return cetl::nullopt;
+        }
+        return cetl::get<MakeFailure>(std::move(maybe_publisher));
+    }
+
+    // MARK: Data members:
+
+    transport::Priority                              priority_{transport::Priority::Nominal};
+    cetl::optional<presentation::Publisher<Message>> publisher_;
+
+};  // PublisherPort
+
+/// @brief Defines a register-driven message subscriber.
+///
+/// The subscriber subject id is taken from the standard `uavcan.sub.<port_name>.id` register (see `BoundPortBase`),
+/// and the port is rebound in place whenever the register is changed. The receive callback is kept by the port,
+/// so it stays registered across rebinds. Rebinding subscribes to the new subject before unsubscribing from
+/// the previous one, so that the port is never left without a subscription in case of failure.
+///
+/// The port is neither copyable nor movable, and should not outlive its binder.
+///
+/// @tparam Message DSDL compiled (aka Nunavut generated) type of the message to subscribe.
+///
+template <typename Message>
+class SubscriberPort final : public detail::BoundPortBase
+{
+public:
+    /// @brief Defines the message callback (arguments, function) - the same as the one of the regular subscriber.
+    ///
+    using OnReceiveCallback = typename presentation::Subscriber<Message>::OnReceiveCallback;
+
+    /// @brief Constructs a new subscriber port, exposes its registers, and binds it to the default subject id.
+    ///
+    /// @param binder The binder context. Should outlive the port.
+    /// @param port_name The port name in the standard register names (like `uavcan.sub.<port_name>.id`).
+    ///                  The name is copied, so it doesn't have to outlive the port.
+    /// @param default_id The initial subject id. By default, the port is not bound until its id register is set.
+    /// @param on_receive_cb_fn Optional callback function to be called when a message is received.
+    ///
+    SubscriberPort(PortBinder&                           binder,
+                   const Name                            port_name,
+                   const transport::PortId               default_id       = PortBinder::UnsetPortId,
+                   typename OnReceiveCallback::Function&& on_receive_cb_fn = {})
+        : BoundPortBase{binder, "sub", port_name, Message::_traits_::FullNameAndVersion(), default_id}
+        , on_receive_cb_fn_{std::move(on_receive_cb_fn)}
+    {
+        bindConfigured();
+    }
+
+    ~SubscriberPort() = default;
+
+    SubscriberPort(const SubscriberPort&)                = delete;
+    SubscriberPort(SubscriberPort&&) noexcept            = delete;
+    SubscriberPort& operator=(const SubscriberPort&)     = delete;
+    SubscriberPort& operator=(SubscriberPort&&) noexcept = delete;
+
+    /// @brief Sets function which will be called on each message reception (on whatever subject is bound).
+    ///
+    /// Note that setting the callback will disable the previous one (if any).
+    ///
+    void setOnReceiveCallback(typename OnReceiveCallback::Function&& on_receive_cb_fn)
+    {
+        on_receive_cb_fn_ = std::move(on_receive_cb_fn);
+    }
+
+private:
+    // MARK: BoundPortBase
+
+    cetl::optional<MakeFailure> rebind(const transport::PortId subject_id) override
+    {
+        if (subject_id == PortBinder::UnsetPortId)
+        {
+            subscriber_.reset();
+            return cetl::nullopt;
+        }
+
+        auto maybe_subscriber = presentation().template makeSubscriber<Message>(subject_id, [this](const auto& arg) {
+            //
+            if (on_receive_cb_fn_)
+            {
+                on_receive_cb_fn_(arg);
+            }
+        });
+        if (auto* const subscriber = cetl::get_if<presentation::Subscriber<Message>>(&maybe_subscriber))
+        {
+            subscriber_.emplace(std::move(*subscriber));
+            return cetl::nullopt;
+        }
+        return cetl::get<MakeFailure>(std::move(maybe_subscriber));
+    }
+
+    // MARK: Data members:
+
+    typename OnReceiveCallback::Function              on_receive_cb_fn_;
+    cetl::optional<presentation::Subscriber<Message>> subscriber_;
+
+};  // SubscriberPort
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_PORT_BINDER_HPP_INCLUDED
@@ -0,0 +1,355 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PUBLISHER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PUBLISHER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/port_observer.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/node/port/List_0_1.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Port List' publisher component for the application node.
+///
+/// Periodically (every `Message::MAX_PUBLICATION_PERIOD` seconds) publishes `uavcan.node.port.List.0.1` messages.
+///
+/// The component observes the presentation layer (see `Presentation::setPortObserver`), so the sets of subject and
+/// service ids in use are maintained incrementally - as publishers, subscribers, clients and servers come and go.
+/// The message is re-serialized only when the sets have changed since the previous publication; otherwise the very
+/// same (cached) payload is published again. Subject id lists are serialized in the compact sparse form whenever
+/// their size allows it, and as bit masks otherwise.
+///
+/// Only one such publisher per presentation layer is supported (b/c presentation has a single port observer).
+///
+class PortListPublisher final : private presentation::IPortObserver
+{
+public:
+    /// @brief Defines the message type for the Port List.
+    ///
+    using Message = uavcan::node::port::List_0_1;
+
+    /// @brief Factory method to create a PortListPublisher instance.
+    ///
+    /// Publishing starts immediately - the very first message is published on the next executor spin.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'List' publisher,
+    ///                     and to observe ports of the node.
+    /// @return The PortListPublisher instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<PortListPublisher, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_publisher = presentation.makePublisher<void>(Message::_traits_::FixedPortId);
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_publisher))
+        {
+            return std::move(*failure);
+        }
+
+        return PortListPublisher{presentation, cetl::get<Publisher>(std::move(maybe_publisher))};
+    }
+
+    PortListPublisher(PortListPublisher&& other) noexcept
+        : presentation_{other.presentation_}
+        , publisher_{std::move(other.publisher_)}
+        , publishers_{other.publishers_}
+        , subscribers_{other.subscribers_}
+        , clients_{other.clients_}
+        , servers_{other.servers_}
+        , payload_{std::move(other.payload_)}
+        , payload_size_{other.payload_size_}
+        , is_dirty_{other.is_dirty_}
+        , is_observing_{false}
+        , next_exec_time_{other.next_exec_time_}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start in the new one.
+        other.periodic_cb_.reset();
+        other.is_observing_ = false;
+
+        startPublishing();
+    }
+
+    ~PortListPublisher()
+    {
+        if (is_observing_)
+        {
+            presentation_.setPortObserver(nullptr);
+        }
+    }
+
+    PortListPublisher(const PortListPublisher&)                = delete;
+    PortListPublisher& operator=(const PortListPublisher&)     = delete;
+    PortListPublisher& operator=(PortListPublisher&&) noexcept = delete;
+
+    /// @brief Sets the node error handler, which is notified about serialization (out of memory)
+    /// and publication failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the publisher.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+private:
+    using Callback       = IExecutor::Callback;
+    using Publisher      = presentation::Publisher<void>;
+    using SubjectIdList  = uavcan::node::port::SubjectIDList_0_1;
+    using ServiceIdList  = uavcan::node::port::ServiceIDList_0_1;
+    using Payload        = std::unique_ptr<cetl::byte[], PmrRawBytesDeleter>;  // NOLINT(*-avoid-c-arrays)
+    using SubjectIdMask  = std::bitset<SubjectIdList::CAPACITY>;
+    using ServiceIdMask  = std::bitset<ServiceIdList::CAPACITY>;
+    using SparseCapacity = SubjectIdList::_traits_::ArrayCapacity;
+
+    PortListPublisher(presentation::Presentation& presentation, Publisher&& publisher)
+        : presentation_{presentation}
+        , publisher_{std::move(publisher)}
+        , payload_size_{0}
+        , is_dirty_{true}
+        , is_observing_{false}
+        , next_exec_time_{presentation.executor().now()}
+    {
+        // The list is informational only, so it should never delay more important traffic.
+        publisher_.setPriority(transport::Priority::Optional);
+
+        startPublishing();
+    }
+
+    static constexpr Duration getPeriod() noexcept
+    {
+        constexpr std::uint8_t PeriodSecs = Message::MAX_PUBLICATION_PERIOD;
+        return std::chrono::seconds{PeriodSecs};
+    }
+
+    void startPublishing()
+    {
+        // Setting the observer replays all ports which are already in use (including our own publisher).
+        presentation_.setPortObserver(this);
+        is_observing_ = true;
+
+        periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            // We keep track of the next execution time to allow
+            // smooth rescheduling to the new instance in the move constructor.
+            next_exec_time_ = arg.exec_time + getPeriod();
+
+            publishMessage(arg.approx_now);
+        });
+
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, getPeriod()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void publishMessage(const TimePoint approx_now)
+    {
+        // There is nothing we can do about possible serialization (out of memory) or publishing failures -
+        // we just report them, and try again on the next period.
+        if (is_dirty_ && !serializeMessage())
+        {
+            error_reporter_.report(ErrorHandler::Kind::Memory,
+                                   ErrorHandler::Origin::Publication,
+                                   Message::_traits_::FixedPortId);
+            return;
+        }
+
+        const cetl::span<const cetl::byte>                      data_span{payload_.get(), payload_size_};
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{data_span};
+
+        // Publication period is the natural deadline for the message -
+        // it has no sense to keep the message in the queue for longer than that.
+        error_reporter_.report(publisher_.publish(approx_now + getPeriod(), fragments),
+                               ErrorHandler::Origin::Publication,
+                               Message::_traits_::FixedPortId);
+    }
+
+    /// Serializes the current sets of ports into the cached payload buffer.
+    ///
+    /// The message object is quite big (its masks alone take several KiB), so it's not kept as a member,
+    /// but temporary allocated (together with the serialization buffer) only when the sets have changed.
+    /// The cached payload buffer is then allocated exactly of the serialized size, which is usually
+    /// just a couple hundred bytes (b/c of sparse subject id lists).
+    ///
+    bool serializeMessage()
+    {
+        constexpr std::size_t BufferSize = Message::_traits_::SerializationBufferSizeBytes;
+
+        auto&                         memory = presentation_.memory();
+        const Message::allocator_type alloc{&memory};
+        const auto                    message = makeUniquePtr<Message, Message>(memory, alloc);
+        if (!message)
+        {
+            return false;
+        }
+        fillSubjectIdList(publishers_, alloc, message->publishers);
+        fillSubjectIdList(subscribers_, alloc, message->subscribers);
+        fillServiceIdList(clients_, message->clients);
+        fillServiceIdList(servers_, message->servers);
+
+        const Payload buffer{static_cast<cetl::byte*>(memory.allocate(BufferSize)),  // NOSONAR cpp:S5356 cpp:S5357
+                             {BufferSize, &memory}};
+        if (!buffer)
+        {
+            return false;
+        }
+
+        // TODO: Eliminate `reinterpret_cast` when Nunavut supports `cetl::byte` at its `serialize`.
+        const auto result_size = serialize(*message,
+                                           // Next nolint & NOSONAR are currently unavoidable.
+                                           // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                                           {reinterpret_cast<std::uint8_t*>(buffer.get()),  // NOSONAR cpp:S3630,
+                                            BufferSize});
+        if (!result_size)
+        {
+            return false;
+        }
+
+        const std::size_t payload_size = result_size.value();
+        Payload payload{static_cast<cetl::byte*>(memory.allocate(payload_size)),  // NOSONAR cpp:S5356 cpp:S5357
+                        {payload_size, &memory}};
+        if (!payload)
+        {
+            return false;
+        }
+        std::copy_n(buffer.get(), payload_size, payload.get());
+
+        payload_      = std::move(payload);
+        payload_size_ = payload_size;
+        is_dirty_     = false;
+        return true;
+    }
+
+    static void fillSubjectIdList(const SubjectIdMask&            ids,
+                                  const Message::allocator_type& alloc,
+                                  SubjectIdList&                 out_list)
+    {
+        const std::size_t count = ids.count();
+        if (count <= SparseCapacity::sparse_list)
+        {
+            using SparseList = SubjectIdList::_traits_::TypeOf::sparse_list;
+
+            auto& sparse_list = out_list.union_value.template emplace<SparseList>(alloc);
+            sparse_list.reserve(count);
+            for (std::size_t subject_id = 0; subject_id < ids.size(); ++subject_id)
+            {
+                if (ids.test(subject_id))
+                {
+                    sparse_list.emplace_back();
+                    sparse_list.back().value = static_cast<std::uint16_t>(subject_id);
+                }
+            }
+            return;
+        }
+
+        using Mask = SubjectIdList::_traits_::TypeOf::mask;
+
+        auto& mask = out_list.union_value.template emplace<Mask>();
+        for (std::size_t subject_id = 0; subject_id < ids.size(); ++subject_id)
+        {
+            mask[subject_id] = ids.test(subject_id);
+        }
+    }
+
+    static void fillServiceIdList(const ServiceIdMask& ids, ServiceIdList& out_list)
+    {
+        for (std::size_t service_id = 0; service_id < ids.size(); ++service_id)
+        {
+            out_list.mask[service_id] = ids.test(service_id);
+        }
+    }
+
+    template <std::size_t Size>
+    void updateIdMask(std::bitset<Size>& ids, const transport::PortId port_id, const bool is_in_use) noexcept
+    {
+        if ((port_id < ids.size()) && (ids.test(port_id) != is_in_use))
+        {
+            ids.set(port_id, is_in_use);
+            is_dirty_ = true;
+        }
+    }
+
+    void updatePort(const PortKind kind, const transport::PortId port_id, const bool is_in_use) noexcept
+    {
+        switch (kind)
+        {
+        case PortKind::Publisher:
+            updateIdMask(publishers_, port_id, is_in_use);
+            break;
+        case PortKind::Subscriber:
+            updateIdMask(subscribers_, port_id, is_in_use);
+            break;
+        case PortKind::Client:
+            updateIdMask(clients_, port_id, is_in_use);
+            break;
+        case PortKind::Server:
+            updateIdMask(servers_, port_id, is_in_use);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // MARK: IPortObserver
+
+    void onPortAdded(const PortKind kind, const transport::PortId port_id) noexcept override
+    {
+        updatePort(kind, port_id, true);
+    }
+
+    void onPortRemoved(const PortKind kind, const transport::PortId port_id) noexcept override
+    {
+        updatePort(kind, port_id, false);
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Publisher                   publisher_;
+    SubjectIdMask               publishers_;
+    SubjectIdMask               subscribers_;
+    ServiceIdMask               clients_;
+    ServiceIdMask               servers_;
+    Payload                     payload_;
+    std::size_t                 payload_size_;
+    bool                        is_dirty_;
+    bool                        is_observing_;
+    TimePoint                   next_exec_time_;
+    ErrorReporter               error_reporter_;
+    Callback::Any               periodic_cb_;
+
+};  // PortListPublisher
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PUBLISHER_HPP_INCLUDED
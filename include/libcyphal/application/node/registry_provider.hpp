@@ -6,6 +6,7 @@
 #ifndef LIBCYPHAL_APPLICATION_NODE_REGISTRY_PROVIDER_HPP_INCLUDED
 #define LIBCYPHAL_APPLICATION_NODE_REGISTRY_PROVIDER_HPP_INCLUDED
 
+#include "error_handler.hpp"
 #include "libcyphal/application/registry/registry.hpp"
 #include "libcyphal/presentation/presentation.hpp"
 #include "libcyphal/presentation/server.hpp"
@@ -73,6 +74,9 @@ public:
         , access_srv_{std::move(other.access_srv_)}
         , response_timeout_{other.response_timeout_}
         , pmr_alloc_{other.pmr_alloc_}
+        , list_response_{std::move(other.list_response_)}
+        , access_response_{std::move(other.access_response_)}
+        , error_reporter_{other.error_reporter_}
     {
         setupOnRequestCallbacks();
     }
@@ -92,6 +96,15 @@ public:
         response_timeout_ = timeout;
     }
 
+    /// @brief Sets the node error handler, which is notified about response transmission failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the provider.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
 private:
     using Name         = registry::IRegister::Name;
     using ListServer   = presentation::ServiceServer<ListService>;
@@ -107,6 +120,8 @@ private:
         , access_srv_{std::move(access_srv)}
         , response_timeout_{std::chrono::seconds{1}}
         , pmr_alloc_{&presentation.memory()}
+        , list_response_{pmr_alloc_}
+        , access_response_{pmr_alloc_}
     {
         // We have to set up request callback again (b/c it captures its own `this` pointer),
         setupOnRequestCallbacks();
@@ -116,12 +131,13 @@ private:
     {
         list_srv_.setOnRequestCallback([this](const auto& arg, auto continuation) {
             //
-            const auto reg_name = registry::makeRegisterName(pmr_alloc_, registry_.index(arg.request.index));
-            const ListService::Response response{reg_name, pmr_alloc_};
+            // The response is reused between requests, so its name array capacity is retained (no allocations).
+            registry::assignRegisterName(list_response_.name, registry_.index(arg.request.index));
 
-            // There is nothing we can do about possible continuation failures - we just ignore them.
-            // TODO: Introduce error handler at the node level.
-            (void) continuation(arg.approx_now + response_timeout_, response);
+            // There is nothing we can do about possible continuation failures - we just report them.
+            error_reporter_.report(continuation(arg.approx_now + response_timeout_, list_response_),
+                                   ErrorHandler::Origin::Response,
+                                   ListService::Request::_traits_::FixedPortId);
         });
         access_srv_.setOnRequestCallback([this](const auto& arg, auto continuation) {
             //
@@ -131,17 +147,25 @@ private:
                 (void) registry_.set(name, arg.request.value);
             }
 
-            AccessService::Response response{pmr_alloc_};
-            if (auto value_and_flags = registry_.get(name))
+            // The response is reused between requests, so its value array capacity is retained
+            // (no allocations as long as the registry supports it - see `IRegistry::getInto`).
+            auto& response = access_response_;
+            if (const auto flags = registry_.getInto(name, response.value))
+            {
+                response._mutable   = flags->_mutable;
+                response.persistent = flags->persistent;
+            }
+            else
             {
-                response.value      = std::move(value_and_flags->value);
-                response._mutable   = value_and_flags->flags._mutable;
-                response.persistent = value_and_flags->flags.persistent;
+                response.value.set_empty();
+                response._mutable   = false;
+                response.persistent = false;
             }
 
-            // There is nothing we can do about possible continuation failures - we just ignore them.
-            // TODO: Introduce error handler at the node level.
-            (void) continuation(arg.approx_now + response_timeout_, response);
+            // There is nothing we can do about possible continuation failures - we just report them.
+            error_reporter_.report(continuation(arg.approx_now + response_timeout_, response),
+                                   ErrorHandler::Origin::Response,
+                                   AccessService::Request::_traits_::FixedPortId);
         });
     }
 
@@ -153,6 +177,9 @@ private:
     AccessServer                           access_srv_;
     Duration                               response_timeout_;
     cetl::pmr::polymorphic_allocator<void> pmr_alloc_;
+    ListService::Response                  list_response_;
+    AccessService::Response                access_response_;
+    ErrorReporter                          error_reporter_;
 
 };  // RegistryProvider
 
@@ -0,0 +1,234 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_TIME_SYNC_PUBLISHER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_TIME_SYNC_PUBLISHER_HPP_INCLUDED
+
+#include "error_handler.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/time/Synchronization_1_0.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Time Synchronization Master' component for the application node.
+///
+/// Periodically publishes `uavcan.time.Synchronization.1.0` messages. Every message carries the time when
+/// the previous message has actually been transmitted. If the transport (and its media) supports TX completion
+/// notifications (see `ITransport::setMessageTxCompleteCallback`) then the media-reported TX timestamp is used,
+/// so that the queuing latency of the local TX pipeline doesn't affect accuracy of the synchronization.
+/// Otherwise, the time of handing over the message to the transport is used as a best effort approximation.
+///
+/// The time base of the master is the executor's monotonic time.
+/// Only one such publisher per transport is supported (b/c transport has a single TX completion callback).
+///
+class TimeSyncPublisher final
+{
+public:
+    /// @brief Defines the message type for the time synchronization.
+    ///
+    using Message = uavcan::time::Synchronization_1_0;
+
+    /// @brief Defines tuning options of the publisher.
+    ///
+    struct Options
+    {
+        /// Publication period. The Cyphal specification limits it to 1 second at most.
+        Duration period{std::chrono::seconds{1}};
+    };
+
+    /// @brief Factory method to create a TimeSyncPublisher instance with default options.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Synchronization' publisher.
+    /// @return The TimeSyncPublisher instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<TimeSyncPublisher, presentation::Presentation::MakeFailure>
+    {
+        return make(presentation, Options{});
+    }
+
+    /// @brief Factory method to create a TimeSyncPublisher instance.
+    ///
+    /// Publishing starts immediately (the first message has unknown previous transmission time).
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Synchronization' publisher.
+    /// @param options The tuning options of the publisher.
+    /// @return The TimeSyncPublisher instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, const Options& options)
+        -> Expected<TimeSyncPublisher, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_publisher = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_publisher))
+        {
+            return std::move(*failure);
+        }
+
+        return TimeSyncPublisher{presentation, options, cetl::get<Publisher>(std::move(maybe_publisher))};
+    }
+
+    TimeSyncPublisher(TimeSyncPublisher&& other) noexcept
+        : presentation_{other.presentation_}
+        , options_{other.options_}
+        , publisher_{std::move(other.publisher_)}
+        , message_{std::move(other.message_)}
+        , next_exec_time_{other.next_exec_time_}
+        , prev_tx_timestamp_{other.prev_tx_timestamp_}
+        , is_awaiting_tx_complete_{other.is_awaiting_tx_complete_}
+        , has_tx_timestamping_{false}
+        , error_reporter_{other.error_reporter_}
+    {
+        // We can't move callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start in the new one.
+        other.periodic_cb_.reset();
+        other.has_tx_timestamping_ = false;
+
+        startPublishing();
+    }
+
+    ~TimeSyncPublisher()
+    {
+        if (has_tx_timestamping_)
+        {
+            (void) presentation_.transport().setMessageTxCompleteCallback({});
+        }
+    }
+
+    TimeSyncPublisher(const TimeSyncPublisher&)                = delete;
+    TimeSyncPublisher& operator=(const TimeSyncPublisher&)     = delete;
+    TimeSyncPublisher& operator=(TimeSyncPublisher&&) noexcept = delete;
+
+    /// @brief Gets whether media-reported TX timestamps are in use (instead of approximated ones).
+    ///
+    bool hasTxTimestamping() const noexcept
+    {
+        return has_tx_timestamping_;
+    }
+
+    /// @brief Sets the node error handler, which is notified about publication failures.
+    ///
+    /// @param error_handler The error handler, or `nullptr` to stop reporting. Should outlive the publisher.
+    ///
+    void setErrorHandler(ErrorHandler* const error_handler) noexcept
+    {
+        error_reporter_.setHandler(error_handler);
+    }
+
+private:
+    using Callback  = IExecutor::Callback;
+    using Publisher = presentation::Publisher<Message>;
+
+    TimeSyncPublisher(presentation::Presentation& presentation, const Options& options, Publisher&& publisher)
+        : presentation_{presentation}
+        , options_{options}
+        , publisher_{std::move(publisher)}
+        , message_{Message::allocator_type{&presentation.memory()}}
+        , next_exec_time_{presentation.executor().now()}
+        , is_awaiting_tx_complete_{false}
+        , has_tx_timestamping_{false}
+    {
+        startPublishing();
+    }
+
+    void startPublishing()
+    {
+        has_tx_timestamping_ = presentation_.transport().setMessageTxCompleteCallback([this](const auto& arg) {
+            //
+            onMessageTxComplete(arg);
+        });
+
+        periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            // We keep track of the next execution time to allow
+            // smooth rescheduling to the new instance in the move constructor.
+            next_exec_time_ = arg.exec_time + options_.period;
+
+            publishMessage(arg.approx_now);
+        });
+
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, options_.period});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void publishMessage(const TimePoint approx_now)
+    {
+        // Zero means that the previous transmission time is unknown (f.e. the very first message,
+        // or the previous one has not been reported as transmitted yet).
+        message_.previous_transmission_timestamp_microsecond = 0;
+        if (prev_tx_timestamp_)
+        {
+            const auto prev_tx_us = std::chrono::duration_cast<std::chrono::microseconds>(  //
+                prev_tx_timestamp_->time_since_epoch());
+            message_.previous_transmission_timestamp_microsecond = static_cast<std::uint64_t>(prev_tx_us.count());
+            prev_tx_timestamp_.reset();
+        }
+
+        // There is no sense to keep the message in the queue for longer than the publication period.
+        const auto failure = publisher_.publish(approx_now + options_.period, message_);
+        if (failure.has_value())
+        {
+            error_reporter_.report(failure, ErrorHandler::Origin::Publication, Message::_traits_::FixedPortId);
+            is_awaiting_tx_complete_ = false;
+            return;
+        }
+
+        if (has_tx_timestamping_)
+        {
+            is_awaiting_tx_complete_ = true;
+        }
+        else
+        {
+            prev_tx_timestamp_ = presentation_.executor().now();
+        }
+    }
+
+    void onMessageTxComplete(const transport::ITransport::MessageTxCompleteCallback::Arg& arg)
+    {
+        // The earliest report wins - in case of redundant media the same message is reported once per media.
+        if (is_awaiting_tx_complete_ && (arg.subject_id == Message::_traits_::FixedPortId))
+        {
+            is_awaiting_tx_complete_ = false;
+            prev_tx_timestamp_       = arg.timestamp;
+        }
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    const Options               options_;
+    Publisher                   publisher_;
+    Message                     message_;
+    TimePoint                   next_exec_time_;
+    cetl::optional<TimePoint>   prev_tx_timestamp_;
+    bool                        is_awaiting_tx_complete_;
+    bool                        has_tx_timestamping_;
+    ErrorReporter               error_reporter_;
+    Callback::Any               periodic_cb_;
+
+};  // TimeSyncPublisher
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_TIME_SYNC_PUBLISHER_HPP_INCLUDED
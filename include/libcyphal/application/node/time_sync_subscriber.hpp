@@ -0,0 +1,368 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_TIME_SYNC_SUBSCRIBER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_TIME_SYNC_SUBSCRIBER_HPP_INCLUDED
+
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/time_provider.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/time/Synchronization_1_0.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines a clock synchronized to a remote time master.
+///
+/// The clock is a linear model on top of a local clock: `synced = anchor + elapsed * (1 + rate)`, where
+/// the `elapsed` is the local time since the anchor point. The model is disciplined by a PI controller:
+/// on every measurement (a pair of local and master time points of the same event) the phase is corrected
+/// by the proportional fraction of the error, and the rate accumulates the integral fraction of the error
+/// (normalized by the interval between measurements). Errors bigger than the step threshold (f.e. at startup,
+/// or after master switch) make the clock to step to the master time immediately.
+///
+/// Until the very first measurement the clock follows the local clock. Corrections may step the time back,
+/// so the clock is not guaranteed to be monotonic - it's up to the user to decide which clock to use where.
+/// Integer arithmetic only (the rate is kept in parts per billion), so it's fine for FPU-less targets.
+///
+class TimeSyncClock final : public ITimeProvider
+{
+public:
+    /// @brief Defines tuning options of the clock controller.
+    ///
+    struct Options
+    {
+        /// Errors bigger than this threshold make the clock to step (instead of a smooth correction).
+        Duration step_threshold{std::chrono::milliseconds{10}};
+
+        /// Proportional gain of the controller as a power of two divisor (`Kp = 1 / 2^shift`).
+        std::uint8_t proportional_shift{1};
+
+        /// Integral gain of the controller as a power of two divisor (`Ki = 1 / 2^shift`).
+        std::uint8_t integral_shift{2};
+
+        /// Limit of the rate correction, in parts per billion.
+        std::int64_t max_rate_ppb{500000};  // NOLINT(*-magic-numbers)
+    };
+
+    explicit TimeSyncClock(const ITimeProvider& local_clock)
+        : TimeSyncClock{local_clock, Options{}}
+    {
+    }
+
+    TimeSyncClock(const ITimeProvider& local_clock, const Options& options)
+        : local_clock_{local_clock}
+        , options_{options}
+    {
+    }
+
+    ~TimeSyncClock() = default;
+
+    TimeSyncClock(const TimeSyncClock&)                = delete;
+    TimeSyncClock(TimeSyncClock&&) noexcept            = delete;
+    TimeSyncClock& operator=(const TimeSyncClock&)     = delete;
+    TimeSyncClock& operator=(TimeSyncClock&&) noexcept = delete;
+
+    /// @brief Converts a local time point to the synchronized time.
+    ///
+    TimePoint toSynchronized(const TimePoint local_time) const noexcept
+    {
+        if (!is_synchronized_)
+        {
+            return local_time;
+        }
+
+        const auto elapsed = (local_time - anchor_local_).count();
+        return anchor_synced_ + Duration{elapsed + ((elapsed * rate_ppb_) / NanosPerSecond)};
+    }
+
+    /// @brief Feeds the controller with a new measurement.
+    ///
+    /// @param local_time The local time of an event (f.e. reception of a synchronization message).
+    /// @param master_time The master time of the same event.
+    ///
+    void update(const TimePoint local_time, const TimePoint master_time) noexcept
+    {
+        if (!is_synchronized_)
+        {
+            step(local_time, master_time);
+            return;
+        }
+
+        const TimePoint predicted = toSynchronized(local_time);
+        last_error_               = master_time - predicted;
+        if ((last_error_ > options_.step_threshold) || (-last_error_ > options_.step_threshold))
+        {
+            step(local_time, master_time);
+            return;
+        }
+
+        const auto error    = last_error_.count();
+        const auto interval = (local_time - anchor_local_).count();
+
+        anchor_local_  = local_time;
+        anchor_synced_ = predicted + Duration{error / (std::int64_t{1} << options_.proportional_shift)};
+        if (interval > 0)
+        {
+            const std::int64_t rate_error_ppb = (error * NanosPerSecond) / interval;
+
+            rate_ppb_ += rate_error_ppb / (std::int64_t{1} << options_.integral_shift);
+            rate_ppb_ = std::max(-options_.max_rate_ppb, std::min(rate_ppb_, options_.max_rate_ppb));
+        }
+    }
+
+    /// @brief Resets the clock back to the unsynchronized state (f.e. on master switch).
+    ///
+    void reset() noexcept
+    {
+        is_synchronized_ = false;
+        rate_ppb_        = 0;
+        last_error_      = Duration::zero();
+    }
+
+    /// @brief Gets whether at least one measurement has been applied since the last reset.
+    ///
+    bool isSynchronized() const noexcept
+    {
+        return is_synchronized_;
+    }
+
+    /// @brief Gets current rate correction, in parts per billion.
+    ///
+    std::int64_t getRatePpb() const noexcept
+    {
+        return rate_ppb_;
+    }
+
+    /// @brief Gets the error (master minus predicted time) of the latest measurement.
+    ///
+    Duration getLastError() const noexcept
+    {
+        return last_error_;
+    }
+
+    // MARK: ITimeProvider
+
+    TimePoint now() const noexcept override
+    {
+        return toSynchronized(local_clock_.now());
+    }
+
+private:
+    static constexpr std::int64_t NanosPerSecond = 1000000000LL;
+
+    void step(const TimePoint local_time, const TimePoint master_time) noexcept
+    {
+        anchor_local_    = local_time;
+        anchor_synced_   = master_time;
+        is_synchronized_ = true;
+    }
+
+    // MARK: Data members:
+
+    const ITimeProvider& local_clock_;
+    const Options        options_;
+    bool                 is_synchronized_{false};
+    TimePoint            anchor_local_{};
+    TimePoint            anchor_synced_{};
+    std::int64_t         rate_ppb_{0};
+    Duration             last_error_{};
+
+};  // TimeSyncClock
+
+/// @brief Defines 'Time Synchronization Slave' component for the application node.
+///
+/// Subscribes to `uavcan.time.Synchronization.1.0` messages, and feeds the given clock with measurements.
+/// Every message carries the master time of the previous message transmission, so a measurement is made of
+/// the local RX timestamp of the previous message (as reported by the media) and the master time from
+/// the current one. Only consecutive messages (by transfer ID) of the current master are taken into account.
+///
+/// If there are several masters, the one with the lowest node ID is followed (see the Cyphal specification).
+/// Another master is selected (and the clock is reset) as well if the current one has been silent for longer
+/// than the master timeout.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the subscriber callback,
+/// but at the destructor level, we don't need to do anything.
+///
+class TimeSyncSubscriber final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the time synchronization.
+    ///
+    using Message = uavcan::time::Synchronization_1_0;
+
+    /// @brief Defines tuning options of the subscriber.
+    ///
+    struct Options
+    {
+        /// Master is considered gone if it has been silent for longer than this timeout
+        /// (3 max publication periods of 1 second, see the Cyphal specification).
+        Duration master_timeout{std::chrono::seconds{3}};
+    };
+
+    /// @brief Factory method to create a TimeSyncSubscriber instance with default options.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Synchronization' subscriber.
+    /// @param clock The clock to discipline. Must outlive the subscriber.
+    /// @return The TimeSyncSubscriber instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, TimeSyncClock& clock)
+        -> Expected<TimeSyncSubscriber, presentation::Presentation::MakeFailure>
+    {
+        return make(presentation, clock, Options{});
+    }
+
+    /// @brief Factory method to create a TimeSyncSubscriber instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Synchronization' subscriber.
+    /// @param clock The clock to discipline. Must outlive the subscriber.
+    ///              RX timestamps of the media are expected to be in the time base of clock's local clock.
+    /// @param options The tuning options of the subscriber.
+    /// @return The TimeSyncSubscriber instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, TimeSyncClock& clock, const Options& options)
+        -> Expected<TimeSyncSubscriber, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_subscriber = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_subscriber))
+        {
+            return std::move(*failure);
+        }
+
+        const auto transfer_id_modulo = presentation.transport().getProtocolParams().transfer_id_modulo;
+        return TimeSyncSubscriber{clock,
+                                  options,
+                                  transfer_id_modulo,
+                                  cetl::get<Subscriber>(std::move(maybe_subscriber))};
+    }
+
+    TimeSyncSubscriber(TimeSyncSubscriber&& other) noexcept
+        : clock_{other.clock_}
+        , options_{other.options_}
+        , transfer_id_modulo_{other.transfer_id_modulo_}
+        , subscriber_{std::move(other.subscriber_)}
+        , master_node_id_{other.master_node_id_}
+        , prev_rx_{other.prev_rx_}
+    {
+        // We can't move the subscriber callback (b/c it captures its own `this` pointer),
+        // so we need to set it up again for the new instance.
+        setupOnReceiveCallback();
+    }
+
+    ~TimeSyncSubscriber() = default;
+
+    TimeSyncSubscriber(const TimeSyncSubscriber&)                = delete;
+    TimeSyncSubscriber& operator=(const TimeSyncSubscriber&)     = delete;
+    TimeSyncSubscriber& operator=(TimeSyncSubscriber&&) noexcept = delete;
+
+    /// @brief Gets node ID of the currently followed time master (if any).
+    ///
+    cetl::optional<transport::NodeId> getMasterNodeId() const noexcept
+    {
+        return master_node_id_;
+    }
+
+private:
+    using Subscriber = presentation::Subscriber<Message>;
+
+    /// Holds reception details of the previous message of the current master.
+    ///
+    struct PrevRx
+    {
+        TimePoint             timestamp;
+        transport::TransferId transfer_id;
+    };
+
+    TimeSyncSubscriber(TimeSyncClock&              clock,
+                       const Options&              options,
+                       const transport::TransferId transfer_id_modulo,
+                       Subscriber&&                subscriber)
+        : clock_{clock}
+        , options_{options}
+        , transfer_id_modulo_{transfer_id_modulo}
+        , subscriber_{std::move(subscriber)}
+    {
+        setupOnReceiveCallback();
+    }
+
+    void setupOnReceiveCallback()
+    {
+        subscriber_.setOnReceiveCallback([this](const auto& arg) {
+            //
+            // Anonymous nodes can't be time masters.
+            if (arg.metadata.publisher_node_id)
+            {
+                onMessage(*arg.metadata.publisher_node_id, arg.metadata.rx_meta, arg.message);
+            }
+        });
+    }
+
+    void onMessage(const transport::NodeId             node_id,
+                   const transport::TransferRxMetadata& rx_meta,
+                   const Message&                       message)
+    {
+        const bool is_master_gone = prev_rx_ && ((rx_meta.timestamp - prev_rx_->timestamp) > options_.master_timeout);
+        if (!master_node_id_ || ((node_id != *master_node_id_) && ((node_id < *master_node_id_) || is_master_gone)))
+        {
+            // Switch to the new master - its time base has nothing to do with the previous one.
+            master_node_id_ = node_id;
+            prev_rx_.reset();
+            clock_.reset();
+        }
+        if (node_id != *master_node_id_)
+        {
+            return;
+        }
+
+        // The previous transmission timestamp is valid only for the immediately preceding message.
+        // Zero timestamp means that the master doesn't know it (yet).
+        const auto prev_tx_us = message.previous_transmission_timestamp_microsecond;
+        if (prev_rx_ && !is_master_gone && (prev_tx_us != 0U) &&
+            (rx_meta.base.transfer_id == nextTransferId(prev_rx_->transfer_id)))
+        {
+            const TimePoint master_time{std::chrono::microseconds{static_cast<std::int64_t>(prev_tx_us)}};
+            clock_.update(prev_rx_->timestamp, master_time);
+        }
+        prev_rx_ = PrevRx{rx_meta.timestamp, rx_meta.base.transfer_id};
+    }
+
+    transport::TransferId nextTransferId(const transport::TransferId transfer_id) const noexcept
+    {
+        const transport::TransferId next = transfer_id + 1U;
+        return (transfer_id_modulo_ > 0U) ? (next % transfer_id_modulo_) : next;
+    }
+
+    // MARK: Data members:
+
+    TimeSyncClock&                    clock_;
+    const Options                     options_;
+    const transport::TransferId       transfer_id_modulo_;
+    Subscriber                        subscriber_;
+    cetl::optional<transport::NodeId> master_node_id_;
+    cetl::optional<PrevRx>            prev_rx_;
+
+};  // TimeSyncSubscriber
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_TIME_SYNC_SUBSCRIBER_HPP_INCLUDED
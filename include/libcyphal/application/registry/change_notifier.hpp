@@ -0,0 +1,326 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_REGISTRY_CHANGE_NOTIFIER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_REGISTRY_CHANGE_NOTIFIER_HPP_INCLUDED
+
+#include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/types.hpp"
+#include "register.hpp"
+#include "registry_impl.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace registry
+{
+
+/// @brief Defines a helper which notifies interested parties (aka observers) about register changes.
+///
+/// The notifier subscribes to the registry change notifications, and on the first one schedules a notification
+/// round to be executed by the executor on its next spin. All register changes made in between are batched
+/// into this single round, and multiple changes of the same register are coalesced into a single notification.
+/// As a result, observers are never called from within the `IRegistry::set` call (f.e. in the middle of
+/// a `uavcan.register.Access` request handling), and they see only the final value of the register.
+///
+/// Observers are created by either `observe` (exact register name) or `observePrefix` (f.e. "uavcan.pub."
+/// to get all publisher port registers) methods. Creation, destruction and notification of observers don't
+/// allocate memory. Note that observers are not allowed to be created or destroyed from within the observer
+/// callbacks, but they may set registers - such changes will be reported either by the current round
+/// (if the register is not reached yet), or by the next one.
+///
+/// Neither the registry nor the observers are scanned during a notification round. The registry queues changed
+/// registers (see `Registry::traverseChanged`), and observers are kept in two trees ordered by name (exact ones,
+/// and prefix ones), so matching observers of a changed register are found by a few logarithmic searches.
+/// Observers of the same name are notified in their creation order; exact observers go first, and then prefix ones
+/// (from the longest prefix to the shortest one).
+///
+/// The notifier is neither copyable nor movable - its callbacks capture `this` pointer.
+/// Only one notifier per registry is supported (the registry has a single change callback).
+///
+class ChangeNotifier final
+{
+public:
+    /// @brief Umbrella type for register observer entities.
+    ///
+    struct ObserverCallback
+    {
+        /// @brief Defines standard arguments for the observer callback.
+        ///
+        struct Arg
+        {
+            /// Holds the register which value has been changed.
+            IRegister& reg;
+
+            /// Holds the approximate time when the notification round has been started.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the observer callback function.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Registry::ChangeNotifier_ObserverCallback_FunctionSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Defines a register observer.
+    ///
+    /// Observer is active as long as it is alive. It can be moved (f.e. to be stored as a member of some
+    /// application component), but it should not outlive its notifier. The observed name (or prefix) is not
+    /// copied, so it should stay valid for the whole observer lifetime (like register names do).
+    ///
+    /// No Sonar cpp:S4963 b/c `Observer` supports move operation.
+    ///
+    class Observer final : public common::cavl::Node<Observer>  // NOSONAR cpp:S4963
+    {
+    public:
+        ~Observer()
+        {
+            if (isLinked())
+            {
+                remove();
+            }
+        }
+
+        Observer(Observer&& other) noexcept            = default;
+        Observer(const Observer&)                      = delete;
+        Observer& operator=(const Observer&)           = delete;
+        Observer& operator=(Observer&& other) noexcept = delete;
+
+        /// Gets the observed register name (or prefix).
+        ///
+        IRegister::Name getName() const noexcept
+        {
+            return name_;
+        }
+
+    private:
+        friend class ChangeNotifier;
+
+        Observer(common::cavl::Tree<Observer>& tree,
+                 const IRegister::Name         name,
+                 const std::size_t             sequence,
+                 ObserverCallback::Function&&  callback_fn)
+            : name_{name}
+            , sequence_{sequence}
+            , callback_fn_{std::move(callback_fn)}
+        {
+            // Observers are ordered by name, and then by their creation order (so the key is always unique).
+            const auto node_existing = tree.search(  //
+                [this](const Observer& other) { return compareWith(other); },
+                [this]() { return this; });
+            CETL_DEBUG_ASSERT(!std::get<1>(node_existing), "Unexpected existing observer node.");
+            (void) node_existing;
+        }
+
+        /// Positive if this observer goes after the other one.
+        ///
+        std::int8_t compareWith(const Observer& other) const noexcept
+        {
+            const auto name_order = name_.compare(other.name_);
+            if (name_order != 0)
+            {
+                return (name_order > 0) ? +1 : -1;
+            }
+            return (sequence_ > other.sequence_) ? +1 : -1;
+        }
+
+        /// Finds the last (in the tree order) observer which name is not greater than the given one.
+        ///
+        static Observer* findLastNotAfter(Observer* node, const IRegister::Name name) noexcept
+        {
+            Observer* result = nullptr;
+            while (node != nullptr)
+            {
+                const bool is_not_after = node->name_.compare(name) <= 0;
+                if (is_not_after)
+                {
+                    result = node;
+                }
+                node = node->getChildNode(is_not_after);
+            }
+            return result;
+        }
+
+        /// Calls all observers of the same name as the given (last of them) one.
+        ///
+        static void notifySameNamed(Observer* const last, const ObserverCallback::Arg& arg)
+        {
+            Observer* first = last;
+            while (Observer* const prev = first->getNextInOrderNode(true))
+            {
+                if (prev->name_ != last->name_)
+                {
+                    break;
+                }
+                first = prev;
+            }
+
+            Observer* observer = first;
+            while (observer != nullptr)
+            {
+                if (observer->callback_fn_)
+                {
+                    observer->callback_fn_(arg);
+                }
+                observer = (observer != last) ? observer->getNextInOrderNode() : nullptr;
+            }
+        }
+
+        // MARK: Data members:
+
+        IRegister::Name            name_;
+        std::size_t                sequence_;
+        ObserverCallback::Function callback_fn_;
+
+    };  // Observer
+
+    /// @brief Constructs a new notifier and subscribes it to the registry change notifications.
+    ///
+    /// @param executor The executor to schedule notification rounds on.
+    /// @param registry The registry to observe. Should outlive the notifier.
+    ///
+    ChangeNotifier(IExecutor& executor, Registry& registry)
+        : executor_{executor}
+        , registry_{registry}
+    {
+        notify_cb_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            notifyObservers(arg.approx_now);
+        });
+        registry_.setChangeCallback([this](const auto&) {
+            //
+            if (!is_pending_)
+            {
+                is_pending_ = true;
+
+                const auto result = notify_cb_.schedule(IExecutor::Callback::Schedule::Once{executor_.now()});
+                CETL_DEBUG_ASSERT(result, "");
+                (void) result;
+            }
+        });
+    }
+
+    ~ChangeNotifier()
+    {
+        registry_.setChangeCallback({});
+    }
+
+    ChangeNotifier(const ChangeNotifier&)                = delete;
+    ChangeNotifier(ChangeNotifier&&) noexcept            = delete;
+    ChangeNotifier& operator=(const ChangeNotifier&)     = delete;
+    ChangeNotifier& operator=(ChangeNotifier&&) noexcept = delete;
+
+    /// @brief Creates a new observer of a single register.
+    ///
+    /// @param name The name of the register to observe. The register doesn't have to exist yet.
+    /// @param observer_callback_fn The function to call (on the next executor spin) after the register change.
+    ///
+    CETL_NODISCARD Observer observe(const IRegister::Name name, ObserverCallback::Function&& observer_callback_fn)
+    {
+        return Observer{exact_observers_, name, next_observer_sequence_++, std::move(observer_callback_fn)};
+    }
+
+    /// @brief Creates a new observer of all registers which names start with the given prefix.
+    ///
+    /// @param prefix The prefix of the register names to observe. An empty prefix matches all registers.
+    /// @param observer_callback_fn The function to call (on the next executor spin) after a register change.
+    ///                             In case of multiple changed registers, it is called once per every register.
+    ///
+    CETL_NODISCARD Observer observePrefix(const IRegister::Name       prefix,
+                                          ObserverCallback::Function&& observer_callback_fn)
+    {
+        return Observer{prefix_observers_, prefix, next_observer_sequence_++, std::move(observer_callback_fn)};
+    }
+
+    /// @brief Checks whether there is a pending notification round.
+    ///
+    bool isPending() const noexcept
+    {
+        return is_pending_;
+    }
+
+private:
+    void notifyObservers(const TimePoint approx_now)
+    {
+        // Changes made by observers themselves (if already passed) will be reported by the next round.
+        is_pending_ = false;
+
+        registry_.traverseChanged([this, approx_now](IRegister& reg) {
+            //
+            notifyRegisterObservers(ObserverCallback::Arg{reg, approx_now});
+        });
+    }
+
+    void notifyRegisterObservers(const ObserverCallback::Arg& arg)
+    {
+        const auto reg_name = arg.reg.getName();
+
+        if (auto* const last = Observer::findLastNotAfter(exact_observers_, reg_name))
+        {
+            if (last->name_ == reg_name)
+            {
+                Observer::notifySameNamed(last, arg);
+            }
+        }
+
+        // Every matching prefix is found by a separate search, and every search narrows the next one:
+        // a matching prefix, which is before the found (but not matching) one, is also a prefix of their common part.
+        IRegister::Name name = reg_name;
+        while (auto* const last = Observer::findLastNotAfter(prefix_observers_, name))
+        {
+            const auto prefix = last->name_;
+            if (reg_name.substr(0, prefix.size()) == prefix)
+            {
+                Observer::notifySameNamed(last, arg);
+                if (prefix.empty())
+                {
+                    break;
+                }
+                name = reg_name.substr(0, prefix.size() - 1);
+            }
+            else
+            {
+                const std::size_t max_size    = std::min(prefix.size(), reg_name.size());
+                std::size_t       common_size = 0;
+                while ((common_size < max_size) && (prefix[common_size] == reg_name[common_size]))
+                {
+                    ++common_size;
+                }
+                name = reg_name.substr(0, common_size);
+            }
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                   executor_;
+    Registry&                    registry_;
+    common::cavl::Tree<Observer> exact_observers_;
+    common::cavl::Tree<Observer> prefix_observers_;
+    std::size_t                  next_observer_sequence_{0};
+    IExecutor::Callback::Any     notify_cb_;
+    bool                         is_pending_{false};
+
+};  // ChangeNotifier
+
+}  // namespace registry
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_REGISTRY_CHANGE_NOTIFIER_HPP_INCLUDED
@@ -0,0 +1,333 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_REGISTRY_DEFERRED_SAVER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_REGISTRY_DEFERRED_SAVER_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/platform/storage.hpp"
+#include "libcyphal/types.hpp"
+#include "register.hpp"
+#include "registry_impl.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace registry
+{
+
+/// @brief Defines a helper which incrementally saves dirty registers of a registry, asynchronously to its users.
+///
+/// The saver subscribes to the registry dirty notifications, and on the first one schedules a save round to be
+/// executed by the executor after a given delay. All register modifications which happen during the delay
+/// (f.e. a burst of `uavcan.register.Access` writes) are coalesced into this single round.
+///
+/// A round never blocks the executor for long: dirty registers are serialized and stored in chunks,
+/// each chunk is limited by the time budget, and the next chunk is scheduled for the next executor spin.
+/// Note that at least one register is stored per chunk, so the budget can't be smaller than a single
+/// `IKeyValue::put` duration. Registers modified while a round is in progress are just stored by the round
+/// (if not reached yet), or by the next round (if already stored). Completion of each round is reported
+/// via the optional completion callback.
+///
+/// A round which has failed with a storage error (f.e. a transient I/O failure) leaves the rest of registers dirty,
+/// and a retry round is scheduled with exponential backoff (see `setRetryPolicy`) - so dirty registers are
+/// eventually saved even if there are no further modifications. Retry rounds are chunked by the time budget as well.
+/// A fresh modification brings a pending retry round forward to the regular delay (if it's sooner than the retry),
+/// so a long backoff never postpones saving of new values for more than the delay.
+///
+/// The saver is neither copyable nor movable - its callbacks capture `this` pointer.
+/// Only one saver per registry is supported (the registry has a single dirty callback).
+///
+class DeferredSaver final
+{
+public:
+    /// @brief Umbrella type for save completion entities.
+    ///
+    struct CompletionCallback
+    {
+        /// @brief Defines standard arguments for the completion callback.
+        ///
+        struct Arg
+        {
+            /// Holds the storage error (if any) which has terminated the save round.
+            /// Registers which were not saved stay dirty, so they will be retried by a retry round.
+            cetl::optional<platform::storage::Error> error;
+
+            /// Holds the approximate time when the round has been completed.
+            TimePoint approx_now;
+        };
+
+        /// @brief Defines signature of the completion callback function.
+        ///
+        static constexpr auto FunctionSize =
+            config::Application::Registry::DeferredSaver_CompletionCallback_FunctionSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Constructs a new saver and subscribes it to the registry dirty notifications.
+    ///
+    /// @param executor The executor to schedule deferred saves on.
+    /// @param key_value The key-value storage to save dirty registers to.
+    /// @param registry The registry to observe. Should outlive the saver.
+    /// @param delay The delay between the first modification and the actual save.
+    /// @param time_budget The maximum time of a single save chunk (per executor spin).
+    ///                    By default, it is unlimited, so the whole round is done at once.
+    ///
+    DeferredSaver(IExecutor&                    executor,
+                  platform::storage::IKeyValue& key_value,
+                  Registry&                     registry,
+                  const Duration                delay,
+                  const Duration                time_budget = Duration::max())
+        : executor_{executor}
+        , key_value_{key_value}
+        , registry_{registry}
+        , delay_{delay}
+        , time_budget_{time_budget}
+        , value_storage_{IRegister::Value::allocator_type{&registry.memory()}}
+    {
+        save_cb_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            if (is_pending_)
+            {
+                saveChunk(arg.approx_now);
+            }
+        });
+        registry_.setDirtyCallback([this](const auto&) {
+            //
+            // A register modified during a round might be already passed by the round,
+            // so another round is needed once the current one is completed.
+            if (is_in_progress_)
+            {
+                is_modified_during_round_ = true;
+            }
+            request();
+        });
+    }
+
+    ~DeferredSaver()
+    {
+        registry_.setDirtyCallback({});
+    }
+
+    DeferredSaver(const DeferredSaver&)                = delete;
+    DeferredSaver(DeferredSaver&&) noexcept            = delete;
+    DeferredSaver& operator=(const DeferredSaver&)     = delete;
+    DeferredSaver& operator=(DeferredSaver&&) noexcept = delete;
+
+    /// @brief Sets the callback which is called on completion of every save round (either successful or not).
+    ///
+    void setCompletionCallback(CompletionCallback::Function&& completion_callback_fn)
+    {
+        completion_callback_fn_ = std::move(completion_callback_fn);
+    }
+
+    /// @brief Sets the retry policy for failed rounds (default is 1s initial delay, up to 1min).
+    ///
+    /// @param retry_delay Delay before the first retry round; the delay doubles after every consecutive failure.
+    ///                    Zero delay disables automatic retries.
+    /// @param max_retry_delay Upper bound of the delay between retry rounds (the backoff stops growing at it).
+    ///
+    void setRetryPolicy(const Duration retry_delay, const Duration max_retry_delay) noexcept
+    {
+        CETL_DEBUG_ASSERT(retry_delay >= Duration::zero(), "");
+        CETL_DEBUG_ASSERT(max_retry_delay >= retry_delay, "");
+
+        retry_delay_     = retry_delay;
+        max_retry_delay_ = max_retry_delay;
+    }
+
+    /// @brief Requests a deferred save.
+    ///
+    /// The save time is never pushed further by subsequent requests. If a save is already pending,
+    /// it's only brought forward (if needed) to the regular delay from now - the case of a retry round
+    /// which is waiting for its (potentially long) backoff.
+    /// Normally there is no need to call it directly - the registry dirty notifications do it automatically.
+    ///
+    void request()
+    {
+        const TimePoint exec_time = executor_.now() + delay_;
+        if (!is_pending_ || (exec_time < scheduled_time_))
+        {
+            is_pending_ = true;
+            schedule(exec_time);
+        }
+    }
+
+    /// @brief Requests a save round to start on the next executor spin, bypassing the delay.
+    ///
+    /// Useful for explicit requests to store persistent states (f.e. `uavcan.node.ExecuteCommand`).
+    /// Brings forward a pending round (if any); does nothing if a round is already in progress,
+    /// b/c its chunks are executed ASAP anyway. The round is still chunked by the time budget.
+    ///
+    void expedite()
+    {
+        if (!is_in_progress_)
+        {
+            is_pending_ = true;
+            schedule(executor_.now());
+        }
+    }
+
+    /// @brief Checks whether there is a pending (or in progress) save round.
+    ///
+    bool isPending() const noexcept
+    {
+        return is_pending_;
+    }
+
+    /// @brief Saves all dirty registers immediately and synchronously (f.e. before shutdown).
+    ///
+    /// Completes the pending round (if any) as well - the completion callback is called.
+    /// In case of failure, dirty registers which were not saved stay dirty,
+    /// so they will be retried by a retry round (or the next flush).
+    ///
+    /// @return Nothing in case of success, otherwise the storage error.
+    ///
+    auto flush() -> cetl::optional<platform::storage::Error>
+    {
+        complete(saveDirty(key_value_, registry_), executor_.now());
+        return last_error_;
+    }
+
+    /// @brief Gets result of the most recent save round (either deferred or explicit).
+    ///
+    cetl::optional<platform::storage::Error> lastError() const noexcept
+    {
+        return last_error_;
+    }
+
+private:
+    /// Result of a single chunk - the chunk is stopped either by a storage error, or when out of time.
+    ///
+    struct ChunkResult
+    {
+        cetl::optional<platform::storage::Error> error;
+        bool                                     out_of_time{false};
+
+        explicit operator bool() const noexcept
+        {
+            return error.has_value() || out_of_time;
+        }
+    };
+
+    void schedule(const TimePoint exec_time)
+    {
+        scheduled_time_   = exec_time;
+        const auto result = save_cb_.schedule(IExecutor::Callback::Schedule::Once{exec_time});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void saveChunk(const TimePoint approx_now)
+    {
+        const TimePoint deadline =
+            (time_budget_ < (TimePoint::max() - approx_now)) ? (approx_now + time_budget_) : TimePoint::max();
+
+        is_in_progress_ = true;
+
+        std::size_t saved_count = 0;
+        const auto  result      = registry_.traverseDirty([this, deadline, &saved_count](IRegister& reg) {
+            //
+            ChunkResult chunk_result{};
+            if ((saved_count > 0) && (executor_.now() >= deadline))
+            {
+                chunk_result.out_of_time = true;
+                return chunk_result;
+            }
+            ++saved_count;
+            chunk_result.error = detail::saveDirtyRegister(key_value_, reg, value_storage_);
+            return chunk_result;
+        });
+
+        if (result.out_of_time)
+        {
+            // Continue with the rest of dirty registers on the next executor spin (ASAP).
+            schedule(executor_.now());
+            return;
+        }
+        complete(result.error, executor_.now());
+    }
+
+    void complete(const cetl::optional<platform::storage::Error> error, const TimePoint approx_now)
+    {
+        is_pending_     = false;
+        is_in_progress_ = false;
+        last_error_     = error;
+        if (completion_callback_fn_)
+        {
+            completion_callback_fn_(CompletionCallback::Arg{error, approx_now});
+        }
+
+        const bool is_modified_during_round = std::exchange(is_modified_during_round_, false);
+        if (error.has_value())
+        {
+            // Registers modified during the round are still dirty, so the retry round will store them as well.
+            scheduleRetry(approx_now);
+            return;
+        }
+        failures_count_ = 0;
+        if (is_modified_during_round)
+        {
+            request();
+        }
+    }
+
+    void scheduleRetry(const TimePoint approx_now)
+    {
+        if (retry_delay_ <= Duration::zero())
+        {
+            return;
+        }
+
+        // Exponential backoff: the delay doubles after every consecutive failure, up to the max retry delay.
+        Duration retry_delay = retry_delay_;
+        for (std::size_t i = 0; (i < failures_count_) && (retry_delay < max_retry_delay_); ++i)
+        {
+            retry_delay = (retry_delay < (max_retry_delay_ / 2)) ? (retry_delay * 2) : max_retry_delay_;
+        }
+        retry_delay = std::min(retry_delay, max_retry_delay_);
+        ++failures_count_;
+
+        is_pending_ = true;
+        schedule(approx_now + retry_delay);
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                               executor_;
+    platform::storage::IKeyValue&            key_value_;
+    Registry&                                registry_;
+    const Duration                           delay_;
+    const Duration                           time_budget_;
+    IRegister::Value                         value_storage_;
+    IExecutor::Callback::Any                 save_cb_;
+    TimePoint                                scheduled_time_;
+    bool                                     is_pending_{false};
+    bool                                     is_in_progress_{false};
+    bool                                     is_modified_during_round_{false};
+    Duration                                 retry_delay_{std::chrono::seconds{1}};
+    Duration                                 max_retry_delay_{std::chrono::minutes{1}};
+    std::size_t                              failures_count_{0};
+    cetl::optional<platform::storage::Error> last_error_;
+    CompletionCallback::Function             completion_callback_fn_;
+
+};  // DeferredSaver
+
+}  // namespace registry
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_REGISTRY_DEFERRED_SAVER_HPP_INCLUDED
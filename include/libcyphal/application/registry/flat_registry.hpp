@@ -0,0 +1,656 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_REGISTRY_FLAT_REGISTRY_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_REGISTRY_FLAT_REGISTRY_HPP_INCLUDED
+
+#include "libcyphal/common/crc.hpp"
+#include "register.hpp"
+#include "registry.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace registry
+{
+
+/// Defines kinds of values which could be stored inline by the flat registry.
+///
+/// Each kind corresponds to the same named alternative of the `IRegister::Value` variant.
+///
+enum class FlatValueKind : std::uint8_t
+{
+    Bit,
+    Integer8,
+    Integer16,
+    Integer32,
+    Integer64,
+    Natural8,
+    Natural16,
+    Natural32,
+    Natural64,
+    Real32,
+    Real64,
+    String,
+
+};  // FlatValueKind
+
+/// Declares a single register of a flat register table.
+///
+/// Numeric registers are arrays of exactly `capacity` elements (initially all zeros).
+/// String registers are of variable length up to `capacity` characters (initially empty).
+///
+struct FlatRegisterDecl final
+{
+    /// The register name. Should point to a string with static storage duration (f.e. a string literal).
+    const char* name;
+
+    /// The kind of the register value.
+    FlatValueKind kind;
+
+    /// Number of value elements (or characters for strings).
+    /// Should not exceed capacity of the corresponding `IRegister::Value` alternative.
+    std::uint16_t capacity;
+
+    /// Behavior flags of the register value.
+    IRegister::Flags flags;
+
+};  // FlatRegisterDecl
+
+/// Defines a table of registers which is prepared (hashed, sorted and laid out) at compile time.
+///
+/// Use `makeFlatTable` to build the table from an array of declarations, normally as a namespace scope
+/// `constexpr` variable, so that the whole table ends up in read-only memory. The table is then used by
+/// the `FlatRegistry`, which keeps only the register values (inline, in a single byte array).
+///
+/// @tparam N The number of registers in the table.
+///
+template <std::size_t N>
+class FlatTable final
+{
+    static_assert(N > 0, "Register table should not be empty.");
+
+public:
+    /// Defines a prepared entry of the table.
+    ///
+    struct Entry final
+    {
+        /// Holds CRC-64-WE hash of the name - the same as the one used by `IRegister::Key`.
+        std::uint64_t key;
+
+        const char*      name;
+        std::size_t      name_size;
+        FlatValueKind    kind;
+        std::uint16_t    capacity;
+        IRegister::Flags flags;
+
+        /// Offset of the inline value within the registry storage (see `FlatTable::storageSize`).
+        std::size_t offset;
+    };
+
+    /// Gets size in bytes of a single element of the given value kind.
+    ///
+    static constexpr std::size_t elementSize(const FlatValueKind kind) noexcept
+    {
+        switch (kind)
+        {
+        case FlatValueKind::Bit:
+        case FlatValueKind::Integer8:
+        case FlatValueKind::Natural8:
+        case FlatValueKind::String:
+            break;
+        case FlatValueKind::Integer16:
+        case FlatValueKind::Natural16:
+            return sizeof(std::uint16_t);
+        case FlatValueKind::Integer32:
+        case FlatValueKind::Natural32:
+            return sizeof(std::uint32_t);
+        case FlatValueKind::Real32:
+            return sizeof(float);
+        case FlatValueKind::Integer64:
+        case FlatValueKind::Natural64:
+            return sizeof(std::uint64_t);
+        case FlatValueKind::Real64:
+            return sizeof(double);
+        }
+        static_assert(sizeof(bool) == sizeof(std::uint8_t), "Bits are stored as bytes.");
+        return sizeof(std::uint8_t);
+    }
+
+    /// Prepares the table from the given declarations.
+    ///
+    /// Names are hashed, entries are sorted by the hash, and each value gets its (naturally aligned) place
+    /// in the storage. Duplicate names (or hash collisions) make the table invalid - see `isValid`.
+    ///
+    explicit constexpr FlatTable(const FlatRegisterDecl (&decls)[N]) noexcept  // NOLINT(*-avoid-c-arrays)
+        : entries_{}
+        , storage_size_{0}
+        , is_valid_{true}
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const FlatRegisterDecl& decl = decls[i];
+
+            std::size_t name_size = 0;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            while (decl.name[name_size] != '\0')
+            {
+                ++name_size;
+            }
+
+            Entry entry{common::CRC64WE::compute(decl.name, name_size),
+                        decl.name,
+                        name_size,
+                        decl.kind,
+                        decl.capacity,
+                        decl.flags,
+                        0};
+
+            // Insertion sort is fine here - it's done once, and normally at compile time.
+            std::size_t j = i;
+            while ((j > 0) && (entries_[j - 1].key > entry.key))
+            {
+                entries_[j] = entries_[j - 1];
+                --j;
+            }
+            entries_[j] = entry;
+        }
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            Entry&            entry     = entries_[i];
+            const std::size_t elem_size = elementSize(entry.kind);
+
+            storage_size_ = ((storage_size_ + elem_size - 1) / elem_size) * elem_size;
+            entry.offset  = storage_size_;
+            storage_size_ += elem_size * entry.capacity;
+
+            if ((i > 0) && (entries_[i - 1].key == entry.key))
+            {
+                is_valid_ = false;
+            }
+        }
+    }
+
+    /// Gets the total number of registers.
+    ///
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    /// Gets the total number of bytes required to store all register values inline.
+    ///
+    constexpr std::size_t storageSize() const noexcept
+    {
+        return storage_size_;
+    }
+
+    /// Checks whether the table has no duplicate names (nor hash collisions).
+    ///
+    /// Intended for `static_assert` checks right after the table definition.
+    ///
+    constexpr bool isValid() const noexcept
+    {
+        return is_valid_;
+    }
+
+    /// Gets entry at the given index (in the key order). The index should be less than `size()`.
+    ///
+    constexpr const Entry& operator[](const std::size_t index) const noexcept
+    {
+        return entries_[index];
+    }
+
+    /// Finds the entry index by the register name.
+    ///
+    /// The complexity is logarithmic in the number of registers.
+    ///
+    /// @return Index of the entry, or `size()` if there is no such register.
+    ///
+    std::size_t find(const IRegister::Name name) const noexcept
+    {
+        const std::uint64_t key = common::CRC64WE(name.data(), name.data() + name.size()).get();
+
+        std::size_t low  = 0;
+        std::size_t high = N;
+        while (low < high)
+        {
+            const std::size_t middle = low + ((high - low) / 2);
+            if (entries_[middle].key < key)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        // Hash match is not enough - the name itself might be not in the table.
+        if ((low < N) && (entries_[low].key == key))
+        {
+            if (IRegister::Name{entries_[low].name, entries_[low].name_size} == name)
+            {
+                return low;
+            }
+        }
+        return N;
+    }
+
+private:
+    // MARK: Data members:
+
+    Entry       entries_[N];  // NOLINT(*-avoid-c-arrays) `std::array` is not mutable in C++14 `constexpr`.
+    std::size_t storage_size_;
+    bool        is_valid_;
+
+};  // FlatTable
+
+/// Makes a new flat register table from the given declarations.
+///
+/// Usage example:
+/// ```
+/// constexpr FlatRegisterDecl MyRegisterDecls[] = {
+///     {"uavcan.node.id", FlatValueKind::Natural16, 1, {true, true}},
+///     {"uavcan.node.description", FlatValueKind::String, 50, {true, true}},
+///     ...
+/// };
+/// constexpr auto MyRegisterTable = makeFlatTable(MyRegisterDecls);
+/// static_assert(MyRegisterTable.isValid(), "Duplicate register names.");
+/// ...
+/// FlatRegistry<MyRegisterTable.size(), MyRegisterTable.storageSize()> registry{memory, MyRegisterTable};
+/// ```
+///
+template <std::size_t N>
+constexpr FlatTable<N> makeFlatTable(const FlatRegisterDecl (&decls)[N]) noexcept  // NOLINT(*-avoid-c-arrays)
+{
+    return FlatTable<N>{decls};
+}
+
+// MARK: -
+
+/// Defines a registry which set of registers is fixed and known at compile time.
+///
+/// In contrast to the `Registry` (which links runtime created register objects into a tree),
+/// this registry is backed by a prepared `FlatTable` - there are no register objects, no startup registration,
+/// no name hashing at startup, and no getters/setters. Instead, all register values are stored inline,
+/// in a single byte array of the registry, and the application accesses them by index (see `find`).
+/// As a result, `size()` and `index()` are constant-time (just an array access),
+/// and name lookups are binary searches in a cache-friendly flat array.
+///
+/// Set of registers is fixed, so `append()` always fails. Register dirty tracking is not supported.
+///
+/// @tparam N The number of registers.
+/// @tparam StorageSize The total number of bytes required to store all values (see `FlatTable::storageSize`).
+///
+template <std::size_t N, std::size_t StorageSize>
+class FlatRegistry final : public IIntrospectableRegistry
+{
+public:
+    using Table = FlatTable<N>;
+
+    /// Constructs a new registry with all values being zeros (or empty strings).
+    ///
+    /// @param memory The memory resource to use for values returned by `get`.
+    /// @param table The prepared table of registers. Should outlive the registry.
+    ///
+    FlatRegistry(cetl::pmr::memory_resource& memory, const Table& table)
+        : memory_{memory}
+        , table_{table}
+        , storage_{}
+        , sizes_{}
+    {
+        CETL_DEBUG_ASSERT(table.storageSize() == StorageSize, "Storage size should match the table.");
+
+        for (std::size_t index = 0; index < N; ++index)
+        {
+            const auto& entry = table_[index];
+            sizes_[index]     = (entry.kind == FlatValueKind::String) ? 0 : entry.capacity;
+        }
+    }
+    ~FlatRegistry() = default;
+
+    FlatRegistry(FlatRegistry&&)                 = delete;
+    FlatRegistry(const FlatRegistry&)            = delete;
+    FlatRegistry& operator=(FlatRegistry&&)      = delete;
+    FlatRegistry& operator=(const FlatRegistry&) = delete;
+
+    cetl::pmr::memory_resource& memory() const noexcept
+    {
+        return memory_;
+    }
+
+    /// Finds index of the register by its name.
+    ///
+    /// The complexity is logarithmic in the number of registers. The application is expected to resolve
+    /// indices of its registers once (f.e. at startup), and then use them with `read`/`write` methods.
+    ///
+    /// @return Index of the register, or `size()` if there is no such register.
+    ///
+    std::size_t find(const IRegister::Name name) const noexcept
+    {
+        return table_.find(name);
+    }
+
+    /// Reads an element of the numeric register value.
+    ///
+    /// @tparam T The element type - should match the register value kind (f.e. `std::uint16_t` for `Natural16`).
+    /// @param index The register index (see `find`).
+    /// @param element The element index. Should be less than the register capacity.
+    ///
+    template <typename T>
+    T read(const std::size_t index, const std::size_t element = 0) const noexcept
+    {
+        CETL_DEBUG_ASSERT(isAccessible<T>(index, element), "Invalid register access.");
+
+        T value{};
+        (void) std::memcpy(&value, elementAt(index, element), sizeof(T));
+        return value;
+    }
+
+    /// Writes an element of the numeric register value.
+    ///
+    /// This is the application side access, so the register mutability flag is not checked.
+    ///
+    /// @tparam T The element type - should match the register value kind (f.e. `std::uint16_t` for `Natural16`).
+    /// @param index The register index (see `find`).
+    /// @param value The new element value.
+    /// @param element The element index. Should be less than the register capacity.
+    ///
+    template <typename T>
+    void write(const std::size_t index, const T value, const std::size_t element = 0) noexcept
+    {
+        CETL_DEBUG_ASSERT(isAccessible<T>(index, element), "Invalid register access.");
+
+        (void) std::memcpy(elementAt(index, element), &value, sizeof(T));
+    }
+
+    /// Reads the string register value.
+    ///
+    /// @param index The register index (see `find`). Should be of the `String` kind.
+    /// @return View of the inline storage - valid until the next modification of the register.
+    ///
+    cetl::string_view readString(const std::size_t index) const noexcept
+    {
+        CETL_DEBUG_ASSERT((index < N) && (table_[index].kind == FlatValueKind::String), "Invalid register access.");
+
+        // No Lint and Sonar cpp:S3630 "reinterpret_cast" should not be used" b/c we need to access raw storage.
+        // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+        return {reinterpret_cast<const char*>(elementAt(index, 0)), sizes_[index]};  // NOSONAR
+    }
+
+    /// Writes the string register value.
+    ///
+    /// This is the application side access, so the register mutability flag is not checked.
+    ///
+    /// @param index The register index (see `find`). Should be of the `String` kind.
+    /// @param value The new value.
+    /// @return `false` if the value doesn't fit into the register capacity (the register is not modified).
+    ///
+    bool writeString(const std::size_t index, const cetl::string_view value) noexcept
+    {
+        CETL_DEBUG_ASSERT((index < N) && (table_[index].kind == FlatValueKind::String), "Invalid register access.");
+
+        if (value.size() > table_[index].capacity)
+        {
+            return false;
+        }
+        if (!value.empty())
+        {
+            (void) std::memmove(elementAt(index, 0), value.data(), value.size());
+        }
+        sizes_[index] = static_cast<std::uint16_t>(value.size());
+        return true;
+    }
+
+    // MARK: - IRegistry
+
+    /// The complexity is logarithmic in the number of registers.
+    ///
+    cetl::optional<IRegister::ValueAndFlags> get(const IRegister::Name name) const override
+    {
+        IRegister::Value value{IRegister::Value::allocator_type{&memory_}};
+        if (const auto flags = getInto(name, value))
+        {
+            return IRegister::ValueAndFlags{std::move(value), *flags};
+        }
+        return cetl::nullopt;
+    }
+
+    /// Doesn't allocate memory as long as the given value already holds the same alternative with enough capacity.
+    /// The complexity is logarithmic in the number of registers.
+    ///
+    cetl::optional<IRegister::Flags> getInto(const IRegister::Name name, IRegister::Value& value) const override
+    {
+        const std::size_t index = find(name);
+        if (index >= N)
+        {
+            return cetl::nullopt;
+        }
+
+        using Alternatives = IRegister::Value::_traits_::TypeOf;
+
+        const auto& entry = table_[index];
+        switch (entry.kind)
+        {
+        case FlatValueKind::Bit:
+            copyOut<bool, Alternatives::bit>(index, value);
+            break;
+        case FlatValueKind::Integer8:
+            copyOut<std::int8_t, Alternatives::integer8>(index, value);
+            break;
+        case FlatValueKind::Integer16:
+            copyOut<std::int16_t, Alternatives::integer16>(index, value);
+            break;
+        case FlatValueKind::Integer32:
+            copyOut<std::int32_t, Alternatives::integer32>(index, value);
+            break;
+        case FlatValueKind::Integer64:
+            copyOut<std::int64_t, Alternatives::integer64>(index, value);
+            break;
+        case FlatValueKind::Natural8:
+            copyOut<std::uint8_t, Alternatives::natural8>(index, value);
+            break;
+        case FlatValueKind::Natural16:
+            copyOut<std::uint16_t, Alternatives::natural16>(index, value);
+            break;
+        case FlatValueKind::Natural32:
+            copyOut<std::uint32_t, Alternatives::natural32>(index, value);
+            break;
+        case FlatValueKind::Natural64:
+            copyOut<std::uint64_t, Alternatives::natural64>(index, value);
+            break;
+        case FlatValueKind::Real32:
+            copyOut<float, Alternatives::real32>(index, value);
+            break;
+        case FlatValueKind::Real64:
+            copyOut<double, Alternatives::real64>(index, value);
+            break;
+        case FlatValueKind::String:
+            copyOut<std::uint8_t, Alternatives::string>(index, value);
+            break;
+        }
+        return entry.flags;
+    }
+
+    /// The new value should be of the same kind as the register, and should fit into its capacity.
+    /// Numeric values should have exactly `capacity` elements. Otherwise, `SetError::Semantics` is returned.
+    /// The complexity is logarithmic in the number of registers.
+    ///
+    cetl::optional<SetError> set(const IRegister::Name name, const IRegister::Value& new_value) override
+    {
+        const std::size_t index = find(name);
+        if (index >= N)
+        {
+            return SetError::Existence;
+        }
+        if (!table_[index].flags._mutable)
+        {
+            return SetError::Mutability;
+        }
+
+        bool is_accepted = false;
+        switch (table_[index].kind)
+        {
+        case FlatValueKind::Bit:
+            is_accepted = copyIn<bool>(index, new_value.get_bit_if());
+            break;
+        case FlatValueKind::Integer8:
+            is_accepted = copyIn<std::int8_t>(index, new_value.get_integer8_if());
+            break;
+        case FlatValueKind::Integer16:
+            is_accepted = copyIn<std::int16_t>(index, new_value.get_integer16_if());
+            break;
+        case FlatValueKind::Integer32:
+            is_accepted = copyIn<std::int32_t>(index, new_value.get_integer32_if());
+            break;
+        case FlatValueKind::Integer64:
+            is_accepted = copyIn<std::int64_t>(index, new_value.get_integer64_if());
+            break;
+        case FlatValueKind::Natural8:
+            is_accepted = copyIn<std::uint8_t>(index, new_value.get_natural8_if());
+            break;
+        case FlatValueKind::Natural16:
+            is_accepted = copyIn<std::uint16_t>(index, new_value.get_natural16_if());
+            break;
+        case FlatValueKind::Natural32:
+            is_accepted = copyIn<std::uint32_t>(index, new_value.get_natural32_if());
+            break;
+        case FlatValueKind::Natural64:
+            is_accepted = copyIn<std::uint64_t>(index, new_value.get_natural64_if());
+            break;
+        case FlatValueKind::Real32:
+            is_accepted = copyIn<float>(index, new_value.get_real32_if());
+            break;
+        case FlatValueKind::Real64:
+            is_accepted = copyIn<double>(index, new_value.get_real64_if());
+            break;
+        case FlatValueKind::String:
+            is_accepted = copyIn<std::uint8_t>(index, new_value.get_string_if());
+            break;
+        }
+        if (!is_accepted)
+        {
+            return SetError::Semantics;
+        }
+        return cetl::nullopt;
+    }
+
+    // MARK: - IIntrospectableRegistry
+
+    /// The complexity is constant.
+    ///
+    std::size_t size() const override
+    {
+        return N;
+    }
+
+    /// The complexity is constant. The ordering is the one of the table (by name hash).
+    ///
+    IRegister::Name index(const std::size_t index) const override
+    {
+        if (index < N)
+        {
+            const auto& entry = table_[index];
+            return {entry.name, entry.name_size};
+        }
+        return {};
+    }
+
+    /// Set of registers is fixed at compile time, so nothing could be appended.
+    ///
+    /// @return Always `false`.
+    ///
+    bool append(IRegister&) override
+    {
+        return false;
+    }
+
+private:
+    template <typename T>
+    bool isAccessible(const std::size_t index, const std::size_t element) const noexcept
+    {
+        return (index < N) && (element < table_[index].capacity) &&
+               (Table::elementSize(table_[index].kind) == sizeof(T));
+    }
+
+    const std::uint8_t* elementAt(const std::size_t index, const std::size_t element) const noexcept
+    {
+        const auto& entry = table_[index];
+        return storage_.data() + entry.offset + (element * Table::elementSize(entry.kind));
+    }
+
+    std::uint8_t* elementAt(const std::size_t index, const std::size_t element) noexcept
+    {
+        const auto& entry = table_[index];
+        return storage_.data() + entry.offset + (element * Table::elementSize(entry.kind));
+    }
+
+    template <typename T, typename Alternative>
+    void copyOut(const std::size_t index, IRegister::Value& value) const
+    {
+        auto& container = reuseValueAlternative<Alternative>(value, IRegister::Value::allocator_type{&memory_}).value;
+        container.clear();
+
+        const std::size_t count = sizes_[index];
+        container.reserve(count);
+        for (std::size_t element = 0; element < count; ++element)
+        {
+            T value{};
+            (void) std::memcpy(&value, elementAt(index, element), sizeof(T));
+            container.push_back(value);
+        }
+    }
+
+    template <typename T, typename Array>
+    bool copyIn(const std::size_t index, const Array* const array)
+    {
+        if (array == nullptr)
+        {
+            return false;
+        }
+
+        const auto&       entry = table_[index];
+        const std::size_t count = array->value.size();
+        if ((entry.kind == FlatValueKind::String) ? (count > entry.capacity) : (count != entry.capacity))
+        {
+            return false;
+        }
+
+        for (std::size_t element = 0; element < count; ++element)
+        {
+            const T value = static_cast<T>(array->value[element]);
+            (void) std::memcpy(elementAt(index, element), &value, sizeof(T));
+        }
+        sizes_[index] = static_cast<std::uint16_t>(count);
+        return true;
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&                       memory_;
+    const Table&                                      table_;
+    alignas(std::uint64_t) std::array<std::uint8_t, StorageSize> storage_;
+    std::array<std::uint16_t, N>                      sizes_;
+
+};  // FlatRegistry
+
+}  // namespace registry
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_REGISTRY_FLAT_REGISTRY_HPP_INCLUDED
@@ -8,8 +8,10 @@
 
 #include "libcyphal/common/cavl/cavl.hpp"
 #include "libcyphal/common/crc.hpp"
+#include "libcyphal/common/intrusive_list.hpp"
 #include "libcyphal/types.hpp"
 
+#include <cetl/pf17/cetlpf.hpp>
 #include <cetl/rtti.hpp>
 #include <cetl/unbounded_variant.hpp>
 
@@ -17,7 +19,10 @@
 #include <uavcan/_register/Value_1_0.hpp>
 #include <uavcan/primitive/String_1_0.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <utility>
 
 namespace libcyphal
 {
@@ -51,7 +56,10 @@ enum class SetError : std::uint8_t
 
 /// Defines interface for a register.
 ///
-class IRegister : public common::cavl::Node<IRegister>
+/// Besides the registry tree, the register could be queued by the registry as changed
+/// (see `Registry::traverseChanged`).
+///
+class IRegister : public common::cavl::Node<IRegister>, public common::IntrusiveListNode<IRegister>
 {
     // 1AD1885B-954B-48CF-BAC4-FA0A251D3FC0
     // clang-format off
@@ -154,6 +162,21 @@ public:
     ///
     virtual ValueAndFlags get() const = 0;
 
+    /// Gets the register current value into the given (reused) value, and returns the register flags.
+    ///
+    /// In contrast to `get()`, the value is not constructed from scratch - if the given value already holds
+    /// the same alternative (f.e. from the previous call), its array is refilled in place, so no memory
+    /// is allocated as long as its capacity is enough. Intended for bulk operations over many registers.
+    /// The default implementation just moves the result of `get` (so it does allocate),
+    /// and supposed to be overridden by concrete registers.
+    ///
+    virtual Flags getInto(Value& value) const
+    {
+        auto value_and_flags = get();
+        value                = std::move(value_and_flags.value);
+        return value_and_flags.flags;
+    }
+
     /// Sets the register value.
     ///
     /// @return Optional error if the value cannot be set.
@@ -182,6 +205,33 @@ public:
     ///
     using Node::isLinked;
 
+    /// Checks whether the register value was modified since it was last saved (aka "dirty").
+    ///
+    /// The flag is raised by successful `set` calls (made either directly or via the registry),
+    /// and cleared by `registry::saveDirty` once the value is stored.
+    ///
+    bool isDirty() const noexcept
+    {
+        return dirty_;
+    }
+
+    /// Marks the register value as modified.
+    ///
+    /// Useful when the value was changed bypassing `set` (f.e. by the application itself),
+    /// so that the next `registry::saveDirty` would store it.
+    ///
+    void markDirty() noexcept
+    {
+        dirty_ = true;
+    }
+
+    /// Marks the register value as saved (or loaded).
+    ///
+    void markClean() noexcept
+    {
+        dirty_ = false;
+    }
+
     // MARK: RTTI
 
     static constexpr cetl::type_id _get_type_id_() noexcept
@@ -197,7 +247,9 @@ protected:
 
     IRegister(IRegister&& other) noexcept
         : Node{std::move(static_cast<Node&&>(other))}
+        , IntrusiveListNode{std::move(static_cast<IntrusiveListNode&&>(other))}
         , key_{other.key_}
+        , dirty_{other.dirty_}
     {
     }
 
@@ -213,6 +265,7 @@ private:
     // MARK: Data members:
 
     const Key key_;
+    bool      dirty_{false};
 
 };  // IRegister
 
@@ -226,25 +279,52 @@ using Register = ImplementationCell<IRegister, cetl::unbounded_variant<Footprint
 
 // MARK: -
 
-/// Makes a new Nunavut register name from a string view.
+/// Assigns an existing Nunavut register name from a string view.
 ///
-inline uavcan::_register::Name_1_0 makeRegisterName(const uavcan::_register::Name_1_0::allocator_type& alloc,
-                                                    const IRegister::Name                              name)
+/// The name array is refilled in place, so no memory is allocated as long as its capacity is enough.
+///
+inline void assignRegisterName(uavcan::_register::Name_1_0& out, const IRegister::Name name)
 {
     using uavcan::_register::Name_1_0;
 
-    Name_1_0 out{alloc};
-    if (!name.empty())
+    constexpr auto NameCapacity = Name_1_0::_traits_::ArrayCapacity::name;
+    out.name.resize(std::min(name.size(), NameCapacity));
+    if (!out.name.empty())
     {
-        constexpr auto NameCapacity = Name_1_0::_traits_::ArrayCapacity::name;
-        out.name.resize(std::min(name.size(), NameCapacity));
-
         // No Sonar `cpp:S5356` b/c we need to pass name payload as raw data.
         (void) std::memmove(out.name.data(), name.data(), out.name.size());  // NOSONAR cpp:S5356
     }
+}
+
+/// Makes a new Nunavut register name from a string view.
+///
+inline uavcan::_register::Name_1_0 makeRegisterName(const uavcan::_register::Name_1_0::allocator_type& alloc,
+                                                    const IRegister::Name                              name)
+{
+    uavcan::_register::Name_1_0 out{alloc};
+    assignRegisterName(out, name);
     return out;
 }
 
+/// Gets the given alternative of a register value, emplacing a new (empty) one only if the value holds another one.
+///
+/// Reuse of the already held alternative retains capacity of its array,
+/// so that refilling of the array (after `clear()`) doesn't allocate memory.
+///
+/// @tparam Alternative One of the `IRegister::Value` alternatives, f.e. `Value::_traits_::TypeOf::natural16`.
+/// @param value The value to reuse.
+/// @param alloc The allocator to use for the new alternative (if the value holds another one).
+///
+template <typename Alternative>
+Alternative& reuseValueAlternative(IRegister::Value& value, const IRegister::Value::allocator_type& alloc)
+{
+    if (auto* const alternative = cetl::get_if<Alternative>(&value.union_value))
+    {
+        return *alternative;
+    }
+    return value.union_value.template emplace<Alternative>(alloc);
+}
+
 /// Makes a new string view from Nunavut's string data.
 ///
 inline cetl::string_view makeStringView(const uavcan::primitive::String_1_0::_traits_::TypeOf::value& container)
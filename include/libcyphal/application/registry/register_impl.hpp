@@ -9,7 +9,12 @@
 #include "register.hpp"
 
 #include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 
 namespace libcyphal
@@ -18,6 +23,47 @@ namespace application
 {
 namespace registry
 {
+
+/// Internal implementation details of the Application layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// Maps a scalar C++ type to the corresponding `IRegister::Value` array alternative.
+///
+/// Getters of such types are served by the "small value" fast path (see `RegisterImpl`).
+///
+template <typename T>
+struct ScalarValue;
+// clang-format off
+template <> struct ScalarValue<bool>          { using Alternative = IRegister::Value::_traits_::TypeOf::bit; };
+template <> struct ScalarValue<std::int8_t>   { using Alternative = IRegister::Value::_traits_::TypeOf::integer8; };
+template <> struct ScalarValue<std::int16_t>  { using Alternative = IRegister::Value::_traits_::TypeOf::integer16; };
+template <> struct ScalarValue<std::int32_t>  { using Alternative = IRegister::Value::_traits_::TypeOf::integer32; };
+template <> struct ScalarValue<std::int64_t>  { using Alternative = IRegister::Value::_traits_::TypeOf::integer64; };
+template <> struct ScalarValue<std::uint8_t>  { using Alternative = IRegister::Value::_traits_::TypeOf::natural8; };
+template <> struct ScalarValue<std::uint16_t> { using Alternative = IRegister::Value::_traits_::TypeOf::natural16; };
+template <> struct ScalarValue<std::uint32_t> { using Alternative = IRegister::Value::_traits_::TypeOf::natural32; };
+template <> struct ScalarValue<std::uint64_t> { using Alternative = IRegister::Value::_traits_::TypeOf::natural64; };
+template <> struct ScalarValue<float>         { using Alternative = IRegister::Value::_traits_::TypeOf::real32; };
+template <> struct ScalarValue<double>        { using Alternative = IRegister::Value::_traits_::TypeOf::real64; };
+// clang-format on
+
+/// Checks whether there is `ScalarValue` mapping for the given type.
+///
+/// Only the types specialized above are matched - other arithmetic types (like `char` or `long double`)
+/// don't have a corresponding `Value` alternative, so they are left to the generic path.
+///
+template <typename T, typename = void>
+struct IsScalarValue : std::false_type
+{};
+template <typename T>
+struct IsScalarValue<T, decltype(void(std::declval<typename ScalarValue<T>::Alternative>()))> : std::true_type
+{};
+
+}  // namespace detail
+
 /// Defines abstract base class for a register implementation.
 ///
 /// Implements common functionality for all register types like name, options, and value accessors.
@@ -59,11 +105,54 @@ protected:
     ValueAndFlags getImpl(const T& value, const bool is_mutable) const
     {
         ValueAndFlags out{Value{allocator_}, {is_mutable, options_.persistent}};
-        out.value.union_value.emplace<T>(value, allocator_);
+        assignValue(out.value, value);
         return out;
     }
 
+    template <typename T>
+    Flags getIntoImpl(Value& out_value, const T& value, const bool is_mutable) const
+    {
+        assignValue(out_value, value);
+        return {is_mutable, options_.persistent};
+    }
+
 private:
+    void assignValue(Value& out_value, const Value& value) const
+    {
+        out_value = value;
+    }
+
+    /// Assigns one of the `Value` alternatives (f.e. `uavcan::primitive::array::Natural16_1_0`).
+    ///
+    template <typename T, std::enable_if_t<!detail::IsScalarValue<T>::value, bool> = true>
+    void assignValue(Value& out_value, const T& value) const
+    {
+        reuseValueAlternative<T>(out_value, allocator_) = value;
+    }
+
+    /// Assigns a scalar - the small value fast path, which doesn't need any intermediate `Value` alternative.
+    ///
+    template <typename T, std::enable_if_t<detail::IsScalarValue<T>::value, bool> = true>
+    void assignValue(Value& out_value, const T value) const
+    {
+        auto& array = reuseValueAlternative<typename detail::ScalarValue<T>::Alternative>(out_value, allocator_).value;
+        array.clear();
+        array.push_back(value);
+    }
+
+    void assignValue(Value& out_value, const cetl::string_view value) const
+    {
+        using String = Value::_traits_::TypeOf::string;
+
+        auto& array = reuseValueAlternative<String>(out_value, allocator_).value;
+        array.clear();
+        const std::size_t size = std::min(value.size(), String::_traits_::ArrayCapacity::value);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            array.push_back(static_cast<std::uint8_t>(value[i]));
+        }
+    }
+
     // MARK: Data members:
 
     const Name            name_;
@@ -76,7 +165,9 @@ private:
 
 /// Defines a read-write register implementation.
 ///
-/// @tparam Getter The getter function `T()` type, where `T` is either `Value` or one of its variants.
+/// @tparam Getter The getter function `T()` type, where `T` is either `Value`, one of its variants,
+///                a scalar (like `bool`, `std::uint16_t` or `float`), or `cetl::string_view`.
+///                Scalar and string getters don't need any intermediate `Value` alternative.
 /// @tparam Setter The setter function `cetl::optional<SetError>(const Value&)` type.
 ///
 /// The actual value is provided by the getter function,
@@ -126,9 +217,19 @@ public:
         return getImpl(getter_(), true);
     }
 
+    Flags getInto(Value& value) const override
+    {
+        return getIntoImpl(value, getter_(), true);
+    }
+
     cetl::optional<SetError> set(const Value& new_value) override
     {
-        return setter_(new_value);
+        cetl::optional<SetError> result = setter_(new_value);
+        if (!result.has_value())
+        {
+            markDirty();
+        }
+        return result;
     }
 
 private:
@@ -139,7 +240,8 @@ private:
 };
 /// Defines a read-only register implementation.
 ///
-/// @tparam Getter The getter function `T()` type, where `T` is either `Value` or one of its variants.
+/// @tparam Getter The getter function `T()` type, where `T` is either `Value`, one of its variants,
+///                a scalar (like `bool`, `std::uint16_t` or `float`), or `cetl::string_view`.
 ///
 /// The actual value is provided by the getter function.
 ///
@@ -181,6 +283,11 @@ public:
         return getImpl(getter_(), false);
     }
 
+    Flags getInto(Value& value) const override
+    {
+        return getIntoImpl(value, getter_(), false);
+    }
+
     cetl::optional<SetError> set(const Value&) override
     {
         return SetError::Mutability;
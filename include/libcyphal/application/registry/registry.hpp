@@ -10,6 +10,9 @@
 
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <cstddef>
+#include <utility>
+
 namespace libcyphal
 {
 namespace application
@@ -35,6 +38,29 @@ public:
     ///
     virtual cetl::optional<IRegister::ValueAndFlags> get(const IRegister::Name name) const = 0;
 
+    /// Reads the current value of the register into the given (reused) value, and returns the register flags.
+    ///
+    /// If the given value already holds the same alternative (f.e. from the previous call), its array is
+    /// refilled in place, so no memory is allocated as long as its capacity is enough. Intended for bulk
+    /// operations over many registers (like `registry::save`), where the same value could be reused.
+    /// The default implementation just moves the result of `get` (so it does allocate),
+    /// and supposed to be overridden by concrete registries.
+    ///
+    /// The worst-case complexity is log(n), where n is the number of registers.
+    ///
+    /// @return Flags of the register. Empty if nonexistent (the value is left intact).
+    ///
+    virtual cetl::optional<IRegister::Flags> getInto(const IRegister::Name name, IRegister::Value& value) const
+    {
+        auto value_and_flags = get(name);
+        if (!value_and_flags)
+        {
+            return cetl::nullopt;
+        }
+        value = std::move(value_and_flags->value);
+        return value_and_flags->flags;
+    }
+
     /// Assigns the register with the specified value.
     ///
     /// The worst-case complexity is log(n), where n is the number of registers.
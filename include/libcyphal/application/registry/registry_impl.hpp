@@ -7,6 +7,8 @@
 #define LIBCYPHAL_APPLICATION_REGISTRY_IMPL_HPP_INCLUDED
 
 #include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/common/intrusive_list.hpp"
+#include "libcyphal/config.hpp"
 #include "libcyphal/platform/storage.hpp"
 #include "register.hpp"
 #include "register_impl.hpp"
@@ -14,11 +16,13 @@
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
 
 #include <uavcan/_register/Value_1_0.hpp>
 
 #include <array>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace libcyphal
@@ -30,6 +34,10 @@ namespace registry
 
 /// Defines the registry implementation.
 ///
+/// Registers are kept in an AVL tree (sorted by the register key), which nodes are augmented with subtree sizes.
+/// As a result, `size()` is constant-time, and both `index()` and name lookups are logarithmic,
+/// so a full registry crawl (like the one done by the `uavcan.register.List` clients) is O(n log n).
+///
 class Registry final : public IIntrospectableRegistry
 {
 public:
@@ -53,6 +61,142 @@ public:
         return memory_;
     }
 
+    /// @brief Umbrella type for dirty register notification entities.
+    ///
+    struct DirtyCallback
+    {
+        /// @brief Defines standard arguments for the dirty callback.
+        ///
+        struct Arg
+        {
+            /// Holds the register which has been just marked as dirty.
+            IRegister& reg;
+        };
+
+        /// @brief Defines signature of the dirty callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Registry::Registry_DirtyCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Sets the callback which is called whenever a register is marked dirty via this registry.
+    ///
+    /// Typical use is to schedule (deferred) incremental persistence - see `DeferredSaver`.
+    /// Note that modifications made directly on a register (bypassing the registry)
+    /// are not reported - use `markDirty(name)` method for such cases.
+    ///
+    /// @param dirty_callback_fn The callback function. Pass an empty one to stop notifications.
+    ///
+    void setDirtyCallback(DirtyCallback::Function&& dirty_callback_fn)
+    {
+        dirty_callback_fn_ = std::move(dirty_callback_fn);
+    }
+
+    /// @brief Marks a register as dirty, and calls the dirty callback (if any).
+    ///
+    /// @return `true` if the register was found.
+    ///
+    bool markDirty(const IRegister::Name name)
+    {
+        if (auto* const reg = findRegisterBy(name))
+        {
+            notifyDirty(*reg);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Marks a register as clean, f.e. b/c its value has been just loaded from the storage.
+    ///
+    /// @return `true` if the register was found.
+    ///
+    bool markClean(const IRegister::Name name)
+    {
+        if (auto* const reg = findRegisterBy(name))
+        {
+            reg->markClean();
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Traverses (in key order) all registers which are marked as dirty.
+    ///
+    /// The action should have `R(IRegister&)` signature, where `R` is default constructable and convertible to `bool`.
+    /// Traversal stops at the first "true" result, which is returned back. Registers must not be added or removed
+    /// from within the action, but the action may change the register dirty flag.
+    ///
+    template <typename Action>
+    auto traverseDirty(const Action& action)
+    {
+        using Result = decltype(action(std::declval<IRegister&>()));
+        return registers_tree_.traverseInOrder([&action](IRegister& reg) -> Result {
+            //
+            if (reg.isDirty())
+            {
+                return action(reg);
+            }
+            return Result{};
+        });
+    }
+
+    /// @brief Umbrella type for register change notification entities.
+    ///
+    struct ChangeCallback
+    {
+        /// @brief Defines standard arguments for the change callback.
+        ///
+        struct Arg
+        {
+            /// Holds the register which value has been just successfully set.
+            IRegister& reg;
+        };
+
+        /// @brief Defines signature of the change callback function.
+        ///
+        static constexpr auto FunctionSize = config::Application::Registry::Registry_ChangeCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Sets the callback which is called whenever a register value is successfully set via this registry.
+    ///
+    /// While the callback is set, the changed register is also queued (once) until the next `traverseChanged` call,
+    /// so that notifications could be batched - see `ChangeNotifier`. In contrast to the dirty flag,
+    /// changes are not reported by `markDirty`, and they are not affected by saving of the register.
+    ///
+    /// @param change_callback_fn The callback function. Pass an empty one to stop notifications
+    ///                           (the queue of changed registers is dropped as well).
+    ///
+    void setChangeCallback(ChangeCallback::Function&& change_callback_fn)
+    {
+        change_callback_fn_ = std::move(change_callback_fn);
+        if (!change_callback_fn_)
+        {
+            changed_registers_.clear();
+        }
+    }
+
+    /// @brief Traverses (in change order) all queued changed registers, and dequeues them.
+    ///
+    /// The action should have `void(IRegister&)` signature. A register is dequeued before the action is called,
+    /// so the action may set the register again - it will be reported by the next traversal.
+    /// Registers must not be added or removed from within the action.
+    ///
+    /// The complexity is linear in the number of changed registers (and doesn't depend on the registry size).
+    ///
+    template <typename Action>
+    void traverseChanged(const Action& action)
+    {
+        // Only the registers queued so far are traversed (see above).
+        for (auto count = changed_registers_.size(); count > 0; --count)
+        {
+            if (auto* const reg = changed_registers_.popFront())
+            {
+                action(*reg);
+            }
+        }
+    }
+
     // MARK: - IRegistry
 
     cetl::optional<IRegister::ValueAndFlags> get(const IRegister::Name name) const override
@@ -64,22 +208,47 @@ public:
         return cetl::nullopt;
     }
 
+    /// Doesn't allocate memory as long as the given value already holds the same alternative with enough capacity,
+    /// and the register getter provides either a scalar or a string (see `RegisterImpl`).
+    ///
+    cetl::optional<IRegister::Flags> getInto(const IRegister::Name name, IRegister::Value& value) const override
+    {
+        if (const auto* const reg = findRegisterBy(name))
+        {
+            return reg->getInto(value);
+        }
+        return cetl::nullopt;
+    }
+
+    /// On success, the register is marked as dirty and changed,
+    /// and then the dirty and change callbacks (if any) are called.
+    ///
     cetl::optional<SetError> set(const IRegister::Name name, const IRegister::Value& new_value) override
     {
         if (auto* const reg = findRegisterBy(name))
         {
-            return reg->set(new_value);
+            auto result = reg->set(new_value);
+            if (!result.has_value())
+            {
+                notifyDirty(*reg);
+                notifyChanged(*reg);
+            }
+            return result;
         }
         return SetError::Existence;
     }
 
     // MARK: - IIntrospectableRegistry
 
+    /// The complexity is constant.
+    ///
     std::size_t size() const override
     {
         return registers_tree_.size();
     }
 
+    /// The complexity is logarithmic in the number of registers.
+    ///
     IRegister::Name index(const std::size_t index) const override
     {
         if (const auto* const reg = registers_tree_[index])
@@ -147,6 +316,27 @@ public:
     }
 
 private:
+    void notifyDirty(IRegister& reg)
+    {
+        reg.markDirty();
+        if (dirty_callback_fn_)
+        {
+            dirty_callback_fn_(DirtyCallback::Arg{reg});
+        }
+    }
+
+    void notifyChanged(IRegister& reg)
+    {
+        if (change_callback_fn_)
+        {
+            if (!changed_registers_.contains(reg))
+            {
+                changed_registers_.pushBack(reg);
+            }
+            change_callback_fn_(ChangeCallback::Arg{reg});
+        }
+    }
+
     CETL_NODISCARD IRegister* findRegisterBy(const IRegister::Name name)
     {
         return registers_tree_.search(
@@ -159,8 +349,11 @@ private:
             [key = IRegister::Key{name}](const IRegister& other) { return other.compareBy(key); });
     }
 
-    cetl::pmr::memory_resource&   memory_;
-    common::cavl::Tree<IRegister> registers_tree_;
+    cetl::pmr::memory_resource&      memory_;
+    common::cavl::Tree<IRegister>    registers_tree_;
+    common::IntrusiveList<IRegister> changed_registers_;
+    DirtyCallback::Function          dirty_callback_fn_;
+    ChangeCallback::Function         change_callback_fn_;
 
 };  // Registry
 
@@ -202,10 +395,16 @@ auto introspectRegistry(Registry& registry, const Action& action) -> OptStorageE
     return cetl::nullopt;
 }
 
-inline auto handleKeyValueGet(const platform::storage::IKeyValue& key_value,
-                              IIntrospectableRegistry&            registry,
-                              const IRegister::Name               register_name,
-                              IRegister::Value&                   value_storage) -> OptStorageError
+/// Loads a single register from the storage, and calls the given action if the register has been assigned.
+///
+/// The action should have `void(const IRegister::Name)` signature.
+///
+template <typename Action>
+auto handleKeyValueGet(const platform::storage::IKeyValue& key_value,
+                       IIntrospectableRegistry&            registry,
+                       const IRegister::Name               register_name,
+                       IRegister::Value&                   value_storage,
+                       const Action&                       on_loaded) -> OptStorageError
 {
     // Next nolint b/c we initialize buffer with `kv.get` call.
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
@@ -228,11 +427,51 @@ inline auto handleKeyValueGet(const platform::storage::IKeyValue& key_value,
     {
         // Assign the value to the register.
         // Shall it fail, the error is likely to be corrected during the next save().
-        (void) registry.set(register_name, value_storage);
+        if (!registry.set(register_name, value_storage).has_value())
+        {
+            on_loaded(register_name);
+        }
     }
 
     return cetl::nullopt;
 }
+inline auto handleKeyValueGet(const platform::storage::IKeyValue& key_value,
+                              IIntrospectableRegistry&            registry,
+                              const IRegister::Name               register_name,
+                              IRegister::Value&                   value_storage) -> OptStorageError
+{
+    return handleKeyValueGet(key_value, registry, register_name, value_storage, [](const IRegister::Name) {});
+}
+
+/// Loads all persistent registers from the storage using the given (reused) value storage.
+///
+/// The action is called for each register which has been assigned with a stored value (see `handleKeyValueGet`).
+///
+template <typename Action>
+auto loadRegisters(const platform::storage::IKeyValue& key_value,
+                   IIntrospectableRegistry&            registry,
+                   IRegister::Value&                   value_storage,
+                   const Action&                       on_loaded) -> OptStorageError
+{
+    return introspectRegistry(  //
+        registry,
+        [&key_value, &registry, &value_storage, &on_loaded](const IRegister::Name reg_name) -> OptStorageError {
+            //
+            // If we get nothing, this means that the register has disappeared from the register.
+            if (const auto reg_flags = registry.getInto(reg_name, value_storage))
+            {
+                // Skip non-persistent registers.
+                // We will attempt to restore the register even if it is immutable,
+                // as it is not incompatible with the protocol.
+                if (reg_flags->persistent)
+                {
+                    return handleKeyValueGet(key_value, registry, reg_name, value_storage, on_loaded);
+                }
+            }
+
+            return cetl::nullopt;
+        });
+}
 
 inline auto handleKeyValueSet(platform::storage::IKeyValue& key_value,
                               const IRegister::Name         register_name,
@@ -268,6 +507,26 @@ inline auto handleKeyValueDrop(platform::storage::IKeyValue& key_value,
     return cetl::nullopt;
 }
 
+/// Saves a single dirty register (if it is persistent and mutable), and marks it as clean on success.
+///
+/// The value storage is reused between calls, so that saving of many registers doesn't allocate memory.
+///
+inline auto saveDirtyRegister(platform::storage::IKeyValue& key_value,
+                              IRegister&                    reg,
+                              IRegister::Value&             value_storage) -> OptStorageError
+{
+    const auto reg_flags = reg.getInto(value_storage);
+    if (reg_flags.persistent && reg_flags._mutable)
+    {
+        if (const auto err = handleKeyValueSet(key_value, reg.getName(), value_storage))
+        {
+            return err;
+        }
+    }
+    reg.markClean();
+    return cetl::nullopt;
+}
+
 }  // namespace detail
 
 /// Scan all persistent registers in the registry and load their values from the storage if present.
@@ -309,6 +568,49 @@ inline auto load(const platform::storage::IKeyValue& key_value, IIntrospectableR
                                       });
 }
 
+/// Loads persistent registers of the registry from the storage (see generic `load` above for details).
+///
+/// In contrast to the generic `load`, current register values are fetched into the given value storage
+/// (see `IRegistry::getInto`), which is reused for all registers. Note that deserialization of the stored values
+/// still needs memory, so unlike `save` this is not allocation-free.
+///
+/// @param value_storage The intermediate register value. Could be kept by the caller between calls.
+///
+inline auto load(const platform::storage::IKeyValue& key_value,
+                 IIntrospectableRegistry&            registry,
+                 IRegister::Value&                   value_storage) -> cetl::optional<platform::storage::Error>
+{
+    return detail::loadRegisters(key_value, registry, value_storage, [](const IRegister::Name) {});
+}
+
+/// Loads persistent registers of the registry from the storage (see generic `load` above for details).
+///
+/// @param memory The memory resource for the intermediate register value.
+///
+inline auto load(const platform::storage::IKeyValue& key_value,
+                 IIntrospectableRegistry&            registry,
+                 cetl::pmr::memory_resource&         memory) -> cetl::optional<platform::storage::Error>
+{
+    IRegister::Value value_storage{IRegister::Value::allocator_type{&memory}};
+    return load(key_value, registry, value_storage);
+}
+
+/// Loads persistent registers of the registry from the storage (see generic `load` above for details).
+///
+/// The intermediate register value is allocated from the registry memory resource.
+/// Values of successfully loaded registers are the ones already stored, so such registers are marked as clean -
+/// the following `saveDirty` won't write them back. Other registers keep their dirty state.
+///
+inline auto load(const platform::storage::IKeyValue& key_value, Registry& registry)  //
+    -> cetl::optional<platform::storage::Error>
+{
+    IRegister::Value value_storage{IRegister::Value::allocator_type{&registry.memory()}};
+    return detail::loadRegisters(key_value, registry, value_storage, [&registry](const IRegister::Name reg_name) {
+        //
+        (void) registry.markClean(reg_name);
+    });
+}
+
 /// Saves all persistent mutable registers from the registry to the storage.
 ///
 /// The register savior is the counterpart of load().
@@ -331,7 +633,8 @@ inline auto load(const platform::storage::IKeyValue& key_value, IIntrospectableR
 /// @return Nothing in case of success.
 ///         Otherwise, the very first error encountered (on which we stopped the registry enumeration).
 ///
-template <typename ResetPredicate>
+template <typename ResetPredicate,
+          std::enable_if_t<!std::is_base_of<cetl::pmr::memory_resource, ResetPredicate>::value, bool> = true>
 auto save(platform::storage::IKeyValue&  key_value,
           const IIntrospectableRegistry& registry,
           const ResetPredicate&          reset_predicate) -> cetl::optional<platform::storage::Error>
@@ -366,6 +669,98 @@ inline auto save(platform::storage::IKeyValue&  key_value,
     return save(key_value, registry, [](const IRegister::Name) { return false; });
 }
 
+/// Saves all persistent mutable registers from the registry to the storage (see generic `save` above for details).
+///
+/// In contrast to the generic `save`, register values are fetched into the given value storage
+/// (see `IRegistry::getInto`), which is reused for all registers. Could be kept by the caller between calls,
+/// so that saving doesn't allocate memory at all once the value storage is warmed up.
+///
+/// @param value_storage The intermediate register value.
+///
+template <typename ResetPredicate>
+auto save(platform::storage::IKeyValue&  key_value,
+          const IIntrospectableRegistry& registry,
+          IRegister::Value&              value_storage,
+          const ResetPredicate&          reset_predicate) -> cetl::optional<platform::storage::Error>
+{
+    return detail::introspectRegistry(  //
+        registry,
+        [&key_value, &registry, &reset_predicate, &value_storage](
+            const IRegister::Name reg_name) -> detail::OptStorageError {
+            //
+            // Reset is handled before any other checks to enhance forward compatibility.
+            if (reset_predicate(reg_name))
+            {
+                return detail::handleKeyValueDrop(key_value, reg_name);
+            }
+
+            // If we get nothing, this means that the register has disappeared from the register.
+            if (const auto reg_flags = registry.getInto(reg_name, value_storage))
+            {
+                // We do not save immutable registers because they are assumed to be constant, so no
+                // need to waste storage.
+                if (reg_flags->persistent && reg_flags->_mutable)
+                {
+                    return detail::handleKeyValueSet(key_value, reg_name, value_storage);
+                }
+            }
+
+            return cetl::nullopt;
+        });
+}
+
+/// Saves all persistent mutable registers from the registry to the storage (see generic `save` above for details).
+///
+/// @param memory The memory resource for the intermediate register value.
+///
+template <typename ResetPredicate>
+auto save(platform::storage::IKeyValue&  key_value,
+          const IIntrospectableRegistry& registry,
+          cetl::pmr::memory_resource&    memory,
+          const ResetPredicate&          reset_predicate) -> cetl::optional<platform::storage::Error>
+{
+    IRegister::Value value_storage{IRegister::Value::allocator_type{&memory}};
+    return save(key_value, registry, value_storage, reset_predicate);
+}
+inline auto save(platform::storage::IKeyValue&  key_value,
+                 const IIntrospectableRegistry& registry,
+                 cetl::pmr::memory_resource&    memory) -> cetl::optional<platform::storage::Error>
+{
+    return save(key_value, registry, memory, [](const IRegister::Name) { return false; });
+}
+
+/// Saves all persistent mutable registers of the registry to the storage (see generic `save` above for details).
+///
+/// The intermediate register value is allocated from the registry memory resource.
+///
+inline auto save(platform::storage::IKeyValue& key_value, const Registry& registry)
+    -> cetl::optional<platform::storage::Error>
+{
+    return save(key_value, registry, registry.memory());
+}
+
+/// Saves only those persistent mutable registers which were modified (aka dirty) since they were last saved.
+///
+/// This is the incremental counterpart of `save()`: unchanged registers are neither serialized nor written.
+/// A register is marked as clean once its value has been successfully stored (or if it doesn't need storing at all,
+/// f.e. because it is not persistent), so in case of failure the rest of dirty registers will be retried next time.
+///
+/// @param key_value The key-value storage to save the registers to.
+/// @param registry The registry to save the dirty registers from.
+/// @return Nothing in case of success.
+///         Otherwise, the very first error encountered (on which we stopped the registry enumeration).
+///
+inline auto saveDirty(platform::storage::IKeyValue& key_value, Registry& registry)
+    -> cetl::optional<platform::storage::Error>
+{
+    IRegister::Value value_storage{IRegister::Value::allocator_type{&registry.memory()}};
+
+    return registry.traverseDirty([&key_value, &value_storage](IRegister& reg) -> detail::OptStorageError {
+        //
+        return detail::saveDirtyRegister(key_value, reg, value_storage);
+    });
+}
+
 }  // namespace registry
 }  // namespace application
 }  // namespace libcyphal
@@ -59,7 +59,9 @@ class Tree;
 /// For instance, the derived type might be a key-value pair struct defined in the user code.
 /// The worst-case complexity of all operations is O(log n), unless specifically noted otherwise.
 /// Note that this class has no public members. The user type should re-export them if needed (usually it is not).
-/// The size of this type is 4x pointer size (16 bytes on a 32-bit platform).
+/// Every node also keeps the size of its subtree, which turns positional (aka order statistic) queries into
+/// logarithmic operations (see `Tree::operator[]` and `Tree::size()`).
+/// The size of this type is 5x pointer size (20 bytes on a 32-bit platform).
 ///
 /// No Sonar cpp:S1448 b/c this is the main node entity without public members - maintainability is not a concern here.
 ///
@@ -134,6 +136,10 @@ protected:
     {
         return bf;
     }
+    auto getSubtreeSize() const noexcept -> std::size_t
+    {
+        return sz;
+    }
     auto getNextInOrderNode(const bool reverse = false) noexcept -> Derived*
     {
         return getNextInOrderNodeImpl<Derived>(this, reverse);
@@ -270,6 +276,7 @@ private:
         lr[0] = other.lr[0];
         lr[1] = other.lr[1];
         bf    = other.bf;
+        sz    = other.sz;
         other.unlink();
 
         if (nullptr != up)
@@ -300,6 +307,27 @@ private:
             lr[!r]->up = this;
         }
         z->lr[r] = this;
+
+        // The rotated subtree as a whole keeps the same set of nodes, so its new top inherits the total size;
+        // the old top has to recount its size from its (possibly new) children.
+        z->sz = sz;
+        sz    = 1U + subtreeSize(lr[0]) + subtreeSize(lr[1]);
+    }
+
+    static auto subtreeSize(const Node* const node) noexcept -> std::size_t
+    {
+        return (node != nullptr) ? node->sz : 0U;
+    }
+
+    /// Adjusts subtree sizes of the given node and all its ancestors up to the root (inclusive).
+    static void adjustSubtreeSizes(Node* node, const bool increment) noexcept
+    {
+        while ((node != nullptr) && node->isLinked())
+        {
+            CAVL_ASSERT(increment || (node->sz > 1U));
+            node->sz = increment ? (node->sz + 1U) : (node->sz - 1U);
+            node     = node->up;
+        }
     }
 
     auto adjustBalance(const bool increment) noexcept -> Node*;
@@ -364,6 +392,7 @@ private:
         lr[0] = nullptr;
         lr[1] = nullptr;
         bf    = 0;
+        sz    = 1U;
     }
 
     static auto extremum(Node* const root, const bool maximum) noexcept -> Derived*
@@ -403,6 +432,7 @@ private:
 
     Node*                up = nullptr;
     std::array<Node*, 2> lr{};
+    std::size_t          sz = 1U;  ///< Number of nodes in the subtree rooted at this node (including itself).
     std::int8_t          bf = 0;
 };
 
@@ -456,6 +486,8 @@ auto Node<Derived>::search(Node& origin, const Pre& predicate, const Fac& factor
         root    = out;
         out->up = &origin;
     }
+    // Sizes are updated before the retracing b/c rotations rely on valid sizes of the rotated children.
+    adjustSubtreeSizes(out->up, true);
     if (Node* const rt = out->retraceOnGrowth())
     {
         root = rt;
@@ -478,6 +510,7 @@ void Node<Derived>::removeImpl(const Node* const node) noexcept
         Node* const re = min(node->lr[1]);
         CAVL_ASSERT((re != nullptr) && (nullptr == re->lr[0]) && (re->up != nullptr));
         re->bf        = node->bf;
+        re->sz        = node->sz;  // Will be decremented below (as part of the `p` ancestry).
         re->lr[0]     = node->lr[0];
         re->lr[0]->up = re;
         if (re->up != node)
@@ -517,6 +550,10 @@ void Node<Derived>::removeImpl(const Node* const node) noexcept
             p->lr[r]->up = p;
         }
     }
+    // All nodes on the path from `p` up to the root have lost exactly one node from their subtrees.
+    // Sizes are updated before the retracing b/c rotations rely on valid sizes of the rotated children.
+    adjustSubtreeSizes(p, false);
+
     // Now that the topology is updated, perform the retracing to restore balance. We climb up adjusting the
     // balance factors until we reach the root or a parent whose balance factor becomes plus/minus one, which
     // means that that parent was able to absorb the balance delta; in other words, the height of the outer
@@ -919,26 +956,20 @@ public:
         return getRootNode();
     }
 
-    /// Access i-th element of the tree in linear time. Returns nullptr if the index is out of bounds.
+    /// Access i-th (in-order) element of the tree in logarithmic time. Returns nullptr if the index is out of bounds.
     auto operator[](const std::size_t index) -> Derived*
     {
-        std::size_t i = index;
-        // No Sonar cpp:S881 b/c this decrement is pretty much straightforward - no maintenance concerns.
-        return traverseInOrder([&i](auto& x) { return (i-- == 0) ? &x : nullptr; });  // NOSONAR cpp:S881
+        return NodeType::down(findByIndex<NodeType>(origin_node_.lr[0], index));
     }
     auto operator[](const std::size_t index) const -> const Derived*
     {
-        std::size_t i = index;
-        // No Sonar cpp:S881 b/c this decrement is pretty much straightforward - no maintenance concerns.
-        return traverseInOrder([&i](const auto& x) { return (i-- == 0) ? &x : nullptr; });  // NOSONAR cpp:S881
+        return NodeType::down(findByIndex<const NodeType>(origin_node_.lr[0], index));
     }
 
-    /// Beware that this convenience method has linear complexity. Use responsibly.
-    auto size() const noexcept
+    /// Constant-complexity b/c the root node keeps the size of the whole tree.
+    auto size() const noexcept -> std::size_t
     {
-        auto i = 0UL;
-        traverseInOrder([&i](auto& /*unused*/) { i++; });
-        return i;
+        return NodeType::subtreeSize(origin_node_.lr[0]);
     }
 
     /// Unlike size(), this one is constant-complexity.
@@ -979,6 +1010,30 @@ private:
         const Tree& that;
     };
 
+    template <typename NodeT>
+    static auto findByIndex(NodeT* node, const std::size_t index) noexcept -> NodeT*
+    {
+        std::size_t i = index;
+        while (node != nullptr)
+        {
+            const std::size_t left_size = NodeType::subtreeSize(node->lr[0]);
+            if (i == left_size)
+            {
+                break;
+            }
+            if (i < left_size)
+            {
+                node = node->lr[0];
+            }
+            else
+            {
+                i -= left_size + 1U;
+                node = node->lr[1];
+            }
+        }
+        return node;
+    }
+
     // root node pointer is stored in the origin_node_ left child.
     auto getRootNode() noexcept -> Derived*
     {
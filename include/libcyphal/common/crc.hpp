@@ -6,7 +6,12 @@
 #ifndef LIBCYPHAL_COMMON_CRC_HPP_INCLUDED
 #define LIBCYPHAL_COMMON_CRC_HPP_INCLUDED
 
+#include <cetl/cetl.hpp>
+
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 
 namespace libcyphal
 {
@@ -33,6 +38,29 @@ public:
         return ~crc_;
     }
 
+    /// Calculates the CRC of a given character string at compile time.
+    ///
+    /// Produces the same result as `CRC64WE{begin, end}.get()`, but bit by bit (without the lookup table),
+    /// so it is much slower and intended for `constexpr` contexts only (f.e. pre-hashing of register names).
+    ///
+    static constexpr auto compute(const char* const data, const std::size_t size) noexcept -> std::uint64_t
+    {
+        constexpr std::uint64_t Poly   = 0x42F0E1EBA9EA3693ULL;
+        constexpr std::uint64_t TopBit = 1ULL << 63U;
+
+        std::uint64_t crc = std::numeric_limits<std::uint64_t>::max();
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            crc ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i])) << 56U;
+            for (std::uint8_t bit = 0; bit < 8U; ++bit)
+            {
+                crc = ((crc & TopBit) != 0U) ? ((crc << 1U) ^ Poly) : (crc << 1U);
+            }
+        }
+        return ~crc;
+    }
+
 private:
     // No Sonar `cpp:S5008` and `cpp:S5356` b/c they are unavoidable - raw data!
     // TODO: Reconsider with `cetl::span<cetl::byte>`.
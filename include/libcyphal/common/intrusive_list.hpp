@@ -0,0 +1,236 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_COMMON_INTRUSIVE_LIST_HPP_INCLUDED
+#define LIBCYPHAL_COMMON_INTRUSIVE_LIST_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+
+#include <cstddef>
+
+namespace libcyphal
+{
+namespace common
+{
+
+template <typename Derived>
+class IntrusiveList;
+
+/// Defines a node of an intrusive doubly-linked list.
+///
+/// The node type is to be composed with the user type through CRTP inheritance (the same way as `cavl::Node`).
+/// The node knows its list, so it could be removed (f.e. on destruction) in constant time without the list reference.
+/// The node can be moved - the new node takes the place of the old one in the list.
+/// Note that this class has no public members - the list is used to manipulate its nodes.
+///
+template <typename Derived>
+class IntrusiveListNode
+{
+public:
+    IntrusiveListNode(const IntrusiveListNode&)                = delete;
+    IntrusiveListNode& operator=(const IntrusiveListNode&)     = delete;
+    IntrusiveListNode& operator=(IntrusiveListNode&&) noexcept = delete;
+
+protected:
+    IntrusiveListNode() = default;
+
+    IntrusiveListNode(IntrusiveListNode&& other) noexcept
+        : list_{other.list_}
+        , prev_{other.prev_}
+        , next_{other.next_}
+    {
+        if (list_ != nullptr)
+        {
+            ((prev_ != nullptr) ? prev_->next_ : list_->head_) = this;
+            ((next_ != nullptr) ? next_->prev_ : list_->tail_) = this;
+
+            other.list_ = nullptr;
+            other.prev_ = nullptr;
+            other.next_ = nullptr;
+        }
+    }
+
+    ~IntrusiveListNode()
+    {
+        if (list_ != nullptr)
+        {
+            list_->remove(*this);
+        }
+    }
+
+private:
+    friend class IntrusiveList<Derived>;
+
+    // MARK: Data members:
+
+    IntrusiveList<Derived>* list_{nullptr};
+    IntrusiveListNode*      prev_{nullptr};
+    IntrusiveListNode*      next_{nullptr};
+
+};  // IntrusiveListNode
+
+/// Defines an intrusive doubly-linked list.
+///
+/// All operations (except traversal and `clear`) are constant-time, and none of them allocates memory.
+/// The list doesn't own its nodes - a node is removed from the list automatically on its destruction,
+/// and all remaining nodes are unlinked on the list destruction.
+///
+/// The list is neither copyable nor movable - its nodes refer to it.
+///
+template <typename Derived>
+class IntrusiveList final
+{
+    using NodeType = IntrusiveListNode<Derived>;
+
+public:
+    IntrusiveList() = default;
+
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    IntrusiveList(const IntrusiveList&)                = delete;
+    IntrusiveList(IntrusiveList&&) noexcept            = delete;
+    IntrusiveList& operator=(const IntrusiveList&)     = delete;
+    IntrusiveList& operator=(IntrusiveList&&) noexcept = delete;
+
+    /// Gets number of nodes in the list.
+    ///
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /// Checks whether the given node is linked to this list.
+    ///
+    bool contains(const Derived& node) const noexcept
+    {
+        return static_cast<const NodeType&>(node).list_ == this;
+    }
+
+    /// Gets the first node of the list, or `nullptr` if the list is empty.
+    ///
+    Derived* front() noexcept
+    {
+        return down(head_);
+    }
+
+    /// Appends an unlinked node to the end of the list.
+    ///
+    void pushBack(Derived& derived) noexcept
+    {
+        NodeType& node = derived;
+        CETL_DEBUG_ASSERT(node.list_ == nullptr, "Should not be linked yet.");
+
+        node.list_ = this;
+        node.prev_ = tail_;
+        node.next_ = nullptr;
+        ((tail_ != nullptr) ? tail_->next_ : head_) = &node;
+        tail_                                        = &node;
+        ++size_;
+    }
+
+    /// Removes the first node of the list.
+    ///
+    /// @return The removed node, or `nullptr` if the list is empty.
+    ///
+    Derived* popFront() noexcept
+    {
+        Derived* const front_node = front();
+        if (front_node != nullptr)
+        {
+            remove(*front_node);
+        }
+        return front_node;
+    }
+
+    /// Removes the node from the list. Has no effect if the node is not linked to this list.
+    ///
+    void remove(Derived& derived) noexcept
+    {
+        remove(static_cast<NodeType&>(derived));
+    }
+
+    /// Removes (unlinks) all nodes. The complexity is linear.
+    ///
+    void clear() noexcept
+    {
+        while (head_ != nullptr)
+        {
+            remove(*head_);
+        }
+    }
+
+    /// Traverses all nodes in the list order.
+    ///
+    /// The visitor should have `void(Derived&)` signature. It may remove the visited node (but not the others).
+    ///
+    template <typename Visitor>
+    void traverse(const Visitor& visitor)
+    {
+        NodeType* node = head_;
+        while (node != nullptr)
+        {
+            NodeType* const next = node->next_;
+            visitor(*down(node));
+            node = next;
+        }
+    }
+    template <typename Visitor>
+    void traverse(const Visitor& visitor) const
+    {
+        const NodeType* node = head_;
+        while (node != nullptr)
+        {
+            visitor(*down(node));
+            node = node->next_;
+        }
+    }
+
+private:
+    friend class IntrusiveListNode<Derived>;
+
+    static Derived* down(NodeType* const node) noexcept
+    {
+        return static_cast<Derived*>(node);
+    }
+    static const Derived* down(const NodeType* const node) noexcept
+    {
+        return static_cast<const Derived*>(node);
+    }
+
+    void remove(NodeType& node) noexcept
+    {
+        if (node.list_ != this)
+        {
+            return;
+        }
+
+        ((node.prev_ != nullptr) ? node.prev_->next_ : head_) = node.next_;
+        ((node.next_ != nullptr) ? node.next_->prev_ : tail_) = node.prev_;
+        node.list_                                            = nullptr;
+        node.prev_                                            = nullptr;
+        node.next_                                            = nullptr;
+        --size_;
+    }
+
+    // MARK: Data members:
+
+    NodeType*   head_{nullptr};
+    NodeType*   tail_{nullptr};
+    std::size_t size_{0};
+
+};  // IntrusiveList
+
+}  // namespace common
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_COMMON_INTRUSIVE_LIST_HPP_INCLUDED
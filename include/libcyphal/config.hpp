@@ -55,10 +55,283 @@ struct Config
                 return sizeof(void*) * 4;
             }
 
+            /// Defines max footprint of a callback function in use by the shared heartbeat scheduler
+            /// to trigger its member producers.
+            ///
+            static constexpr std::size_t HeartbeatScheduler_MemberCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines number of phase slots of the shared heartbeat scheduler.
+            ///
+            /// The heartbeat period is split into this many equal slots, and member producers are evenly spread
+            /// among them - so that only a fraction of all producers publishes at every scheduler tick.
+            ///
+            static constexpr std::size_t HeartbeatScheduler_SlotCount()  // NOSONAR cpp:S799
+            {
+                return 10;
+            }
+
+            /// Defines max footprint of a callback function in use by the bulk registry client to deliver entries.
+            ///
+            static constexpr std::size_t BulkRegistryClient_EntryCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the bulk registry client to report completion.
+            ///
+            static constexpr std::size_t BulkRegistryClient_CompletionCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max number of concurrent (aka pipelined) requests of the bulk registry client.
+            ///
+            /// Note that the CAN transport limits number of pending requests by 32 (transfer ID range) per client.
+            ///
+            static constexpr std::size_t BulkRegistryClient_MaxPipelineDepth()  // NOSONAR cpp:S799
+            {
+                return 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the node tracker to report node changes.
+            ///
+            static constexpr std::size_t NodeTracker_EventCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines number of node IDs which states are kept by the node tracker in its flat (inline) array.
+            ///
+            /// Default value covers the whole CAN node ID range (0...127), so that tracking of CAN nodes
+            /// doesn't need any memory allocation. States of nodes with bigger IDs (UDP) are allocated on demand.
+            ///
+            static constexpr std::size_t NodeTracker_FlatCapacity()  // NOSONAR cpp:S799
+            {
+                return 128;
+            }
+
+            /// Defines max footprint of a callback function in use by the node info cache to report queried info.
+            ///
+            static constexpr std::size_t NodeInfoCache_InfoCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max number of concurrent 'GetInfo' requests of the node info cache.
+            ///
+            static constexpr std::size_t NodeInfoCache_MaxConcurrency()  // NOSONAR cpp:S799
+            {
+                return 4;
+            }
+
+            /// Defines max number of files which are kept open by the file server at the same time.
+            ///
+            static constexpr std::size_t FileServer_MaxOpenFiles()  // NOSONAR cpp:S799
+            {
+                return 4;
+            }
+
+            /// Defines size of a read-ahead cache block of the file server.
+            ///
+            /// The block is loaded from a (not memory mapped) file at once, and then serves multiple read requests.
+            ///
+            static constexpr std::size_t FileServer_CacheBlockSize()  // NOSONAR cpp:S799
+            {
+                return 4096;
+            }
+
+            /// Defines number of read-ahead cache blocks per an open file of the file server.
+            ///
+            /// Blocks are shared between all clients reading the same file, so it's worth to have
+            /// at least as many blocks as there are expected clients reading at different offsets.
+            ///
+            static constexpr std::size_t FileServer_CacheBlockCount()  // NOSONAR cpp:S799
+            {
+                return 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the file read client to deliver file data.
+            ///
+            static constexpr std::size_t FileReadClient_DataCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the file read client to report completion.
+            ///
+            static constexpr std::size_t FileReadClient_CompletionCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max number of outstanding 'Read' requests (aka sliding window) of the file read client.
+            ///
+            /// Every outstanding request keeps its own response buffer (for out-of-order reassembly),
+            /// so the value affects memory footprint of the client. The window is also limited at runtime
+            /// by half of the transport transfer ID modulo (f.e. 16 for CAN).
+            ///
+            static constexpr std::size_t FileReadClient_MaxWindowSize()  // NOSONAR cpp:S799
+            {
+                return 8;
+            }
+
+            /// Defines number of node IDs (starting from zero) which are managed by the PnP node ID allocator.
+            ///
+            /// The allocator keeps a flat (inline) table indexed by node ID, plus a hash index twice as big,
+            /// so the value affects memory footprint of the allocator. Default value covers the whole CAN range.
+            ///
+            static constexpr std::size_t PnpAllocator_Capacity()  // NOSONAR cpp:S799
+            {
+                return 128;
+            }
+
+            /// Defines max footprint of a callback function in use by the PnP client to report allocated node ID.
+            ///
+            static constexpr std::size_t PnpClient_AllocationCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines number of slots in the ring buffer of not yet processed diagnostic records.
+            ///
+            /// Must be a power of two. Records logged while the ring is full are dropped (and accounted),
+            /// so the value should cover the worst-case burst between two consecutive drains of the ring.
+            ///
+            static constexpr std::size_t DiagnosticLogger_RingCapacity()  // NOSONAR cpp:S799
+            {
+                return 32;
+            }
+
+            /// Defines max length of text of a diagnostic record (in bytes). Longer texts are truncated.
+            ///
+            /// Every slot of the ring buffer keeps its own text buffer, so the value affects memory footprint
+            /// of the logger. The `uavcan.diagnostic.Record.1.1` message limits the text to 255 bytes.
+            ///
+            static constexpr std::size_t DiagnosticLogger_TextCapacity()  // NOSONAR cpp:S799
+            {
+                return 112;
+            }
+
+            /// Defines max footprint of a callback function in use by the 'ExecuteCommand' provider
+            /// to handle custom (non-standard) commands.
+            ///
+            static constexpr std::size_t ExecuteCommandProvider_CommandCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the 'ExecuteCommand' provider
+            /// to perform the node restart.
+            ///
+            static constexpr std::size_t ExecuteCommandProvider_RestartCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max length of a port register name (like `uavcan.pub.<port_name>.type`) of a bound port.
+            ///
+            /// Every bound port keeps its own name buffers (one per register), so the value affects memory footprint
+            /// of the port. Longer names are truncated. Standard register names are limited to 255 characters.
+            ///
+            static constexpr std::size_t PortBinder_NameCapacity()  // NOSONAR cpp:S799
+            {
+                return 64;
+            }
+
+            /// Defines max footprint of a callback function in use by the node error handler to report failures.
+            ///
+            static constexpr std::size_t ErrorHandler_ReportCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max number of ports which failures are individually counted by the node error handler.
+            ///
+            /// Failures of ports beyond this capacity are still counted (per failure kind), but not per port.
+            ///
+            static constexpr std::size_t ErrorHandler_PortCapacity()  // NOSONAR cpp:S799
+            {
+                return 16;
+            }
+
         };  // Node
 
+        struct Registry
+        {
+            /// Defines max footprint of a callback function in use by the registry to report dirty registers.
+            ///
+            static constexpr std::size_t Registry_DirtyCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the registry to report changed registers.
+            ///
+            static constexpr std::size_t Registry_ChangeCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the change notifier to report register changes.
+            ///
+            static constexpr std::size_t ChangeNotifier_ObserverCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+            /// Defines max footprint of a callback function in use by the deferred saver to report save completion.
+            ///
+            static constexpr std::size_t DeferredSaver_CompletionCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+        };  // Registry
+
     };  // Application
 
+    /// Defines various configuration parameters for the platform layer.
+    ///
+    struct Platform
+    {
+        /// Defines number of allocation size buckets in the histogram of a tracking memory resource.
+        ///
+        /// Buckets are powers of two starting from 8 bytes, and the last one collects all larger sizes.
+        /// So, the default 16 buckets distinguish sizes up to 128 KiB.
+        ///
+        static constexpr std::size_t TrackingMemoryResource_HistogramSize()  // NOSONAR cpp:S799
+        {
+            return 16;
+        }
+
+        /// Defines max footprint of a callback function in use by the guard memory resource to report violations.
+        ///
+        static constexpr std::size_t GuardMemoryResource_ViolationHandler_FunctionSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+            return sizeof(void*) * 4;
+        }
+
+    };  // Platform
+
     /// Defines various configuration parameters for the presentation layer.
     ///
     struct Presentation
@@ -129,6 +402,15 @@ struct Config
             return sizeof(void*) * 4;
         }
 
+        /// Defines max footprint of a callback function in use by the message TX completion notification.
+        /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+        ///
+        static constexpr std::size_t ITransport_MessageTxCompleteCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+            return sizeof(void*) * 4;
+        }
+
         /// Defines max footprint of a platform-specific error implementation.
         ///
         static constexpr std::size_t PlatformErrorMaxSize()
@@ -145,6 +427,20 @@ struct Config
             return sizeof(void*) * 8;
         }
 
+        /// Defines the size of the stack buffer in use to concatenate fragmented TX payloads.
+        ///
+        /// Transfers with several non-empty payload fragments have to be made contiguous before passing them
+        /// to the libcanard/libudpard. Payloads larger than this size are PMR allocated (from the general memory),
+        /// so a node which never sends larger fragmented payloads does not allocate on its TX paths.
+        ///
+        /// Setting it to 0 will force all such payloads to be PMR allocated.
+        ///
+        static constexpr std::size_t ContiguousPayload_SmallBufferSize()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary - as compromise between stack and PMR allocation.
+            return 256;
+        }
+
         /// Defines various configuration parameters for the CAN transport sublayer.
         ///
         struct Can
@@ -157,6 +453,14 @@ struct Config
                 return sizeof(void*) * 3;
             }
 
+            /// Defines max footprint of a callback function in use by the CAN media TX completion notification.
+            ///
+            static constexpr std::size_t IMedia_TxCompleteCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
         };  // Can
 
         /// Defines various configuration parameters for the UDO transport sublayer.
@@ -171,6 +475,14 @@ struct Config
                 return sizeof(void*) * 3;
             }
 
+            /// Defines max footprint of a callback function in use by the UDP TX socket completion notification.
+            ///
+            static constexpr std::size_t ITxSocket_TxCompleteCallback_FunctionMaxSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
         };  // Udp
 
     };  // Transport
@@ -0,0 +1,131 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PLATFORM_FILE_SYSTEM_HPP_INCLUDED
+#define LIBCYPHAL_PLATFORM_FILE_SYSTEM_HPP_INCLUDED
+
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace platform
+{
+namespace file_system
+{
+
+/// Defines possible errors that can occur during file system operations.
+///
+enum class Error : std::uint8_t
+{
+    NotFound,      ///< File (or directory) does not exist.
+    IO,            ///< Device input/output error.
+    AccessDenied,  ///< Not enough permissions to access the file.
+    IsDirectory,   ///< File operation is requested on a directory.
+    InvalidValue,  ///< Bad API invocation (e.g., malformed path).
+    FileTooLarge,  ///< File size exceeds what the implementation could handle.
+    NotSupported,  ///< Operation is not supported by the implementation.
+
+};  // Error
+
+/// Defines information about a file system entry.
+///
+struct Info
+{
+    std::uint64_t size{0};
+    std::uint64_t unix_timestamp_of_last_modification{0};
+    bool          is_file_not_directory{true};
+    bool          is_link{false};
+    bool          is_readable{false};
+    bool          is_writeable{false};
+
+};  // Info
+
+/// Defines interface of a file opened for reading.
+///
+class IFile
+{
+public:
+    IFile(IFile&&)                 = delete;
+    IFile(const IFile&)            = delete;
+    IFile& operator=(IFile&&)      = delete;
+    IFile& operator=(const IFile&) = delete;
+
+    /// Gets size of the file (at the moment of its opening).
+    ///
+    virtual std::uint64_t getSize() const noexcept = 0;
+
+    /// Gets the whole content of the file if it is mapped into memory.
+    ///
+    /// Mapped content allows readers to access file data directly (without copying it to intermediate buffers).
+    /// The content stays valid until the file is destroyed.
+    ///
+    /// @return Span of the file content (of `getSize()` bytes), or an empty span if the file is not mapped
+    ///         (in which case `read` should be used instead).
+    ///
+    virtual cetl::span<const cetl::byte> getMapped() const noexcept
+    {
+        return {};
+    }
+
+    /// Reads data from the file at a given offset.
+    ///
+    /// @param offset The offset in the file to read from. Reading beyond the end of file is not an error.
+    /// @param buffer The buffer to read the data to.
+    /// @return Either the number of bytes read (less than buffer size at the end of file) or an error.
+    ///
+    virtual auto read(const std::uint64_t offset, const cetl::span<cetl::byte> buffer) const
+        -> Expected<std::size_t, Error> = 0;
+
+protected:
+    IFile()  = default;
+    ~IFile() = default;
+
+};  // IFile
+
+/// Defines interface of a very simple read-only file system.
+///
+/// Paths are in the Cyphal format - with `/` as the separator; interpretation of them is up to the implementation
+/// (f.e. relative to some root directory). Implementation is allowed to block, but it's expected to be fast
+/// enough to be called from an executor callback (f.e. by memory mapping the files).
+///
+class IFileSystem
+{
+public:
+    IFileSystem(IFileSystem&&)                 = delete;
+    IFileSystem(const IFileSystem&)            = delete;
+    IFileSystem& operator=(IFileSystem&&)      = delete;
+    IFileSystem& operator=(const IFileSystem&) = delete;
+
+    /// Gets information about a file system entry.
+    ///
+    /// @param path The path of the file (or directory) to get information about.
+    /// @return Either the information or an error.
+    ///
+    virtual auto getInfo(const cetl::string_view path) const -> Expected<Info, Error> = 0;
+
+    /// Opens a file for reading.
+    ///
+    /// @param path The path of the file to open.
+    /// @return Either unique pointer to the opened file or an error.
+    ///
+    virtual auto open(const cetl::string_view path) -> Expected<UniquePtr<IFile>, Error> = 0;
+
+protected:
+    IFileSystem()  = default;
+    ~IFileSystem() = default;
+
+};  // IFileSystem
+
+}  // namespace file_system
+}  // namespace platform
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PLATFORM_FILE_SYSTEM_HPP_INCLUDED
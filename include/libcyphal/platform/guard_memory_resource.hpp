@@ -0,0 +1,206 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PLATFORM_GUARD_MEMORY_RESOURCE_HPP_INCLUDED
+#define LIBCYPHAL_PLATFORM_GUARD_MEMORY_RESOURCE_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace platform
+{
+
+/// @brief Defines a memory resource, which forbids allocations once armed (f.e. after initialization is completed).
+///
+/// For hard real-time nodes any allocation in the steady state is a bug. The resource passes all requests
+/// through to its upstream while disarmed (the initialization and warm-up phase), and once `arm`-ed,
+/// every allocation is reported as a violation (see `setViolationHandler`), and by default also refused -
+/// so that the owner of the allocation observes an ordinary out-of-memory failure.
+///
+/// Deallocations are always passed through (and never reported) - releasing memory is fine at any time.
+///
+/// Usually the resource guards "designated" memory only - the one which is not expected to be in use
+/// on hot paths (like the transport general memory), while resources which are in use per transfer by design
+/// (like the CAN TX queue or UDP payload buffers) are better instrumented with `TrackingMemoryResource`.
+///
+class GuardMemoryResource final : public cetl::pmr::memory_resource
+{
+public:
+    /// @brief Defines construction options of the resource.
+    ///
+    struct Options
+    {
+        /// Refuses (returns `nullptr`) allocations made while armed. Otherwise, violations are just reported.
+        bool refuse_when_armed{true};
+    };
+
+    /// @brief Defines a violation report - an allocation made while the resource was armed.
+    ///
+    struct Violation
+    {
+        /// Holds the requested size of the allocation.
+        std::size_t size_bytes;
+
+        /// Holds the requested alignment of the allocation.
+        std::size_t alignment;
+
+        /// Holds whether the allocation was refused (see `Options::refuse_when_armed`).
+        bool refused;
+    };
+
+    /// @brief Defines signature of the violation handler.
+    ///
+    /// The handler is called in context of the allocating code, so it should not allocate from this resource.
+    ///
+    static constexpr auto FunctionSize = config::Platform::GuardMemoryResource_ViolationHandler_FunctionSize();
+    using ViolationHandler             = cetl::pmr::function<void(const Violation& violation), FunctionSize>;
+
+    /// @brief Constructs a new (disarmed) guard memory resource.
+    ///
+    /// @param upstream The memory resource to pass requests to. Should outlive the resource.
+    /// @param options Extra options of the resource.
+    ///
+    GuardMemoryResource(cetl::pmr::memory_resource& upstream, const Options options)
+        : upstream_{upstream}
+        , options_{options}
+    {
+    }
+
+    /// @brief Constructs a new (disarmed) guard memory resource with default options.
+    ///
+    explicit GuardMemoryResource(cetl::pmr::memory_resource& upstream)
+        : GuardMemoryResource{upstream, Options{}}
+    {
+    }
+
+    ~GuardMemoryResource() override = default;
+
+    GuardMemoryResource(const GuardMemoryResource&)                = delete;
+    GuardMemoryResource(GuardMemoryResource&&) noexcept            = delete;
+    GuardMemoryResource& operator=(const GuardMemoryResource&)     = delete;
+    GuardMemoryResource& operator=(GuardMemoryResource&&) noexcept = delete;
+
+    /// @brief Gets the upstream memory resource.
+    ///
+    cetl::pmr::memory_resource& getUpstream() const noexcept
+    {
+        return upstream_;
+    }
+
+    /// @brief Arms the guard - all following allocations are violations.
+    ///
+    void arm() noexcept
+    {
+        is_armed_.store(true, std::memory_order_release);
+    }
+
+    /// @brief Disarms the guard - all following allocations are passed through to the upstream.
+    ///
+    /// Useful f.e. around a reconfiguration, where allocations are expected.
+    ///
+    void disarm() noexcept
+    {
+        is_armed_.store(false, std::memory_order_release);
+    }
+
+    /// @brief Gets whether the guard is armed.
+    ///
+    bool isArmed() const noexcept
+    {
+        return is_armed_.load(std::memory_order_acquire);
+    }
+
+    /// @brief Gets total number of violations so far.
+    ///
+    std::uint64_t getViolationsCount() const noexcept
+    {
+        return violations_count_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Sets the violation handler.
+    ///
+    /// Should be set before arming - the handler itself is not guarded against concurrent allocations.
+    ///
+    /// @param handler The handler to call on every violation. Empty function disables reporting.
+    ///
+    void setViolationHandler(ViolationHandler&& handler)
+    {
+        violation_handler_ = std::move(handler);
+    }
+
+private:
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (isArmed() && onViolation(size_bytes, alignment))
+        {
+            return nullptr;
+        }
+        return upstream_.allocate(size_bytes, alignment);
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        upstream_.deallocate(ptr, size_bytes, alignment);
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        if (isArmed() && onViolation(new_size_bytes, alignment))
+        {
+            return nullptr;
+        }
+        return upstream_.reallocate(ptr, old_size_bytes, new_size_bytes, alignment);
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    /// Reports a violation, and returns `true` if the allocation should be refused.
+    ///
+    bool onViolation(const std::size_t size_bytes, const std::size_t alignment)
+    {
+        violations_count_.fetch_add(1, std::memory_order_relaxed);
+        if (violation_handler_)
+        {
+            violation_handler_(Violation{size_bytes, alignment, options_.refuse_when_armed});
+        }
+        return options_.refuse_when_armed;
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& upstream_;
+    const Options               options_;
+    std::atomic<bool>           is_armed_{false};
+    std::atomic<std::uint64_t>  violations_count_{0};
+    ViolationHandler            violation_handler_;
+
+};  // GuardMemoryResource
+
+}  // namespace platform
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PLATFORM_GUARD_MEMORY_RESOURCE_HPP_INCLUDED
@@ -0,0 +1,436 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PLATFORM_TRACKING_MEMORY_RESOURCE_HPP_INCLUDED
+#define LIBCYPHAL_PLATFORM_TRACKING_MEMORY_RESOURCE_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace libcyphal
+{
+namespace platform
+{
+
+/// @brief Defines an instrumented memory resource, which accounts allocations passed through to its upstream.
+///
+/// The resource is meant to be used in production (not only in tests) to find out which subsystem holds memory,
+/// so every subsystem (f.e. CAN TX queue, UDP fragments or payloads, sessions, presentation objects)
+/// gets its own instance with a distinct tag, all of them usually sharing the same upstream resource.
+/// See also `transport::can::TrackingMemoryResources` and `transport::udp::TrackingMemoryResources`.
+///
+/// Counters are atomic, so statistics could be read (f.e. by a diagnostic thread) concurrently with allocations,
+/// and the resource itself is as thread-safe as its upstream. Besides the counters, the resource maintains:
+/// - a high-water mark of the bytes in use (could be reset, f.e. after initialization is completed);
+/// - a histogram of allocation sizes (see `config::Platform::TrackingMemoryResource_HistogramSize`);
+/// - optionally (see `Options::track_leaks`), a list of live allocations. Each allocation then gets a small
+///   header (so the upstream gets a bit larger requests), and the list is guarded by a spin lock.
+///
+/// Statistics don't depend on the leak tracking, and so it's off by default.
+///
+class TrackingMemoryResource final : public cetl::pmr::memory_resource
+{
+    struct LiveHeader;
+
+public:
+    /// @brief Defines number of buckets in the allocation size histogram.
+    ///
+    static constexpr std::size_t HistogramSize = config::Platform::TrackingMemoryResource_HistogramSize();
+
+    /// @brief Defines the smallest allocation size bucket (the upper bound of the first bucket).
+    ///
+    static constexpr std::size_t HistogramMinBucketSize = 8;
+
+    /// @brief Defines construction options of the resource.
+    ///
+    struct Options
+    {
+        /// Enables tracking of live allocations (see `visitLiveAllocations`).
+        bool track_leaks{false};
+    };
+
+    /// @brief Defines a snapshot of the resource statistics.
+    ///
+    /// Counters are read one by one (not atomically as a whole), so a snapshot taken concurrently with
+    /// allocations might be slightly inconsistent.
+    ///
+    struct Statistics
+    {
+        /// Total number of successful allocations (including reallocations).
+        std::uint64_t allocations_count;
+
+        /// Total number of deallocations.
+        std::uint64_t deallocations_count;
+
+        /// Total number of allocations refused by the upstream.
+        std::uint64_t failures_count;
+
+        /// Total number of bytes allocated so far.
+        std::uint64_t total_allocated_bytes;
+
+        /// Number of bytes currently in use (allocated, but not yet deallocated).
+        std::size_t in_use_bytes;
+
+        /// The highest number of bytes in use since construction (or since `resetHighWaterMark`).
+        std::size_t high_water_bytes;
+
+        /// Number of allocations per size bucket. Bucket `i` counts sizes in `(8 * 2^(i-1), 8 * 2^i]` range,
+        /// except the last bucket, which counts all larger sizes too.
+        std::array<std::uint64_t, HistogramSize> histogram;
+    };
+
+    /// @brief Defines a live allocation entry (see `visitLiveAllocations`).
+    ///
+    struct LiveAllocation
+    {
+        const void* pointer;
+        std::size_t size;
+    };
+
+    /// @brief Constructs a new tracking memory resource.
+    ///
+    /// @param tag The static name of the subsystem which memory is tracked (f.e. "udp.payload").
+    ///            The pointer is stored as is, so it should be a string literal (or outlive the resource).
+    /// @param upstream The memory resource to pass allocations to. Should outlive the resource.
+    /// @param options Extra options of the resource.
+    ///
+    TrackingMemoryResource(const char* const tag, cetl::pmr::memory_resource& upstream, const Options options)
+        : tag_{tag}
+        , upstream_{upstream}
+        , options_{options}
+    {
+        CETL_DEBUG_ASSERT(tag != nullptr, "");
+    }
+
+    /// @brief Constructs a new tracking memory resource with default options.
+    ///
+    TrackingMemoryResource(const char* const tag, cetl::pmr::memory_resource& upstream)
+        : TrackingMemoryResource{tag, upstream, Options{}}
+    {
+    }
+
+    /// @brief Constructs a new tracking memory resource on top of the default memory resource.
+    ///
+    explicit TrackingMemoryResource(const char* const tag)
+        : TrackingMemoryResource{tag, *cetl::pmr::get_default_resource()}
+    {
+    }
+
+    ~TrackingMemoryResource() override = default;
+
+    TrackingMemoryResource(const TrackingMemoryResource&)                = delete;
+    TrackingMemoryResource(TrackingMemoryResource&&) noexcept            = delete;
+    TrackingMemoryResource& operator=(const TrackingMemoryResource&)     = delete;
+    TrackingMemoryResource& operator=(TrackingMemoryResource&&) noexcept = delete;
+
+    /// @brief Gets the tag (name of the subsystem) of the resource.
+    ///
+    const char* getTag() const noexcept
+    {
+        return tag_;
+    }
+
+    /// @brief Gets the upstream memory resource.
+    ///
+    cetl::pmr::memory_resource& getUpstream() const noexcept
+    {
+        return upstream_;
+    }
+
+    /// @brief Takes a snapshot of the statistics.
+    ///
+    Statistics getStatistics() const noexcept
+    {
+        Statistics stats{};
+        stats.allocations_count     = allocations_count_.load(std::memory_order_relaxed);
+        stats.deallocations_count   = deallocations_count_.load(std::memory_order_relaxed);
+        stats.failures_count        = failures_count_.load(std::memory_order_relaxed);
+        stats.total_allocated_bytes = total_allocated_bytes_.load(std::memory_order_relaxed);
+        stats.in_use_bytes          = in_use_bytes_.load(std::memory_order_relaxed);
+        stats.high_water_bytes      = high_water_bytes_.load(std::memory_order_relaxed);
+        for (std::size_t index = 0; index < HistogramSize; ++index)
+        {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            stats.histogram[index] = histogram_[index].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    /// @brief Resets the high-water mark to the current number of bytes in use.
+    ///
+    /// Useful to measure the peak usage of some phase (f.e. a steady state after initialization).
+    ///
+    void resetHighWaterMark() noexcept
+    {
+        high_water_bytes_.store(in_use_bytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    /// @brief Gets number of live allocations, or zero if leak tracking is disabled.
+    ///
+    std::size_t getLiveAllocationsCount() const noexcept
+    {
+        const LockGuard lock{live_lock_};
+        return live_count_;
+    }
+
+    /// @brief Visits all live allocations (in order of allocation), if leak tracking is enabled.
+    ///
+    /// The visitor is called under the internal lock, so it should neither block,
+    /// nor allocate from (or deallocate to) this resource.
+    ///
+    /// @param visitor The function to call with `const LiveAllocation&` argument.
+    ///
+    template <typename Visitor>
+    void visitLiveAllocations(const Visitor& visitor) const
+    {
+        const LockGuard lock{live_lock_};
+        for (const LiveHeader* header = live_head_; header != nullptr; header = header->next)
+        {
+            visitor(LiveAllocation{header->user_pointer, header->size});
+        }
+    }
+
+    /// @brief Gets index of the histogram bucket for the given allocation size.
+    ///
+    static constexpr std::size_t getHistogramBucket(const std::size_t size_bytes) noexcept
+    {
+        std::size_t index       = 0;
+        std::size_t bucket_size = HistogramMinBucketSize;
+        while ((size_bytes > bucket_size) && (index < (HistogramSize - 1)))
+        {
+            bucket_size <<= 1U;
+            ++index;
+        }
+        return index;
+    }
+
+private:
+    /// Header prepended to every allocation when leak tracking is enabled.
+    /// It links all live allocations into an intrusive doubly linked list (so no extra memory is needed).
+    ///
+    struct LiveHeader
+    {
+        LiveHeader* prev;
+        LiveHeader* next;
+        const void* user_pointer;
+        std::size_t size;
+    };
+
+    /// Minimal RAII guard for the spin lock (`std::lock_guard` requires `lock`/`unlock` methods).
+    ///
+    class LockGuard final
+    {
+    public:
+        explicit LockGuard(std::atomic_flag& flag) noexcept
+            : flag_{flag}
+        {
+            while (flag_.test_and_set(std::memory_order_acquire))
+            {
+                // Spin - critical sections are just a few pointer updates.
+            }
+        }
+
+        ~LockGuard()
+        {
+            flag_.clear(std::memory_order_release);
+        }
+
+        LockGuard(const LockGuard&)                = delete;
+        LockGuard(LockGuard&&) noexcept            = delete;
+        LockGuard& operator=(const LockGuard&)     = delete;
+        LockGuard& operator=(LockGuard&&) noexcept = delete;
+
+    private:
+        std::atomic_flag& flag_;
+
+    };  // LockGuard
+
+    /// Gets alignment of the upstream (header prefixed) allocation - the header itself has to be aligned as well,
+    /// even if the requested alignment is weaker (f.e. byte buffers).
+    ///
+    static std::size_t getRawAlignment(const std::size_t alignment) noexcept
+    {
+        return std::max(alignment, alignof(LiveHeader));
+    }
+
+    /// Gets size of the header area (aligned, so that the user pointer keeps the requested alignment).
+    ///
+    static std::size_t getHeaderOffset(const std::size_t alignment) noexcept
+    {
+        const std::size_t align = getRawAlignment(alignment);
+        return ((sizeof(LiveHeader) + align - 1U) / align) * align;
+    }
+
+    void onAllocated(const std::size_t size_bytes) noexcept
+    {
+        allocations_count_.fetch_add(1, std::memory_order_relaxed);
+        total_allocated_bytes_.fetch_add(size_bytes, std::memory_order_relaxed);
+        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+        histogram_[getHistogramBucket(size_bytes)].fetch_add(1, std::memory_order_relaxed);
+
+        const std::size_t in_use = in_use_bytes_.fetch_add(size_bytes, std::memory_order_relaxed) + size_bytes;
+        std::size_t       high   = high_water_bytes_.load(std::memory_order_relaxed);
+        while ((in_use > high) && !high_water_bytes_.compare_exchange_weak(high, in_use, std::memory_order_relaxed))
+        {
+            // `high` is reloaded by the failed exchange.
+        }
+    }
+
+    void onDeallocated(const std::size_t size_bytes) noexcept
+    {
+        deallocations_count_.fetch_add(1, std::memory_order_relaxed);
+        in_use_bytes_.fetch_sub(size_bytes, std::memory_order_relaxed);
+    }
+
+    void* linkLive(void* const raw_ptr, const std::size_t size_bytes, const std::size_t alignment) noexcept
+    {
+        // No Sonar cpp:S5356 and cpp:S5357 b/c we do raw memory arithmetic here.
+        auto* const header   = static_cast<LiveHeader*>(raw_ptr);                                // NOSONAR
+        auto* const user_ptr = static_cast<cetl::byte*>(raw_ptr) + getHeaderOffset(alignment);  // NOSONAR
+        *header              = LiveHeader{nullptr, nullptr, user_ptr, size_bytes};
+
+        const LockGuard lock{live_lock_};
+        header->prev = live_tail_;
+        (live_tail_ != nullptr ? live_tail_->next : live_head_) = header;
+        live_tail_                                              = header;
+        ++live_count_;
+        return user_ptr;
+    }
+
+    void* unlinkLive(void* const user_ptr, const std::size_t alignment) noexcept
+    {
+        // No Sonar cpp:S5356 and cpp:S5357 b/c we do raw memory arithmetic here.
+        auto* const raw_ptr = static_cast<cetl::byte*>(user_ptr) - getHeaderOffset(alignment);  // NOSONAR
+        auto* const header  = static_cast<LiveHeader*>(static_cast<void*>(raw_ptr));            // NOSONAR
+        CETL_DEBUG_ASSERT(header->user_pointer == user_ptr, "Not allocated by this resource.");
+
+        const LockGuard lock{live_lock_};
+        (header->prev != nullptr ? header->prev->next : live_head_) = header->next;
+        (header->next != nullptr ? header->next->prev : live_tail_) = header->prev;
+        --live_count_;
+        return raw_ptr;
+    }
+
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (!options_.track_leaks)
+        {
+            void* const ptr = upstream_.allocate(size_bytes, alignment);
+            if (ptr == nullptr)
+            {
+                failures_count_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            onAllocated(size_bytes);
+            return ptr;
+        }
+
+        void* const raw_ptr =
+            upstream_.allocate(getHeaderOffset(alignment) + size_bytes, getRawAlignment(alignment));
+        if (raw_ptr == nullptr)
+        {
+            failures_count_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        onAllocated(size_bytes);
+        return linkLive(raw_ptr, size_bytes, alignment);
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        CETL_DEBUG_ASSERT((nullptr != ptr) || (0 == size_bytes), "");
+
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        onDeallocated(size_bytes);
+
+        if (!options_.track_leaks)
+        {
+            upstream_.deallocate(ptr, size_bytes, alignment);
+            return;
+        }
+        upstream_.deallocate(unlinkLive(ptr, alignment),
+                             getHeaderOffset(alignment) + size_bytes,
+                             getRawAlignment(alignment));
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        CETL_DEBUG_ASSERT((nullptr != ptr) || (0 == old_size_bytes), "");
+
+        if (!options_.track_leaks)
+        {
+            void* const new_ptr = upstream_.reallocate(ptr, old_size_bytes, new_size_bytes, alignment);
+            if (new_ptr == nullptr)
+            {
+                failures_count_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            if (ptr != nullptr)
+            {
+                onDeallocated(old_size_bytes);
+            }
+            onAllocated(new_size_bytes);
+            return new_ptr;
+        }
+
+        // With leak tracking the header has to be relinked, so it's done as allocate + copy + deallocate.
+        void* const new_ptr = do_allocate(new_size_bytes, alignment);
+        if ((new_ptr != nullptr) && (ptr != nullptr))
+        {
+            (void) std::memcpy(new_ptr, ptr, std::min(old_size_bytes, new_size_bytes));
+            do_deallocate(ptr, old_size_bytes, alignment);
+        }
+        return new_ptr;
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    // MARK: Data members:
+
+    const char* const                                     tag_;
+    cetl::pmr::memory_resource&                           upstream_;
+    const Options                                         options_;
+    std::atomic<std::uint64_t>                            allocations_count_{0};
+    std::atomic<std::uint64_t>                            deallocations_count_{0};
+    std::atomic<std::uint64_t>                            failures_count_{0};
+    std::atomic<std::uint64_t>                            total_allocated_bytes_{0};
+    std::atomic<std::size_t>                              in_use_bytes_{0};
+    std::atomic<std::size_t>                              high_water_bytes_{0};
+    std::array<std::atomic<std::uint64_t>, HistogramSize> histogram_{};
+    mutable std::atomic_flag                              live_lock_ = ATOMIC_FLAG_INIT;
+    LiveHeader*                                           live_head_{nullptr};
+    LiveHeader*                                           live_tail_{nullptr};
+    std::size_t                                           live_count_{0};
+
+};  // TrackingMemoryResource
+
+}  // namespace platform
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PLATFORM_TRACKING_MEMORY_RESOURCE_HPP_INCLUDED
@@ -169,6 +169,11 @@ public:
         return delegate_.memory();
     }
 
+    CETL_NODISCARD transport::PortId getServiceId() const noexcept
+    {
+        return response_rx_params_.service_id;
+    }
+
     CETL_NODISCARD std::int32_t compareByNodeAndServiceIds(const transport::ResponseRxParams& rx_params) const
     {
         if (response_rx_params_.server_node_id != rx_params.server_node_id)
@@ -0,0 +1,57 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_PORT_OBSERVER_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_PORT_OBSERVER_HPP_INCLUDED
+
+#include "libcyphal/transport/types.hpp"
+
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// @brief Defines interface of an observer of the set of ports in use by the presentation layer.
+///
+/// See `Presentation::setPortObserver` for details on when and how the observer is notified.
+///
+class IPortObserver
+{
+public:
+    /// @brief Defines kinds of ports.
+    ///
+    enum class PortKind : std::uint8_t
+    {
+        Publisher,   ///< Message publisher (subject id).
+        Subscriber,  ///< Message subscriber (subject id).
+        Client,      ///< RPC client (service id).
+        Server,      ///< RPC server (service id).
+    };
+
+    IPortObserver(const IPortObserver&)                = delete;
+    IPortObserver(IPortObserver&&) noexcept            = delete;
+    IPortObserver& operator=(const IPortObserver&)     = delete;
+    IPortObserver& operator=(IPortObserver&&) noexcept = delete;
+
+    /// @brief Notifies that the given port id of the given kind has come into use.
+    ///
+    virtual void onPortAdded(const PortKind kind, const transport::PortId port_id) noexcept = 0;
+
+    /// @brief Notifies that the given port id of the given kind is no longer in use.
+    ///
+    virtual void onPortRemoved(const PortKind kind, const transport::PortId port_id) noexcept = 0;
+
+protected:
+    IPortObserver()  = default;
+    ~IPortObserver() = default;
+
+};  // IPortObserver
+
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_PORT_OBSERVER_HPP_INCLUDED
@@ -8,6 +8,7 @@
 
 #include "client.hpp"
 #include "client_impl.hpp"
+#include "port_observer.hpp"
 #include "presentation_delegate.hpp"
 #include "publisher.hpp"
 #include "publisher_impl.hpp"
@@ -31,6 +32,7 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <bitset>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -113,6 +115,7 @@ public:
         , executor_{executor}
         , transport_{transport}
         , unreferenced_nodes_{&unreferenced_nodes_, &unreferenced_nodes_}
+        , port_observer_{nullptr}
     {
         unref_nodes_deleter_callback_ = executor_.registerCallback([this](const auto&) {
             //
@@ -152,6 +155,57 @@ public:
         return transport_;
     }
 
+    /// @brief Sets (or resets) the observer of the set of ports in use by this presentation object.
+    ///
+    /// The observer is notified when a port id of some kind comes into use, and when it's no longer in use.
+    /// Notifications are per port id (rather than per publisher, subscriber, client or server object):
+    /// - message publishers and subscribers are notified on creation and (deferred) destruction of their
+    ///   shared implementation nodes, so multiple objects on the same subject id make a single notification;
+    /// - RPC clients to the same service id (but to different server nodes) are also reported once;
+    /// - RPC servers are notified on creation and destruction (transport allows only one server per service id).
+    ///
+    /// On setting a new observer all the currently in use ports are immediately reported to it as added ones,
+    /// so that the observer could be set at any moment. Only one observer is supported at a time.
+    /// The observer must be reset (by passing `nullptr`) before its destruction.
+    ///
+    void setPortObserver(IPortObserver* const observer) noexcept
+    {
+        port_observer_ = observer;
+        if (port_observer_ == nullptr)
+        {
+            return;
+        }
+
+        publisher_impl_nodes_.traverseInOrder([observer](const detail::PublisherImpl& publisher_impl) {
+            //
+            observer->onPortAdded(PortKind::Publisher, publisher_impl.getSubjectId());
+        });
+        subscriber_impl_nodes_.traverseInOrder([observer](const detail::SubscriberImpl& subscriber_impl) {
+            //
+            observer->onPortAdded(PortKind::Subscriber, subscriber_impl.getSubjectId());
+        });
+
+        // Shared clients are ordered by server node id first, so the same service id may appear multiple times.
+        std::bitset<MaxServiceIds> reported_client_ids;
+        shared_client_nodes_.traverseInOrder([observer, &reported_client_ids](const detail::SharedClient& client) {
+            //
+            const auto service_id = client.getServiceId();
+            if ((service_id < MaxServiceIds) && !reported_client_ids.test(service_id))
+            {
+                reported_client_ids.set(service_id);
+                observer->onPortAdded(PortKind::Client, service_id);
+            }
+        });
+
+        for (std::size_t service_id = 0; service_id < MaxServiceIds; ++service_id)
+        {
+            if (server_service_ids_.test(service_id))
+            {
+                observer->onPortAdded(PortKind::Server, static_cast<transport::PortId>(service_id));
+            }
+        }
+    }
+
     /// @brief Makes a message publisher.
     ///
     /// The publisher must never outlive this presentation object.
@@ -485,6 +539,10 @@ public:
 
 private:
     using Schedule = IExecutor::Callback::Schedule;
+    using PortKind = IPortObserver::PortKind;
+
+    /// Cyphal service ids are in the [0, 511] range.
+    static constexpr std::size_t MaxServiceIds = 512U;
 
     IPresentationDelegate& asDelegate() noexcept
     {
@@ -516,10 +574,16 @@ private:
     {
         if (auto tx_session = getIfSession(transport_.makeMessageTxSession(params), out_failure))
         {
-            return detail::SharedObject::createWithPmr<detail::PublisherImpl>(memory_,
-                                                                              out_failure,
-                                                                              asDelegate(),
-                                                                              std::move(tx_session));
+            auto* const publisher_impl = detail::SharedObject::createWithPmr<detail::PublisherImpl>(  //
+                memory_,
+                out_failure,
+                asDelegate(),
+                std::move(tx_session));
+            if (publisher_impl != nullptr)
+            {
+                notifyPortAdded(PortKind::Publisher, params.subject_id);
+            }
+            return publisher_impl;
         }
         CETL_DEBUG_ASSERT(out_failure, "");
         return nullptr;
@@ -561,11 +625,17 @@ private:
     {
         if (auto rx_session = getIfSession(transport_.makeMessageRxSession(params), out_failure))
         {
-            return detail::SharedObject::createWithPmr<detail::SubscriberImpl>(memory_,
-                                                                               out_failure,
-                                                                               asDelegate(),
-                                                                               executor_,
-                                                                               std::move(rx_session));
+            auto* const subscriber_impl = detail::SharedObject::createWithPmr<detail::SubscriberImpl>(  //
+                memory_,
+                out_failure,
+                asDelegate(),
+                executor_,
+                std::move(rx_session));
+            if (subscriber_impl != nullptr)
+            {
+                notifyPortAdded(PortKind::Subscriber, params.subject_id);
+            }
+            return subscriber_impl;
         }
         CETL_DEBUG_ASSERT(out_failure, "");
         return nullptr;
@@ -579,7 +649,17 @@ private:
             const transport::ResponseTxParams tx_params{params.service_id};
             if (auto tx_session = getIfSession(transport_.makeResponseTxSession(tx_params), out_failure))
             {
-                return detail::ServerImpl{memory_, executor_, std::move(rx_session), std::move(tx_session)};
+                if (params.service_id < MaxServiceIds)
+                {
+                    server_service_ids_.set(params.service_id);
+                }
+                notifyPortAdded(PortKind::Server, params.service_id);
+
+                return detail::ServerImpl{asDelegate(),
+                                          executor_,
+                                          params.service_id,
+                                          std::move(rx_session),
+                                          std::move(tx_session)};
             }
         }
         CETL_DEBUG_ASSERT(out_failure, "");
@@ -608,6 +688,13 @@ private:
         auto* const shared_client = std::get<0>(shared_client_existing);
         CETL_DEBUG_ASSERT(shared_client != nullptr, "");
 
+        // A newly inserted client is reported only if it's the very first one for its service id.
+        if ((port_observer_ != nullptr) && !std::get<1>(shared_client_existing) &&
+            !hasOtherSharedClient(*shared_client))
+        {
+            notifyPortAdded(PortKind::Client, rx_params.service_id);
+        }
+
         // This client impl node might be in the list of previously unreferenced nodes -
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
         // If it's the case, we need to remove it from the list b/c it's going to be referenced.
@@ -681,6 +768,36 @@ private:
         shared_node.unlinkIfReferenced();  // from the list
     }
 
+    /// Checks whether there is another (than the given one) shared client to the same service id.
+    ///
+    /// Complexity is linear in the number of shared clients, but it's in use only when a client node
+    /// is created or destroyed (and only if there is a port observer), so it's not on any hot path.
+    ///
+    bool hasOtherSharedClient(const detail::SharedClient& shared_client) noexcept
+    {
+        const auto service_id = shared_client.getServiceId();
+        return shared_client_nodes_.traverseInOrder([&shared_client, service_id](const detail::SharedClient& other) {
+            //
+            return (&other != &shared_client) && (other.getServiceId() == service_id);
+        });
+    }
+
+    void notifyPortAdded(const PortKind kind, const transport::PortId port_id) const noexcept
+    {
+        if (port_observer_ != nullptr)
+        {
+            port_observer_->onPortAdded(kind, port_id);
+        }
+    }
+
+    void notifyPortRemoved(const PortKind kind, const transport::PortId port_id) const noexcept
+    {
+        if (port_observer_ != nullptr)
+        {
+            port_observer_->onPortRemoved(kind, port_id);
+        }
+    }
+
     void destroyUnreferencedNodes() const noexcept
     {
         // In the loop, destruction of a shared object also removes it from the list of unreferenced nodes.
@@ -713,16 +830,33 @@ private:
     void forgetSharedClient(detail::SharedClient& shared_client) noexcept override
     {
         forgetSharedNode(shared_client);
+
+        // The client is already removed from the tree, so any remaining one keeps its service id in use.
+        if ((port_observer_ != nullptr) && !hasOtherSharedClient(shared_client))
+        {
+            notifyPortRemoved(PortKind::Client, shared_client.getServiceId());
+        }
     }
 
     void forgetPublisherImpl(detail::PublisherImpl& publisher_impl) noexcept override
     {
         forgetSharedNode(publisher_impl);
+        notifyPortRemoved(PortKind::Publisher, publisher_impl.getSubjectId());
     }
 
     void forgetSubscriberImpl(detail::SubscriberImpl& subscriber_impl) noexcept override
     {
         forgetSharedNode(subscriber_impl);
+        notifyPortRemoved(PortKind::Subscriber, subscriber_impl.getSubjectId());
+    }
+
+    void forgetServerImpl(const transport::PortId service_id) noexcept override
+    {
+        if (service_id < MaxServiceIds)
+        {
+            server_service_ids_.reset(service_id);
+        }
+        notifyPortRemoved(PortKind::Server, service_id);
     }
 
     // MARK: Data members:
@@ -735,6 +869,8 @@ private:
     common::cavl::Tree<detail::SubscriberImpl> subscriber_impl_nodes_;
     detail::UnRefNode                          unreferenced_nodes_;
     IExecutor::Callback::Any                   unref_nodes_deleter_callback_;
+    IPortObserver*                             port_observer_;
+    std::bitset<MaxServiceIds>                 server_service_ids_;
 
 };  // Presentation
 
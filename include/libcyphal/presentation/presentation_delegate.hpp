@@ -8,6 +8,8 @@
 
 #include "shared_object.hpp"
 
+#include "libcyphal/transport/types.hpp"
+
 #include <cetl/pf17/cetlpf.hpp>
 
 #include <type_traits>
@@ -90,6 +92,7 @@ public:
     virtual void forgetSharedClient(SharedClient& shared_client) noexcept       = 0;
     virtual void forgetPublisherImpl(PublisherImpl& publisher_impl) noexcept    = 0;
     virtual void forgetSubscriberImpl(SubscriberImpl& subscriber_impl) noexcept = 0;
+    virtual void forgetServerImpl(const transport::PortId service_id) noexcept  = 0;
 
 protected:
     IPresentationDelegate()  = default;
@@ -7,6 +7,7 @@
 #define LIBCYPHAL_PRESENTATION_SERVER_IMPL_HPP_INCLUDED
 
 #include "common_helpers.hpp"
+#include "presentation_delegate.hpp"
 
 #include "libcyphal/time_provider.hpp"
 #include "libcyphal/transport/errors.hpp"
@@ -51,11 +52,14 @@ public:
 
     };  // Callback
 
-    ServerImpl(cetl::pmr::memory_resource&              memory,
+    ServerImpl(IPresentationDelegate&                   delegate,
                ITimeProvider&                           time_provider,
+               const transport::PortId                  service_id,
                UniquePtr<transport::IRequestRxSession>  svc_req_rx_session,
                UniquePtr<transport::IResponseTxSession> svc_res_tx_session)
-        : memory_{memory}
+        : delegate_{&delegate}
+        , memory_{delegate.memory()}
+        , service_id_{service_id}
         , time_provider_{time_provider}
         , svc_req_rx_session_{std::move(svc_req_rx_session)}
         , svc_res_tx_session_{std::move(svc_res_tx_session)}
@@ -64,6 +68,30 @@ public:
         CETL_DEBUG_ASSERT(svc_res_tx_session_ != nullptr, "");
     }
 
+    ServerImpl(ServerImpl&& other) noexcept
+        : delegate_{other.delegate_}
+        , memory_{other.memory_}
+        , service_id_{other.service_id_}
+        , time_provider_{other.time_provider_}
+        , svc_req_rx_session_{std::move(other.svc_req_rx_session_)}
+        , svc_res_tx_session_{std::move(other.svc_res_tx_session_)}
+    {
+        // Only the last (moved-to) instance should notify the delegate on destruction.
+        other.delegate_ = nullptr;
+    }
+
+    ~ServerImpl()
+    {
+        if (delegate_ != nullptr)
+        {
+            delegate_->forgetServerImpl(service_id_);
+        }
+    }
+
+    ServerImpl(const ServerImpl&)                = delete;
+    ServerImpl& operator=(const ServerImpl&)     = delete;
+    ServerImpl& operator=(ServerImpl&&) noexcept = delete;
+
     void setOnReceiveCallback(Callback& callback) const
     {
         CETL_DEBUG_ASSERT(svc_req_rx_session_ != nullptr, "");
@@ -95,7 +123,9 @@ public:
 private:
     // MARK: Data members:
 
+    IPresentationDelegate*                   delegate_;
     cetl::pmr::memory_resource&              memory_;
+    const transport::PortId                  service_id_;
     ITimeProvider&                           time_provider_;
     UniquePtr<transport::IRequestRxSession>  svc_req_rx_session_;
     UniquePtr<transport::IResponseTxSession> svc_res_tx_session_;
@@ -199,6 +199,11 @@ public:
         return time_provider_.now();
     }
 
+    CETL_NODISCARD transport::PortId getSubjectId() const noexcept
+    {
+        return subject_id_;
+    }
+
     CETL_NODISCARD std::int32_t compareBySubjectId(const transport::PortId subject_id) const
     {
         return static_cast<std::int32_t>(subject_id_) - static_cast<std::int32_t>(subject_id);
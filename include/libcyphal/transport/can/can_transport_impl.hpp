@@ -186,6 +186,10 @@ public:
         {
             flushCanardTxQueue(media.canard_tx_queue(), canardInstance());
         }
+        if (msg_tx_complete_cb_fn_)
+        {
+            (void) setMessageTxCompleteCallback({});
+        }
 
         CETL_DEBUG_ASSERT(total_msg_rx_ports_ == 0,  //
                           "Message sessions must be destroyed before transport.");
@@ -308,6 +312,27 @@ private:
         return SvcResponseTxSession::make(asDelegate(), params);
     }
 
+    bool setMessageTxCompleteCallback(MessageTxCompleteCallback::Function&& function) override
+    {
+        msg_tx_complete_cb_fn_ = std::move(function);
+        const bool is_enabled  = static_cast<bool>(msg_tx_complete_cb_fn_);
+
+        bool is_supported = false;
+        for (Media& media : media_array_)
+        {
+            IMedia::TxCompleteCallback::Function media_fn{};
+            if (is_enabled)
+            {
+                media_fn = [this, &media](const IMedia::TxCompleteCallback::Arg& arg) {
+                    //
+                    onMediaTxComplete(media, arg);
+                };
+            }
+            is_supported = media.interface().setTxCompleteCallback(std::move(media_fn)) || is_supported;
+        }
+        return is_supported;
+    }
+
     // MARK: TransportDelegate
 
     CETL_NODISCARD cetl::optional<AnyFailure> sendTransfer(const TimePoint               deadline,
@@ -621,6 +646,21 @@ private:
         return -1;
     }
 
+    /// @brief Translates media TX completion of a message frame to the transport level notification.
+    ///
+    void onMediaTxComplete(const Media& media, const IMedia::TxCompleteCallback::Arg& arg) const
+    {
+        // See Cyphal/CAN Specification, "Service, not message" bit, and subject ID bits of the CAN ID.
+        constexpr CanId ServiceNotMessageFlag = 1UL << 25U;
+        constexpr CanId SubjectIdOffset       = 8U;
+
+        if (msg_tx_complete_cb_fn_ && ((arg.can_id & ServiceNotMessageFlag) == 0U))
+        {
+            const auto subject_id = static_cast<PortId>((arg.can_id >> SubjectIdOffset) & CANARD_SUBJECT_ID_MAX);
+            msg_tx_complete_cb_fn_(MessageTxCompleteCallback::Arg{subject_id, media.index(), arg.timestamp});
+        }
+    }
+
     /// @brief Tries to push next frame from TX queue to media.
     ///
     void pushNextFrameToMedia(Media& media)
@@ -787,12 +827,13 @@ private:
 
     // MARK: Data members:
 
-    IExecutor&            executor_;
-    MediaArray            media_array_;
-    std::size_t           total_msg_rx_ports_;
-    std::size_t           total_svc_rx_ports_;
-    TransientErrorHandler transient_error_handler_;
-    Callback::Any         configure_filters_callback_;
+    IExecutor&                          executor_;
+    MediaArray                          media_array_;
+    std::size_t                         total_msg_rx_ports_;
+    std::size_t                         total_svc_rx_ports_;
+    TransientErrorHandler               transient_error_handler_;
+    Callback::Any                       configure_filters_callback_;
+    MessageTxCompleteCallback::Function msg_tx_complete_cb_fn_;
 
 };  // TransportImpl
 
@@ -6,6 +6,7 @@
 #ifndef LIBCYPHAL_TRANSPORT_CAN_MEDIA_HPP_INCLUDED
 #define LIBCYPHAL_TRANSPORT_CAN_MEDIA_HPP_INCLUDED
 
+#include "libcyphal/config.hpp"
 #include "libcyphal/executor.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/media_payload.hpp"
@@ -14,6 +15,7 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pf20/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -155,6 +157,42 @@ public:
     ///
     virtual cetl::pmr::memory_resource& getTxMemoryResource() = 0;
 
+    /// @brief Umbrella type for TX completion notification entities.
+    ///
+    struct TxCompleteCallback
+    {
+        /// @brief Defines arguments of the TX completion notification.
+        ///
+        struct Arg
+        {
+            /// Holds time point when the frame has actually left the media (f.e. hardware TX timestamp,
+            /// or a timestamp of the looped back frame). The same time base as for `PopResult::Metadata::timestamp`.
+            TimePoint timestamp;
+
+            /// Holds CAN ID of the transmitted frame.
+            CanId can_id;
+        };
+
+        static constexpr auto FunctionSize = config::Transport::Can::IMedia_TxCompleteCallback_FunctionMaxSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Sets TX completion (aka loopback) callback function.
+    ///
+    /// Support of TX completion notifications is optional - by default they are not supported.
+    /// Media which is capable to timestamp transmitted frames (f.e. via hardware TX timestamping,
+    /// or via loopback of own frames) should call the function once per successfully transmitted frame.
+    /// The function is supposed to be called from the executor context (f.e. from within "ready to pop" callback).
+    ///
+    /// @param function The function to be called on TX completion. Empty function disables notifications.
+    /// @return `true` if TX completion notifications are supported by the media.
+    ///
+    virtual bool setTxCompleteCallback(TxCompleteCallback::Function&& function)
+    {
+        (void) function;
+        return false;
+    }
+
 protected:
     IMedia()  = default;
     ~IMedia() = default;
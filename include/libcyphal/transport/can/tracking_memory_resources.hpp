@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_TRACKING_MEMORY_RESOURCES_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_TRACKING_MEMORY_RESOURCES_HPP_INCLUDED
+
+#include "libcyphal/platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// @brief Defines a set of tracking memory resources - one per memory consumer of the CAN transport.
+///
+/// Usage:
+/// - pass `general` to the `can::makeTransport` factory (sessions, RX reassembly buffers);
+/// - return `tx` from `IMedia::getTxMemoryResource` of all media (TX queue items and frame payloads).
+///
+/// All the resources share the same upstream memory resource, so the accounting is per subsystem,
+/// while the memory itself still comes from a single pool.
+///
+struct TrackingMemoryResources final
+{
+    using Resource = platform::TrackingMemoryResource;
+
+    explicit TrackingMemoryResources(cetl::pmr::memory_resource& upstream, const Resource::Options options = {})
+        : general{"can.general", upstream, options}
+        , tx{"can.tx", upstream, options}
+    {
+    }
+
+    /// @brief Visits all the resources (f.e. to report their statistics).
+    ///
+    /// @param visitor The function to call with `const Resource&` argument.
+    ///
+    template <typename Visitor>
+    void visit(const Visitor& visitor) const
+    {
+        visitor(general);
+        visitor(tx);
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    Resource general;
+    Resource tx;
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+};  // TrackingMemoryResources
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_TRACKING_MEMORY_RESOURCES_HPP_INCLUDED
@@ -8,11 +8,14 @@
 
 #include "types.hpp"
 
+#include "libcyphal/config.hpp"
+
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pf20/cetlpf.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstring>
 
@@ -31,6 +34,8 @@ namespace detail
 ///
 /// Has optimization for the case when there is only one non-empty fragment -
 /// in this case there will be no memory allocation and payload copying.
+/// Small payloads (see `config::Transport::ContiguousPayload_SmallBufferSize`) are copied into
+/// an internal buffer, so the object is expected to be on stack, and there is no memory allocation either.
 /// Automatically deallocates memory (if any) when the object is destroyed.
 ///
 /// Probably could be deleted when libcanard will start support fragmented payloads (at `canardTxPush`).
@@ -39,6 +44,8 @@ namespace detail
 class ContiguousPayload final
 {
 public:
+    // No zero initialization of the small buffer b/c it's filled (up to the payload size) only when in use.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init, hicpp-member-init)
     ContiguousPayload(cetl::pmr::memory_resource& mr, const PayloadFragments payload_fragments)
         : mr_{mr}
         , payload_{nullptr}
@@ -63,9 +70,14 @@ public:
 
         if (total_non_empty_fragments > 1)
         {
-            allocated_buffer_ = static_cast<cetl::byte*>(mr_.allocate(payload_size_));
-            payload_          = allocated_buffer_;
-            if (cetl::byte* const buffer = allocated_buffer_)
+            cetl::byte* buffer = small_buffer_.data();
+            if (payload_size_ > small_buffer_.size())
+            {
+                allocated_buffer_ = static_cast<cetl::byte*>(mr_.allocate(payload_size_));
+                buffer            = allocated_buffer_;
+            }
+            payload_ = buffer;
+            if (buffer != nullptr)
             {
                 std::size_t offset = 0;
                 for (const Fragment frag : payload_fragments)
@@ -102,12 +114,15 @@ public:
     }
 
 private:
+    using SmallBuffer = std::array<cetl::byte, config::Transport::ContiguousPayload_SmallBufferSize()>;
+
     // MARK: Data members:
 
     cetl::pmr::memory_resource& mr_;
     const cetl::byte*           payload_;
     std::size_t                 payload_size_;
     cetl::byte*                 allocated_buffer_;
+    SmallBuffer                 small_buffer_;
 
 };  // ContiguousBytes
 
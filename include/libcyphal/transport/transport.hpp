@@ -11,10 +11,14 @@
 #include "svc_sessions.hpp"
 #include "types.hpp"
 
+#include "libcyphal/config.hpp"
 #include "libcyphal/errors.hpp"
 #include "libcyphal/types.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+#include <cstdint>
 
 namespace libcyphal
 {
@@ -105,6 +109,45 @@ public:
     virtual Expected<UniquePtr<IResponseTxSession>, AnyFailure> makeResponseTxSession(
         const ResponseTxParams& params) = 0;
 
+    /// @brief Umbrella type for message TX completion notification entities.
+    ///
+    struct MessageTxCompleteCallback
+    {
+        /// @brief Defines arguments of the message TX completion notification.
+        ///
+        struct Arg
+        {
+            /// Holds subject ID of the transmitted message frame.
+            PortId subject_id;
+
+            /// Holds index of the (redundant) media interface which has transmitted the frame.
+            std::uint8_t media_index;
+
+            /// Holds time point when the frame has actually left the media (as reported by the media).
+            TimePoint timestamp;
+        };
+
+        static constexpr auto FunctionSize =
+            config::Transport::ITransport_MessageTxCompleteCallback_FunctionMaxSize();
+        using Function = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Sets message TX completion callback function.
+    ///
+    /// The function is called for every message frame which has been reported by the underlying media
+    /// as actually transmitted (see f.e. `can::IMedia::setTxCompleteCallback`). In case of redundant media
+    /// interfaces the same frame is reported once per media. Only one callback could be set at a time.
+    /// Support of such notifications is optional - by default they are not supported.
+    ///
+    /// @param function The function to be called on message TX completion. Empty function disables notifications.
+    /// @return `true` if at least one of the media interfaces supports TX completion notifications.
+    ///
+    virtual bool setMessageTxCompleteCallback(MessageTxCompleteCallback::Function&& function)
+    {
+        (void) function;
+        return false;
+    }
+
 protected:
     ITransport()  = default;
     ~ITransport() = default;
@@ -0,0 +1,80 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_TRACKING_MEMORY_RESOURCES_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_TRACKING_MEMORY_RESOURCES_HPP_INCLUDED
+
+#include "udp_transport.hpp"
+
+#include "libcyphal/platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// @brief Defines a set of tracking memory resources - one per memory consumer of the UDP transport.
+///
+/// Usage:
+/// - pass `makeSpec()` to the `udp::makeTransport` factory (general, session, fragment and payload resources);
+/// - allocate received datagrams from `payload` in RX sockets of all media;
+/// - return `tx` from `IMedia::getTxMemoryResource` of all media (TX queue items and datagram payloads).
+///
+/// All the resources share the same upstream memory resource, so the accounting is per subsystem,
+/// while the memory itself still comes from a single pool.
+///
+struct TrackingMemoryResources final
+{
+    using Resource = platform::TrackingMemoryResource;
+
+    explicit TrackingMemoryResources(cetl::pmr::memory_resource& upstream, const Resource::Options options = {})
+        : general{"udp.general", upstream, options}
+        , session{"udp.session", upstream, options}
+        , fragment{"udp.fragment", upstream, options}
+        , payload{"udp.payload", upstream, options}
+        , tx{"udp.tx", upstream, options}
+    {
+    }
+
+    /// @brief Makes the transport memory resources specification, which refers to these resources.
+    ///
+    MemoryResourcesSpec makeSpec() noexcept
+    {
+        return MemoryResourcesSpec{general, &session, &fragment, &payload};
+    }
+
+    /// @brief Visits all the resources (f.e. to report their statistics).
+    ///
+    /// @param visitor The function to call with `const Resource&` argument.
+    ///
+    template <typename Visitor>
+    void visit(const Visitor& visitor) const
+    {
+        visitor(general);
+        visitor(session);
+        visitor(fragment);
+        visitor(payload);
+        visitor(tx);
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    Resource general;
+    Resource session;
+    Resource fragment;
+    Resource payload;
+    Resource tx;
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+};  // TrackingMemoryResources
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_TRACKING_MEMORY_RESOURCES_HPP_INCLUDED
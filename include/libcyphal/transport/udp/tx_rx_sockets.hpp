@@ -6,12 +6,14 @@
 #ifndef LIBCYPHAL_TRANSPORT_UDP_TX_RX_SOCKETS_HPP_INCLUDED
 #define LIBCYPHAL_TRANSPORT_UDP_TX_RX_SOCKETS_HPP_INCLUDED
 
+#include "libcyphal/config.hpp"
 #include "libcyphal/executor.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
 #include <udpard.h>
 
 #include <cstddef>
@@ -107,6 +109,41 @@ public:
     ///
     CETL_NODISCARD virtual IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) = 0;
 
+    /// @brief Umbrella type for TX completion notification entities.
+    ///
+    struct TxCompleteCallback
+    {
+        /// @brief Defines arguments of the TX completion notification.
+        ///
+        struct Arg
+        {
+            /// Holds time point when the datagram has actually left the socket (f.e. `SO_TIMESTAMPING` TX timestamp,
+            /// or a timestamp of the looped back multicast datagram). The same time base as for RX timestamps.
+            TimePoint timestamp;
+
+            /// Holds the multicast endpoint the datagram has been sent to.
+            IpEndpoint multicast_endpoint;
+        };
+
+        static constexpr auto FunctionSize = config::Transport::Udp::ITxSocket_TxCompleteCallback_FunctionMaxSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Sets TX completion (aka loopback) callback function.
+    ///
+    /// Support of TX completion notifications is optional - by default they are not supported.
+    /// Socket which is capable to timestamp transmitted datagrams should call the function once per
+    /// successfully transmitted datagram. The function is supposed to be called from the executor context.
+    ///
+    /// @param function The function to be called on TX completion. Empty function disables notifications.
+    /// @return `true` if TX completion notifications are supported by the socket.
+    ///
+    virtual bool setTxCompleteCallback(TxCompleteCallback::Function&& function)
+    {
+        (void) function;
+        return false;
+    }
+
 protected:
     ITxSocket()  = default;
     ~ITxSocket() = default;
@@ -330,6 +330,26 @@ private:
         return SvcResponseTxSession::make(memoryResources().general, asDelegate(), params);
     }
 
+    bool setMessageTxCompleteCallback(MessageTxCompleteCallback::Function&& function) override
+    {
+        msg_tx_complete_cb_fn_ = std::move(function);
+
+        // TX sockets are made on demand, so we try to make them now to find out whether
+        // TX completion notifications are supported. Sockets made later will get the callback as well.
+        // Failures are not reported here - they will be reported (and retried) by the very next transmission.
+        (void) ensureMediaTxSockets();
+
+        bool is_supported = false;
+        for (Media& media : media_array_)
+        {
+            if (media.txSocketState().interface)
+            {
+                is_supported = setupTxSocketCompleteCallback(media, *media.txSocketState().interface) || is_supported;
+            }
+        }
+        return is_supported;
+    }
+
     // MARK: TransportDelegate
 
     CETL_NODISCARD TransportDelegate& asDelegate()
@@ -646,6 +666,10 @@ private:
                                                                                              MemoryError{},
                                                                                              media.interface());
             }
+            if (msg_tx_complete_cb_fn_)
+            {
+                (void) setupTxSocketCompleteCallback(media, *media.txSocketState().interface);
+            }
         }
 
         return std::forward<Action>(action)(media, *(media.txSocketState().interface));
@@ -666,6 +690,36 @@ private:
         return cetl::nullopt;
     }
 
+    bool setupTxSocketCompleteCallback(const Media& media, ITxSocket& tx_socket)
+    {
+        ITxSocket::TxCompleteCallback::Function socket_fn{};
+        if (msg_tx_complete_cb_fn_)
+        {
+            socket_fn = [this, &media](const ITxSocket::TxCompleteCallback::Arg& arg) {
+                //
+                onTxSocketComplete(media, arg);
+            };
+        }
+        return tx_socket.setTxCompleteCallback(std::move(socket_fn));
+    }
+
+    /// @brief Translates socket TX completion of a message datagram to the transport level notification.
+    ///
+    void onTxSocketComplete(const Media& media, const ITxSocket::TxCompleteCallback::Arg& arg) const
+    {
+        // See Cyphal/UDP Specification, message multicast group address is `239.0.0.0 | subject_id`
+        // (while service ones have the "service, not message" bit 16 set).
+        constexpr std::uint32_t MulticastPrefixMask = 0xFFFF0000UL;
+        constexpr std::uint32_t MessagePrefix       = 0xEF000000UL;
+
+        const std::uint32_t ip_address = arg.multicast_endpoint.ip_address;
+        if (msg_tx_complete_cb_fn_ && ((ip_address & MulticastPrefixMask) == MessagePrefix))
+        {
+            const auto subject_id = static_cast<PortId>(ip_address & UDPARD_SUBJECT_ID_MAX);
+            msg_tx_complete_cb_fn_(MessageTxCompleteCallback::Arg{subject_id, media.index(), arg.timestamp});
+        }
+    }
+
     static void flushUdpardTxQueue(UdpardTx& udpard_tx)
     {
         while (UdpardTxItem* const maybe_item = ::udpardTxPeek(&udpard_tx))
@@ -997,6 +1051,7 @@ private:
     SessionTree<RxSessionTreeNode::Request>  svc_request_rx_session_nodes_;
     SessionTree<RxSessionTreeNode::Response> svc_response_rx_session_nodes_;
     cetl::optional<IpEndpoint>               svc_rx_sockets_endpoint_;
+    MessageTxCompleteCallback::Function      msg_tx_complete_cb_fn_;
 
 };  // TransportImpl
 
@@ -0,0 +1,214 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "transport/can/in_process_can_bus.hpp"
+#include "virtual_time_executor.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/file_read_client.hpp>
+#include <libcyphal/application/node/file_server.hpp>
+#include <libcyphal/platform/file_system.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::UniquePtr;
+using libcyphal::VirtualTimeExecutor;
+using libcyphal::application::node::FileReadClient;
+using libcyphal::application::node::FileServer;
+using libcyphal::presentation::Presentation;
+using libcyphal::transport::NodeId;
+using libcyphal::transport::can::ICanTransport;
+using libcyphal::transport::can::InProcessCanBus;
+using libcyphal::transport::can::InProcessCanMedia;
+using libcyphal::transport::can::makeTransport;
+using namespace libcyphal::platform::file_system;  // NOLINT This our main concern here in the benchmarks.
+
+using std::literals::chrono_literals::operator""s;   // NOLINT(misc-unused-using-decls)
+using std::literals::chrono_literals::operator""us;  // NOLINT(misc-unused-using-decls)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr std::size_t FileSize     = 64 * 1024;
+constexpr NodeId      ServerNodeId = 1;
+constexpr NodeId      ClientNodeId = 2;
+const char* const     FilePath     = "fw.bin";
+
+/// Implements in-memory file system with a single (not mapped) file.
+///
+class MemoryFileSystem final : public IFileSystem
+{
+public:
+    MemoryFileSystem()
+        : content_(FileSize)
+    {
+    }
+
+    // MARK: IFileSystem
+
+    auto getInfo(const cetl::string_view) const -> libcyphal::Expected<Info, Error> override
+    {
+        Info info{};
+        info.size = content_.size();
+        return info;
+    }
+
+    auto open(const cetl::string_view) -> libcyphal::Expected<UniquePtr<IFile>, Error> override
+    {
+        return libcyphal::makeUniquePtr<IFile, File>(*cetl::pmr::get_default_resource(), content_);
+    }
+
+private:
+    class File final : public IFile
+    {
+    public:
+        explicit File(const std::vector<cetl::byte>& content)
+            : content_{content}
+        {
+        }
+
+        ~File() = default;
+
+        File(const File&)                = delete;
+        File(File&&) noexcept            = delete;
+        File& operator=(const File&)     = delete;
+        File& operator=(File&&) noexcept = delete;
+
+        std::uint64_t getSize() const noexcept override
+        {
+            return content_.size();
+        }
+
+        auto read(const std::uint64_t offset, const cetl::span<cetl::byte> buffer) const
+            -> libcyphal::Expected<std::size_t, Error> override
+        {
+            const auto pos  = std::min<std::size_t>(offset, content_.size());
+            const auto size = std::min(buffer.size(), content_.size() - pos);
+            (void) std::copy_n(content_.begin() + static_cast<std::ptrdiff_t>(pos), size, buffer.begin());
+            return size;
+        }
+
+    private:
+        const std::vector<cetl::byte>& content_;
+
+    };  // File
+
+    std::vector<cetl::byte> content_;
+
+};  // MemoryFileSystem
+
+/// Holds the whole stack (media, CAN transport and presentation layer) of a node on the in-process bus.
+///
+class BusNode final
+{
+public:
+    BusNode(InProcessCanBus& bus, const NodeId node_id, const std::size_t tx_capacity)
+        : media_{bus}
+    {
+        auto& memory = *cetl::pmr::get_default_resource();
+
+        std::array<libcyphal::transport::can::IMedia*, 1> media_array{&media_};
+
+        auto maybe_transport = makeTransport(memory, bus.executor(), media_array, tx_capacity);
+        transport_           = cetl::get<UniquePtr<ICanTransport>>(std::move(maybe_transport));
+        (void) transport_->setLocalNodeId(node_id);
+
+        presentation_.emplace(memory, bus.executor(), *transport_);
+    }
+
+    Presentation& presentation() noexcept
+    {
+        return *presentation_;
+    }
+
+private:
+    InProcessCanMedia            media_;
+    UniquePtr<ICanTransport>     transport_;
+    cetl::optional<Presentation> presentation_;
+
+};  // BusNode
+
+/// Downloads a whole file from the file server over a CAN FD bus with the given (fixed) window size.
+///
+/// Window of one request is the classic "one chunk per round trip" client. Bus time is virtual, so
+/// the `bus_time_ms` and `bus_utilization` counters show how close the download is to the bus bandwidth,
+/// while the measured time is CPU cost of the whole stack on both nodes.
+///
+void BM_FileReadClient_Download(benchmark::State& state)
+{
+    const auto window_size = static_cast<std::size_t>(state.range(0));
+
+    VirtualTimeExecutor executor;
+    InProcessCanBus     bus{executor, 64, 20us};  // ~ CAN FD frame at 5 Mbit/s data phase
+
+    MemoryFileSystem file_system;
+    BusNode          server_node{bus, ServerNodeId, 1024};
+    auto             maybe_file_server = FileServer::make(server_node.presentation(), file_system);
+    if (cetl::get_if<FileServer>(&maybe_file_server) == nullptr)
+    {
+        state.SkipWithError("failed to make the file server");
+        return;
+    }
+
+    BusNode client_node{bus, ClientNodeId, 64};
+    auto    client = client_node.presentation().makeClient<FileReadClient::Service>(ServerNodeId);
+
+    FileReadClient::Options options{};
+    options.initial_window_size = window_size;
+    options.max_window_size     = window_size;
+    FileReadClient read_client{client_node.presentation(),
+                               cetl::get<FileReadClient::Client>(std::move(client)),
+                               options};
+
+    std::uint64_t total_bytes_read = 0;
+    const auto    start_time       = executor.now();
+    const auto    start_frames     = bus.getFramesCount();
+    for (auto _ : state)
+    {
+        bool is_done = false;
+        (void) read_client.read(
+            FilePath,
+            0,
+            [](const auto& arg) { benchmark::DoNotOptimize(arg.data.data()); },
+            [&](const auto& arg) {
+                total_bytes_read += arg.size;
+                is_done = !arg.failure.has_value();
+            });
+        if (!executor.spinUntil([&is_done] { return is_done; }, executor.now() + 60s))
+        {
+            state.SkipWithError("file reading has failed or timed out");
+            break;
+        }
+    }
+
+    const auto iterations = static_cast<double>(state.iterations());
+    const auto bus_time   = executor.now() - start_time;
+    const auto busy_time  = bus.getFrameDuration() * static_cast<std::int64_t>(bus.getFramesCount() - start_frames);
+    state.SetBytesProcessed(static_cast<std::int64_t>(total_bytes_read));
+    state.counters["bus_time_ms"] = std::chrono::duration<double, std::milli>(bus_time).count() / iterations;
+    state.counters["bus_utilization"] =
+        std::chrono::duration<double>(busy_time).count() / std::chrono::duration<double>(bus_time).count();
+    state.counters["window_size"] = static_cast<double>(read_client.getWindowSize());
+}
+BENCHMARK(BM_FileReadClient_Download)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
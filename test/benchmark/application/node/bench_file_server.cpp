@@ -0,0 +1,340 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "platform/posix/posix_file_system.hpp"
+#include "temp_directory.hpp"
+#include "transport/can/in_process_can_bus.hpp"
+#include "virtual_time_executor.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/application/node/file_server.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/platform/file_system.hpp>
+#include <libcyphal/presentation/client.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/response_promise.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/file/Read_1_1.hpp>
+#include <uavcan/primitive/Unstructured_1_0.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TempDirectory;
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::VirtualTimeExecutor;
+using libcyphal::application::node::FileServer;
+using libcyphal::presentation::Presentation;
+using libcyphal::transport::NodeId;
+using libcyphal::transport::can::ICanTransport;
+using libcyphal::transport::can::InProcessCanBus;
+using libcyphal::transport::can::InProcessCanMedia;
+using libcyphal::transport::can::makeTransport;
+using namespace libcyphal::platform::file_system;  // NOLINT This our main concern here in the benchmarks.
+
+using std::literals::chrono_literals::operator""s;   // NOLINT(misc-unused-using-decls)
+using std::literals::chrono_literals::operator""us;  // NOLINT(misc-unused-using-decls)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr std::size_t FileSize     = 8192;
+constexpr NodeId      ServerNodeId = 1;
+const char* const     FilePath     = "fw.bin";
+
+/// Implements in-memory file system with a single file which is NOT mapped,
+/// so that the file server has to use its read-ahead cache.
+///
+class UnmappedFileSystem final : public IFileSystem
+{
+public:
+    UnmappedFileSystem()
+        : content_(FileSize)
+    {
+    }
+
+    std::size_t readsCount() const noexcept
+    {
+        return reads_count_;
+    }
+
+    // MARK: IFileSystem
+
+    auto getInfo(const cetl::string_view) const -> libcyphal::Expected<Info, Error> override
+    {
+        Info info{};
+        info.size = content_.size();
+        return info;
+    }
+
+    auto open(const cetl::string_view) -> libcyphal::Expected<UniquePtr<IFile>, Error> override
+    {
+        return libcyphal::makeUniquePtr<IFile, File>(*cetl::pmr::get_default_resource(), *this);
+    }
+
+private:
+    class File final : public IFile
+    {
+    public:
+        explicit File(UnmappedFileSystem& file_system)
+            : file_system_{file_system}
+        {
+        }
+
+        ~File() = default;
+
+        File(const File&)                = delete;
+        File(File&&) noexcept            = delete;
+        File& operator=(const File&)     = delete;
+        File& operator=(File&&) noexcept = delete;
+
+        std::uint64_t getSize() const noexcept override
+        {
+            return file_system_.content_.size();
+        }
+
+        auto read(const std::uint64_t offset, const cetl::span<cetl::byte> buffer) const
+            -> libcyphal::Expected<std::size_t, Error> override
+        {
+            ++file_system_.reads_count_;
+
+            const auto& content = file_system_.content_;
+            const auto  pos     = std::min<std::size_t>(offset, content.size());
+            const auto  size    = std::min(buffer.size(), content.size() - pos);
+            (void) std::copy_n(content.begin() + static_cast<std::ptrdiff_t>(pos), size, buffer.begin());
+            return size;
+        }
+
+    private:
+        UnmappedFileSystem& file_system_;
+
+    };  // File
+
+    std::vector<cetl::byte> content_;
+    std::size_t             reads_count_{0};
+
+};  // UnmappedFileSystem
+
+/// Creates the served file (for the mapped POSIX file system) in the given root directory, and returns the root.
+///
+const std::string& makeMappedFileRoot(const TempDirectory& root_dir)
+{
+    std::ofstream           file{root_dir.makePath(FilePath), std::ios::binary | std::ios::trunc};
+    const std::vector<char> content(FileSize, 'x');
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return root_dir.path();
+}
+
+/// Holds the whole stack (media, CAN transport and presentation layer) of a node on the in-process bus.
+///
+class BusNode final
+{
+public:
+    BusNode(InProcessCanBus& bus, const NodeId node_id, const std::size_t tx_capacity)
+        : media_{bus}
+    {
+        auto& memory = *cetl::pmr::get_default_resource();
+
+        std::array<libcyphal::transport::can::IMedia*, 1> media_array{&media_};
+
+        auto maybe_transport = makeTransport(memory, bus.executor(), media_array, tx_capacity);
+        transport_           = cetl::get<UniquePtr<ICanTransport>>(std::move(maybe_transport));
+        (void) transport_->setLocalNodeId(node_id);
+
+        presentation_.emplace(memory, bus.executor(), *transport_);
+    }
+
+    Presentation& presentation() noexcept
+    {
+        return *presentation_;
+    }
+
+private:
+    InProcessCanMedia            media_;
+    UniquePtr<ICanTransport>     transport_;
+    cetl::optional<Presentation> presentation_;
+
+};  // BusNode
+
+/// Reads the whole file sequentially (one chunk at a time) - like a node which updates its firmware.
+///
+class FileReader final
+{
+public:
+    using Service = FileServer::ReadService;
+
+    FileReader(InProcessCanBus& bus, const NodeId node_id)
+        : node_{bus, node_id, 16}
+        , executor_{bus.executor()}
+        , client_{cetl::get<Client>(node_.presentation().makeClient<Service>(ServerNodeId))}
+        , request_{Service::Request::allocator_type{cetl::pmr::get_default_resource()}}
+    {
+        const cetl::string_view path{FilePath};
+        (void) std::copy(path.begin(), path.end(), std::back_inserter(request_.path.path));
+
+        // Next request is sent from a separate callback b/c the promise can't be destroyed from its own callback.
+        next_request_cb_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            sendRequest(arg.approx_now);
+        });
+    }
+
+    void start()
+    {
+        request_.offset = 0;
+        is_done_        = false;
+        sendRequest(executor_.now());
+    }
+
+    bool isDone() const noexcept
+    {
+        return is_done_;
+    }
+
+    std::size_t bytesRead() const noexcept
+    {
+        return bytes_read_;
+    }
+
+private:
+    using Client  = libcyphal::presentation::ServiceClient<Service>;
+    using Promise = libcyphal::presentation::ResponsePromise<Service::Response>;
+
+    static constexpr std::size_t ChunkCapacity = uavcan::primitive::Unstructured_1_0::_traits_::ArrayCapacity::value;
+
+    void sendRequest(const TimePoint now)
+    {
+        promise_.reset();
+
+        auto maybe_promise = client_.request(now + 1s, request_);
+        if (auto* const promise = cetl::get_if<Promise>(&maybe_promise))
+        {
+            promise_.emplace(std::move(*promise));
+            promise_->setCallback([this](const auto& arg) {
+                //
+                if (const auto* const success = cetl::get_if<Promise::Success>(&arg.result))
+                {
+                    const auto chunk_size = success->response.data.value.size();
+                    bytes_read_ += chunk_size;
+                    request_.offset += chunk_size;
+                    if (chunk_size < ChunkCapacity)
+                    {
+                        is_done_ = true;
+                        return;
+                    }
+                }
+                // Timed out requests are just retried at the same offset.
+                scheduleNextRequest(arg.approx_now);
+            });
+            return;
+        }
+        scheduleNextRequest(now);
+    }
+
+    void scheduleNextRequest(const TimePoint now)
+    {
+        const auto result = next_request_cb_.schedule(libcyphal::IExecutor::Callback::Schedule::Once{now});
+        (void) result;
+    }
+
+    BusNode                             node_;
+    libcyphal::IExecutor&               executor_;
+    Client                              client_;
+    Service::Request                    request_;
+    cetl::optional<Promise>             promise_;
+    libcyphal::IExecutor::Callback::Any next_request_cb_;
+    bool                                is_done_{true};
+    std::size_t                         bytes_read_{0};
+
+};  // FileReader
+
+/// Many nodes concurrently read the same file from the file server over a CAN FD bus.
+///
+/// The first argument is number of reading nodes; the second one selects whether the file is served
+/// from a memory mapped file (1) or from the read-ahead cache (0).
+/// Bus time is virtual, so the measured time is CPU cost of the whole stack on all nodes.
+///
+void BM_FileServer_ConcurrentRead(benchmark::State& state)
+{
+    const auto readers_count = static_cast<std::size_t>(state.range(0));
+    const bool is_mapped     = state.range(1) != 0;
+
+    VirtualTimeExecutor executor;
+    InProcessCanBus     bus{executor, 64, 20us};  // ~ CAN FD frame at 5 Mbit/s data phase
+
+    const TempDirectory                       root_dir{"org.opencyphal.bench_file_server"};
+    UnmappedFileSystem                        unmapped_file_system;
+    example::platform::posix::PosixFileSystem mapped_file_system{*cetl::pmr::get_default_resource(),
+                                                                 makeMappedFileRoot(root_dir)};
+    IFileSystem& file_system = is_mapped ? static_cast<IFileSystem&>(mapped_file_system) : unmapped_file_system;
+
+    BusNode server_node{bus, ServerNodeId, 1024};
+    auto    maybe_file_server = FileServer::make(server_node.presentation(), file_system);
+    if (cetl::get_if<FileServer>(&maybe_file_server) == nullptr)
+    {
+        state.SkipWithError("failed to make the file server");
+        return;
+    }
+
+    std::vector<std::unique_ptr<FileReader>> readers;
+    for (std::size_t i = 0; i < readers_count; ++i)
+    {
+        readers.push_back(std::make_unique<FileReader>(bus, static_cast<NodeId>(ServerNodeId + 1 + i)));
+    }
+
+    const auto all_done = [&readers] {
+        return std::all_of(readers.begin(), readers.end(), [](const auto& reader) { return reader->isDone(); });
+    };
+
+    const auto start_time = executor.now();
+    for (auto _ : state)
+    {
+        for (auto& reader : readers)
+        {
+            reader->start();
+        }
+        if (!executor.spinUntil(all_done, executor.now() + 600s))
+        {
+            state.SkipWithError("file reading has timed out");
+            break;
+        }
+    }
+
+    std::size_t total_bytes_read = 0;
+    for (const auto& reader : readers)
+    {
+        total_bytes_read += reader->bytesRead();
+    }
+    const auto iterations = static_cast<double>(state.iterations());
+    state.SetBytesProcessed(static_cast<std::int64_t>(total_bytes_read));
+    state.counters["bus_frames"]    = static_cast<double>(bus.getFramesCount()) / iterations;
+    state.counters["backend_reads"] = static_cast<double>(unmapped_file_system.readsCount()) / iterations;
+    state.counters["bus_time_ms"]   =
+        std::chrono::duration<double, std::milli>(executor.now() - start_time).count() / iterations;
+}
+BENCHMARK(BM_FileServer_ConcurrentRead)->ArgsProduct({{1, 10, 100}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,201 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "transport/can/in_process_can_bus.hpp"
+#include "virtual_time_executor.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/application/node/time_sync_publisher.hpp>
+#include <libcyphal/application/node/time_sync_subscriber.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/time_provider.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::IExecutor;
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::VirtualTimeExecutor;
+using libcyphal::application::node::TimeSyncClock;
+using libcyphal::application::node::TimeSyncPublisher;
+using libcyphal::application::node::TimeSyncSubscriber;
+using libcyphal::presentation::Presentation;
+using libcyphal::presentation::Publisher;
+using libcyphal::transport::NodeId;
+using libcyphal::transport::PortId;
+using libcyphal::transport::Priority;
+using libcyphal::transport::can::ICanTransport;
+using libcyphal::transport::can::InProcessCanBus;
+using libcyphal::transport::can::InProcessCanMedia;
+using libcyphal::transport::can::makeTransport;
+
+using std::literals::chrono_literals::operator""s;   // NOLINT(misc-unused-using-decls)
+using std::literals::chrono_literals::operator""ms;  // NOLINT(misc-unused-using-decls)
+using std::literals::chrono_literals::operator""us;  // NOLINT(misc-unused-using-decls)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr NodeId MasterNodeId  = 1;
+constexpr NodeId SlaveNodeId   = 2;
+constexpr PortId LoadSubjectId = 100;
+
+/// Holds the whole stack (media, CAN transport and presentation layer) of a node on the in-process bus.
+///
+class BusNode final
+{
+public:
+    BusNode(InProcessCanBus& bus, const NodeId node_id, const std::size_t tx_capacity)
+        : media_{bus}
+    {
+        auto& memory = *cetl::pmr::get_default_resource();
+
+        std::array<libcyphal::transport::can::IMedia*, 1> media_array{&media_};
+
+        auto maybe_transport = makeTransport(memory, bus.executor(), media_array, tx_capacity);
+        transport_           = cetl::get<UniquePtr<ICanTransport>>(std::move(maybe_transport));
+        (void) transport_->setLocalNodeId(node_id);
+
+        presentation_.emplace(memory, bus.executor(), *transport_);
+    }
+
+    InProcessCanMedia& media() noexcept
+    {
+        return media_;
+    }
+
+    Presentation& presentation() noexcept
+    {
+        return *presentation_;
+    }
+
+private:
+    InProcessCanMedia            media_;
+    UniquePtr<ICanTransport>     transport_;
+    cetl::optional<Presentation> presentation_;
+
+};  // BusNode
+
+/// Local (skewed) clock of a node - the same time base as timestamps of its media.
+///
+class MediaClock final : public libcyphal::ITimeProvider
+{
+public:
+    MediaClock(const InProcessCanMedia& media, const IExecutor& executor)
+        : media_{media}
+        , executor_{executor}
+    {
+    }
+
+    ~MediaClock() = default;
+
+    MediaClock(const MediaClock&)                = delete;
+    MediaClock(MediaClock&&) noexcept            = delete;
+    MediaClock& operator=(const MediaClock&)     = delete;
+    MediaClock& operator=(MediaClock&&) noexcept = delete;
+
+    TimePoint now() const noexcept override
+    {
+        return media_.toLocalTime(executor_.now());
+    }
+
+private:
+    const InProcessCanMedia& media_;
+    const IExecutor&         executor_;
+
+};  // MediaClock
+
+/// Synchronizes a slave clock (5 s offset, +100 ppm drift) to a master over a classic CAN bus.
+///
+/// Every second, just before the sync message, the master publishes a high priority multi-frame message,
+/// so the sync frame waits ~3 ms in the master's TX queue. With `Arg(0)` the master media doesn't report
+/// TX completion, so the master has to approximate its TX time by the publication time; with `Arg(1)`
+/// media-reported TX timestamps are in use. After a warm-up, the slave clock is sampled every 10 ms
+/// of the virtual time - `max_error_us` and `mean_error_us` counters show the accuracy,
+/// while the measured time is CPU cost of one virtual minute of the whole stack on both nodes.
+///
+void BM_TimeSync_Accuracy(benchmark::State& state)
+{
+    const bool has_tx_timestamping = state.range(0) != 0;
+
+    VirtualTimeExecutor executor;
+    InProcessCanBus     bus{executor, 8, 100us};  // ~ classic CAN frame at 1 Mbit/s
+
+    BusNode master_node{bus, MasterNodeId, 256};
+    master_node.media().setTxTimestamping(has_tx_timestamping);
+
+    BusNode slave_node{bus, SlaveNodeId, 16};
+    slave_node.media().setClockSkew(5s, 100000);
+
+    MediaClock    local_clock{slave_node.media(), executor};
+    TimeSyncClock slave_clock{local_clock};
+    auto          maybe_subscriber = TimeSyncSubscriber::make(slave_node.presentation(), slave_clock);
+    auto          maybe_publisher  = TimeSyncPublisher::make(master_node.presentation());
+    auto          maybe_load_pub   = master_node.presentation().makePublisher<void>(LoadSubjectId);
+    if ((cetl::get_if<TimeSyncSubscriber>(&maybe_subscriber) == nullptr) ||
+        (cetl::get_if<TimeSyncPublisher>(&maybe_publisher) == nullptr) ||
+        (cetl::get_if<Publisher<void>>(&maybe_load_pub) == nullptr))
+    {
+        state.SkipWithError("failed to make time sync components");
+        return;
+    }
+
+    auto load_publisher = cetl::get<Publisher<void>>(std::move(maybe_load_pub));
+    load_publisher.setPriority(Priority::Fast);
+
+    const std::array<cetl::byte, 256>                 load_payload{};
+    const std::array<cetl::span<const cetl::byte>, 1> load_fragments{load_payload};
+
+    auto load_cb = executor.registerCallback([&](const auto& arg) {
+        //
+        (void) load_publisher.publish(arg.approx_now + 1s, load_fragments);
+    });
+    (void) load_cb.schedule(IExecutor::Callback::Schedule::Repeat{executor.now() + 1s - 1ms, 1s});
+
+    executor.spinFor(30s);
+
+    Duration      max_abs_error{};
+    std::int64_t  sum_abs_error_us = 0;
+    std::uint64_t samples_count    = 0;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < 6000; ++i)
+        {
+            executor.spinFor(10ms);
+
+            const auto error     = slave_clock.now() - executor.now();
+            const auto abs_error = (error < Duration::zero()) ? -error : error;
+            max_abs_error        = std::max(max_abs_error, abs_error);
+            sum_abs_error_us += abs_error.count();
+            ++samples_count;
+        }
+    }
+
+    state.counters["max_error_us"]  = static_cast<double>(max_abs_error.count());
+    state.counters["mean_error_us"] = static_cast<double>(sum_abs_error_us) / static_cast<double>(samples_count);
+    state.counters["rate_ppb"]      = static_cast<double>(slave_clock.getRatePpb());
+}
+BENCHMARK(BM_TimeSync_Accuracy)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
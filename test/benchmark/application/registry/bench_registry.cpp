@@ -0,0 +1,208 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/flat_registry.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the benchmarks.
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Provides a small natural32 value - typical for a real register.
+///
+struct Getter
+{
+    IRegister::Value operator()() const
+    {
+        IRegister::Value value{IRegister::Value::allocator_type{cetl::pmr::get_default_resource()}};
+        value.set_natural32().value.push_back(42U);
+        return value;
+    }
+};
+
+/// Holds a registry populated with the requested number of read-only registers.
+///
+class PopulatedRegistry final
+{
+public:
+    explicit PopulatedRegistry(const std::size_t count)
+        : registry_{*cetl::pmr::get_default_resource()}
+    {
+        names_.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            names_.push_back("bench.reg." + std::to_string(i));
+            registers_.push_back(registry_.route(names_.back(), Getter{}));
+        }
+    }
+
+    const Registry& registry() const noexcept
+    {
+        return registry_;
+    }
+
+private:
+    Registry                               registry_;
+    std::vector<std::string>               names_;
+    std::list<RegisterImpl<Getter, void>> registers_;
+
+};  // PopulatedRegistry
+
+/// Mimics a `uavcan.register.List` client which crawls the whole registry by index.
+///
+void BM_Registry_ListCrawl(benchmark::State& state)
+{
+    const PopulatedRegistry populated{static_cast<std::size_t>(state.range(0))};
+    const auto&             rgy = populated.registry();
+
+    for (auto _ : state)
+    {
+        std::size_t total_name_length = 0;
+        for (std::size_t index = 0; index < rgy.size(); ++index)
+        {
+            total_name_length += rgy.index(index).size();
+        }
+        benchmark::DoNotOptimize(total_name_length);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Registry_ListCrawl)->Arg(100)->Arg(1000)->Arg(10000)->Complexity(benchmark::oNLogN);
+
+/// Mimics a full `uavcan.register.List` + `uavcan.register.Access` crawl (names first, then values by name).
+///
+void BM_Registry_ListAccessCrawl(benchmark::State& state)
+{
+    const PopulatedRegistry populated{static_cast<std::size_t>(state.range(0))};
+    const auto&             rgy = populated.registry();
+
+    for (auto _ : state)
+    {
+        for (std::size_t index = 0; index < rgy.size(); ++index)
+        {
+            auto value_and_flags = rgy.get(rgy.index(index));
+            benchmark::DoNotOptimize(value_and_flags);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Registry_ListAccessCrawl)->Arg(100)->Arg(1000)->Arg(10000)->Complexity(benchmark::oNLogN);
+
+/// Measures a single indexed access in the middle of the registry.
+///
+void BM_Registry_Index(benchmark::State& state)
+{
+    const PopulatedRegistry populated{static_cast<std::size_t>(state.range(0))};
+    const auto&             rgy    = populated.registry();
+    const std::size_t       middle = rgy.size() / 2;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rgy.index(middle));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Registry_Index)->Arg(100)->Arg(1000)->Arg(10000)->Complexity(benchmark::oLogN);
+
+/// Holds a flat registry with the given number of natural32 registers.
+///
+/// Normally, a flat table is prepared at compile time, but here it is built at runtime
+/// (by the very same `constexpr` code) - so that the number of registers could be large.
+///
+template <std::size_t N>
+class PopulatedFlatRegistry final
+{
+public:
+    using Table = FlatTable<N>;
+
+    PopulatedFlatRegistry()
+    {
+        names_.reserve(N);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            names_.push_back("bench.reg." + std::to_string(i));
+            decls_[i] = FlatRegisterDecl{names_.back().c_str(), FlatValueKind::Natural32, 1, {}};
+        }
+        table_    = std::make_unique<Table>(decls_);
+        registry_ = std::make_unique<Registry>(*cetl::pmr::get_default_resource(), *table_);
+        for (std::size_t index = 0; index < N; ++index)
+        {
+            registry_->template write<std::uint32_t>(index, 42U);
+        }
+    }
+
+    const IIntrospectableRegistry& registry() const noexcept
+    {
+        return *registry_;
+    }
+
+private:
+    using Registry = FlatRegistry<N, N * sizeof(std::uint32_t)>;
+
+    std::vector<std::string>  names_;
+    FlatRegisterDecl          decls_[N]{};  // NOLINT(*-avoid-c-arrays)
+    std::unique_ptr<Table>    table_;
+    std::unique_ptr<Registry> registry_;
+
+};  // PopulatedFlatRegistry
+
+/// The same as `BM_Registry_ListAccessCrawl`, but for the flat registry.
+///
+template <std::size_t N>
+void BM_FlatRegistry_ListAccessCrawl(benchmark::State& state)
+{
+    const auto  populated = std::make_unique<PopulatedFlatRegistry<N>>();
+    const auto& rgy       = populated->registry();
+
+    for (auto _ : state)
+    {
+        for (std::size_t index = 0; index < rgy.size(); ++index)
+        {
+            auto value_and_flags = rgy.get(rgy.index(index));
+            benchmark::DoNotOptimize(value_and_flags);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(N));
+}
+BENCHMARK_TEMPLATE(BM_FlatRegistry_ListAccessCrawl, 100);
+BENCHMARK_TEMPLATE(BM_FlatRegistry_ListAccessCrawl, 1000);
+BENCHMARK_TEMPLATE(BM_FlatRegistry_ListAccessCrawl, 10000);
+
+/// The same as `BM_Registry_Index`, but for the flat registry.
+///
+template <std::size_t N>
+void BM_FlatRegistry_Index(benchmark::State& state)
+{
+    const auto        populated = std::make_unique<PopulatedFlatRegistry<N>>();
+    const auto&       rgy       = populated->registry();
+    const std::size_t middle    = rgy.size() / 2;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rgy.index(middle));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FlatRegistry_Index, 100);
+BENCHMARK_TEMPLATE(BM_FlatRegistry_Index, 1000);
+BENCHMARK_TEMPLATE(BM_FlatRegistry_Index, 10000);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
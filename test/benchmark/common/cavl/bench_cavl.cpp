@@ -0,0 +1,392 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <libcyphal/common/cavl/cavl.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::common;  // NOLINT This our main concern here in the benchmarks.
+
+using Key = std::uint64_t;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Defines an intrusive cavl node keyed by a number - the same shape as executor callback nodes,
+/// presentation registries, transfer-ID and deadline trees.
+///
+class Item final : public cavl::Node<Item>
+{
+public:
+    Key key{0};
+};
+
+/// Adapts the cavl tree (over a preallocated pool of nodes) to the common interface of benchmarked sets.
+///
+/// Being intrusive, the tree itself never allocates - so the pool is allocated once up front.
+///
+class CavlSet final
+{
+public:
+    explicit CavlSet(const std::size_t capacity)
+        : pool_{std::make_unique<Item[]>(capacity)}  // NOLINT(*-avoid-c-arrays)
+    {
+        free_items_.reserve(capacity);
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            free_items_.push_back(&pool_[i]);
+        }
+    }
+
+    void insert(const Key key)
+    {
+        Item* const item = free_items_.back();
+        free_items_.pop_back();
+        item->key = key;
+
+        const auto result = tree_.search([key](const Item& other) { return compare(key, other); },
+                                         [item]() { return item; });
+        benchmark::DoNotOptimize(std::get<0>(result));
+    }
+
+    void remove(const Key key)
+    {
+        Item* const item = tree_.search([key](const Item& other) { return compare(key, other); });
+        tree_.remove(item);
+        free_items_.push_back(item);
+    }
+
+    bool contains(const Key key) const
+    {
+        return tree_.search([key](const Item& other) { return compare(key, other); }) != nullptr;
+    }
+
+    Key popMin()
+    {
+        Item* const item = tree_.min();
+        const Key   key  = item->key;
+        tree_.remove(item);
+        free_items_.push_back(item);
+        return key;
+    }
+
+    template <typename Visitor>
+    void traverse(const Visitor& visitor) const
+    {
+        tree_.traverseInOrder([&visitor](const Item& item) { visitor(item.key); });
+    }
+
+private:
+    static std::int8_t compare(const Key key, const Item& item) noexcept
+    {
+        if (key == item.key)
+        {
+            return 0;
+        }
+        return (key > item.key) ? +1 : -1;
+    }
+
+    std::unique_ptr<Item[]> pool_;  // NOLINT(*-avoid-c-arrays)
+    std::vector<Item*>      free_items_;
+    cavl::Tree<Item>        tree_;
+
+};  // CavlSet
+
+/// Adapts `std::map` (one heap allocation per node) to the common interface of benchmarked sets.
+///
+class MapSet final
+{
+public:
+    explicit MapSet(const std::size_t capacity)
+    {
+        (void) capacity;
+    }
+
+    void insert(const Key key)
+    {
+        map_.emplace(key, key);
+    }
+
+    void remove(const Key key)
+    {
+        map_.erase(key);
+    }
+
+    bool contains(const Key key) const
+    {
+        return map_.find(key) != map_.end();
+    }
+
+    Key popMin()
+    {
+        const auto it  = map_.begin();
+        const Key  key = it->first;
+        map_.erase(it);
+        return key;
+    }
+
+    template <typename Visitor>
+    void traverse(const Visitor& visitor) const
+    {
+        for (const auto& entry : map_)
+        {
+            visitor(entry.first);
+        }
+    }
+
+private:
+    std::map<Key, Key> map_;
+
+};  // MapSet
+
+/// Adapts sorted `std::vector` (binary search, linear insert/remove) to the common interface of benchmarked sets.
+///
+/// Elements are kept in descending order, so that the minimum is popped from the back in constant time.
+///
+class SortedVectorSet final
+{
+public:
+    explicit SortedVectorSet(const std::size_t capacity)
+    {
+        keys_.reserve(capacity);
+    }
+
+    void insert(const Key key)
+    {
+        keys_.insert(std::lower_bound(keys_.begin(), keys_.end(), key, std::greater<Key>{}), key);
+    }
+
+    void remove(const Key key)
+    {
+        const auto it = std::lower_bound(keys_.begin(), keys_.end(), key, std::greater<Key>{});
+        if ((it != keys_.end()) && (*it == key))
+        {
+            keys_.erase(it);
+        }
+    }
+
+    bool contains(const Key key) const
+    {
+        return std::binary_search(keys_.begin(), keys_.end(), key, std::greater<Key>{});
+    }
+
+    Key popMin()
+    {
+        const Key key = keys_.back();
+        keys_.pop_back();
+        return key;
+    }
+
+    template <typename Visitor>
+    void traverse(const Visitor& visitor) const
+    {
+        std::for_each(keys_.rbegin(), keys_.rend(), visitor);
+    }
+
+private:
+    std::vector<Key> keys_;
+
+};  // SortedVectorSet
+
+/// Adapts binary min-heap (over a preallocated `std::vector`) to the common interface of benchmarked sets.
+///
+/// A heap supports only insertion and removal of the minimum (f.e. a timer queue) - so it's benchmarked
+/// only for the `PopMinInsert` workload. Note that the executor also needs an arbitrary removal
+/// (f.e. on rescheduling or destruction of a callback), which is linear for a heap without back-references.
+///
+class HeapSet final
+{
+public:
+    explicit HeapSet(const std::size_t capacity)
+    {
+        keys_.reserve(capacity);
+    }
+
+    void insert(const Key key)
+    {
+        keys_.push_back(key);
+        std::push_heap(keys_.begin(), keys_.end(), std::greater<Key>{});
+    }
+
+    Key popMin()
+    {
+        std::pop_heap(keys_.begin(), keys_.end(), std::greater<Key>{});
+        const Key key = keys_.back();
+        keys_.pop_back();
+        return key;
+    }
+
+private:
+    std::vector<Key> keys_;
+
+};  // HeapSet
+
+/// Makes `count` unique keys (even numbers, so that odd ones are guaranteed to be missing) in a random order.
+///
+std::vector<Key> makeShuffledKeys(const std::size_t count)
+{
+    std::vector<Key> keys(count);
+    std::iota(keys.begin(), keys.end(), Key{0});
+    for (auto& key : keys)
+    {
+        key *= 2U;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64{42});  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+    return keys;
+}
+
+template <typename Set>
+void fill(Set& set, const std::vector<Key>& keys)
+{
+    for (const Key key : keys)
+    {
+        set.insert(key);
+    }
+}
+
+/// Replaces a random existing element with a new (missing) one - while the set keeps its size of `range(0)`.
+///
+template <typename Set>
+void BM_Cavl_RemoveInsert(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto       keys  = makeShuffledKeys(count);
+
+    Set set{count};
+    fill(set, keys);
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        // Odd keys are not in the set - so they become even again on the next round.
+        Key& key = keys[index];
+        set.remove(key);
+        key ^= 1U;
+        set.insert(key);
+        index = (index + 1U) % count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Searches for random keys in a set of size `range(0)` - every second search is a miss.
+///
+template <typename Set>
+void BM_Cavl_Search(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys  = makeShuffledKeys(count);
+
+    Set set{count};
+    fill(set, keys);
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        const Key key = keys[index / 2U] + (index % 2U);
+        benchmark::DoNotOptimize(set.contains(key));
+        index = (index + 1U) % (count * 2U);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Pops the minimum element, and inserts a new one which is greater than any existing one -
+/// the typical workload of a timer queue (like executor callbacks) of size `range(0)`.
+///
+template <typename Set>
+void BM_Cavl_PopMinInsert(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    Set set{count};
+    fill(set, makeShuffledKeys(count));
+
+    Key next_key = count * 2U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(set.popMin());
+        set.insert(next_key++);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Traverses all `range(0)` elements of a set in order.
+///
+template <typename Set>
+void BM_Cavl_Traverse(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    Set set{count};
+    fill(set, makeShuffledKeys(count));
+
+    for (auto _ : state)
+    {
+        Key sum = 0;
+        set.traverse([&sum](const Key key) { sum += key; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Builds a set of `range(0)` elements from scratch (in a random order), and then destroys it.
+///
+template <typename Set>
+void BM_Cavl_Build(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys  = makeShuffledKeys(count);
+
+    for (auto _ : state)
+    {
+        Set set{count};
+        fill(set, keys);
+        benchmark::DoNotOptimize(set);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sizes(benchmark::internal::Benchmark* const benchmark)
+{
+    benchmark->ArgName("n")->RangeMultiplier(10)->Range(10, 1000000);
+}
+
+BENCHMARK_TEMPLATE(BM_Cavl_RemoveInsert, CavlSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_RemoveInsert, MapSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_RemoveInsert, SortedVectorSet)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Cavl_Search, CavlSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Search, MapSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Search, SortedVectorSet)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Cavl_PopMinInsert, CavlSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_PopMinInsert, MapSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_PopMinInsert, SortedVectorSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_PopMinInsert, HeapSet)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Cavl_Traverse, CavlSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Traverse, MapSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Traverse, SortedVectorSet)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Cavl_Build, CavlSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Build, MapSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Build, SortedVectorSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Cavl_Build, HeapSet)->Apply(sizes);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
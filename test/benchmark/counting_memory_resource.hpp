@@ -0,0 +1,114 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_BENCHMARK_COUNTING_MEMORY_RESOURCE_HPP_INCLUDED
+#define LIBCYPHAL_BENCHMARK_COUNTING_MEMORY_RESOURCE_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+
+/// Defines memory resource which counts allocations passed through to its upstream resource.
+///
+/// In contrast to the unit tests' `TrackingMemoryResource`, this one doesn't keep a list of live allocations,
+/// so its overhead is negligible, and it could be used in the hot path of a benchmark (f.e. to report
+/// `allocs_per_op` counter as a difference of counts before and after the measured loop).
+///
+class CountingMemoryResource final : public cetl::pmr::memory_resource
+{
+public:
+    explicit CountingMemoryResource(cetl::pmr::memory_resource& upstream = *cetl::pmr::get_default_resource())
+        : upstream_{upstream}
+    {
+    }
+
+    /// Gets total number of allocations (including reallocations) made so far.
+    ///
+    std::uint64_t getAllocationsCount() const noexcept
+    {
+        return allocations_count_;
+    }
+
+    /// Gets total number of bytes allocated so far.
+    ///
+    std::uint64_t getAllocatedBytes() const noexcept
+    {
+        return allocated_bytes_;
+    }
+
+    /// Gets number of bytes which are currently allocated (not yet deallocated).
+    ///
+    std::uint64_t getInUseBytes() const noexcept
+    {
+        return in_use_bytes_;
+    }
+
+private:
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        void* const ptr = upstream_.allocate(size_bytes, alignment);
+        if (ptr != nullptr)
+        {
+            ++allocations_count_;
+            allocated_bytes_ += size_bytes;
+            in_use_bytes_ += size_bytes;
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        CETL_DEBUG_ASSERT((nullptr != ptr) || (0 == size_bytes), "");
+
+        upstream_.deallocate(ptr, size_bytes, alignment);
+        if (ptr != nullptr)
+        {
+            in_use_bytes_ -= size_bytes;
+        }
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        void* const new_ptr = upstream_.reallocate(ptr, old_size_bytes, new_size_bytes, alignment);
+        if (new_ptr != nullptr)
+        {
+            ++allocations_count_;
+            allocated_bytes_ += new_size_bytes;
+            in_use_bytes_ = in_use_bytes_ - old_size_bytes + new_size_bytes;
+        }
+        return new_ptr;
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& upstream_;
+    std::uint64_t               allocations_count_{0};
+    std::uint64_t               allocated_bytes_{0};
+    std::uint64_t               in_use_bytes_{0};
+
+};  // CountingMemoryResource
+
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_BENCHMARK_COUNTING_MEMORY_RESOURCE_HPP_INCLUDED
@@ -0,0 +1,70 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_BENCHMARK_LATENCY_SAMPLES_HPP_INCLUDED
+#define LIBCYPHAL_BENCHMARK_LATENCY_SAMPLES_HPP_INCLUDED
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace libcyphal
+{
+
+/// Collects wall clock latency samples of a benchmark, and reports their percentiles as benchmark counters.
+///
+/// Google Benchmark reports only the mean time per iteration, which hides the tail of the distribution -
+/// so operations which latency matters (f.e. end-to-end transfer delivery) record every sample.
+///
+class LatencySamples final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit LatencySamples(const std::size_t expected_count)
+    {
+        samples_.reserve(expected_count);
+    }
+
+    void add(const Clock::duration latency)
+    {
+        samples_.push_back(latency);
+    }
+
+    /// Adds `p50_ns` and `p99_ns` counters to the benchmark state (unless there are no samples).
+    ///
+    void report(benchmark::State& state)
+    {
+        if (samples_.empty())
+        {
+            return;
+        }
+        state.counters["p50_ns"] = toNanoseconds(percentile(50));
+        state.counters["p99_ns"] = toNanoseconds(percentile(99));
+    }
+
+private:
+    Clock::duration percentile(const std::size_t percent)
+    {
+        const auto nth = samples_.begin() + static_cast<std::ptrdiff_t>(((samples_.size() - 1U) * percent) / 100U);
+        std::nth_element(samples_.begin(), nth, samples_.end());
+        return *nth;
+    }
+
+    static double toNanoseconds(const Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::nano>(duration).count();
+    }
+
+    std::vector<Clock::duration> samples_;
+
+};  // LatencySamples
+
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_BENCHMARK_LATENCY_SAMPLES_HPP_INCLUDED
@@ -0,0 +1,176 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "virtual_time_executor.hpp"
+
+#include <libcyphal/executor.hpp>
+#include <libcyphal/types.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::IExecutor;
+using libcyphal::VirtualTimeExecutor;
+
+using Callback = IExecutor::Callback;
+
+using std::literals::chrono_literals::operator""h;  // NOLINT(misc-unused-using-decls)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Makes `count` pseudo-random (but reproducible) delays in the range [10ms, 1s].
+///
+std::vector<Duration> makeDelays(const std::size_t count)
+{
+    std::mt19937                                 rng{42};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+    std::uniform_int_distribution<std::uint32_t> distribution{10, 1000};
+
+    std::vector<Duration> delays;
+    delays.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        delays.emplace_back(std::chrono::milliseconds{distribution(rng)});
+    }
+    return delays;
+}
+
+/// Holds `count` executor callbacks; `repeat_percent` of them are scheduled as `Repeat` (with their delay
+/// as the period), and the rest as `Once` - which reschedule themselves (after their delay) on every execution.
+///
+class CallbackPopulation final
+{
+public:
+    CallbackPopulation(VirtualTimeExecutor& executor, const std::size_t count, const std::size_t repeat_percent)
+        : delays_{makeDelays(count)}
+    {
+        callbacks_.reserve(count);
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            const auto delay = delays_[index];
+            if ((index % 100U) < repeat_percent)
+            {
+                callbacks_.push_back(executor.registerCallback([this](const auto&) {
+                    //
+                    ++executed_count_;
+                }));
+                (void) callbacks_.back().schedule(Callback::Schedule::Repeat{executor.now() + delay, delay});
+            }
+            else
+            {
+                callbacks_.push_back(executor.registerCallback([this, index](const auto& arg) {
+                    //
+                    ++executed_count_;
+                    (void) callbacks_[index].schedule(Callback::Schedule::Once{arg.approx_now + delays_[index]});
+                }));
+                (void) callbacks_.back().schedule(Callback::Schedule::Once{executor.now() + delay});
+            }
+        }
+    }
+
+    ~CallbackPopulation() = default;
+
+    // Callbacks capture `this` - so no copying or moving.
+    CallbackPopulation(const CallbackPopulation&)                = delete;
+    CallbackPopulation(CallbackPopulation&&) noexcept            = delete;
+    CallbackPopulation& operator=(const CallbackPopulation&)     = delete;
+    CallbackPopulation& operator=(CallbackPopulation&&) noexcept = delete;
+
+    std::uint64_t getExecutedCount() const noexcept
+    {
+        return executed_count_;
+    }
+
+    Callback::Any& operator[](const std::size_t index)
+    {
+        return callbacks_[index];
+    }
+
+    Duration getDelay(const std::size_t index) const
+    {
+        return delays_[index];
+    }
+
+private:
+    const std::vector<Duration> delays_;
+    std::vector<Callback::Any>  callbacks_;
+    std::uint64_t               executed_count_{0};
+
+};  // CallbackPopulation
+
+/// Registers (and then destroys) a callback, while `range(0)` callbacks are already scheduled.
+///
+void BM_Executor_RegisterCallback(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    VirtualTimeExecutor      executor;
+    const CallbackPopulation population{executor, count, 50};
+
+    for (auto _ : state)
+    {
+        auto callback = executor.registerCallback([](const auto&) {});
+        benchmark::DoNotOptimize(callback);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Executor_RegisterCallback)->ArgName("n")->RangeMultiplier(10)->Range(10, 100000);
+
+/// Reschedules (as `Once`) one of `range(0)` already scheduled callbacks.
+///
+void BM_Executor_Schedule(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    VirtualTimeExecutor executor;
+    CallbackPopulation  population{executor, count, 50};
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        const auto delay = population.getDelay((index * 7U) % count);
+        (void) population[index].schedule(Callback::Schedule::Once{executor.now() + delay});
+        index = (index + 1U) % count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Executor_Schedule)->ArgName("n")->RangeMultiplier(10)->Range(10, 100000);
+
+/// Spins the executor until the next callback is executed, while there are `range(0)` scheduled callbacks,
+/// `range(1)` percent of which are `Repeat` ones (the rest are self-rescheduling `Once` ones).
+///
+/// So the measured time is cost of one callback dispatch by `spinOnce` (the virtual time is free).
+///
+void BM_Executor_SpinOnce(benchmark::State& state)
+{
+    const auto count          = static_cast<std::size_t>(state.range(0));
+    const auto repeat_percent = static_cast<std::size_t>(state.range(1));
+
+    VirtualTimeExecutor executor;
+    CallbackPopulation  population{executor, count, repeat_percent};
+
+    for (auto _ : state)
+    {
+        const auto expected_count = population.getExecutedCount() + 1U;
+        (void) executor.spinUntil([&] { return population.getExecutedCount() >= expected_count; },
+                                  executor.now() + 1h);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(population.getExecutedCount()));
+}
+BENCHMARK(BM_Executor_SpinOnce)
+    ->ArgNames({"n", "repeat%"})
+    ->ArgsProduct({{10, 100, 1000, 10000, 100000}, {0, 50, 100}});
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
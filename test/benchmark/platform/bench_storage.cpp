@@ -0,0 +1,200 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "platform/log_key_value.hpp"
+#include "platform/storage.hpp"
+#include "temp_directory.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/platform/storage.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the benchmarks.
+
+using libcyphal::TempDirectory;
+using example::platform::storage::KeyValue;
+using example::platform::storage::LogKeyValue;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Holds a registry populated with the requested number of persistent mutable registers.
+///
+class PersistentRegistry final
+{
+public:
+    explicit PersistentRegistry(const std::size_t count)
+        : registry_{*cetl::pmr::get_default_resource()}
+        , values_(count, 0U)
+    {
+        names_.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            names_.push_back("bench.persistent." + std::to_string(i));
+            registers_.push_back(registry_.route(names_.back(), Getter{&values_[i]}, Setter{&values_[i]}, {true}));
+        }
+    }
+
+    Registry& registry() noexcept
+    {
+        return registry_;
+    }
+
+    /// Changes all register values, so that the next save has something new to store.
+    ///
+    void touch()
+    {
+        for (auto& value : values_)
+        {
+            ++value;
+        }
+    }
+
+private:
+    struct Getter
+    {
+        IRegister::Value operator()() const
+        {
+            IRegister::Value value{IRegister::Value::allocator_type{cetl::pmr::get_default_resource()}};
+            value.set_natural32().value.push_back(*storage);
+            return value;
+        }
+        std::uint32_t* storage;
+    };
+
+    struct Setter
+    {
+        cetl::optional<SetError> operator()(const IRegister::Value& value) const
+        {
+            if (const auto* const nat32 = value.get_natural32_if())
+            {
+                if (!nat32->value.empty())
+                {
+                    *storage = nat32->value.front();
+                    return cetl::nullopt;
+                }
+            }
+            return SetError::Semantics;
+        }
+        std::uint32_t* storage;
+    };
+
+    Registry                                  registry_;
+    std::vector<std::uint32_t>                values_;
+    std::vector<std::string>                  names_;
+    std::list<RegisterImpl<Getter, Setter>> registers_;
+
+};  // PersistentRegistry
+
+void BM_Storage_PerFile_Save(benchmark::State& state)
+{
+    const TempDirectory temp_dir{"org.opencyphal.bench_storage"};
+    PersistentRegistry  persistent{static_cast<std::size_t>(state.range(0))};
+    KeyValue            storage{temp_dir.makePath("per_file")};
+
+    for (auto _ : state)
+    {
+        persistent.touch();
+        if (save(storage, persistent.registry()))
+        {
+            state.SkipWithError("save failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Storage_PerFile_Save)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+void BM_Storage_PerFile_Load(benchmark::State& state)
+{
+    const TempDirectory temp_dir{"org.opencyphal.bench_storage"};
+    PersistentRegistry  persistent{static_cast<std::size_t>(state.range(0))};
+    KeyValue            storage{temp_dir.makePath("per_file")};
+    (void) save(storage, persistent.registry());
+
+    for (auto _ : state)
+    {
+        if (load(storage, persistent.registry()))
+        {
+            state.SkipWithError("load failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Storage_PerFile_Load)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+/// The second argument selects whether every `put` is synced (1), or there is one `sync` per whole save (0).
+///
+void BM_Storage_Log_Save(benchmark::State& state)
+{
+    const TempDirectory temp_dir{"org.opencyphal.bench_storage"};
+    PersistentRegistry  persistent{static_cast<std::size_t>(state.range(0))};
+
+    LogKeyValue::Options options{};
+    options.sync_on_put = state.range(1) != 0;
+    auto maybe_storage  = LogKeyValue::make(temp_dir.makePath("log"), options);
+    if (cetl::get_if<std::unique_ptr<LogKeyValue>>(&maybe_storage) == nullptr)
+    {
+        state.SkipWithError("failed to open the log");
+        return;
+    }
+    auto& storage = *cetl::get<std::unique_ptr<LogKeyValue>>(maybe_storage);
+
+    for (auto _ : state)
+    {
+        persistent.touch();
+        if (save(storage, persistent.registry()) || storage.sync())
+        {
+            state.SkipWithError("save failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.counters["file_bytes"] = static_cast<double>(storage.fileSize());
+}
+BENCHMARK(BM_Storage_Log_Save)->ArgsProduct({{100, 1000}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+void BM_Storage_Log_Load(benchmark::State& state)
+{
+    const TempDirectory temp_dir{"org.opencyphal.bench_storage"};
+    PersistentRegistry  persistent{static_cast<std::size_t>(state.range(0))};
+
+    auto maybe_storage = LogKeyValue::make(temp_dir.makePath("log"));
+    if (cetl::get_if<std::unique_ptr<LogKeyValue>>(&maybe_storage) == nullptr)
+    {
+        state.SkipWithError("failed to open the log");
+        return;
+    }
+    auto& storage = *cetl::get<std::unique_ptr<LogKeyValue>>(maybe_storage);
+    (void) save(storage, persistent.registry());
+
+    for (auto _ : state)
+    {
+        if (load(storage, persistent.registry()))
+        {
+            state.SkipWithError("load failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Storage_Log_Load)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,371 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "counting_memory_resource.hpp"
+#include "transport/udp/in_process_udp_network.hpp"
+#include "virtual_time_executor.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/common_helpers.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/presentation/subscriber.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/udp_transport.hpp>
+#include <libcyphal/transport/udp/udp_transport_impl.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/_register/Value_1_0.hpp>
+#include <uavcan/node/GetInfo_1_0.hpp>
+#include <uavcan/node/Heartbeat_1_0.hpp>
+#include <uavcan/primitive/array/Natural8_1_0.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::CountingMemoryResource;
+using libcyphal::MemoryError;
+using libcyphal::UniquePtr;
+using libcyphal::VirtualTimeExecutor;
+using libcyphal::presentation::Presentation;
+using libcyphal::presentation::Publisher;
+using libcyphal::presentation::Subscriber;
+using libcyphal::presentation::detail::tryDeserializePayload;
+using libcyphal::presentation::detail::tryPerformOnSerialized;
+using libcyphal::transport::NodeId;
+using libcyphal::transport::PortId;
+using libcyphal::transport::ScatteredBuffer;
+using libcyphal::transport::udp::InProcessUdpMedia;
+using libcyphal::transport::udp::InProcessUdpNetwork;
+using libcyphal::transport::udp::IUdpTransport;
+using libcyphal::transport::udp::makeTransport;
+using libcyphal::transport::udp::MemoryResourcesSpec;
+
+using Heartbeat    = uavcan::node::Heartbeat_1_0;
+using GetInfo      = uavcan::node::GetInfo_1_0::Response;
+using RegisterVal  = uavcan::_register::Value_1_0;
+using LargeArray   = uavcan::primitive::array::Natural8_1_0;
+using CodecFailure = cetl::variant<MemoryError, nunavut::support::Error>;
+
+using std::literals::chrono_literals::operator""s;   // NOLINT(misc-unused-using-decls)
+using std::literals::chrono_literals::operator""us;  // NOLINT(misc-unused-using-decls)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr NodeId PublisherNodeId  = 1;
+constexpr NodeId SubscriberNodeId = 2;
+constexpr PortId SubjectId        = 100;
+constexpr int    WarmUpMessages   = 16;
+
+/// Makes a representative (as large as the type is typically used) instance of a message.
+///
+template <typename Message>
+Message makeMessage(cetl::pmr::memory_resource& memory);
+
+template <>
+Heartbeat makeMessage<Heartbeat>(cetl::pmr::memory_resource& memory)
+{
+    Heartbeat heartbeat{Heartbeat::allocator_type{&memory}};
+    heartbeat.uptime                      = 123456;
+    heartbeat.vendor_specific_status_code = 42;
+    return heartbeat;
+}
+
+template <>
+GetInfo makeMessage<GetInfo>(cetl::pmr::memory_resource& memory)
+{
+    GetInfo get_info{GetInfo::allocator_type{&memory}};
+    get_info.software_version.major   = 1;
+    get_info.software_vcs_revision_id = 0x0123456789ABCDEF;
+    get_info.name.assign(GetInfo::_traits_::ArrayCapacity::name, 'n');
+    get_info.software_image_crc.push_back(0xFEDCBA9876543210);
+    get_info.certificate_of_authenticity.assign(GetInfo::_traits_::ArrayCapacity::certificate_of_authenticity, 0xCA);
+    return get_info;
+}
+
+template <>
+RegisterVal makeMessage<RegisterVal>(cetl::pmr::memory_resource& memory)
+{
+    RegisterVal value{RegisterVal::allocator_type{&memory}};
+    auto&       natural16 = value.set_natural16().value;
+    for (std::size_t i = 0; i < RegisterVal::_traits_::TypeOf::natural16::_traits_::ArrayCapacity::value; ++i)
+    {
+        natural16.push_back(static_cast<std::uint16_t>(i));
+    }
+    return value;
+}
+
+template <>
+LargeArray makeMessage<LargeArray>(cetl::pmr::memory_resource& memory)
+{
+    LargeArray array{LargeArray::allocator_type{&memory}};
+    array.value.assign(LargeArray::_traits_::ArrayCapacity::value, 0x5A);
+    return array;
+}
+
+/// Implements scattered buffer storage over a contiguous span of bytes - the simplest possible one.
+///
+class SpanStorage final : public ScatteredBuffer::IStorage
+{
+public:
+    explicit SpanStorage(const cetl::span<const cetl::byte> data)
+        : data_{data}
+    {
+    }
+
+    // MARK: ScatteredBuffer::IStorage
+
+    std::size_t size() const noexcept override
+    {
+        return data_.size();
+    }
+
+    std::size_t copy(const std::size_t offset_bytes,
+                     cetl::byte* const destination,
+                     const std::size_t length_bytes) const override
+    {
+        if (offset_bytes >= data_.size())
+        {
+            return 0;
+        }
+        const auto fragment = data_.subspan(offset_bytes, std::min(length_bytes, data_.size() - offset_bytes));
+        (void) std::copy(fragment.begin(), fragment.end(), destination);
+        return fragment.size();
+    }
+
+private:
+    cetl::span<const cetl::byte> data_;
+
+};  // SpanStorage
+
+/// Holds the whole stack (media, UDP transport and presentation layer) of a node on the in-process network.
+///
+class NetworkNode final
+{
+public:
+    NetworkNode(InProcessUdpNetwork& network, cetl::pmr::memory_resource& memory, const NodeId node_id)
+        : media_{network, memory}
+    {
+        std::array<libcyphal::transport::udp::IMedia*, 1> media_array{&media_};
+
+        auto maybe_transport = makeTransport(MemoryResourcesSpec{memory}, network.executor(), media_array, 256);
+        if (auto* const transport = cetl::get_if<UniquePtr<IUdpTransport>>(&maybe_transport))
+        {
+            transport_ = std::move(*transport);
+            (void) transport_->setLocalNodeId(node_id);
+            presentation_.emplace(memory, network.executor(), *transport_);
+        }
+    }
+
+    Presentation* presentation() noexcept
+    {
+        return presentation_ ? &presentation_.value() : nullptr;
+    }
+
+private:
+    InProcessUdpMedia            media_;
+    UniquePtr<IUdpTransport>     transport_;
+    cetl::optional<Presentation> presentation_;
+
+};  // NetworkNode
+
+/// Serializes a message - just like `Publisher<Message>::publish` does - into a buffer either on stack
+/// or allocated from PMR (`IsOnStack`), so that the cost of the buffer strategy could be compared.
+///
+template <typename Message, bool IsOnStack>
+void BM_Presentation_Serialize(benchmark::State& state)
+{
+    using Result                     = cetl::optional<CodecFailure>;
+    constexpr std::size_t BufferSize = Message::_traits_::SerializationBufferSizeBytes;
+
+    CountingMemoryResource memory;
+    const Message          message = makeMessage<Message>(memory);
+
+    std::size_t total_bytes   = 0;
+    const auto  allocs_before = memory.getAllocationsCount();
+    for (auto _ : state)
+    {
+        const auto failure = tryPerformOnSerialized<Message, Result, BufferSize, IsOnStack>(  //
+            message,
+            memory,
+            [&total_bytes](const auto fragments) -> Result {
+                //
+                benchmark::DoNotOptimize(fragments.front().data());
+                total_bytes += fragments.front().size();
+                return cetl::nullopt;
+            });
+        if (failure)
+        {
+            state.SkipWithError("failed to serialize");
+            return;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(total_bytes));
+    state.counters["allocs_per_op"] =
+        benchmark::Counter(static_cast<double>(memory.getAllocationsCount() - allocs_before),
+                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, Heartbeat, true);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, Heartbeat, false);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, GetInfo, true);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, GetInfo, false);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, RegisterVal, true);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, RegisterVal, false);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, LargeArray, true);
+BENCHMARK_TEMPLATE(BM_Presentation_Serialize, LargeArray, false);
+
+/// Deserializes a message from a scattered buffer - just like a subscriber does. Small payloads are copied
+/// into a stack buffer, while larger ones into a temporary PMR buffer (see `tryDeserializePayload`).
+/// The `allocs_per_op` counter includes allocations of the message itself (its variable-length arrays).
+///
+template <typename Message>
+void BM_Presentation_Deserialize(benchmark::State& state)
+{
+    CountingMemoryResource memory;
+
+    std::vector<cetl::byte> payload(Message::_traits_::SerializationBufferSizeBytes);
+    {
+        const Message message = makeMessage<Message>(memory);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto* const data        = reinterpret_cast<std::uint8_t*>(payload.data());
+        const auto  result_size = serialize(message, {data, payload.size()});
+        if (!result_size)
+        {
+            state.SkipWithError("failed to serialize");
+            return;
+        }
+        payload.resize(result_size.value());
+    }
+    const ScatteredBuffer buffer{SpanStorage{payload}};
+
+    const auto allocs_before = memory.getAllocationsCount();
+    for (auto _ : state)
+    {
+        Message message{typename Message::allocator_type{&memory}};
+        if (tryDeserializePayload(buffer, memory, message))
+        {
+            state.SkipWithError("failed to deserialize");
+            return;
+        }
+        benchmark::DoNotOptimize(message);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(payload.size()));
+    state.counters["allocs_per_op"] =
+        benchmark::Counter(static_cast<double>(memory.getAllocationsCount() - allocs_before),
+                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_Presentation_Deserialize, Heartbeat);
+BENCHMARK_TEMPLATE(BM_Presentation_Deserialize, GetInfo);
+BENCHMARK_TEMPLATE(BM_Presentation_Deserialize, RegisterVal);
+BENCHMARK_TEMPLATE(BM_Presentation_Deserialize, LargeArray);
+
+/// Publishes a message from one node, and receives it on another one by `range(0)` subscribers
+/// of the same subject. The message is deserialized once for all of them (`deserializeMsgOnceForManySubs`),
+/// so the cost of extra subscribers should be just the callback dispatch.
+///
+/// Every iteration is one message end to end - serialization, the UDP transport (over the in-process network)
+/// on both nodes, deserialization and delivery to all subscribers. The `allocs_per_op` counter includes
+/// allocations of both nodes' transport and presentation layers.
+///
+template <typename Message>
+void BM_Presentation_PubSub(benchmark::State& state)
+{
+    const auto subscribers_count = static_cast<std::size_t>(state.range(0));
+
+    VirtualTimeExecutor    executor;
+    InProcessUdpNetwork    network{executor, 10us};
+    CountingMemoryResource memory;
+    NetworkNode            pub_node{network, memory, PublisherNodeId};
+    NetworkNode            sub_node{network, memory, SubscriberNodeId};
+    if ((pub_node.presentation() == nullptr) || (sub_node.presentation() == nullptr))
+    {
+        state.SkipWithError("failed to make UDP transports");
+        return;
+    }
+
+    auto        maybe_publisher = pub_node.presentation()->makePublisher<Message>(SubjectId);
+    auto* const publisher_ptr = cetl::get_if<Publisher<Message>>(&maybe_publisher);
+    if (publisher_ptr == nullptr)
+    {
+        state.SkipWithError("failed to make publisher");
+        return;
+    }
+
+    std::size_t                      received_count = 0;
+    std::vector<Subscriber<Message>> subscribers;
+    subscribers.reserve(subscribers_count);
+    for (std::size_t index = 0; index < subscribers_count; ++index)
+    {
+        auto        maybe_subscriber = sub_node.presentation()->makeSubscriber<Message>(SubjectId);
+        auto* const subscriber_ptr = cetl::get_if<Subscriber<Message>>(&maybe_subscriber);
+        if (subscriber_ptr == nullptr)
+        {
+            state.SkipWithError("failed to make subscriber");
+            return;
+        }
+        subscriber_ptr->setOnReceiveCallback([&received_count](const auto& arg) {
+            //
+            benchmark::DoNotOptimize(arg.message);
+            ++received_count;
+        });
+        subscribers.push_back(std::move(*subscriber_ptr));
+    }
+
+    const Message message = makeMessage<Message>(memory);
+    const auto    publish = [&]() -> bool {
+        const auto expected_count = received_count + subscribers_count;
+        return !publisher_ptr->publish(executor.now() + 1s, message).has_value() &&
+               executor.spinUntil([&] { return received_count == expected_count; }, executor.now() + 1s);
+    };
+
+    // Warm up to let all lazy allocations happen before the measurement.
+    for (int i = 0; i < WarmUpMessages; ++i)
+    {
+        if (!publish())
+        {
+            state.SkipWithError("message was not delivered");
+            return;
+        }
+    }
+
+    const auto allocs_before = memory.getAllocationsCount();
+    for (auto _ : state)
+    {
+        if (!publish())
+        {
+            state.SkipWithError("message was not delivered");
+            return;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["allocs_per_op"] =
+        benchmark::Counter(static_cast<double>(memory.getAllocationsCount() - allocs_before),
+                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_Presentation_PubSub, Heartbeat)->ArgName("subs")->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_Presentation_PubSub, RegisterVal)->ArgName("subs")->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_Presentation_PubSub, LargeArray)->ArgName("subs")->Arg(1)->Arg(10)->Arg(100);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
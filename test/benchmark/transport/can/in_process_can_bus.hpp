@@ -0,0 +1,331 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_BENCHMARK_TRANSPORT_CAN_IN_PROCESS_CAN_BUS_HPP_INCLUDED
+#define LIBCYPHAL_BENCHMARK_TRANSPORT_CAN_IN_PROCESS_CAN_BUS_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+class InProcessCanMedia;
+
+/// Defines a virtual CAN bus which connects media of multiple in-process nodes.
+///
+/// The bus transmits one frame at a time - every frame occupies the bus for the `frame_duration`, and
+/// a media which tries to push a frame while the bus is busy is told to retry later (like an arbitration loss).
+/// Transmitted frames are delivered to RX queues of all other attached media (subject to their filters).
+///
+class InProcessCanBus final
+{
+public:
+    InProcessCanBus(IExecutor& executor, const std::size_t mtu, const Duration frame_duration)
+        : executor_{executor}
+        , mtu_{mtu}
+        , frame_duration_{frame_duration}
+    {
+    }
+
+    IExecutor& executor() const noexcept
+    {
+        return executor_;
+    }
+
+    std::size_t getMtu() const noexcept
+    {
+        return mtu_;
+    }
+
+    Duration getFrameDuration() const noexcept
+    {
+        return frame_duration_;
+    }
+
+    /// Gets total number of frames transmitted over the bus.
+    ///
+    std::size_t getFramesCount() const noexcept
+    {
+        return frames_count_;
+    }
+
+    void attach(InProcessCanMedia& media)
+    {
+        media_.push_back(&media);
+    }
+
+    void detach(InProcessCanMedia& media)
+    {
+        media_.erase(std::remove(media_.begin(), media_.end(), &media), media_.end());
+    }
+
+    /// Tries to transmit a frame on behalf of the given sender media.
+    ///
+    /// @return `false` if the bus is currently busy (so the frame should be pushed again later).
+    ///
+    bool tryTransmit(const InProcessCanMedia& sender, const CanId can_id, const cetl::span<const cetl::byte> payload);
+
+private:
+    IExecutor&                      executor_;
+    const std::size_t               mtu_;
+    const Duration                  frame_duration_;
+    std::vector<InProcessCanMedia*> media_;
+    TimePoint                       busy_until_{};
+    std::size_t                     frames_count_{0};
+
+};  // InProcessCanBus
+
+/// Defines CAN media of a node attached to an in-process bus.
+///
+/// Readiness to push and pop is polled once per frame duration (similar to a polling driver),
+/// so the media doesn't need any integration with the executor besides regular callbacks.
+///
+/// TX completion is reported (if enabled) when transmission of the frame is over, i.e. at the same time
+/// when other media receive it. RX and TX timestamps are in the local time of the media, which by default
+/// is the bus (executor) time, but could be skewed to emulate an independent clock of a node.
+///
+class InProcessCanMedia final : public IMedia
+{
+public:
+    explicit InProcessCanMedia(InProcessCanBus& bus)
+        : bus_{bus}
+    {
+        bus_.attach(*this);
+    }
+
+    ~InProcessCanMedia()
+    {
+        bus_.detach(*this);
+    }
+
+    InProcessCanMedia(const InProcessCanMedia&)                = delete;
+    InProcessCanMedia(InProcessCanMedia&&) noexcept            = delete;
+    InProcessCanMedia& operator=(const InProcessCanMedia&)     = delete;
+    InProcessCanMedia& operator=(InProcessCanMedia&&) noexcept = delete;
+
+    /// Puts a frame transmitted by another media into the RX queue (unless it's rejected by the filters).
+    ///
+    void deliver(const TimePoint timestamp, const CanId can_id, const cetl::span<const cetl::byte> payload)
+    {
+        CETL_DEBUG_ASSERT(payload.size() <= MaxMtu, "");
+
+        const bool is_accepted = std::any_of(filters_.begin(), filters_.end(), [can_id](const Filter& filter) {
+            return (can_id & filter.mask) == (filter.id & filter.mask);
+        });
+        if (!is_accepted)
+        {
+            return;
+        }
+
+        RxFrame frame{timestamp, can_id, payload.size(), {}};
+        (void) std::copy(payload.begin(), payload.end(), frame.data.begin());
+        rx_queue_.push_back(frame);
+    }
+
+    /// Sets skew of the local clock of the media relative to the bus time.
+    ///
+    /// @param offset Offset of the local clock at the bus time zero.
+    /// @param drift_ppb Drift of the local clock, in parts per billion (positive means that it runs faster).
+    ///
+    void setClockSkew(const Duration offset, const std::int64_t drift_ppb)
+    {
+        clock_offset_    = offset;
+        clock_drift_ppb_ = drift_ppb;
+    }
+
+    /// Converts the bus time to the local time of the media.
+    ///
+    TimePoint toLocalTime(const TimePoint bus_time) const noexcept
+    {
+        const auto since_epoch = bus_time.time_since_epoch();
+        return bus_time + clock_offset_ + Duration{(since_epoch.count() * clock_drift_ppb_) / 1000000000LL};
+    }
+
+    /// Enables or disables support of TX completion notifications (enabled by default).
+    ///
+    void setTxTimestamping(const bool is_enabled)
+    {
+        is_tx_timestamping_ = is_enabled;
+    }
+
+    // MARK: IMedia
+
+    std::size_t getMtu() const noexcept override
+    {
+        return bus_.getMtu();
+    }
+
+    cetl::optional<MediaFailure> setFilters(const Filters filters) noexcept override
+    {
+        filters_.assign(filters.begin(), filters.end());
+        return cetl::nullopt;
+    }
+
+    PushResult::Type push(const TimePoint deadline, const CanId can_id, MediaPayload& payload) noexcept override
+    {
+        if (bus_.executor().now() > deadline)
+        {
+            // Timed out frames are just dropped.
+            return PushResult::Success{true};
+        }
+        const bool is_accepted = bus_.tryTransmit(*this, can_id, payload.getSpan());
+        if (is_accepted && tx_complete_fn_)
+        {
+            // The bus transmits one frame at a time, so there could be only one pending TX completion.
+            pending_tx_complete_ = {bus_.executor().now() + bus_.getFrameDuration(), can_id};
+
+            const IExecutor::Callback::Schedule::Once schedule{pending_tx_complete_.timestamp};
+            const auto                                result = tx_complete_cb_.schedule(schedule);
+            CETL_DEBUG_ASSERT(result, "");
+            (void) result;
+        }
+        return PushResult::Success{is_accepted};
+    }
+
+    CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
+    {
+        // A frame is not received until its transmission is over.
+        if (rx_queue_.empty() || (rx_queue_.front().timestamp > bus_.executor().now()))
+        {
+            return cetl::nullopt;
+        }
+
+        const RxFrame& frame = rx_queue_.front();
+        const auto     size  = std::min(frame.size, payload_buffer.size());
+        (void) std::copy_n(frame.data.begin(), size, payload_buffer.begin());
+
+        const PopResult::Metadata metadata{toLocalTime(frame.timestamp), frame.can_id, size};
+        rx_queue_.pop_front();
+        return metadata;
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPushCallback(IExecutor::Callback::Function&& function) override
+    {
+        return registerPollingCallback(std::move(function));
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPopCallback(IExecutor::Callback::Function&& function) override
+    {
+        return registerPollingCallback(std::move(function));
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return *cetl::pmr::get_default_resource();
+    }
+
+    bool setTxCompleteCallback(TxCompleteCallback::Function&& function) override
+    {
+        if (!is_tx_timestamping_)
+        {
+            return false;
+        }
+
+        tx_complete_fn_ = std::move(function);
+        if (!tx_complete_fn_)
+        {
+            tx_complete_cb_.reset();
+            return true;
+        }
+
+        tx_complete_cb_ = bus_.executor().registerCallback([this](const auto&) {
+            //
+            if (tx_complete_fn_)
+            {
+                const auto& pending = pending_tx_complete_;
+                tx_complete_fn_(TxCompleteCallback::Arg{toLocalTime(pending.timestamp), pending.can_id});
+            }
+        });
+        return true;
+    }
+
+private:
+    static constexpr std::size_t MaxMtu = 64;
+
+    struct RxFrame
+    {
+        TimePoint                      timestamp;
+        CanId                          can_id;
+        std::size_t                    size;
+        std::array<cetl::byte, MaxMtu> data;
+    };
+
+    IExecutor::Callback::Any registerPollingCallback(IExecutor::Callback::Function&& function)
+    {
+        auto&      executor = bus_.executor();
+        const auto period   = bus_.getFrameDuration();
+
+        auto callback = executor.registerCallback(std::move(function));
+        const auto result = callback.schedule(IExecutor::Callback::Schedule::Repeat{executor.now() + period, period});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+        return callback;
+    }
+
+    struct TxComplete
+    {
+        TimePoint timestamp;
+        CanId     can_id;
+    };
+
+    InProcessCanBus&             bus_;
+    std::vector<Filter>          filters_;
+    std::deque<RxFrame>          rx_queue_;
+    Duration                     clock_offset_{};
+    std::int64_t                 clock_drift_ppb_{0};
+    bool                         is_tx_timestamping_{true};
+    TxCompleteCallback::Function tx_complete_fn_;
+    IExecutor::Callback::Any     tx_complete_cb_;
+    TxComplete                   pending_tx_complete_{};
+
+};  // InProcessCanMedia
+
+inline bool InProcessCanBus::tryTransmit(const InProcessCanMedia&           sender,
+                                         const CanId                        can_id,
+                                         const cetl::span<const cetl::byte> payload)
+{
+    const auto now = executor_.now();
+    if (now < busy_until_)
+    {
+        return false;
+    }
+    busy_until_ = now + frame_duration_;
+    ++frames_count_;
+
+    for (InProcessCanMedia* const media : media_)
+    {
+        if (media != &sender)
+        {
+            media->deliver(busy_until_, can_id, payload);
+        }
+    }
+    return true;
+}
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_BENCHMARK_TRANSPORT_CAN_IN_PROCESS_CAN_BUS_HPP_INCLUDED
@@ -0,0 +1,214 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "counting_memory_resource.hpp"
+#include "latency_samples.hpp"
+#include "transport/udp/in_process_udp_network.hpp"
+#include "virtual_time_executor.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/udp_transport.hpp>
+#include <libcyphal/transport/udp/udp_transport_impl.hpp>
+#include <libcyphal/types.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::CountingMemoryResource;
+using libcyphal::LatencySamples;
+using libcyphal::UniquePtr;
+using libcyphal::VirtualTimeExecutor;
+using libcyphal::transport::IMessageRxSession;
+using libcyphal::transport::IMessageTxSession;
+using libcyphal::transport::MessageRxParams;
+using libcyphal::transport::MessageTxParams;
+using libcyphal::transport::NodeId;
+using libcyphal::transport::PortId;
+using libcyphal::transport::Priority;
+using libcyphal::transport::TransferTxMetadata;
+using libcyphal::transport::udp::InProcessUdpMedia;
+using libcyphal::transport::udp::InProcessUdpNetwork;
+using libcyphal::transport::udp::IUdpTransport;
+using libcyphal::transport::udp::makeTransport;
+using libcyphal::transport::udp::MemoryResourcesSpec;
+
+using std::literals::chrono_literals::operator""s;   // NOLINT(misc-unused-using-decls)
+using std::literals::chrono_literals::operator""us;  // NOLINT(misc-unused-using-decls)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr NodeId PublisherNodeId  = 1;
+constexpr NodeId SubscriberNodeId = 2;
+constexpr PortId FirstSubjectId   = 100;
+constexpr int    WarmUpTransfers  = 16;
+
+/// Holds media (one per redundant network) and UDP transport of a node on the in-process networks.
+///
+class NetworkNode final
+{
+public:
+    NetworkNode(std::vector<InProcessUdpNetwork>& networks,
+                cetl::pmr::memory_resource&       memory,
+                const NodeId                      node_id)
+    {
+        std::vector<libcyphal::transport::udp::IMedia*> media_ptrs;
+        for (auto& network : networks)
+        {
+            media_.emplace_back(std::make_unique<InProcessUdpMedia>(network, memory));
+            media_ptrs.push_back(media_.back().get());
+        }
+
+        auto maybe_transport = makeTransport(MemoryResourcesSpec{memory}, networks.front().executor(), media_ptrs, 256);
+        if (auto* const transport = cetl::get_if<UniquePtr<IUdpTransport>>(&maybe_transport))
+        {
+            transport_ = std::move(*transport);
+            (void) transport_->setLocalNodeId(node_id);
+        }
+    }
+
+    IUdpTransport* transport() const noexcept
+    {
+        return transport_.get();
+    }
+
+private:
+    std::vector<std::unique_ptr<InProcessUdpMedia>> media_;
+    UniquePtr<IUdpTransport>                        transport_;
+
+};  // NetworkNode
+
+std::size_t getDatagramsCount(const std::vector<InProcessUdpNetwork>& networks)
+{
+    std::size_t count = 0;
+    for (const auto& network : networks)
+    {
+        count += network.getDatagramsCount();
+    }
+    return count;
+}
+
+/// Publishes messages of `range(0)` bytes from one node, and receives them on another one,
+/// which is subscribed to `range(2)` subjects (published in round-robin), over `range(1)` redundant networks.
+///
+/// Every iteration is one transfer end to end - from the `send` call, via TX queues, media, datagram reassembly
+/// and deduplication of redundant copies, up to the subscriber's receive callback. So the measured time is CPU cost
+/// of a transfer on both nodes (the virtual time of the networks is free), while `p50_ns`/`p99_ns` counters show
+/// its wall clock distribution.
+/// The `allocs_per_transfer` counter includes allocations of both transports (including RX datagram buffers),
+/// and `datagrams_per_transfer` - all redundant copies.
+///
+void BM_UdpTransport_PubSub(benchmark::State& state)
+{
+    const auto payload_size        = static_cast<std::size_t>(state.range(0));
+    const auto redundancy          = static_cast<std::size_t>(state.range(1));
+    const auto subscriptions_count = static_cast<std::size_t>(state.range(2));
+
+    VirtualTimeExecutor              executor;
+    std::vector<InProcessUdpNetwork> networks(redundancy, InProcessUdpNetwork{executor, 10us});
+    CountingMemoryResource           memory;
+    NetworkNode                      pub_node{networks, memory, PublisherNodeId};
+    NetworkNode                      sub_node{networks, memory, SubscriberNodeId};
+    if ((pub_node.transport() == nullptr) || (sub_node.transport() == nullptr))
+    {
+        state.SkipWithError("failed to make UDP transports");
+        return;
+    }
+
+    std::size_t                               received_count = 0;
+    std::vector<UniquePtr<IMessageTxSession>> tx_sessions;
+    std::vector<UniquePtr<IMessageRxSession>> rx_sessions;
+    for (std::size_t index = 0; index < subscriptions_count; ++index)
+    {
+        const auto subject_id = static_cast<PortId>(FirstSubjectId + index);
+
+        auto maybe_tx_session  = pub_node.transport()->makeMessageTxSession(MessageTxParams{subject_id});
+        auto maybe_rx_session  = sub_node.transport()->makeMessageRxSession(MessageRxParams{payload_size, subject_id});
+        auto* const tx_session = cetl::get_if<UniquePtr<IMessageTxSession>>(&maybe_tx_session);
+        auto* const rx_session = cetl::get_if<UniquePtr<IMessageRxSession>>(&maybe_rx_session);
+        if ((tx_session == nullptr) || (rx_session == nullptr))
+        {
+            state.SkipWithError("failed to make UDP sessions");
+            return;
+        }
+        (*rx_session)->setOnReceiveCallback([&received_count, payload_size](const auto& arg) {
+            //
+            if (arg.transfer.payload.size() == payload_size)
+            {
+                ++received_count;
+            }
+        });
+        tx_sessions.push_back(std::move(*tx_session));
+        rx_sessions.push_back(std::move(*rx_session));
+    }
+
+    const std::vector<cetl::byte>                     payload(payload_size);
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{cetl::span<const cetl::byte>{payload}};
+
+    std::uint64_t transfer_id = 0;
+    const auto    transfer    = [&]() -> bool {
+        auto&                    tx_session = *tx_sessions[transfer_id % subscriptions_count];
+        const TransferTxMetadata metadata{{transfer_id, Priority::Nominal}, executor.now() + 1s};
+        ++transfer_id;
+
+        const auto expected_count = received_count + 1;
+        return !tx_session.send(metadata, fragments).has_value() &&
+               executor.spinUntil([&] { return received_count == expected_count; }, executor.now() + 1s);
+    };
+
+    // Warm up to let all lazy allocations (like RX session states) happen before the measurement.
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        if (!transfer())
+        {
+            state.SkipWithError("transfer was not delivered");
+            return;
+        }
+    }
+
+    const auto     allocs_before    = memory.getAllocationsCount();
+    const auto     datagrams_before = getDatagramsCount(networks);
+    LatencySamples latencies{1024};
+    for (auto _ : state)
+    {
+        const auto started_at = LatencySamples::Clock::now();
+        if (!transfer())
+        {
+            state.SkipWithError("transfer was not delivered");
+            return;
+        }
+        latencies.add(LatencySamples::Clock::now() - started_at);
+    }
+
+    const auto iterations      = static_cast<double>(state.iterations());
+    const auto allocs_count    = memory.getAllocationsCount() - allocs_before;
+    const auto datagrams_count = getDatagramsCount(networks) - datagrams_before;
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(payload_size));
+    state.counters["allocs_per_transfer"]    = static_cast<double>(allocs_count) / iterations;
+    state.counters["datagrams_per_transfer"] = static_cast<double>(datagrams_count) / iterations;
+    latencies.report(state);
+}
+BENCHMARK(BM_UdpTransport_PubSub)
+    ->ArgNames({"payload", "redundancy", "subs"})
+    ->ArgsProduct({{64, 1400, 8192, 65536}, {1, 2, 3}, {1, 16}})
+    ->Unit(benchmark::kMicrosecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,326 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_BENCHMARK_TRANSPORT_UDP_IN_PROCESS_UDP_NETWORK_HPP_INCLUDED
+#define LIBCYPHAL_BENCHMARK_TRANSPORT_UDP_IN_PROCESS_UDP_NETWORK_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+class InProcessUdpRxSocket;
+
+/// Defines a virtual multicast network which connects UDP media of multiple in-process nodes.
+///
+/// The network has unlimited bandwidth - every datagram is accepted immediately, and it's delivered
+/// (after the fixed `latency`) to all RX sockets which joined its multicast group, except the sender's ones.
+/// Redundant interfaces are modeled by multiple networks (one media of a node per network).
+///
+class InProcessUdpNetwork final
+{
+public:
+    InProcessUdpNetwork(IExecutor& executor, const Duration latency)
+        : executor_{executor}
+        , latency_{latency}
+    {
+    }
+
+    IExecutor& executor() const noexcept
+    {
+        return executor_;
+    }
+
+    Duration getLatency() const noexcept
+    {
+        return latency_;
+    }
+
+    /// Gets total number of datagrams sent over the network.
+    ///
+    std::size_t getDatagramsCount() const noexcept
+    {
+        return datagrams_count_;
+    }
+
+    void join(InProcessUdpRxSocket& rx_socket)
+    {
+        rx_sockets_.push_back(&rx_socket);
+    }
+
+    void leave(InProcessUdpRxSocket& rx_socket)
+    {
+        rx_sockets_.erase(std::remove(rx_sockets_.begin(), rx_sockets_.end(), &rx_socket), rx_sockets_.end());
+    }
+
+    /// Sends a datagram (gathered from the payload fragments) on behalf of the given sender media.
+    ///
+    void send(const void* const sender, const IpEndpoint endpoint, const PayloadFragments payload_fragments);
+
+private:
+    IExecutor&                         executor_;
+    const Duration                     latency_;
+    std::vector<InProcessUdpRxSocket*> rx_sockets_;
+    std::size_t                        datagrams_count_{0};
+
+};  // InProcessUdpNetwork
+
+/// Defines UDP RX socket of an in-process media.
+///
+/// Received datagrams are queued (with their delivery time), and handed over to the transport
+/// in a buffer allocated from the payload memory resource of the transport (as the transport requires).
+///
+class InProcessUdpRxSocket final : public IRxSocket
+{
+public:
+    InProcessUdpRxSocket(InProcessUdpNetwork&        network,
+                         const void* const           owner,
+                         const IpEndpoint            endpoint,
+                         cetl::pmr::memory_resource& payload_memory)
+        : network_{network}
+        , owner_{owner}
+        , endpoint_{endpoint}
+        , payload_memory_{payload_memory}
+    {
+        network_.join(*this);
+    }
+
+    ~InProcessUdpRxSocket()
+    {
+        network_.leave(*this);
+    }
+
+    InProcessUdpRxSocket(const InProcessUdpRxSocket&)                = delete;
+    InProcessUdpRxSocket(InProcessUdpRxSocket&&) noexcept            = delete;
+    InProcessUdpRxSocket& operator=(const InProcessUdpRxSocket&)     = delete;
+    InProcessUdpRxSocket& operator=(InProcessUdpRxSocket&&) noexcept = delete;
+
+    const void* getOwner() const noexcept
+    {
+        return owner_;
+    }
+
+    const IpEndpoint& getEndpoint() const noexcept
+    {
+        return endpoint_;
+    }
+
+    void deliver(const TimePoint timestamp, const PayloadFragments payload_fragments)
+    {
+        Datagram datagram{timestamp, {}};
+        for (const auto fragment : payload_fragments)
+        {
+            datagram.data.insert(datagram.data.end(), fragment.begin(), fragment.end());
+        }
+        rx_queue_.push_back(std::move(datagram));
+    }
+
+    // MARK: IRxSocket
+
+    CETL_NODISCARD ReceiveResult::Type receive() override
+    {
+        // A datagram is not received until its delivery time.
+        if (rx_queue_.empty() || (rx_queue_.front().timestamp > network_.executor().now()))
+        {
+            return cetl::nullopt;
+        }
+
+        const Datagram& datagram = rx_queue_.front();
+        const auto      size     = datagram.data.size();
+        auto* const     buffer   = static_cast<cetl::byte*>(payload_memory_.allocate(size));
+        if (buffer == nullptr)
+        {
+            return MemoryError{};
+        }
+        (void) std::copy(datagram.data.begin(), datagram.data.end(), buffer);
+
+        ReceiveResult::Metadata metadata{datagram.timestamp, {buffer, PmrRawBytesDeleter{size, &payload_memory_}}};
+        rx_queue_.pop_front();
+        return metadata;
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+    {
+        return registerPollingCallback(network_, std::move(function));
+    }
+
+    /// Registers callback which polls readiness once per network latency (similar to a polling driver).
+    ///
+    static IExecutor::Callback::Any registerPollingCallback(InProcessUdpNetwork&            network,
+                                                            IExecutor::Callback::Function&& function)
+    {
+        auto&      executor = network.executor();
+        const auto period   = network.getLatency();
+
+        auto callback = executor.registerCallback(std::move(function));
+        const auto result = callback.schedule(IExecutor::Callback::Schedule::Repeat{executor.now() + period, period});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+        return callback;
+    }
+
+private:
+    struct Datagram
+    {
+        TimePoint               timestamp;
+        std::vector<cetl::byte> data;
+    };
+
+    InProcessUdpNetwork&        network_;
+    const void* const           owner_;
+    const IpEndpoint            endpoint_;
+    cetl::pmr::memory_resource& payload_memory_;
+    std::deque<Datagram>        rx_queue_;
+
+};  // InProcessUdpRxSocket
+
+/// Defines UDP TX socket of an in-process media.
+///
+class InProcessUdpTxSocket final : public ITxSocket
+{
+public:
+    InProcessUdpTxSocket(InProcessUdpNetwork& network, const void* const owner)
+        : network_{network}
+        , owner_{owner}
+    {
+    }
+
+    ~InProcessUdpTxSocket() = default;
+
+    InProcessUdpTxSocket(const InProcessUdpTxSocket&)                = delete;
+    InProcessUdpTxSocket(InProcessUdpTxSocket&&) noexcept            = delete;
+    InProcessUdpTxSocket& operator=(const InProcessUdpTxSocket&)     = delete;
+    InProcessUdpTxSocket& operator=(InProcessUdpTxSocket&&) noexcept = delete;
+
+    // MARK: ITxSocket
+
+    SendResult::Type send(const TimePoint        deadline,
+                          const IpEndpoint       multicast_endpoint,
+                          const std::uint8_t     dscp,
+                          const PayloadFragments payload_fragments) override
+    {
+        (void) dscp;
+
+        // Timed out datagrams are just dropped.
+        if (network_.executor().now() <= deadline)
+        {
+            network_.send(owner_, multicast_endpoint, payload_fragments);
+        }
+        return SendResult::Success{true};
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+    {
+        return InProcessUdpRxSocket::registerPollingCallback(network_, std::move(function));
+    }
+
+private:
+    InProcessUdpNetwork& network_;
+    const void* const    owner_;
+
+};  // InProcessUdpTxSocket
+
+/// Defines UDP media of a node attached to an in-process network.
+///
+class InProcessUdpMedia final : public IMedia
+{
+public:
+    /// @param network The network to attach to.
+    /// @param payload_memory The payload memory resource of the transport (see `MemoryResourcesSpec::payload`).
+    ///
+    InProcessUdpMedia(InProcessUdpNetwork& network, cetl::pmr::memory_resource& payload_memory)
+        : network_{network}
+        , payload_memory_{payload_memory}
+    {
+    }
+
+    ~InProcessUdpMedia() = default;
+
+    InProcessUdpMedia(const InProcessUdpMedia&)                = delete;
+    InProcessUdpMedia(InProcessUdpMedia&&) noexcept            = delete;
+    InProcessUdpMedia& operator=(const InProcessUdpMedia&)     = delete;
+    InProcessUdpMedia& operator=(InProcessUdpMedia&&) noexcept = delete;
+
+    // MARK: IMedia
+
+    MakeTxSocketResult::Type makeTxSocket() override
+    {
+        auto tx_socket = makeUniquePtr<ITxSocket, InProcessUdpTxSocket>(*cetl::pmr::get_default_resource(),
+                                                                        network_,
+                                                                        this);
+        if (tx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return tx_socket;
+    }
+
+    MakeRxSocketResult::Type makeRxSocket(const IpEndpoint& multicast_endpoint) override
+    {
+        auto rx_socket = makeUniquePtr<IRxSocket, InProcessUdpRxSocket>(*cetl::pmr::get_default_resource(),
+                                                                        network_,
+                                                                        this,
+                                                                        multicast_endpoint,
+                                                                        payload_memory_);
+        if (rx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return rx_socket;
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return *cetl::pmr::get_default_resource();
+    }
+
+private:
+    InProcessUdpNetwork&        network_;
+    cetl::pmr::memory_resource& payload_memory_;
+
+};  // InProcessUdpMedia
+
+inline void InProcessUdpNetwork::send(const void* const      sender,
+                                      const IpEndpoint       endpoint,
+                                      const PayloadFragments payload_fragments)
+{
+    ++datagrams_count_;
+
+    const auto delivery_time = executor_.now() + latency_;
+    for (InProcessUdpRxSocket* const rx_socket : rx_sockets_)
+    {
+        const auto& rx_endpoint = rx_socket->getEndpoint();
+        if ((rx_socket->getOwner() != sender) && (rx_endpoint.ip_address == endpoint.ip_address) &&
+            (rx_endpoint.udp_port == endpoint.udp_port))
+        {
+            rx_socket->deliver(delivery_time, payload_fragments);
+        }
+    }
+}
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_BENCHMARK_TRANSPORT_UDP_IN_PROCESS_UDP_NETWORK_HPP_INCLUDED
@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_BENCHMARK_VIRTUAL_TIME_EXECUTOR_HPP_INCLUDED
+#define LIBCYPHAL_BENCHMARK_VIRTUAL_TIME_EXECUTOR_HPP_INCLUDED
+
+#include <libcyphal/platform/single_threaded_executor.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+
+namespace libcyphal
+{
+
+/// Defines single-threaded executor which runs in virtual time.
+///
+/// In contrast to the unit tests' `VirtualTimeScheduler`, this one doesn't depend on gtest,
+/// so it could be used in the benchmarks. Idle periods are skipped - the virtual time jumps straight
+/// to the next scheduled callback, so only CPU time of the callbacks is measured by a benchmark.
+///
+class VirtualTimeExecutor final : public platform::SingleThreadedExecutor
+{
+public:
+    explicit VirtualTimeExecutor(const TimePoint initial_now = {})
+        : now_{initial_now}
+    {
+    }
+
+    /// Spins the executor until the given virtual time duration is over.
+    ///
+    void spinFor(const Duration duration)
+    {
+        const auto end_time = now_ + duration;
+        (void) spinUntil([] { return false; }, end_time);
+    }
+
+    /// Spins the executor until the condition is met or the deadline is reached.
+    ///
+    /// @return `true` if the condition has been met; `false` on the deadline.
+    ///
+    template <typename Condition>
+    bool spinUntil(Condition&& condition, const TimePoint deadline)
+    {
+        while (!condition())
+        {
+            if (now_ >= deadline)
+            {
+                return false;
+            }
+
+            const auto spin_result = spinOnce();
+            if (!spin_result.next_exec_time)
+            {
+                now_ = deadline;
+                return condition();
+            }
+            now_ = std::min(deadline, std::max(now_, *spin_result.next_exec_time));
+        }
+        return true;
+    }
+
+    // MARK: - ITimeProvider
+
+    TimePoint now() const noexcept override
+    {
+        return now_;
+    }
+
+private:
+    TimePoint now_;
+
+};  // VirtualTimeExecutor
+
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_BENCHMARK_VIRTUAL_TIME_EXECUTOR_HPP_INCLUDED
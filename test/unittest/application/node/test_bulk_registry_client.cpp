@@ -0,0 +1,364 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/bulk_registry_client.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/response_promise.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestBulkRegistryClient : public testing::Test
+{
+protected:
+    using BulkClient         = node::BulkRegistryClient;
+    using Service            = BulkClient::Service;
+    using UniquePtrReqTxSpec = RequestTxSessionMock::RefWrapper::Spec;
+    using UniquePtrResRxSpec = ResponseRxSessionMock::RefWrapper::Spec;
+
+    static constexpr PortId ServiceId    = 147;
+    static constexpr NodeId ServerNodeId = 0x31;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(res_rx_session_mock_, getParams())  //
+            .WillOnce(Return(rx_params_));
+        EXPECT_CALL(res_rx_session_mock_, setTransferIdTimeout(Eq(0s)))  //
+            .WillOnce(Return());
+        EXPECT_CALL(res_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                res_rx_cb_fn_ = std::forward<IResponseRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+
+        const RequestTxParams tx_params{ServiceId, ServerNodeId};
+        EXPECT_CALL(transport_mock_, makeRequestTxSession(RequestTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, req_tx_session_mock_);
+            }));
+        EXPECT_CALL(transport_mock_, makeResponseRxSession(ResponseRxParamsEq(rx_params_)))  //
+            .WillOnce(Invoke([&](const auto&) {                                              //
+                return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, res_rx_session_mock_);
+            }));
+
+        EXPECT_CALL(res_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(req_tx_session_mock_, deinit()).Times(1);
+
+        EXPECT_CALL(storage_mock_, size())
+            .WillRepeatedly(Return(Service::Response::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Service::Response::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_response_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        test_response_ = Service::Response{mr_alloc_};
+
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    BulkClient::Client makeClient(Presentation& presentation)
+    {
+        auto maybe_client = presentation.makeClient<Service>(ServerNodeId, ServiceId);
+        EXPECT_THAT(maybe_client, VariantWith<BulkClient::Client>(_));
+        return cetl::get<BulkClient::Client>(std::move(maybe_client));
+    }
+
+    BulkClient::Entry makeEntry(const char* const name) const
+    {
+        BulkClient::Entry entry{mr_alloc_};
+        entry.name = registry::makeRegisterName(mr_alloc_, name);
+        entry.value.set_natural16().value.push_back(42);
+        return entry;
+    }
+
+    /// Delivers `test_response_` as the response transfer to the request with the given transfer id.
+    ///
+    void respond(const TransferId transfer_id)
+    {
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        ServiceRxTransfer                   transfer{{{{transfer_id, Priority::Nominal}, now()}, ServerNodeId},
+                                                     ScatteredBuffer{std::move(storage)}};
+        res_rx_cb_fn_({transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                 scheduler_{};
+    TrackingMemoryResource                          mr_;
+    cetl::pmr::polymorphic_allocator<void>          mr_alloc_{&mr_};
+    StrictMock<TransportMock>                       transport_mock_;
+    const ResponseRxParams                          rx_params_{Service::Response::_traits_::ExtentBytes,
+                                                               ServiceId,
+                                                               ServerNodeId};
+    StrictMock<RequestTxSessionMock>                req_tx_session_mock_;
+    StrictMock<ResponseRxSessionMock>               res_rx_session_mock_;
+    IResponseRxSession::OnReceiveCallback::Function res_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>            storage_mock_;
+    Service::Response                               test_response_{mr_alloc_};
+    // NOLINTEND
+
+};  // TestBulkRegistryClient
+
+// MARK: - Tests:
+
+TEST_F(TestBulkRegistryClient, pipelined_read)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    BulkClient bulk_client{presentation, makeClient(presentation), 2};
+
+    std::vector<std::uint16_t> requested_starts;
+    EXPECT_CALL(req_tx_session_mock_, send(_, _))  //
+        .Times(3)
+        .WillRepeatedly(Invoke([&](const auto&, const auto fragments) {
+            //
+            Service::Request request{mr_alloc_};
+            EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(request, fragments));
+            EXPECT_THAT(request.end_index - request.start_index, Service::Request::MAX_ENTRIES);
+            EXPECT_THAT(request.writes, IsEmpty());
+            requested_starts.push_back(request.start_index);
+            return cetl::nullopt;
+        }));
+
+    std::vector<std::string>                        names;
+    std::vector<BulkClient::CompletionCallback::Arg> completions;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(bulk_client.read(
+            "",
+            200ms,
+            [&names](const auto& arg) {
+                //
+                names.emplace_back(arg.entry.name.name.begin(), arg.entry.name.name.end());
+            },
+            [&completions](const auto& arg) {
+                //
+                completions.push_back(arg);
+            }));
+        EXPECT_TRUE(bulk_client.isBusy());
+        EXPECT_FALSE(bulk_client.read("", 200ms, {}, {}));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // First range is done, but the registry is not over yet - the freed slot requests the third range.
+        EXPECT_THAT(requested_starts, ElementsAre(0, 16));
+        test_response_.next_index = 16;
+        test_response_.entries.push_back(makeEntry("a.x"));
+        respond(0);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        EXPECT_THAT(requested_starts, ElementsAre(0, 16, 32));
+
+        // The end of the registry - no more ranges are requested, but the third one is still pending.
+        test_response_.next_index = Service::Request::INDEX_END;
+        test_response_.entries.clear();
+        test_response_.entries.push_back(makeEntry("a.y"));
+        respond(1);
+    });
+    scheduler_.scheduleAt(1s + 30ms, [&](const auto&) {
+        //
+        EXPECT_THAT(completions, IsEmpty());
+        test_response_.entries.clear();
+        respond(2);
+    });
+    scheduler_.scheduleAt(1s + 40ms, [&](const auto&) {
+        //
+        EXPECT_FALSE(bulk_client.isBusy());
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(names, ElementsAre("a.x", "a.y"));
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure, Eq(cetl::nullopt));
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 30ms});
+}
+
+TEST_F(TestBulkRegistryClient, prefix_read)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    BulkClient bulk_client{presentation, makeClient(presentation), 2};
+
+    std::vector<std::uint16_t> requested_starts;
+    EXPECT_CALL(req_tx_session_mock_, send(_, _))  //
+        .Times(2)
+        .WillRepeatedly(Invoke([&](const auto&, const auto fragments) {
+            //
+            Service::Request request{mr_alloc_};
+            EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(request, fragments));
+            EXPECT_THAT(request.end_index, Service::Request::INDEX_END);
+            EXPECT_THAT(request.prefix.name, ElementsAre('a', '.'));
+            requested_starts.push_back(request.start_index);
+            return cetl::nullopt;
+        }));
+
+    std::vector<std::string>                        names;
+    std::vector<BulkClient::CompletionCallback::Arg> completions;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(bulk_client.read(
+            "a.",
+            200ms,
+            [&names](const auto& arg) {
+                //
+                names.emplace_back(arg.entry.name.name.begin(), arg.entry.name.name.end());
+            },
+            [&completions](const auto& arg) {
+                //
+                completions.push_back(arg);
+            }));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // Despite the free slot, the rest of the registry is requested by a single request.
+        EXPECT_THAT(requested_starts, ElementsAre(0));
+        test_response_.next_index = 123;
+        test_response_.entries.push_back(makeEntry("a.x"));
+        respond(0);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        // The next request continues from where the provider has stopped.
+        EXPECT_THAT(requested_starts, ElementsAre(0, 123));
+        EXPECT_THAT(completions, IsEmpty());
+        test_response_.next_index = Service::Request::INDEX_END;
+        test_response_.entries.clear();
+        test_response_.entries.push_back(makeEntry("a.y"));
+        respond(1);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(names, ElementsAre("a.x", "a.y"));
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure, Eq(cetl::nullopt));
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 20ms});
+    EXPECT_FALSE(bulk_client.isBusy());
+}
+
+TEST_F(TestBulkRegistryClient, chunked_write_timeout)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    BulkClient bulk_client{presentation, makeClient(presentation)};
+
+    std::vector<BulkClient::Entry> entries;
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        entries.push_back(makeEntry("x"));
+    }
+
+    std::vector<std::size_t> requested_counts;
+    EXPECT_CALL(req_tx_session_mock_, send(_, _))  //
+        .Times(2)
+        .WillRepeatedly(Invoke([&](const auto&, const auto fragments) {
+            //
+            Service::Request request{mr_alloc_};
+            EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(request, fragments));
+            requested_counts.push_back(request.writes.size());
+            return cetl::nullopt;
+        }));
+
+    std::vector<BulkClient::CompletionCallback::Arg> completions;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(bulk_client.write(entries, 200ms, {}, [&completions](const auto& arg) {
+            //
+            completions.push_back(arg);
+        }));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // Only the first chunk is answered - the second one times out, and fails the whole operation.
+        test_response_.next_index = Service::Request::INDEX_END;
+        respond(0);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(requested_counts, ElementsAre(16, 4));
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure,
+                Optional(VariantWith<ResponsePromiseFailure>(VariantWith<ResponsePromiseExpired>(_))));
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 200ms});
+    EXPECT_FALSE(bulk_client.isBusy());
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
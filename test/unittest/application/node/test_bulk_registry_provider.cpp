@@ -0,0 +1,380 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "application/registry/registry_mock.hpp"
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/bulk_registry_provider.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <libcyphal_ext/_register/Entry_0_1.hpp>
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;            // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;           // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;              // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestBulkRegistryProvider : public testing::Test
+{
+protected:
+    using Service            = node::BulkRegistryProvider::Service;
+    using Entry              = libcyphal_ext::_register::Entry_0_1;
+    using UniquePtrReqRxSpec = RequestRxSessionMock::RefWrapper::Spec;
+    using UniquePtrResTxSpec = ResponseTxSessionMock::RefWrapper::Spec;
+
+    static constexpr PortId ServiceId = 147;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    IRegister::Value makeUInt16Value(const std::uint16_t value) const
+    {
+        IRegister::Value reg_value{mr_alloc_};
+        reg_value.set_natural16().value.push_back(value);
+        return reg_value;
+    }
+
+    static std::vector<std::string> namesOf(const Service::Response& response)
+    {
+        std::vector<std::string> names;
+        for (const auto& entry : response.entries)
+        {
+            names.emplace_back(entry.name.name.begin(), entry.name.name.end());
+        }
+        return names;
+    }
+
+    void expectSvcServerSessions()
+    {
+        EXPECT_CALL(req_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                req_rx_cb_fn_ = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+
+        constexpr RequestRxParams rx_params{Service::Request::_traits_::ExtentBytes, ServiceId};
+        EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))
+            .WillOnce(Invoke([&](const auto&) {
+                return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock_);
+            }));
+
+        constexpr ResponseTxParams tx_params{ServiceId};
+        EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))
+            .WillOnce(Invoke([&](const auto&) {
+                return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock_);
+            }));
+
+        EXPECT_CALL(req_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock_, deinit()).Times(1);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                scheduler_{};
+    TrackingMemoryResource                         mr_;
+    cetl::pmr::polymorphic_allocator<void>         mr_alloc_{&mr_};
+    StrictMock<TransportMock>                      transport_mock_;
+    IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn_;
+    StrictMock<RequestRxSessionMock>               req_rx_session_mock_;
+    StrictMock<ResponseTxSessionMock>              res_tx_session_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestBulkRegistryProvider, read_and_write)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    Registry   rgy{mr_};
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a_x  = rgy.route("a.x", [this] { return makeUInt16Value(1); }, setter, {true});
+    auto       r_b_y  = rgy.route("b.y", [this] { return makeUInt16Value(2); });
+    auto       r_a_z  = rgy.route("a.z", [this] { return makeUInt16Value(3); }, setter);
+
+    expectSvcServerSessions();
+
+    cetl::optional<node::BulkRegistryProvider> provider;
+
+    Service::Request                     test_request{mr_alloc_};
+    NiceMock<ScatteredBufferStorageMock> storage_mock;
+    EXPECT_CALL(storage_mock, size())
+        .WillRepeatedly(Return(Service::Request::_traits_::SerializationBufferSizeBytes));
+    EXPECT_CALL(storage_mock, copy(0, _, _))                           //
+        .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+            //
+            std::vector<std::uint8_t> buffer(Service::Request::_traits_::SerializationBufferSizeBytes);
+            const auto result = serialize(test_request, nunavut::support::bitspan{buffer.data(), buffer.size()});
+            const auto size   = std::min(result.value(), len);
+            (void) std::memmove(dst, buffer.data(), size);
+            return size;
+        }));
+    ScatteredBufferStorageMock::Wrapper storage{&storage_mock};
+    ServiceRxTransfer request{{{{123, Priority::Fast}, {}}, NodeId{0x31}}, ScatteredBuffer{std::move(storage)}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_provider = node::BulkRegistryProvider::make(presentation, rgy, ServiceId);
+        ASSERT_THAT(maybe_provider, VariantWith<node::BulkRegistryProvider>(_));
+        provider.emplace(cetl::get<node::BulkRegistryProvider>(std::move(maybe_provider)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Read all registers with "a." prefix.
+        EXPECT_CALL(res_tx_session_mock_, send(_, _))  //
+            .WillOnce(Invoke([this](const auto&, const auto fragments) {
+                //
+                Service::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response.next_index, Service::Request::INDEX_END);
+                EXPECT_THAT(namesOf(response).size(), 2);
+                for (const auto& entry : response.entries)
+                {
+                    EXPECT_TRUE(entry.value.is_natural16());
+                    EXPECT_TRUE(entry._mutable);
+                }
+                return cetl::nullopt;
+            }));
+
+        test_request.start_index = 0;
+        test_request.end_index   = Service::Request::INDEX_END;
+        test_request.prefix      = makeRegisterName(mr_alloc_, "a.");
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn_({request});
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Read a range of the registry - the end of the registry is not reached yet.
+        EXPECT_CALL(res_tx_session_mock_, send(_, _))  //
+            .WillOnce(Invoke([this, &rgy](const auto&, const auto fragments) {
+                //
+                Service::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                const auto first = rgy.index(0);
+                EXPECT_THAT(response.next_index, 1);
+                EXPECT_THAT(namesOf(response), ElementsAre(std::string{first.data(), first.size()}));
+                return cetl::nullopt;
+            }));
+
+        test_request.start_index = 0;
+        test_request.end_index   = 1;
+        test_request.prefix      = makeRegisterName(mr_alloc_, "");
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn_({request});
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Write two registers (one of them is immutable), and one unknown.
+        EXPECT_CALL(res_tx_session_mock_, send(_, _))  //
+            .WillOnce(Invoke([this](const auto&, const auto fragments) {
+                //
+                Service::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response.next_index, Service::Request::INDEX_END);
+                EXPECT_THAT(namesOf(response), ElementsAre("a.x", "b.y", "c"));
+                EXPECT_TRUE(response.entries[0]._mutable);
+                EXPECT_TRUE(response.entries[0].persistent);
+                EXPECT_FALSE(response.entries[1]._mutable);
+                EXPECT_TRUE(response.entries[2].value.is_empty());
+                return cetl::nullopt;
+            }));
+
+        test_request.writes.clear();
+        for (const auto* const name : {"a.x", "b.y", "c"})
+        {
+            Entry entry{mr_alloc_};
+            entry.name  = makeRegisterName(mr_alloc_, name);
+            entry.value = makeUInt16Value(7);
+            test_request.writes.push_back(std::move(entry));
+        }
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn_({request});
+        EXPECT_TRUE(r_a_x.isDirty());
+        EXPECT_FALSE(r_b_y.isDirty());
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        provider.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestBulkRegistryProvider, read_index_end_boundary)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    // The registry is bigger than the service could address - its last registers are unreachable.
+    NiceMock<IntrospectableRegistryMock> rgy_mock;
+    EXPECT_CALL(rgy_mock, size()).WillRepeatedly(Return(0x10000));
+    EXPECT_CALL(rgy_mock, index(_)).WillRepeatedly(Return("r"));
+
+    expectSvcServerSessions();
+
+    cetl::optional<node::BulkRegistryProvider> provider;
+
+    Service::Request                     test_request{mr_alloc_};
+    NiceMock<ScatteredBufferStorageMock> storage_mock;
+    EXPECT_CALL(storage_mock, size())
+        .WillRepeatedly(Return(Service::Request::_traits_::SerializationBufferSizeBytes));
+    EXPECT_CALL(storage_mock, copy(0, _, _))                           //
+        .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+            //
+            std::vector<std::uint8_t> buffer(Service::Request::_traits_::SerializationBufferSizeBytes);
+            const auto result = serialize(test_request, nunavut::support::bitspan{buffer.data(), buffer.size()});
+            const auto size   = std::min(result.value(), len);
+            (void) std::memmove(dst, buffer.data(), size);
+            return size;
+        }));
+    ScatteredBufferStorageMock::Wrapper storage{&storage_mock};
+    ServiceRxTransfer request{{{{123, Priority::Fast}, {}}, NodeId{0x31}}, ScatteredBuffer{std::move(storage)}};
+
+    const auto expectResponse = [this](const std::uint16_t next_index, const std::size_t entries_count) {
+        //
+        EXPECT_CALL(res_tx_session_mock_, send(_, _))  //
+            .WillOnce(Invoke([this, next_index, entries_count](const auto&, const auto fragments) {
+                //
+                Service::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response.next_index, next_index);
+                EXPECT_THAT(namesOf(response).size(), entries_count);
+                for (const auto& entry : response.entries)
+                {
+                    EXPECT_THAT(entry.name.name, ElementsAre('r'));
+                    EXPECT_TRUE(entry.value.is_empty());
+                }
+                return cetl::nullopt;
+            }));
+    };
+    const auto sendRequest = [&](const std::uint16_t start_index) {
+        //
+        test_request.start_index           = start_index;
+        test_request.end_index             = Service::Request::INDEX_END;
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn_({request});
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_provider = node::BulkRegistryProvider::make(presentation, rgy_mock, ServiceId);
+        ASSERT_THAT(maybe_provider, VariantWith<node::BulkRegistryProvider>(_));
+        provider.emplace(cetl::get<node::BulkRegistryProvider>(std::move(maybe_provider)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Full response which stops right before the last addressable index.
+        expectResponse(0xFFFE, Service::Request::MAX_ENTRIES);
+        sendRequest(0xFFEE);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Full response which reaches the last addressable index - it must not be reported as `0xFFFF` "next" one.
+        expectResponse(Service::Request::INDEX_END, Service::Request::MAX_ENTRIES);
+        sendRequest(0xFFEF);
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Partial response - the surplus entries are spared...
+        expectResponse(Service::Request::INDEX_END, 7);
+        sendRequest(0xFFF8);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        // ... and reused by the next full response.
+        expectResponse(0xFFFE, Service::Request::MAX_ENTRIES);
+        sendRequest(0xFFEE);
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        // Start index at the very end.
+        expectResponse(Service::Request::INDEX_END, 0);
+        sendRequest(0xFFFF);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        provider.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestBulkRegistryProvider, make_failure)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    Registry rgy{mr_};
+
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(_))  //
+        .WillOnce(Return(libcyphal::ArgumentError{}));
+
+    EXPECT_THAT(node::BulkRegistryProvider::make(presentation, rgy, ServiceId),
+                VariantWith<Presentation::MakeFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,349 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/diagnostic_logger.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/transport.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestDiagnosticLogger : public testing::Test
+{
+protected:
+    using Logger             = node::DiagnosticLogger;
+    using Message            = Logger::Message;
+    using Severity           = Logger::Severity;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock_, getParams()).WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(msg_tx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock_);
+            }));
+
+        EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+            .WillRepeatedly(Invoke([this](const auto& metadata, const auto fragments) {
+                //
+                EXPECT_THAT(metadata.base.priority, priority_);
+
+                Message message{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(message, fragments));
+                published_.push_back(std::to_string(message.severity.value) + ":" +
+                                     std::string{message.text.begin(), message.text.end()});
+                return cetl::nullopt;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    StrictMock<TransportMock>              transport_mock_;
+    StrictMock<MessageTxSessionMock>       msg_tx_session_mock_;
+    Priority                               priority_{Priority::Low};
+    std::vector<std::string>               published_;
+    // NOLINTEND
+
+};  // TestDiagnosticLogger
+
+// MARK: - Tests:
+
+TEST_F(TestDiagnosticLogger, deduplication)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_logger = Logger::make(presentation);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+    });
+    scheduler_.scheduleAt(1s + 5ms, [&](const auto&) {
+        //
+        for (int i = 0; i < 5; ++i)
+        {
+            EXPECT_TRUE(logger->log(Severity::WARNING, "A"));
+        }
+        EXPECT_TRUE(logger->log(Severity::INFO, "B"));
+    });
+    scheduler_.scheduleAt(2s + 5ms, [&](const auto&) {
+        //
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_TRUE(logger->log(Severity::INFO, "B"));
+        }
+
+        // Moved logger should continue with the same (still pending) repeats.
+        cetl::optional<Logger> logger2{std::move(logger)};
+        logger.reset();
+        logger.emplace(std::move(*logger2));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(logger->getStatistics().published, 4);
+        EXPECT_THAT(logger->getStatistics().deduplicated, 7);
+        EXPECT_THAT(logger->getStatistics().suppressed, 0);
+        EXPECT_THAT(logger->getStatistics().dropped, 0);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published_,
+                ElementsAre("4:A",
+                            "4:previous record repeated 4 times",
+                            "2:B",
+                            "2:previous record repeated 3 times"));
+}
+
+TEST_F(TestDiagnosticLogger, rate_limiting)
+{
+    priority_ = Priority::Nominal;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        Logger::Options options{};
+        options.priority           = Priority::Nominal;
+        options.records_per_second = 10;
+        options.burst_records      = 5;
+        options.reserved_records   = 2;
+        auto maybe_logger          = Logger::make(presentation, options);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+    });
+    scheduler_.scheduleAt(1s + 5ms, [&](const auto&) {
+        //
+        // Only 3 (out of 5) records of the burst are available for the INFO records;
+        // the rest 2 are reserved for the WARNING+ records.
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(logger->log(Severity::INFO, ("i" + std::to_string(i)).c_str()));
+        }
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_TRUE(logger->log(Severity::ERROR, ("e" + std::to_string(i)).c_str()));
+        }
+    });
+    scheduler_.scheduleAt(1s + 105ms, [&](const auto&) {
+        //
+        // No budget yet for the summary.
+        EXPECT_THAT(published_, SizeIs(5));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(logger->getStatistics().published, 6);
+        EXPECT_THAT(logger->getStatistics().suppressed, 8);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published_, ElementsAre("2:i0", "2:i1", "2:i2", "5:e0", "5:e1", "5:8 records suppressed"));
+}
+
+TEST_F(TestDiagnosticLogger, publish_failure)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_logger = Logger::make(presentation);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+    });
+    scheduler_.scheduleAt(1s + 5ms, [&](const auto&) {
+        //
+        // The very first record fails to be sent - it's not counted as published.
+        EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+            .WillOnce(Return(libcyphal::ArgumentError{}))
+            .RetiresOnSaturation();
+
+        EXPECT_TRUE(logger->log(Severity::INFO, "A"));
+        EXPECT_TRUE(logger->log(Severity::INFO, "B"));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(logger->getStatistics().published, 1);
+        EXPECT_THAT(logger->getStatistics().failed, 1);
+        EXPECT_THAT(logger->getStatistics().suppressed, 0);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published_, ElementsAre("2:B"));
+}
+
+TEST_F(TestDiagnosticLogger, ring_overflow)
+{
+    constexpr std::size_t Capacity = libcyphal::config::Application::Node::DiagnosticLogger_RingCapacity();
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        Logger::Options options{};
+        options.records_per_second = 100;
+        options.burst_records      = 100;
+        options.reserved_records   = 0;
+        auto maybe_logger          = Logger::make(presentation, options);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+    });
+    scheduler_.scheduleAt(1s + 5ms, [&](const auto&) {
+        //
+        for (std::size_t i = 0; i < Capacity + 8; ++i)
+        {
+            EXPECT_THAT(logger->log(Severity::DEBUG, ("r" + std::to_string(i)).c_str()), Eq(i < Capacity));
+        }
+
+        // Too long text is truncated.
+        EXPECT_FALSE(logger->log(Severity::DEBUG, std::string(300, 'x').c_str()));
+    });
+    scheduler_.scheduleAt(1s + 15ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(logger->log(Severity::DEBUG, std::string(300, 'x').c_str()));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(logger->getStatistics().published, Capacity + 2);
+        EXPECT_THAT(logger->getStatistics().dropped, 9);
+        EXPECT_THAT(logger->getStatistics().suppressed, 0);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    ASSERT_THAT(published_, SizeIs(Capacity + 2));
+    EXPECT_THAT(published_[0], "1:r0");
+    EXPECT_THAT(published_[Capacity - 1], "1:r" + std::to_string(Capacity - 1));
+    EXPECT_THAT(published_[Capacity], "1:9 records suppressed");
+    EXPECT_THAT(published_[Capacity + 1],
+                "1:" + std::string(libcyphal::config::Application::Node::DiagnosticLogger_TextCapacity(), 'x'));
+}
+
+TEST_F(TestDiagnosticLogger, concurrent_logging)
+{
+    constexpr std::size_t Threads          = 4;
+    constexpr std::size_t RecordsPerThread = 8;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        Logger::Options options{};
+        options.records_per_second = 100;
+        options.burst_records      = 100;
+        auto maybe_logger          = Logger::make(presentation, options);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+    });
+    scheduler_.scheduleAt(1s + 5ms, [&](const auto&) {
+        //
+        std::array<std::thread, Threads> threads;
+        for (std::size_t t = 0; t < Threads; ++t)
+        {
+            threads[t] = std::thread([&logger, t] {
+                //
+                for (std::size_t i = 0; i < RecordsPerThread; ++i)
+                {
+                    const auto text = std::to_string(t) + "." + std::to_string(i);
+                    EXPECT_TRUE(logger->log(Severity::ERROR, text.c_str()));
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(logger->getStatistics().published, Threads * RecordsPerThread);
+        EXPECT_THAT(logger->getStatistics().dropped, 0);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published_, SizeIs(Threads * RecordsPerThread));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
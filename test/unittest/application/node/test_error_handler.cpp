@@ -0,0 +1,242 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/error_handler.hpp>
+#include <libcyphal/config.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/node/Health_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;    // NOLINT This our main concern here in the unit tests.
+
+using testing::IsEmpty;
+using testing::ElementsAre;
+
+using Health = uavcan::node::Health_1_0;
+using Kind   = node::ErrorHandler::Kind;
+using Origin = node::ErrorHandler::Origin;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestErrorHandler : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestErrorHandler, counters)
+{
+    node::ErrorHandler handler{scheduler_};
+    EXPECT_THAT(handler.getTotalFailures(), 0);
+
+    handler.report(libcyphal::MemoryError{}, Origin::Internal);
+    handler.report(CapacityError{}, Origin::Publication, 7);
+    handler.report(AnyFailure{libcyphal::ArgumentError{}}, Origin::Publication, 7);
+    handler.report(AnyFailure{AlreadyExistsError{}}, Origin::Request, 7);
+    handler.report(node::ErrorHandler::Report{Kind::Storage, Origin::Response, 430});
+    handler.report(42, Origin::Media);
+
+    EXPECT_THAT(handler.getFailures(Kind::Memory), 1);
+    EXPECT_THAT(handler.getFailures(Kind::Capacity), 1);
+    EXPECT_THAT(handler.getFailures(Kind::Argument), 1);
+    EXPECT_THAT(handler.getFailures(Kind::AlreadyExists), 1);
+    EXPECT_THAT(handler.getFailures(Kind::Storage), 1);
+    EXPECT_THAT(handler.getFailures(Kind::Other), 1);
+    EXPECT_THAT(handler.getFailures(Kind::Platform), 0);
+    EXPECT_THAT(handler.getTotalFailures(), 6);
+
+    // Subjects and services are counted separately, even if their ids are the same.
+    EXPECT_THAT(handler.getSubjectFailures(7), 2);
+    EXPECT_THAT(handler.getServiceFailures(7), 1);
+    EXPECT_THAT(handler.getServiceFailures(430), 1);
+    EXPECT_THAT(handler.getSubjectFailures(430), 0);
+    EXPECT_THAT(handler.getUntrackedPortFailures(), 0);
+}
+
+TEST_F(TestErrorHandler, port_capacity)
+{
+    constexpr auto PortCapacity = libcyphal::config::Application::Node::ErrorHandler_PortCapacity();
+
+    node::ErrorHandler handler{scheduler_};
+
+    for (PortId port_id = 0; port_id < PortCapacity + 2; ++port_id)
+    {
+        handler.report(CapacityError{}, Origin::Publication, port_id);
+    }
+    handler.report(CapacityError{}, Origin::Publication, 0);
+
+    EXPECT_THAT(handler.getSubjectFailures(0), 2);
+    EXPECT_THAT(handler.getSubjectFailures(static_cast<PortId>(PortCapacity - 1)), 1);
+    EXPECT_THAT(handler.getSubjectFailures(static_cast<PortId>(PortCapacity)), 0);
+    EXPECT_THAT(handler.getUntrackedPortFailures(), 2);
+    EXPECT_THAT(handler.getTotalFailures(), PortCapacity + 3);
+}
+
+TEST_F(TestErrorHandler, report_callback_rate_limit)
+{
+    node::ErrorHandler handler{scheduler_, node::ErrorHandler::Options{1s, 3, 1s}};
+
+    std::vector<std::tuple<TimePoint, Kind, std::uint32_t>> calls;
+    handler.setReportCallback([&](const auto& arg) {
+        //
+        EXPECT_THAT(arg.approx_now, now());
+        calls.emplace_back(arg.approx_now, arg.report.kind, arg.suppressed);
+    });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        handler.report(CapacityError{}, Origin::Publication, 7);
+        handler.report(libcyphal::MemoryError{}, Origin::Internal);
+    });
+    scheduler_.scheduleAt(1s + 500ms, [&](const auto&) {
+        //
+        handler.report(CapacityError{}, Origin::Publication, 7);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        handler.report(AnonymousError{}, Origin::Media);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        handler.report(CapacityError{}, Origin::Publication, 7);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(calls,
+                ElementsAre(std::make_tuple(TimePoint{1s}, Kind::Capacity, 0U),
+                            std::make_tuple(TimePoint{2s}, Kind::Anonymous, 2U),
+                            std::make_tuple(TimePoint{5s}, Kind::Capacity, 0U)));
+    EXPECT_THAT(handler.getTotalFailures(), 5);
+}
+
+TEST_F(TestErrorHandler, health)
+{
+    node::ErrorHandler handler{scheduler_, node::ErrorHandler::Options{1s, 3, 1s}};
+
+    std::vector<std::tuple<TimePoint, int>> health;
+    for (int sec = 0; sec < 12; ++sec)
+    {
+        scheduler_.scheduleAt(std::chrono::seconds{sec} + 900ms, [&](const auto&) {
+            //
+            health.emplace_back(now(), static_cast<int>(handler.getHealth(now())));
+        });
+    }
+
+    // A single failure is just an advisory - for the current and the next window.
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        handler.report(CapacityError{}, Origin::Publication, 7);
+    });
+    // Sustained failures (3 consecutive windows) - caution, until a clean window.
+    for (int sec = 4; sec < 7; ++sec)
+    {
+        scheduler_.scheduleAt(std::chrono::seconds{sec} + 200ms, [&](const auto&) {
+            //
+            handler.report(CapacityError{}, Origin::Publication, 7);
+        });
+    }
+    // Any memory failure - caution, until a clean window.
+    scheduler_.scheduleAt(9s + 100ms, [&](const auto&) {
+        //
+        handler.report(libcyphal::MemoryError{}, Origin::Internal);
+    });
+    scheduler_.spinFor(20s);
+
+    EXPECT_THAT(health,
+                ElementsAre(std::make_tuple(TimePoint{900ms}, static_cast<int>(Health::NOMINAL)),
+                            std::make_tuple(TimePoint{1s + 900ms}, static_cast<int>(Health::ADVISORY)),
+                            std::make_tuple(TimePoint{2s + 900ms}, static_cast<int>(Health::ADVISORY)),
+                            std::make_tuple(TimePoint{3s + 900ms}, static_cast<int>(Health::NOMINAL)),
+                            std::make_tuple(TimePoint{4s + 900ms}, static_cast<int>(Health::ADVISORY)),
+                            std::make_tuple(TimePoint{5s + 900ms}, static_cast<int>(Health::ADVISORY)),
+                            std::make_tuple(TimePoint{6s + 900ms}, static_cast<int>(Health::CAUTION)),
+                            std::make_tuple(TimePoint{7s + 900ms}, static_cast<int>(Health::NOMINAL)),
+                            std::make_tuple(TimePoint{8s + 900ms}, static_cast<int>(Health::NOMINAL)),
+                            std::make_tuple(TimePoint{9s + 900ms}, static_cast<int>(Health::CAUTION)),
+                            std::make_tuple(TimePoint{10s + 900ms}, static_cast<int>(Health::NOMINAL)),
+                            std::make_tuple(TimePoint{11s + 900ms}, static_cast<int>(Health::NOMINAL))));
+}
+
+TEST_F(TestErrorHandler, reporter)
+{
+    node::ErrorReporter reporter;
+    EXPECT_THAT(reporter.getHandler(), nullptr);
+
+    // No handler - nothing happens.
+    reporter.report(Kind::Memory, Origin::Internal);
+    reporter.report(cetl::optional<AnyFailure>{CapacityError{}}, Origin::Publication, 7);
+
+    node::ErrorHandler handler{scheduler_};
+    reporter.setHandler(&handler);
+    EXPECT_THAT(reporter.getHandler(), &handler);
+
+    reporter.report(cetl::optional<AnyFailure>{}, Origin::Publication, 7);
+    EXPECT_THAT(handler.getTotalFailures(), 0);
+
+    reporter.report(cetl::optional<AnyFailure>{CapacityError{}}, Origin::Publication, 7);
+    reporter.report(Kind::Memory, Origin::Internal);
+    EXPECT_THAT(handler.getFailures(Kind::Capacity), 1);
+    EXPECT_THAT(handler.getFailures(Kind::Memory), 1);
+    EXPECT_THAT(handler.getSubjectFailures(7), 1);
+
+    // Copies share the same handler.
+    const node::ErrorReporter reporter_copy{reporter};
+    reporter_copy.report(Kind::Argument, Origin::Request, 430);
+    EXPECT_THAT(handler.getServiceFailures(430), 1);
+    EXPECT_THAT(handler.getTotalFailures(), 3);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
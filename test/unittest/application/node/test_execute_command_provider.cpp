@@ -0,0 +1,422 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "platform/storage_key_value_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/execute_command_provider.hpp>
+#include <libcyphal/application/registry/deferred_saver.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""min;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestExecuteCommandProvider : public testing::Test
+{
+protected:
+    using Provider           = node::ExecuteCommandProvider;
+    using Request            = Provider::Request;
+    using Response           = Provider::Response;
+    using Service            = uavcan::node::ExecuteCommand_1_3;
+    using UniquePtrReqRxSpec = RequestRxSessionMock::RefWrapper::Spec;
+    using UniquePtrResTxSpec = ResponseTxSessionMock::RefWrapper::Spec;
+
+    static constexpr NodeId ClientNodeId = 0x31;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(req_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                req_rx_cb_fn_ = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+
+        constexpr RequestRxParams rx_params{Request::_traits_::ExtentBytes, Request::_traits_::FixedPortId};
+        EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock_);
+            }));
+        constexpr ResponseTxParams tx_params{Response::_traits_::FixedPortId};
+        EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                             //
+                return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock_);
+            }));
+
+        EXPECT_CALL(req_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock_, deinit()).Times(1);
+
+        EXPECT_CALL(res_tx_session_mock_, send(_, _))  //
+            .WillRepeatedly(Invoke([this](const auto& metadata, const auto fragments) {
+                //
+                EXPECT_THAT(metadata.remote_node_id, NodeId{ClientNodeId});
+                EXPECT_THAT(metadata.tx_meta.deadline, now() + 1s);
+
+                Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                responses_.emplace_back(now(), response.status);
+                return cetl::nullopt;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    static std::tuple<TimePoint, std::uint8_t> makeStatus(const TimePoint time, const std::uint8_t status)
+    {
+        return std::make_tuple(time, status);
+    }
+
+    /// Delivers the given command (serialized) to the provider.
+    ///
+    void receive(const std::uint16_t command, const std::string& parameter = "")
+    {
+        Request request{mr_alloc_};
+        request.command = command;
+        std::copy(parameter.begin(), parameter.end(), std::back_inserter(request.parameter));
+
+        EXPECT_CALL(req_storage_mock_, size()).WillRepeatedly(Return(Request::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(req_storage_mock_, copy(0, _, _))                            //
+            .WillRepeatedly(Invoke([request](auto, auto* const dst, auto len) {  //
+                //
+                std::array<std::uint8_t, Request::_traits_::SerializationBufferSizeBytes> buffer{};
+                const auto result = serialize(request, buffer);
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+
+        ScatteredBufferStorageMock::Wrapper storage{&req_storage_mock_};
+        ServiceRxTransfer transfer{{{{transfer_id_++, Priority::Nominal}, now()}, ClientNodeId},
+                                   ScatteredBuffer{std::move(storage)}};
+        req_rx_cb_fn_({transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                  scheduler_{};
+    TrackingMemoryResource                           mr_;
+    cetl::pmr::polymorphic_allocator<void>           mr_alloc_{&mr_};
+    StrictMock<TransportMock>                        transport_mock_;
+    StrictMock<RequestRxSessionMock>                 req_rx_session_mock_;
+    StrictMock<ResponseTxSessionMock>                res_tx_session_mock_;
+    IRequestRxSession::OnReceiveCallback::Function   req_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>             req_storage_mock_;
+    TransferId                                       transfer_id_{0};
+    std::vector<std::tuple<TimePoint, std::uint8_t>> responses_;
+    // NOLINTEND
+
+};  // TestExecuteCommandProvider
+
+// MARK: - Tests:
+
+TEST_F(TestExecuteCommandProvider, restart_and_custom_commands)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Provider> provider;
+    std::vector<TimePoint>   restarts;
+    std::vector<std::string> custom_commands;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_provider = Provider::make(presentation);
+        ASSERT_THAT(maybe_provider, VariantWith<Provider>(_));
+        provider.emplace(cetl::get<Provider>(std::move(maybe_provider)));
+
+        // Nothing is configured yet.
+        receive(Request::COMMAND_RESTART);
+        receive(Request::COMMAND_STORE_PERSISTENT_STATES);
+        receive(Request::COMMAND_BEGIN_SOFTWARE_UPDATE, "fw.bin");
+        receive(42);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        provider->setRestartCallback([&restarts](const auto& arg) {
+            //
+            restarts.push_back(arg.approx_now);
+        });
+        provider->setCommandCallback([&custom_commands](const auto& arg) {
+            //
+            EXPECT_THAT(arg.remote_node_id, NodeId{ClientNodeId});
+            custom_commands.emplace_back(arg.request.parameter.begin(), arg.request.parameter.end());
+            return (arg.request.command == 42) ? Response::STATUS_SUCCESS : Response::STATUS_BAD_PARAMETER;
+        });
+
+        // The restart is postponed till the response deadline.
+        receive(Request::COMMAND_RESTART);
+        receive(42, "abc");
+        receive(Request::COMMAND_POWER_OFF);
+    });
+    scheduler_.scheduleAt(2s + 500ms, [&](const auto&) {
+        //
+        EXPECT_THAT(restarts, IsEmpty());
+
+        // The pending restart survives the move of the provider.
+        cetl::optional<Provider> provider2{std::move(provider)};
+        provider.reset();
+        provider.emplace(std::move(*provider2));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        provider.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(responses_,
+                ElementsAre(makeStatus(TimePoint{1s}, Response::STATUS_BAD_COMMAND),
+                            makeStatus(TimePoint{1s}, Response::STATUS_BAD_COMMAND),
+                            makeStatus(TimePoint{1s}, Response::STATUS_BAD_COMMAND),
+                            makeStatus(TimePoint{1s}, Response::STATUS_BAD_COMMAND),
+                            makeStatus(TimePoint{2s}, Response::STATUS_SUCCESS),
+                            makeStatus(TimePoint{2s}, Response::STATUS_SUCCESS),
+                            makeStatus(TimePoint{2s}, Response::STATUS_BAD_PARAMETER)));
+    EXPECT_THAT(restarts, ElementsAre(TimePoint{3s}));
+    EXPECT_THAT(custom_commands, ElementsAre("abc", ""));
+}
+
+TEST_F(TestExecuteCommandProvider, store_persistent_states)
+{
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    registry::Registry rgy{mr_};
+    KeyValueMock       key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<registry::SetError> { return cetl::nullopt; };
+    const auto getter = [this] {
+        registry::IRegister::Value value{registry::IRegister::Value::allocator_type{&mr_}};
+        value.set_natural8().value.push_back(7);
+        return value;
+    };
+    auto r_a = rgy.route("A", getter, setter, {true});
+
+    // The long delay stands for the "normal" coalescing of register writes.
+    registry::DeferredSaver saver{scheduler_, key_value_mock, rgy, 1min};
+
+    std::vector<TimePoint> put_times;
+    EXPECT_CALL(key_value_mock, put(registry::IRegister::Name{"A"}, _))  //
+        .WillRepeatedly(Invoke([&](const auto, const auto) {
+            put_times.push_back(now());
+            return cetl::nullopt;
+        }));
+
+    cetl::optional<Provider> provider;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_provider = Provider::make(presentation);
+        ASSERT_THAT(maybe_provider, VariantWith<Provider>(_));
+        provider.emplace(cetl::get<Provider>(std::move(maybe_provider)));
+        provider->setPersistentStatesSaver(&saver);
+
+        EXPECT_THAT(rgy.set("A", getter()), Eq(cetl::nullopt));
+        EXPECT_TRUE(saver.isPending());
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // The register is stored on the next executor spin - not from within the request reception.
+        receive(Request::COMMAND_STORE_PERSISTENT_STATES);
+        EXPECT_THAT(put_times, IsEmpty());
+        EXPECT_TRUE(r_a.isDirty());
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_FALSE(saver.isPending());
+        EXPECT_FALSE(r_a.isDirty());
+        provider.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(responses_, ElementsAre(makeStatus(TimePoint{2s}, Response::STATUS_SUCCESS)));
+    EXPECT_THAT(put_times, ElementsAre(TimePoint{2s}));
+}
+
+TEST_F(TestExecuteCommandProvider, begin_software_update)
+{
+    using ReadService        = node::FileReadClient::Service;
+    using UniquePtrReqTxSpec = RequestTxSessionMock::RefWrapper::Spec;
+    using UniquePtrResRxSpec = ResponseRxSessionMock::RefWrapper::Spec;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    // The requesting node is the file server of the image.
+    StrictMock<RequestTxSessionMock>                req_tx_session_mock;
+    StrictMock<ResponseRxSessionMock>               res_rx_session_mock;
+    IResponseRxSession::OnReceiveCallback::Function res_rx_cb_fn;
+    NiceMock<ScatteredBufferStorageMock>            res_storage_mock;
+
+    const ResponseRxParams rx_params{ReadService::Response::_traits_::ExtentBytes,
+                                     ReadService::Request::_traits_::FixedPortId,
+                                     ClientNodeId};
+    EXPECT_CALL(res_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(res_rx_session_mock, setTransferIdTimeout(Eq(0s))).WillOnce(Return());
+    EXPECT_CALL(res_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            res_rx_cb_fn = std::forward<IResponseRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+    const RequestTxParams tx_params{ReadService::Request::_traits_::FixedPortId, ClientNodeId};
+    EXPECT_CALL(transport_mock_, makeRequestTxSession(RequestTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, req_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeResponseRxSession(ResponseRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, res_rx_session_mock);
+        }));
+    EXPECT_CALL(res_rx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(req_tx_session_mock, deinit()).Times(1);
+
+    std::vector<std::uint64_t> requested_offsets;
+    EXPECT_CALL(req_tx_session_mock, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto&, const auto fragments) {
+            //
+            ReadService::Request request{mr_alloc_};
+            EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(request, fragments));
+            EXPECT_THAT(request.path.path, ElementsAre('f', 'w'));
+            requested_offsets.push_back(request.offset);
+            return cetl::nullopt;
+        }));
+
+    cetl::optional<Provider>                                   provider;
+    std::vector<std::uint64_t>                                 chunks;
+    std::vector<node::FileReadClient::CompletionCallback::Arg> completions;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_provider = Provider::make(presentation);
+        ASSERT_THAT(maybe_provider, VariantWith<Provider>(_));
+        provider.emplace(cetl::get<Provider>(std::move(maybe_provider)));
+        EXPECT_THAT(provider->setSoftwareUpdateCallbacks(
+                        [&chunks](const auto& arg) {
+                            //
+                            chunks.push_back(arg.data.size());
+                        },
+                        [&completions](const auto& arg) {
+                            //
+                            completions.push_back(arg);
+                        }),
+                    Eq(cetl::nullopt));
+
+        receive(Request::COMMAND_BEGIN_SOFTWARE_UPDATE);
+        receive(Request::COMMAND_BEGIN_SOFTWARE_UPDATE, "fw");
+        EXPECT_TRUE(provider->isSoftwareUpdateInProgress());
+        receive(Request::COMMAND_BEGIN_SOFTWARE_UPDATE, "fw");
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        EXPECT_THAT(requested_offsets, ElementsAre(0, 256));
+
+        // The update keeps going while the provider is moved.
+        cetl::optional<Provider> provider2{std::move(provider)};
+        provider.reset();
+        provider.emplace(std::move(*provider2));
+
+        ReadService::Response read_response{mr_alloc_};
+        read_response.data.value.assign(100, 0xAA);
+        EXPECT_CALL(res_storage_mock, size())
+            .WillRepeatedly(Return(ReadService::Response::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(res_storage_mock, copy(0, _, _))                                   //
+            .WillRepeatedly(Invoke([read_response](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(ReadService::Response::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(read_response, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+
+        ScatteredBufferStorageMock::Wrapper storage{&res_storage_mock};
+        ServiceRxTransfer                   transfer{{{{0, Priority::Nominal}, now()}, ClientNodeId},
+                                                     ScatteredBuffer{std::move(storage)}};
+        res_rx_cb_fn({transfer});
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_FALSE(provider->isSoftwareUpdateInProgress());
+        provider.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(responses_,
+                ElementsAre(makeStatus(TimePoint{1s}, Response::STATUS_BAD_PARAMETER),
+                            makeStatus(TimePoint{1s}, Response::STATUS_SUCCESS),
+                            makeStatus(TimePoint{1s}, Response::STATUS_BAD_STATE)));
+    EXPECT_THAT(chunks, ElementsAre(100));
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure, Eq(cetl::nullopt));
+    EXPECT_THAT(completions[0].size, 100);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
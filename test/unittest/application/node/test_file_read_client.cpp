@@ -0,0 +1,405 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/file_read_client.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/response_promise.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Field;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestFileReadClient : public testing::Test
+{
+protected:
+    using ReadClient         = node::FileReadClient;
+    using Service            = ReadClient::Service;
+    using UniquePtrReqTxSpec = RequestTxSessionMock::RefWrapper::Spec;
+    using UniquePtrResRxSpec = ResponseRxSessionMock::RefWrapper::Spec;
+
+    static constexpr NodeId ServerNodeId = 0x31;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Invoke([this] { return ProtocolParams{transfer_id_modulo_, 0, 0}; }));
+
+        EXPECT_CALL(res_rx_session_mock_, getParams())  //
+            .WillOnce(Return(rx_params_));
+        EXPECT_CALL(res_rx_session_mock_, setTransferIdTimeout(Eq(0s)))  //
+            .WillOnce(Return());
+        EXPECT_CALL(res_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                res_rx_cb_fn_ = std::forward<IResponseRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+
+        const RequestTxParams tx_params{Service::Request::_traits_::FixedPortId, ServerNodeId};
+        EXPECT_CALL(transport_mock_, makeRequestTxSession(RequestTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, req_tx_session_mock_);
+            }));
+        EXPECT_CALL(transport_mock_, makeResponseRxSession(ResponseRxParamsEq(rx_params_)))  //
+            .WillOnce(Invoke([&](const auto&) {                                              //
+                return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, res_rx_session_mock_);
+            }));
+
+        EXPECT_CALL(res_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(req_tx_session_mock_, deinit()).Times(1);
+
+        EXPECT_CALL(storage_mock_, size())
+            .WillRepeatedly(Return(Service::Response::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Service::Response::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_response_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        test_response_ = Service::Response{mr_alloc_};
+
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    ReadClient::Client makeClient(Presentation& presentation)
+    {
+        auto maybe_client = presentation.makeClient<Service>(ServerNodeId);
+        EXPECT_THAT(maybe_client, VariantWith<ReadClient::Client>(_));
+        return cetl::get<ReadClient::Client>(std::move(maybe_client));
+    }
+
+    /// Captures offsets of all sent requests.
+    ///
+    void expectRequests(const std::size_t count)
+    {
+        EXPECT_CALL(req_tx_session_mock_, send(_, _))  //
+            .Times(static_cast<int>(count))
+            .WillRepeatedly(Invoke([this](const auto&, const auto fragments) {
+                //
+                Service::Request request{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(request, fragments));
+                EXPECT_THAT(request.path.path, ElementsAre('f', 'w'));
+                requested_offsets_.push_back(request.offset);
+                return cetl::nullopt;
+            }));
+    }
+
+    /// Delivers response with a chunk of the given size to the request with the given transfer id.
+    ///
+    void respond(const TransferId transfer_id, const std::size_t chunk_size, const std::uint8_t fill = 0)
+    {
+        test_response_._error.value = Service::Response::_traits_::TypeOf::_error::OK;
+        test_response_.data.value.assign(chunk_size, fill);
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        ServiceRxTransfer                   transfer{{{{transfer_id, Priority::Nominal}, now()}, ServerNodeId},
+                                                     ScatteredBuffer{std::move(storage)}};
+        res_rx_cb_fn_({transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                 scheduler_{};
+    TrackingMemoryResource                          mr_;
+    cetl::pmr::polymorphic_allocator<void>          mr_alloc_{&mr_};
+    StrictMock<TransportMock>                       transport_mock_;
+    TransferId                                      transfer_id_modulo_{std::numeric_limits<TransferId>::max()};
+    const ResponseRxParams                          rx_params_{Service::Response::_traits_::ExtentBytes,
+                                                               Service::Request::_traits_::FixedPortId,
+                                                               ServerNodeId};
+    StrictMock<RequestTxSessionMock>                req_tx_session_mock_;
+    StrictMock<ResponseRxSessionMock>               res_rx_session_mock_;
+    IResponseRxSession::OnReceiveCallback::Function res_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>            storage_mock_;
+    Service::Response                               test_response_{mr_alloc_};
+    std::vector<std::uint64_t>                      requested_offsets_;
+    // NOLINTEND
+
+};  // TestFileReadClient
+
+// MARK: - Tests:
+
+TEST_F(TestFileReadClient, out_of_order_reassembly)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    ReadClient::Options options{};
+    options.initial_window_size = 2;
+    options.max_window_size     = 3;
+    ReadClient read_client{presentation, makeClient(presentation), options};
+
+    using Chunk = std::pair<std::uint64_t, std::uint8_t>;
+
+    std::vector<Chunk>                               chunks;
+    std::vector<ReadClient::CompletionCallback::Arg> completions;
+
+    expectRequests(5);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(read_client.read(
+            "fw",
+            0,
+            [&chunks](const auto& arg) {
+                //
+                chunks.emplace_back(arg.offset, arg.data.front());
+            },
+            [&completions](const auto& arg) {
+                //
+                completions.push_back(arg);
+            }));
+        EXPECT_TRUE(read_client.isBusy());
+        EXPECT_FALSE(read_client.read("fw", 0, {}, {}));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        EXPECT_THAT(requested_offsets_, ElementsAre(0, 256));
+
+        // The second chunk arrives first - it's buffered until the first one.
+        respond(1, 256, 2);
+    });
+    scheduler_.scheduleAt(1s + 15ms, [&](const auto&) {
+        //
+        EXPECT_THAT(chunks, IsEmpty());
+        EXPECT_THAT(read_client.getWindowSize(), 3);
+        EXPECT_THAT(requested_offsets_, ElementsAre(0, 256, 512));
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        respond(0, 256, 1);
+    });
+    scheduler_.scheduleAt(1s + 25ms, [&](const auto&) {
+        //
+        EXPECT_THAT(chunks, ElementsAre(Chunk{0, 1}, Chunk{256, 2}));
+        EXPECT_THAT(requested_offsets_, ElementsAre(0, 256, 512, 768, 1024));
+    });
+    scheduler_.scheduleAt(1s + 30ms, [&](const auto&) {
+        //
+        // The short chunk is the end of file - requests beyond it are canceled.
+        respond(2, 88, 3);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(chunks, ElementsAre(Chunk{0, 1}, Chunk{256, 2}, Chunk{512, 3}));
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure, Eq(cetl::nullopt));
+    EXPECT_THAT(completions[0].size, 600);
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 30ms});
+    EXPECT_FALSE(read_client.isBusy());
+}
+
+TEST_F(TestFileReadClient, timeout_retry_and_shrink)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    ReadClient::Options options{};
+    options.initial_window_size = 2;
+    options.max_window_size     = 2;
+    options.initial_timeout     = 100ms;
+    options.min_timeout         = 50ms;
+    ReadClient read_client{presentation, makeClient(presentation), options};
+
+    std::vector<ReadClient::CompletionCallback::Arg> completions;
+
+    expectRequests(5);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(read_client.read("fw", 0, {}, [&completions](const auto& arg) {
+            //
+            completions.push_back(arg);
+        }));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        respond(0, 256);
+    });
+    scheduler_.scheduleAt(1s + 15ms, [&](const auto&) {
+        //
+        // The first round trip time is 10ms, so the timeout is at its 50ms minimum now.
+        EXPECT_THAT(read_client.getSmoothedRtt(), 10ms);
+        EXPECT_THAT(read_client.getTimeout(), 50ms);
+        EXPECT_THAT(requested_offsets_, ElementsAre(0, 256, 512));
+    });
+    scheduler_.scheduleAt(1s + 105ms, [&](const auto&) {
+        //
+        // Both outstanding requests have timed out (@60ms and @100ms), and were re-issued.
+        EXPECT_THAT(requested_offsets_, ElementsAre(0, 256, 512, 512, 256));
+        EXPECT_THAT(read_client.getWindowSize(), 1);
+        EXPECT_THAT(read_client.getTimeout(), 200ms);
+    });
+    scheduler_.scheduleAt(1s + 120ms, [&](const auto&) {
+        //
+        respond(4, 44);
+    });
+    scheduler_.spinFor(10s);
+
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure, Eq(cetl::nullopt));
+    EXPECT_THAT(completions[0].size, 300);
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 120ms});
+}
+
+TEST_F(TestFileReadClient, max_attempts_failure)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    ReadClient::Options options{};
+    options.initial_window_size = 1;
+    options.max_window_size     = 1;
+    options.initial_timeout     = 100ms;
+    options.max_attempts        = 2;
+    ReadClient read_client{presentation, makeClient(presentation), options};
+
+    std::vector<ReadClient::CompletionCallback::Arg> completions;
+
+    expectRequests(2);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(read_client.read("fw", 0, {}, [&completions](const auto& arg) {
+            //
+            completions.push_back(arg);
+        }));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(requested_offsets_, ElementsAre(0, 0));
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure,
+                Optional(VariantWith<ResponsePromiseFailure>(VariantWith<ResponsePromiseExpired>(_))));
+    EXPECT_THAT(completions[0].size, 0);
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 300ms});
+    EXPECT_FALSE(read_client.isBusy());
+}
+
+TEST_F(TestFileReadClient, file_error)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    ReadClient read_client{presentation, makeClient(presentation)};
+
+    std::vector<ReadClient::CompletionCallback::Arg> completions;
+
+    expectRequests(2);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(read_client.read("fw", 0, {}, [&completions](const auto& arg) {
+            //
+            completions.push_back(arg);
+        }));
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        test_response_._error.value = ReadClient::FileError::NOT_FOUND;
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        ServiceRxTransfer                   transfer{{{{0, Priority::Nominal}, now()}, ServerNodeId},
+                                                     ScatteredBuffer{std::move(storage)}};
+        res_rx_cb_fn_({transfer});
+    });
+    scheduler_.spinFor(10s);
+
+    ASSERT_THAT(completions.size(), 1);
+    EXPECT_THAT(completions[0].failure,
+                Optional(VariantWith<ReadClient::FileError>(
+                    Field(&ReadClient::FileError::value, ReadClient::FileError::NOT_FOUND))));
+    EXPECT_THAT(completions[0].approx_now, TimePoint{1s + 10ms});
+}
+
+TEST_F(TestFileReadClient, window_limited_by_transfer_id_space)
+{
+    transfer_id_modulo_ = 4;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    ReadClient::Options options{};
+    options.initial_window_size = ReadClient::MaxWindowSize;
+    ReadClient read_client{presentation, makeClient(presentation), options};
+    EXPECT_THAT(read_client.getWindowSize(), 2);
+
+    expectRequests(2);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(read_client.read("fw", 0, {}, {}));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(requested_offsets_, ElementsAre(0, 256));
+        read_client.cancel();
+        EXPECT_FALSE(read_client.isBusy());
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
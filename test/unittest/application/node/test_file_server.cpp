@@ -0,0 +1,602 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/application/node/file_server.hpp>
+#include <libcyphal/platform/file_system.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/file/Error_1_0.hpp>
+#include <uavcan/file/GetInfo_0_2.hpp>
+#include <uavcan/file/Read_1_1.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;           // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::platform::file_system;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;           // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;              // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::StrictMock;
+using testing::VariantWith;
+using testing::ElementsAreArray;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Implements in-memory file system, which could pretend that its files are memory mapped.
+///
+class FileSystemStub final : public IFileSystem
+{
+public:
+    explicit FileSystemStub(cetl::pmr::memory_resource& memory, const bool is_mapped)
+        : memory_{memory}
+        , is_mapped_{is_mapped}
+    {
+    }
+
+    void addFile(const std::string& path, const std::size_t size)
+    {
+        auto& content = files_[path];
+        content.resize(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            content[i] = static_cast<cetl::byte>(i % 251);
+        }
+    }
+
+    const std::vector<cetl::byte>& content(const std::string& path) const
+    {
+        return files_.at(path);
+    }
+
+    // MARK: IFileSystem
+
+    auto getInfo(const cetl::string_view path) const -> libcyphal::Expected<Info, Error> override
+    {
+        const auto it = files_.find(std::string{path.data(), path.size()});
+        if (it == files_.end())
+        {
+            return Error::NotFound;
+        }
+
+        Info info{};
+        info.size                                = it->second.size();
+        info.unix_timestamp_of_last_modification = 1234;
+        info.is_readable                         = true;
+        return info;
+    }
+
+    auto open(const cetl::string_view path) -> libcyphal::Expected<libcyphal::UniquePtr<IFile>, Error> override
+    {
+        const auto it = files_.find(std::string{path.data(), path.size()});
+        if (it == files_.end())
+        {
+            return Error::NotFound;
+        }
+
+        ++opens_count;
+        return libcyphal::makeUniquePtr<IFile, FileStub>(memory_, *this, it->second);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    std::size_t opens_count{0};
+    std::size_t reads_count{0};
+    // NOLINTEND
+
+private:
+    class FileStub final : public IFile
+    {
+    public:
+        FileStub(FileSystemStub& file_system, const std::vector<cetl::byte>& content)
+            : file_system_{file_system}
+            , content_{content}
+        {
+        }
+
+        ~FileStub() = default;
+
+        FileStub(const FileStub&)                = delete;
+        FileStub(FileStub&&) noexcept            = delete;
+        FileStub& operator=(const FileStub&)     = delete;
+        FileStub& operator=(FileStub&&) noexcept = delete;
+
+        // MARK: IFile
+
+        std::uint64_t getSize() const noexcept override
+        {
+            return content_.size();
+        }
+
+        cetl::span<const cetl::byte> getMapped() const noexcept override
+        {
+            if (file_system_.is_mapped_)
+            {
+                return {content_.data(), content_.size()};
+            }
+            return {};
+        }
+
+        auto read(const std::uint64_t offset, const cetl::span<cetl::byte> buffer) const
+            -> libcyphal::Expected<std::size_t, Error> override
+        {
+            ++file_system_.reads_count;
+
+            const auto pos  = std::min<std::size_t>(offset, content_.size());
+            const auto size = std::min(buffer.size(), content_.size() - pos);
+            (void) std::copy_n(content_.begin() + static_cast<std::ptrdiff_t>(pos), size, buffer.begin());
+            return size;
+        }
+
+    private:
+        FileSystemStub&                file_system_;
+        const std::vector<cetl::byte>& content_;
+
+    };  // FileStub
+
+    cetl::pmr::memory_resource&                    memory_;
+    const bool                                     is_mapped_;
+    std::map<std::string, std::vector<cetl::byte>> files_;
+
+};  // FileSystemStub
+
+class TestFileServer : public testing::Test
+{
+protected:
+    using ReadService        = node::FileServer::ReadService;
+    using GetInfoService     = node::FileServer::GetInfoService;
+    using FileError          = uavcan::file::Error_1_0;
+    using UniquePtrReqRxSpec = RequestRxSessionMock::RefWrapper::Spec;
+    using UniquePtrResTxSpec = ResponseTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    template <typename Container>
+    static void setPath(Container& container, const std::string& path)
+    {
+        container.clear();
+        std::copy(path.begin(), path.end(), std::back_inserter(container));
+    }
+
+    struct SvcServerContext
+    {
+        // NOLINTBEGIN
+        IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn;
+        StrictMock<RequestRxSessionMock>               req_rx_session_mock;
+        StrictMock<ResponseTxSessionMock>              res_tx_session_mock;
+        NiceMock<ScatteredBufferStorageMock>           storage_mock;
+        // NOLINTEND
+
+        template <typename Service>
+        void expectSvcServerSessions(TrackingMemoryResource& mr, TransportMock& transport_mock)
+        {
+            EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_))  //
+                .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+                    req_rx_cb_fn = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+                }));
+
+            constexpr RequestRxParams rx_params{Service::Request::_traits_::ExtentBytes,
+                                                Service::Request::_traits_::FixedPortId};
+            EXPECT_CALL(transport_mock, makeRequestRxSession(RequestRxParamsEq(rx_params)))
+                .WillOnce(Invoke([&](const auto&) {
+                    return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr, req_rx_session_mock);
+                }));
+
+            constexpr ResponseTxParams tx_params{Service::Response::_traits_::FixedPortId};
+            EXPECT_CALL(transport_mock, makeResponseTxSession(ResponseTxParamsEq(tx_params)))
+                .WillOnce(Invoke([&](const auto&) {
+                    return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr, res_tx_session_mock);
+                }));
+
+            EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+            EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+        }
+
+        /// Delivers the given request (serialized) to the server.
+        ///
+        template <typename Request>
+        void receive(const Request& request, const TransferId transfer_id, const TimePoint timestamp)
+        {
+            EXPECT_CALL(storage_mock, size()).WillRepeatedly(Return(Request::_traits_::SerializationBufferSizeBytes));
+            EXPECT_CALL(storage_mock, copy(0, _, _))                           //
+                .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                    //
+                    std::array<std::uint8_t, Request::_traits_::SerializationBufferSizeBytes> buffer{};
+                    const auto result = serialize(request, buffer);
+                    const auto size   = std::min(result.value(), len);
+                    (void) std::memmove(dst, buffer.data(), size);
+                    return size;
+                }));
+
+            ScatteredBufferStorageMock::Wrapper storage{&storage_mock};
+            ServiceRxTransfer transfer{{{{transfer_id, Priority::Nominal}, timestamp}, NodeId{0x31}},
+                                       ScatteredBuffer{std::move(storage)}};
+            req_rx_cb_fn({transfer});
+        }
+
+    };  // SvcServerContext
+
+    /// Expects 'Read' response with the given error and chunk of the file content.
+    ///
+    void expectReadResponse(SvcServerContext&              read_svc_cnxt,
+                            const TransferId               transfer_id,
+                            const std::uint16_t            error,
+                            const std::vector<cetl::byte>& content,
+                            const std::size_t              offset,
+                            const std::size_t              size,
+                            const std::size_t              fragments_count)
+    {
+        EXPECT_CALL(read_svc_cnxt.res_tx_session_mock,
+                    send(ServiceTxMetadataEq({{{transfer_id, Priority::Nominal}, now() + 1s}, NodeId{0x31}}), _))  //
+            .WillOnce(Invoke([=, &content](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments, SizeIs(fragments_count));
+
+                ReadService::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response._error.value, error);
+
+                const auto* const chunk = reinterpret_cast<const std::uint8_t*>(content.data() + offset);  // NOLINT
+                EXPECT_THAT(response.data.value, ElementsAreArray(chunk, size));
+                return cetl::nullopt;
+            }));
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    StrictMock<TransportMock>              transport_mock_;
+    // NOLINTEND
+
+};  // TestFileServer
+
+// MARK: - Tests:
+
+TEST_F(TestFileServer, read_mapped)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    FileSystemStub file_system{mr_, true};
+    file_system.addFile("fw.bin", 300);
+    const auto& content = file_system.content("fw.bin");
+
+    SvcServerContext read_svc_cnxt;
+    read_svc_cnxt.expectSvcServerSessions<ReadService>(mr_, transport_mock_);
+    SvcServerContext get_info_svc_cnxt;
+    get_info_svc_cnxt.expectSvcServerSessions<GetInfoService>(mr_, transport_mock_);
+
+    cetl::optional<node::FileServer> file_server;
+    ReadService::Request             request{mr_alloc_};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_file_server = node::FileServer::make(presentation, file_system);
+        ASSERT_THAT(maybe_file_server, VariantWith<node::FileServer>(_));
+        file_server.emplace(cetl::get<node::FileServer>(std::move(maybe_file_server)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Chunk data is sent straight from the mapped memory.
+        EXPECT_CALL(read_svc_cnxt.res_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments, SizeIs(2));
+                EXPECT_THAT(fragments[1].data(), content.data());
+                EXPECT_THAT(fragments[1].size(), 256);
+                return cetl::nullopt;
+            }));
+
+        setPath(request.path.path, "fw.bin");
+        request.offset = 0;
+        read_svc_cnxt.receive(request, 1, now());
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        expectReadResponse(read_svc_cnxt, 2, FileError::OK, content, 256, 44, 2);
+        request.offset = 256;
+        read_svc_cnxt.receive(request, 2, now());
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Beyond the end of file - an empty chunk (just the header).
+        expectReadResponse(read_svc_cnxt, 3, FileError::OK, content, 0, 0, 1);
+        request.offset = 1000;
+        read_svc_cnxt.receive(request, 3, now());
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        expectReadResponse(read_svc_cnxt, 4, FileError::NOT_FOUND, content, 0, 0, 1);
+        setPath(request.path.path, "none.bin");
+        read_svc_cnxt.receive(request, 4, now());
+
+        EXPECT_THAT(file_server->getOpenFilesCount(), 1);
+        EXPECT_THAT(file_system.opens_count, 1);
+        EXPECT_THAT(file_system.reads_count, 0);
+    });
+    scheduler_.scheduleAt(9s - 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(file_server->getOpenFilesCount(), 1);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        // The file was last accessed @4s, so it's closed after the default 5s idle timeout.
+        EXPECT_THAT(file_server->getOpenFilesCount(), 0);
+    });
+    scheduler_.scheduleAt(10s, [&](const auto&) {
+        //
+        file_server.reset();
+    });
+    scheduler_.spinFor(11s);
+}
+
+TEST_F(TestFileServer, read_cached)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    FileSystemStub file_system{mr_, false};
+    file_system.addFile("fw.bin", 5000);
+    const auto& content = file_system.content("fw.bin");
+
+    SvcServerContext read_svc_cnxt;
+    read_svc_cnxt.expectSvcServerSessions<ReadService>(mr_, transport_mock_);
+    SvcServerContext get_info_svc_cnxt;
+    get_info_svc_cnxt.expectSvcServerSessions<GetInfoService>(mr_, transport_mock_);
+
+    cetl::optional<node::FileServer> file_server;
+    ReadService::Request             request{mr_alloc_};
+    setPath(request.path.path, "fw.bin");
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_file_server = node::FileServer::make(presentation, file_system);
+        ASSERT_THAT(maybe_file_server, VariantWith<node::FileServer>(_));
+        file_server.emplace(cetl::get<node::FileServer>(std::move(maybe_file_server)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // The chunk spans two cache blocks.
+        expectReadResponse(read_svc_cnxt, 1, FileError::OK, content, 4000, 256, 3);
+        request.offset = 4000;
+        read_svc_cnxt.receive(request, 1, now());
+        EXPECT_THAT(file_system.reads_count, 2);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Both blocks are already in the cache.
+        expectReadResponse(read_svc_cnxt, 2, FileError::OK, content, 3900, 256, 3);
+        request.offset = 3900;
+        read_svc_cnxt.receive(request, 2, now());
+        EXPECT_THAT(file_system.reads_count, 2);
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // The last (short) chunk.
+        expectReadResponse(read_svc_cnxt, 3, FileError::OK, content, 4864, 136, 2);
+        request.offset = 4864;
+        read_svc_cnxt.receive(request, 3, now());
+        EXPECT_THAT(file_system.reads_count, 2);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        // Moving the file server should keep its open files (and their caches).
+        auto other_file_server = std::move(*file_server);
+        file_server.emplace(std::move(other_file_server));
+        EXPECT_THAT(file_server->getOpenFilesCount(), 1);
+
+        expectReadResponse(read_svc_cnxt, 4, FileError::OK, content, 100, 256, 2);
+        request.offset = 100;
+        read_svc_cnxt.receive(request, 4, now());
+        EXPECT_THAT(file_system.reads_count, 2);
+        EXPECT_THAT(file_system.opens_count, 1);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        file_server.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestFileServer, max_open_files)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    FileSystemStub file_system{mr_, true};
+    for (std::size_t i = 0; i <= node::FileServer::MaxOpenFiles; ++i)
+    {
+        file_system.addFile("fw" + std::to_string(i), 10);
+    }
+
+    SvcServerContext read_svc_cnxt;
+    read_svc_cnxt.expectSvcServerSessions<ReadService>(mr_, transport_mock_);
+    SvcServerContext get_info_svc_cnxt;
+    get_info_svc_cnxt.expectSvcServerSessions<GetInfoService>(mr_, transport_mock_);
+
+    cetl::optional<node::FileServer> file_server;
+    ReadService::Request             request{mr_alloc_};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_file_server = node::FileServer::make(presentation, file_system);
+        ASSERT_THAT(maybe_file_server, VariantWith<node::FileServer>(_));
+        file_server.emplace(cetl::get<node::FileServer>(std::move(maybe_file_server)));
+        file_server->setIdleTimeout(3s);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(read_svc_cnxt.res_tx_session_mock, send(_, _))
+            .Times(node::FileServer::MaxOpenFiles + 2)
+            .WillRepeatedly(Return(cetl::nullopt));
+
+        TransferId transfer_id = 0;
+        for (std::size_t i = 0; i <= node::FileServer::MaxOpenFiles; ++i)
+        {
+            setPath(request.path.path, "fw" + std::to_string(i));
+            read_svc_cnxt.receive(request, ++transfer_id, now());
+        }
+        EXPECT_THAT(file_server->getOpenFilesCount(), node::FileServer::MaxOpenFiles);
+
+        // All files were accessed at the same time, so the first one (in path order) was considered
+        // as the least recently used one. It was closed, and has to be opened again.
+        setPath(request.path.path, "fw0");
+        read_svc_cnxt.receive(request, ++transfer_id, now());
+        EXPECT_THAT(file_server->getOpenFilesCount(), node::FileServer::MaxOpenFiles);
+        EXPECT_THAT(file_system.opens_count, node::FileServer::MaxOpenFiles + 2);
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        EXPECT_THAT(file_server->getOpenFilesCount(), 0);
+        file_server.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestFileServer, get_info)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    FileSystemStub file_system{mr_, true};
+    file_system.addFile("fw.bin", 300);
+
+    SvcServerContext read_svc_cnxt;
+    read_svc_cnxt.expectSvcServerSessions<ReadService>(mr_, transport_mock_);
+    SvcServerContext get_info_svc_cnxt;
+    get_info_svc_cnxt.expectSvcServerSessions<GetInfoService>(mr_, transport_mock_);
+
+    cetl::optional<node::FileServer> file_server;
+    GetInfoService::Request          request{mr_alloc_};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_file_server = node::FileServer::make(presentation, file_system);
+        ASSERT_THAT(maybe_file_server, VariantWith<node::FileServer>(_));
+        file_server.emplace(cetl::get<node::FileServer>(std::move(maybe_file_server)));
+        file_server->setResponseTimeout(100ms);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(get_info_svc_cnxt.res_tx_session_mock,
+                    send(ServiceTxMetadataEq({{{1, Priority::Nominal}, now() + 100ms}, NodeId{0x31}}), _))  //
+            .WillOnce(Invoke([this](const auto&, const auto fragments) {
+                //
+                GetInfoService::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response._error.value, FileError::OK);
+                EXPECT_THAT(response.size, 300);
+                EXPECT_THAT(response.unix_timestamp_of_last_modification, 1234);
+                EXPECT_TRUE(response.is_file_not_directory);
+                EXPECT_TRUE(response.is_readable);
+                EXPECT_FALSE(response.is_writeable);
+                return cetl::nullopt;
+            }));
+
+        setPath(request.path.path, "fw.bin");
+        get_info_svc_cnxt.receive(request, 1, now());
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_CALL(get_info_svc_cnxt.res_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([this](const auto&, const auto fragments) {
+                //
+                GetInfoService::Response response{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response._error.value, FileError::NOT_FOUND);
+                return cetl::nullopt;
+            }));
+
+        setPath(request.path.path, "none.bin");
+        get_info_svc_cnxt.receive(request, 2, now());
+
+        // 'GetInfo' doesn't open files.
+        EXPECT_THAT(file_system.opens_count, 0);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        file_server.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestFileServer, make_failure)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    FileSystemStub file_system{mr_, true};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(transport_mock_, makeRequestRxSession(_))  //
+            .WillOnce(Return(libcyphal::ArgumentError{}));
+
+        EXPECT_THAT(node::FileServer::make(presentation, file_system),
+                    VariantWith<Presentation::MakeFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
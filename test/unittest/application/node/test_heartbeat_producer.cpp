@@ -12,6 +12,7 @@
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/application/node/heartbeat_producer.hpp>
+#include <libcyphal/application/node/heartbeat_scheduler.hpp>
 #include <libcyphal/errors.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/transport/msg_sessions.hpp>
@@ -258,6 +259,142 @@ TEST_F(TestHeartbeatProducer, move)
     EXPECT_THAT(calls, ElementsAre(TimePoint{1s}, TimePoint{2s}, TimePoint{3s}, TimePoint{4s}));
 }
 
+TEST_F(TestHeartbeatProducer, set_period)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    EXPECT_CALL(msg_tx_session_mock, getParams())  //
+        .WillOnce(Return(MessageTxParams{uavcan::node::Heartbeat_1_0::_traits_::FixedPortId}));
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    std::vector<TimePoint>                  calls;
+    cetl::optional<node::HeartbeatProducer> heartbeat_producer;
+
+    EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto& metadata, const auto) {
+            //
+            EXPECT_THAT(metadata.deadline, now() + heartbeat_producer->getPeriod());
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_heartbeat = node::HeartbeatProducer::make(presentation);
+        ASSERT_THAT(maybe_heartbeat, VariantWith<node::HeartbeatProducer>(_));
+        heartbeat_producer.emplace(cetl::get<node::HeartbeatProducer>(std::move(maybe_heartbeat)));
+        EXPECT_THAT(heartbeat_producer->getPeriod(), 1s);
+        heartbeat_producer->setUpdateCallback([&](const auto& arg) {
+            //
+            calls.push_back(arg.approx_now);
+        });
+    });
+    scheduler_.scheduleAt(2s + 500ms, [&](const auto&) {
+        //
+        // The already planned (at 3s) heartbeat stays as is.
+        heartbeat_producer->setPeriod(200ms);
+        EXPECT_THAT(heartbeat_producer->getPeriod(), 200ms);
+    });
+    scheduler_.scheduleAt(3s + 500ms, [&](const auto&) {
+        //
+        heartbeat_producer.reset();
+    });
+    scheduler_.spinFor(5s);
+
+    EXPECT_THAT(calls,
+                ElementsAre(TimePoint{1s},
+                            TimePoint{2s},
+                            TimePoint{3s},
+                            TimePoint{3s + 200ms},
+                            TimePoint{3s + 400ms}));
+}
+
+TEST_F(TestHeartbeatProducer, shared_scheduler)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    EXPECT_CALL(msg_tx_session_mock, getParams())  //
+        .WillOnce(Return(MessageTxParams{uavcan::node::Heartbeat_1_0::_traits_::FixedPortId}));
+    EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+        .WillRepeatedly(Return(cetl::nullopt));
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+
+    Presentation             presentation{mr_, scheduler_, transport_mock_};
+    node::HeartbeatScheduler hb_scheduler{scheduler_};
+
+    std::vector<std::tuple<int, TimePoint>> calls;
+    cetl::optional<node::HeartbeatProducer> heartbeat_producer1;
+    cetl::optional<node::HeartbeatProducer> heartbeat_producer2;
+    cetl::optional<node::HeartbeatProducer> heartbeat_producer3;
+
+    scheduler_.scheduleAt(1s + 50ms, [&](const auto&) {
+        //
+        auto maybe_heartbeat1 = node::HeartbeatProducer::make(presentation, hb_scheduler);
+        ASSERT_THAT(maybe_heartbeat1, VariantWith<node::HeartbeatProducer>(_));
+        heartbeat_producer1.emplace(cetl::get<node::HeartbeatProducer>(std::move(maybe_heartbeat1)));
+        heartbeat_producer1->setUpdateCallback([&](const auto& arg) {
+            //
+            calls.emplace_back(1, arg.approx_now);
+        });
+
+        auto maybe_heartbeat2 = node::HeartbeatProducer::make(presentation, hb_scheduler);
+        ASSERT_THAT(maybe_heartbeat2, VariantWith<node::HeartbeatProducer>(_));
+        heartbeat_producer2.emplace(cetl::get<node::HeartbeatProducer>(std::move(maybe_heartbeat2)));
+        heartbeat_producer2->setUpdateCallback([&](const auto& arg) {
+            //
+            calls.emplace_back(2, arg.approx_now);
+        });
+
+        EXPECT_THAT(hb_scheduler.getMembersCount(), 2);
+        EXPECT_THAT(heartbeat_producer1->getPeriod(), 1s);
+
+        // Own period of a scheduled producer has no effect.
+        heartbeat_producer1->setPeriod(200ms);
+        EXPECT_THAT(heartbeat_producer1->getPeriod(), 1s);
+    });
+    scheduler_.scheduleAt(2s + 50ms, [&](const auto&) {
+        //
+        // Moved producer keeps its phase slot.
+        heartbeat_producer3.emplace(std::move(*heartbeat_producer1));
+        heartbeat_producer1.reset();
+        EXPECT_THAT(hb_scheduler.getMembersCount(), 2);
+    });
+    scheduler_.scheduleAt(3s + 50ms, [&](const auto&) {
+        //
+        hb_scheduler.setPeriod(2s);
+        EXPECT_THAT(heartbeat_producer2->getPeriod(), 2s);
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        heartbeat_producer2.reset();
+        heartbeat_producer3.reset();
+        EXPECT_THAT(hb_scheduler.getMembersCount(), 0);
+    });
+    scheduler_.spinFor(10s);
+
+    // New 200ms ticks start from the period change (from the slot 1, so the 2nd producer goes first).
+    EXPECT_THAT(calls,
+                ElementsAre(std::make_tuple(1, TimePoint{2s}),
+                            std::make_tuple(2, TimePoint{2s + 100ms}),
+                            std::make_tuple(1, TimePoint{3s}),
+                            std::make_tuple(2, TimePoint{3s + 50ms + 200ms}),
+                            std::make_tuple(1, TimePoint{3s + 50ms + 2s}),
+                            std::make_tuple(2, TimePoint{3s + 50ms + 2s + 200ms})));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
@@ -0,0 +1,188 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/heartbeat_scheduler.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::TimePoint;
+using namespace libcyphal::application;  // NOLINT This our main concern here in the unit tests.
+
+using testing::IsEmpty;
+using testing::ElementsAre;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestHeartbeatScheduler : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestHeartbeatScheduler, phase_spreading)
+{
+    constexpr std::size_t SlotCount = node::HeartbeatScheduler::SlotCount;
+    static_assert(SlotCount == 10, "The test expects 100ms ticks for 1s period.");
+
+    node::HeartbeatScheduler hb_scheduler{scheduler_};
+    EXPECT_THAT(hb_scheduler.getPeriod(), 1s);
+    EXPECT_THAT(hb_scheduler.getMembersCount(), 0);
+
+    std::vector<std::tuple<std::size_t, TimePoint>>                             calls;
+    std::array<cetl::optional<node::HeartbeatScheduler::Member>, SlotCount + 2> members;
+    for (std::size_t index = 0; index < members.size(); ++index)
+    {
+        members[index].emplace(hb_scheduler.join([&calls, index](const auto& arg) {
+            //
+            EXPECT_THAT(arg.period, 1s);
+            calls.emplace_back(index, arg.approx_now);
+        }));
+        EXPECT_THAT(members[index]->getSlot(), index % SlotCount);
+    }
+    EXPECT_THAT(hb_scheduler.getMembersCount(), SlotCount + 2);
+
+    // Now the 3rd slot is the least populated (empty) one.
+    members[2].reset();
+    EXPECT_THAT(hb_scheduler.getMembersCount(), SlotCount + 1);
+    {
+        const auto new_member = hb_scheduler.join([](const auto&) {});
+        EXPECT_THAT(new_member.getSlot(), 2);
+        EXPECT_THAT(hb_scheduler.getMembersCount(), SlotCount + 2);
+    }
+    EXPECT_THAT(hb_scheduler.getMembersCount(), SlotCount + 1);
+
+    scheduler_.spinFor(1s);
+
+    EXPECT_THAT(calls,
+                ElementsAre(std::make_tuple(0U, TimePoint{0ms}),
+                            std::make_tuple(10U, TimePoint{0ms}),
+                            std::make_tuple(1U, TimePoint{100ms}),
+                            std::make_tuple(11U, TimePoint{100ms}),
+                            std::make_tuple(3U, TimePoint{300ms}),
+                            std::make_tuple(4U, TimePoint{400ms}),
+                            std::make_tuple(5U, TimePoint{500ms}),
+                            std::make_tuple(6U, TimePoint{600ms}),
+                            std::make_tuple(7U, TimePoint{700ms}),
+                            std::make_tuple(8U, TimePoint{800ms}),
+                            std::make_tuple(9U, TimePoint{900ms})));
+}
+
+TEST_F(TestHeartbeatScheduler, set_period)
+{
+    node::HeartbeatScheduler hb_scheduler{scheduler_, 500ms};
+    EXPECT_THAT(hb_scheduler.getPeriod(), 500ms);
+
+    std::vector<std::tuple<TimePoint, Duration>> calls;
+
+    const auto member = hb_scheduler.join([&](const auto& arg) {
+        //
+        EXPECT_THAT(arg.approx_now, now());
+        calls.emplace_back(arg.approx_now, arg.period);
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        hb_scheduler.setPeriod(2s);
+        EXPECT_THAT(hb_scheduler.getPeriod(), 2s);
+    });
+    scheduler_.spinFor(6s);
+
+    // New ticks (200ms each) start from the moment of the period change (from the slot 1),
+    // so the slot 0 comes with the 10th new tick.
+    EXPECT_THAT(calls,
+                ElementsAre(std::make_tuple(TimePoint{0s}, Duration{500ms}),
+                            std::make_tuple(TimePoint{500ms}, Duration{500ms}),
+                            std::make_tuple(TimePoint{1s}, Duration{500ms}),
+                            std::make_tuple(TimePoint{1s + 10ms + 200ms * 10}, Duration{2s}),
+                            std::make_tuple(TimePoint{1s + 10ms + 200ms * 20}, Duration{2s})));
+}
+
+TEST_F(TestHeartbeatScheduler, move)
+{
+    static_assert(std::is_move_constructible<node::HeartbeatScheduler::Member>::value, "Should be movable.");
+    static_assert(!std::is_copy_constructible<node::HeartbeatScheduler::Member>::value, "Should not be copyable.");
+    static_assert(!std::is_move_constructible<node::HeartbeatScheduler>::value, "Should not be movable.");
+
+    node::HeartbeatScheduler hb_scheduler{scheduler_};
+
+    std::vector<TimePoint> calls;
+
+    cetl::optional<node::HeartbeatScheduler::Member> member1;
+    cetl::optional<node::HeartbeatScheduler::Member> member2;
+
+    scheduler_.scheduleAt(50ms, [&](const auto&) {
+        //
+        member1.emplace(hb_scheduler.join([&](const auto& arg) {
+            //
+            calls.push_back(arg.approx_now);
+        }));
+        EXPECT_THAT(member1->getSlot(), 0);
+    });
+    scheduler_.scheduleAt(1s + 50ms, [&](const auto&) {
+        //
+        member2.emplace(std::move(*member1));
+        member1.reset();
+        EXPECT_THAT(member2->getSlot(), 0);
+        EXPECT_THAT(hb_scheduler.getMembersCount(), 1);
+    });
+    scheduler_.scheduleAt(2s + 50ms, [&](const auto&) {
+        //
+        member2.reset();
+        EXPECT_THAT(hb_scheduler.getMembersCount(), 0);
+    });
+    scheduler_.spinFor(5s);
+
+    EXPECT_THAT(calls, ElementsAre(TimePoint{1s}, TimePoint{2s}));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,333 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/node_info_cache.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/node/GetInfo_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::IsNull;
+using testing::NotNull;
+using testing::NiceMock;
+using testing::StrictMock;
+using testing::ElementsAre;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestNodeInfoCache : public testing::Test
+{
+protected:
+    using Service            = node::NodeInfoCache::Service;
+    using Calls              = std::vector<std::tuple<TimePoint, NodeId, bool>>;
+    using UniquePtrReqTxSpec = RequestTxSessionMock::RefWrapper::Spec;
+    using UniquePtrResRxSpec = ResponseRxSessionMock::RefWrapper::Spec;
+
+    static constexpr std::size_t NodeCount = 4;
+
+    /// Holds RPC sessions of a remote node - they are reused by every 'GetInfo' client of the node.
+    ///
+    struct NodeSessions
+    {
+        // NOLINTBEGIN
+        NiceMock<RequestTxSessionMock>                  req_tx_session_mock;
+        NiceMock<ResponseRxSessionMock>                 res_rx_session_mock;
+        IResponseRxSession::OnReceiveCallback::Function res_rx_cb_fn;
+        cetl::optional<TransferId>                      pending_transfer_id;
+        std::vector<TimePoint>                          requests;
+        // NOLINTEND
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(transport_mock_, makeRequestTxSession(_))  //
+            .WillRepeatedly(Invoke([this](const auto& params) {
+                //
+                auto& sessions = sessions_.at(params.server_node_id);
+                ON_CALL(sessions.req_tx_session_mock, send(_, _))
+                    .WillByDefault(Invoke([this, &sessions](const auto& metadata, const auto) {
+                        //
+                        sessions.pending_transfer_id = metadata.base.transfer_id;
+                        sessions.requests.push_back(now());
+                        return cetl::nullopt;
+                    }));
+                return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, sessions.req_tx_session_mock);
+            }));
+        EXPECT_CALL(transport_mock_, makeResponseRxSession(_))  //
+            .WillRepeatedly(Invoke([this](const auto& params) {
+                //
+                auto& sessions = sessions_.at(params.server_node_id);
+                ON_CALL(sessions.res_rx_session_mock, getParams()).WillByDefault(Return(params));
+                ON_CALL(sessions.res_rx_session_mock, setOnReceiveCallback(_))
+                    .WillByDefault(Invoke([&sessions](auto&& cb_fn) {
+                        //
+                        sessions.res_rx_cb_fn = std::forward<IResponseRxSession::OnReceiveCallback::Function>(cb_fn);
+                    }));
+                return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, sessions.res_rx_session_mock);
+            }));
+
+        EXPECT_CALL(storage_mock_, size())
+            .WillRepeatedly(Return(Service::Response::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Service::Response::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_response_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        test_response_ = Service::Response{mr_alloc_};
+
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void setTestResponse(const char* const name, const std::uint8_t sw_major, const std::uint8_t unique_id)
+    {
+        test_response_.name.clear();
+        for (const char* ch = name; *ch != '\0'; ++ch)
+        {
+            test_response_.name.push_back(static_cast<std::uint8_t>(*ch));
+        }
+        test_response_.software_version.major = sw_major;
+        test_response_.unique_id.fill(unique_id);
+    }
+
+    /// Delivers `test_response_` as the response to the pending request of the given node.
+    ///
+    void respond(const NodeId node_id)
+    {
+        auto& sessions = sessions_.at(node_id);
+        ASSERT_TRUE(sessions.pending_transfer_id);
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        ServiceRxTransfer transfer{{{{*sessions.pending_transfer_id, Priority::Nominal}, now()}, node_id},
+                                   ScatteredBuffer{std::move(storage)}};
+        sessions.res_rx_cb_fn({transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler         scheduler_{};
+    TrackingMemoryResource                  mr_;
+    cetl::pmr::polymorphic_allocator<void>  mr_alloc_{&mr_};
+    StrictMock<TransportMock>               transport_mock_;
+    std::array<NodeSessions, NodeCount>     sessions_;
+    NiceMock<ScatteredBufferStorageMock>    storage_mock_;
+    Service::Response                       test_response_{mr_alloc_};
+    // NOLINTEND
+
+};  // TestNodeInfoCache
+
+// MARK: - Tests:
+
+TEST_F(TestNodeInfoCache, bounded_concurrency_retry_and_dedup)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<node::NodeInfoCache> cache;
+    cache.emplace(presentation, 2);
+    cache->setRequestTimeout(100ms);
+    cache->setRetryPolicy(2, 1s);
+
+    Calls calls;
+    cache->setInfoCallback([&calls](const auto& arg) {
+        //
+        calls.emplace_back(arg.approx_now, arg.node_id, arg.info != nullptr);
+    });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_TRUE(cache->query(1));
+        EXPECT_TRUE(cache->query(2));
+        EXPECT_TRUE(cache->query(3));
+        EXPECT_TRUE(cache->query(2));  // already queued - ignored
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // Only two queries are in flight; the third one waits for a free slot.
+        EXPECT_THAT(sessions_[1].requests, ElementsAre(TimePoint{1s}));
+        EXPECT_THAT(sessions_[2].requests, ElementsAre(TimePoint{1s}));
+        EXPECT_THAT(sessions_[3].requests, IsEmpty());
+
+        setTestResponse("org.example.esc", 1, 0xA1);
+        respond(1);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        EXPECT_THAT(sessions_[3].requests, ElementsAre(TimePoint{1s + 10ms}));
+
+        // Same kind of node - its descriptor is shared.
+        setTestResponse("org.example.esc", 1, 0xA3);
+        respond(3);
+    });
+    scheduler_.scheduleAt(1s + 30ms, [&](const auto&) {
+        //
+        EXPECT_THAT(cache->getDescriptorCount(), 1);
+
+        const auto* const info1 = cache->findInfo(1);
+        const auto* const info3 = cache->findInfo(3);
+        ASSERT_THAT(info1, NotNull());
+        ASSERT_THAT(info3, NotNull());
+        EXPECT_THAT(info1->descriptor, info3->descriptor);
+        EXPECT_THAT(info1->unique_id[0], 0xA1);
+        EXPECT_THAT(info3->unique_id[0], 0xA3);
+        EXPECT_THAT(std::string(info1->descriptor->getName().data(), info1->descriptor->getName().size()),
+                    "org.example.esc");
+        EXPECT_THAT(info1->descriptor->software_version.major, 1);
+    });
+    scheduler_.scheduleAt(2s + 110ms, [&](const auto&) {
+        //
+        // Node 2 has timed out @1.1s, and was retried after 1s delay.
+        EXPECT_THAT(sessions_[2].requests, ElementsAre(TimePoint{1s}, TimePoint{2s + 100ms}));
+
+        setTestResponse("org.example.gps", 3, 0xA2);
+        respond(2);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(cache->getDescriptorCount(), 2);
+
+        cache->invalidate(1);
+        EXPECT_THAT(cache->findInfo(1), IsNull());
+        EXPECT_THAT(cache->getDescriptorCount(), 2);
+
+        cache->invalidate(3);
+        EXPECT_THAT(cache->getDescriptorCount(), 1);
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Node 1 doesn't respond anymore - the failure is reported after all attempts.
+        EXPECT_TRUE(cache->query(1));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(sessions_[1].requests, ElementsAre(TimePoint{1s}, TimePoint{4s}, TimePoint{5s + 100ms}));
+        cache.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(calls,
+                ElementsAre(std::make_tuple(TimePoint{1s + 10ms}, 1, true),
+                            std::make_tuple(TimePoint{1s + 20ms}, 3, true),
+                            std::make_tuple(TimePoint{2s + 110ms}, 2, true),
+                            std::make_tuple(TimePoint{5s + 200ms}, 1, false)));
+}
+
+TEST_F(TestNodeInfoCache, node_events)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<node::NodeInfoCache> cache;
+    cache.emplace(presentation);
+
+    node::NodeTracker::NodeState node_state{};
+    node_state.node_id   = 1;
+    node_state.is_online = true;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        cache->onNodeEvent({node_state, node::NodeTracker::Change::Online, now()});
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        setTestResponse("org.example.esc", 1, 0xA1);
+        respond(1);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Known node is not re-queried.
+        ASSERT_THAT(cache->findInfo(1), NotNull());
+        cache->onNodeEvent({node_state, node::NodeTracker::Change::Health, now()});
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Restarted node is re-queried, and its restart while the query is in flight discards the result.
+        cache->onNodeEvent({node_state, node::NodeTracker::Change::Restarted, now()});
+        EXPECT_THAT(cache->findInfo(1), IsNull());
+    });
+    scheduler_.scheduleAt(3s + 10ms, [&](const auto&) {
+        //
+        cache->onNodeEvent({node_state, node::NodeTracker::Change::Restarted, now()});
+        setTestResponse("org.example.esc", 2, 0xA1);
+        respond(1);
+        EXPECT_THAT(cache->findInfo(1), IsNull());
+    });
+    scheduler_.scheduleAt(3s + 20ms, [&](const auto&) {
+        //
+        respond(1);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        const auto* const info = cache->findInfo(1);
+        ASSERT_THAT(info, NotNull());
+        EXPECT_THAT(info->descriptor->software_version.major, 2);
+        EXPECT_THAT(sessions_[1].requests, ElementsAre(TimePoint{1s}, TimePoint{3s}, TimePoint{3s + 10ms}));
+        cache.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
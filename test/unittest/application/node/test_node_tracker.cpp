@@ -0,0 +1,311 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/node_tracker.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/node/Health_1_0.hpp>
+#include <uavcan/node/Heartbeat_1_0.hpp>
+#include <uavcan/node/Mode_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::IsNull;
+using testing::NotNull;
+using testing::NiceMock;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestNodeTracker : public testing::Test
+{
+protected:
+    using Message            = node::NodeTracker::Message;
+    using Change             = node::NodeTracker::Change;
+    using Events             = std::vector<std::tuple<TimePoint, NodeId, std::uint8_t>>;
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::array<std::uint8_t, Message::_traits_::SerializationBufferSizeBytes> buffer{};
+                const auto result = serialize(test_message_, buffer);
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectHeartbeatSubscription()
+    {
+        constexpr MessageRxParams rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_rx_session_mock_, getParams()).WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                msg_rx_cb_fn_ = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(msg_rx_session_mock_, deinit()).Times(1);
+
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock_);
+            }));
+    }
+
+    /// Delivers `test_message_` as a heartbeat from the given node.
+    ///
+    void receiveHeartbeat(const NodeId node_id, const std::uint32_t uptime)
+    {
+        test_message_.uptime = uptime;
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer transfer{{{{0, Priority::Nominal}, now()}, node_id}, ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({transfer});
+    }
+
+    /// Makes expected event. Change flags are taken by value (to avoid their ODR-use in C++14).
+    ///
+    static Events::value_type event(const TimePoint approx_now, const NodeId node_id, const std::uint8_t changes)
+    {
+        return std::make_tuple(approx_now, node_id, changes);
+    }
+
+    static node::NodeTracker::EventCallback::Function makeRecorder(Events& events)
+    {
+        return [&events](const auto& arg) {
+            //
+            events.emplace_back(arg.approx_now, arg.node.node_id, arg.changes);
+        };
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                scheduler_{};
+    TrackingMemoryResource                         mr_;
+    StrictMock<TransportMock>                      transport_mock_;
+    StrictMock<MessageRxSessionMock>               msg_rx_session_mock_;
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>           storage_mock_;
+    Message                                        test_message_{};
+    // NOLINTEND
+
+};  // TestNodeTracker
+
+// MARK: - Tests:
+
+TEST_F(TestNodeTracker, online_offline)
+{
+    expectHeartbeatSubscription();
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<node::NodeTracker> tracker;
+
+    Events events;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_tracker = node::NodeTracker::make(presentation);
+        ASSERT_THAT(maybe_tracker, VariantWith<node::NodeTracker>(_));
+        tracker.emplace(cetl::get<node::NodeTracker>(std::move(maybe_tracker)));
+        tracker->setEventCallback(makeRecorder(events));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Both "flat" (CAN range) and "tree" (UDP range) nodes are tracked. Events are batched.
+        receiveHeartbeat(0x31, 10);
+        receiveHeartbeat(1000, 20);
+        receiveHeartbeat(1000, 21);
+        EXPECT_THAT(events, IsEmpty());
+        EXPECT_THAT(tracker->getOnlineCount(), 2);
+        EXPECT_THAT(tracker->findNode(0x32), IsNull());
+        EXPECT_THAT(tracker->findNode(1001), IsNull());
+
+        const auto* const node_state = tracker->findNode(1000);
+        ASSERT_THAT(node_state, NotNull());
+        EXPECT_THAT(node_state->uptime, 21);
+        EXPECT_THAT(node_state->last_seen, TimePoint{2s});
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Health and mode changes are reported for online nodes.
+        test_message_.health.value = uavcan::node::Health_1_0::WARNING;
+        receiveHeartbeat(0x31, 11);
+        test_message_.health.value = uavcan::node::Health_1_0::NOMINAL;
+        test_message_.mode.value   = uavcan::node::Mode_1_0::MAINTENANCE;
+        receiveHeartbeat(1000, 22);
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Node 1000 has been restarted (its uptime went backwards); node 0x31 is just alive.
+        receiveHeartbeat(0x31, 12);
+        receiveHeartbeat(1000, 0);
+
+        std::vector<NodeId> online_nodes;
+        tracker->visitOnlineNodes([&online_nodes](const auto& node) { online_nodes.push_back(node.node_id); });
+        EXPECT_THAT(online_nodes, ElementsAre(0x31, 1000));
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        // Only node 0x31 stays alive. Anonymous heartbeats are ignored.
+        receiveHeartbeat(0x31, 13);
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer                   anonymous{{{{0, Priority::Nominal}, now()}, cetl::nullopt},
+                                                      ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({anonymous});
+    });
+    scheduler_.scheduleAt(6s, [&](const auto&) {
+        //
+        receiveHeartbeat(0x31, 14);
+    });
+    scheduler_.scheduleAt(8s + 500ms, [&](const auto&) {
+        //
+        EXPECT_THAT(tracker->getOnlineCount(), 1);
+
+        const auto* const node_state = tracker->findNode(1000);
+        ASSERT_THAT(node_state, NotNull());
+        EXPECT_FALSE(node_state->is_online);
+        EXPECT_THAT(node_state->restart_count, 1);
+    });
+    scheduler_.scheduleAt(10s, [&](const auto&) {
+        //
+        // Node comes back after being offline.
+        receiveHeartbeat(1000, 5);
+    });
+    scheduler_.scheduleAt(20s, [&](const auto&) {
+        //
+        tracker.reset();
+    });
+    scheduler_.spinFor(30s);
+
+    EXPECT_THAT(events,
+                ElementsAre(event(TimePoint{2s}, 0x31, Change::Online),
+                            event(TimePoint{2s}, 1000, Change::Online),
+                            event(TimePoint{3s}, 0x31, Change::Health),
+                            event(TimePoint{3s}, 1000, Change::Mode),
+                            event(TimePoint{4s}, 0x31, Change::Health | Change::Mode),
+                            event(TimePoint{4s}, 1000, Change::Restarted),
+                            event(TimePoint{7s}, 1000, Change::Offline),
+                            event(TimePoint{9s}, 0x31, Change::Offline),
+                            event(TimePoint{10s}, 1000, Change::Online),
+                            event(TimePoint{13s}, 1000, Change::Offline)));
+}
+
+TEST_F(TestNodeTracker, move)
+{
+    expectHeartbeatSubscription();
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<node::NodeTracker> tracker;
+
+    Events events;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_tracker = node::NodeTracker::make(presentation);
+        ASSERT_THAT(maybe_tracker, VariantWith<node::NodeTracker>(_));
+        tracker.emplace(cetl::get<node::NodeTracker>(std::move(maybe_tracker)));
+        tracker->setEventCallback(makeRecorder(events));
+        tracker->setOfflineTimeout(1s);
+
+        receiveHeartbeat(7, 1);
+        receiveHeartbeat(300, 1);
+
+        // Pending events and offline checks are taken by the new instance.
+        node::NodeTracker moved_tracker{std::move(*tracker)};
+        tracker.reset();
+        tracker.emplace(std::move(moved_tracker));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        tracker.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(events,
+                ElementsAre(event(TimePoint{1s}, 7, Change::Online),
+                            event(TimePoint{1s}, 300, Change::Online),
+                            event(TimePoint{2s}, 7, Change::Offline),
+                            event(TimePoint{2s}, 300, Change::Offline)));
+}
+
+TEST_F(TestNodeTracker, make_failure)
+{
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(_))  //
+        .WillOnce(Return(libcyphal::ArgumentError{}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    EXPECT_THAT(node::NodeTracker::make(presentation),
+                VariantWith<Presentation::MakeFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
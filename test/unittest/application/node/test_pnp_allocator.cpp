@@ -0,0 +1,380 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "platform/storage_key_value_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/pnp_allocator.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr std::uint64_t HashA = 0xAAAA00000001ULL;
+constexpr std::uint64_t HashB = 0xBBBB00000002ULL;
+constexpr std::uint64_t HashC = 0xCCCC00000003ULL;
+
+class TestPnpAllocator : public testing::Test
+{
+protected:
+    using Allocator          = node::PnpAllocator;
+    using Message            = Allocator::Message;
+    using StorageError       = libcyphal::platform::storage::Error;
+    using Responses          = std::vector<std::tuple<TimePoint, std::uint64_t, NodeId>>;
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Message::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_message_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+
+        // The key-value storage mock is backed by a simple map.
+        EXPECT_CALL(key_value_mock_, get(_, _))  //
+            .WillRepeatedly(Invoke([this](auto key, auto data) -> libcyphal::Expected<std::size_t, StorageError> {
+                const auto it = stored_.find(std::string{key.data(), key.size()});
+                if (it == stored_.end())
+                {
+                    return StorageError::Existence;
+                }
+                const auto size = std::min(data.size(), it->second.size());
+                (void) std::copy_n(it->second.begin(), size, data.begin());
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        test_message_ = Message{mr_alloc_};
+
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectSessions(const cetl::optional<NodeId> local_node_id)
+    {
+        constexpr MessageRxParams rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_rx_session_mock_, getParams()).WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                msg_rx_cb_fn_ = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(msg_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock_);
+            }));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock_, getParams()).WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(msg_tx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock_);
+            }));
+
+        EXPECT_CALL(transport_mock_, getLocalNodeId()).WillRepeatedly(Return(local_node_id));
+    }
+
+    /// Captures all published responses.
+    ///
+    void expectResponses(const std::size_t count)
+    {
+        EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+            .Times(static_cast<int>(count))
+            .WillRepeatedly(Invoke([this](const auto&, const auto fragments) {
+                //
+                Message message{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(message, fragments));
+                EXPECT_THAT(message.allocated_node_id.size(), 1);
+                responses_.emplace_back(now(), message.unique_id_hash, message.allocated_node_id.front().value);
+                return cetl::nullopt;
+            }));
+    }
+
+    /// Expects the given number of successful storage writes (which update the map).
+    ///
+    void expectPuts(const std::size_t count)
+    {
+        EXPECT_CALL(key_value_mock_, put(_, _))  //
+            .Times(static_cast<int>(count))
+            .WillRepeatedly(Invoke([this](auto key, auto data) {
+                //
+                stored_[std::string{key.data(), key.size()}].assign(data.begin(), data.end());
+                return cetl::nullopt;
+            }));
+    }
+
+    /// Delivers `NodeIDAllocationData` message with the given hash (and optionally allocated node ID).
+    ///
+    void receive(const std::uint64_t          unique_id_hash,
+                 const cetl::optional<NodeId> publisher_node_id = cetl::nullopt,
+                 const cetl::optional<NodeId> allocated_node_id = cetl::nullopt)
+    {
+        test_message_.unique_id_hash = unique_id_hash;
+        test_message_.allocated_node_id.clear();
+        if (allocated_node_id)
+        {
+            test_message_.allocated_node_id.emplace_back();
+            test_message_.allocated_node_id.back().value = *allocated_node_id;
+        }
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer                   transfer{{{{0, Priority::Nominal}, now()}, publisher_node_id},
+                                                     ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({transfer});
+    }
+
+    static std::vector<std::uint8_t> storedHash(const std::uint64_t unique_id_hash)
+    {
+        std::vector<std::uint8_t> value;
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            value.push_back(static_cast<std::uint8_t>(unique_id_hash >> (i * 8U)));
+        }
+        return value;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                        scheduler_{};
+    TrackingMemoryResource                                 mr_;
+    cetl::pmr::polymorphic_allocator<void>                 mr_alloc_{&mr_};
+    StrictMock<TransportMock>                              transport_mock_;
+    StrictMock<MessageRxSessionMock>                       msg_rx_session_mock_;
+    StrictMock<MessageTxSessionMock>                       msg_tx_session_mock_;
+    IMessageRxSession::OnReceiveCallback::Function         msg_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>                   storage_mock_;
+    StrictMock<libcyphal::platform::storage::KeyValueMock> key_value_mock_;
+    std::map<std::string, std::vector<std::uint8_t>>       stored_;
+    Message                                                test_message_{mr_alloc_};
+    Responses                                              responses_;
+    // NOLINTEND
+
+};  // TestPnpAllocator
+
+// MARK: - Tests:
+
+TEST_F(TestPnpAllocator, allocation_and_batching)
+{
+    expectSessions(NodeId{124});
+
+    // Node 125 is already allocated to A, and allocation of 123 is corrupted (so it's never reallocated).
+    stored_["uavcan.pnp.125"] = storedHash(HashA);
+    stored_["uavcan.pnp.123"] = {1, 2, 3};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    Allocator::Options options{};
+    options.max_batch_size = 2;
+
+    cetl::optional<Allocator> allocator;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocator = Allocator::make(presentation, key_value_mock_, options);
+        ASSERT_THAT(maybe_allocator, VariantWith<Allocator>(_));
+        allocator.emplace(cetl::get<Allocator>(std::move(maybe_allocator)));
+
+        EXPECT_THAT(allocator->getAllocatedCount(), 1);
+        EXPECT_THAT(allocator->findNodeId(HashA), Optional(125));
+        EXPECT_THAT(allocator->findNodeId(HashB), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Repeated requests are merged; responses of other allocators (or non-anonymous requests) are ignored.
+        receive(HashA);
+        receive(HashB);
+        receive(HashC);
+        receive(HashB);
+        receive(0x123, NodeId{42});
+        receive(0x456, NodeId{42}, NodeId{7});
+        EXPECT_THAT(allocator->getAllocatedCount(), 3);
+        EXPECT_THAT(allocator->findNodeId(HashB), Optional(122));
+        EXPECT_THAT(allocator->findNodeId(HashC), Optional(121));
+        EXPECT_THAT(allocator->findNodeId(0x123), Eq(cetl::nullopt));
+
+        // Nothing is stored or published until the batch is flushed (on the next spin).
+        expectPuts(1);
+        expectResponses(2);
+    });
+    scheduler_.scheduleAt(2s + 5ms, [&](const auto&) {
+        //
+        EXPECT_THAT(responses_,
+                    ElementsAre(std::make_tuple(TimePoint{2s}, HashA, 125),  //
+                                std::make_tuple(TimePoint{2s}, HashB, 122)));
+        EXPECT_THAT(stored_["uavcan.pnp.122"], ElementsAre(0x02, 0x00, 0x00, 0x00, 0xBB, 0xBB));
+        responses_.clear();
+        expectPuts(1);
+        expectResponses(1);
+    });
+    scheduler_.scheduleAt(2s + 15ms, [&](const auto&) {
+        //
+        EXPECT_THAT(responses_, ElementsAre(std::make_tuple(TimePoint{2s + 10ms}, HashC, 121)));
+        EXPECT_THAT(stored_["uavcan.pnp.121"], ElementsAre(0x03, 0x00, 0x00, 0x00, 0xCC, 0xCC));
+        responses_.clear();
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        allocator.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestPnpAllocator, storage_failure_retry)
+{
+    expectSessions(cetl::nullopt);
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Allocator> allocator;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocator = Allocator::make(presentation, key_value_mock_);
+        ASSERT_THAT(maybe_allocator, VariantWith<Allocator>(_));
+        allocator.emplace(cetl::get<Allocator>(std::move(maybe_allocator)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        receive(HashA);
+
+        // The allocation is not announced until it's stored.
+        EXPECT_CALL(key_value_mock_, put(_, _)).WillOnce(Return(StorageError::IO));
+    });
+    scheduler_.scheduleAt(2s + 5ms, [&](const auto&) {
+        //
+        EXPECT_THAT(responses_, IsEmpty());
+        expectPuts(1);
+        expectResponses(1);
+    });
+    scheduler_.scheduleAt(2s + 15ms, [&](const auto&) {
+        //
+        EXPECT_THAT(responses_, ElementsAre(std::make_tuple(TimePoint{2s + 10ms}, HashA, 125)));
+        EXPECT_THAT(stored_["uavcan.pnp.125"], ElementsAre(0x01, 0x00, 0x00, 0x00, 0xAA, 0xAA));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        allocator.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestPnpAllocator, range_exhaustion)
+{
+    expectSessions(cetl::nullopt);
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    Allocator::Options options{};
+    options.min_node_id = 10;
+    options.max_node_id = 10;
+
+    cetl::optional<Allocator> allocator;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocator = Allocator::make(presentation, key_value_mock_, options);
+        ASSERT_THAT(maybe_allocator, VariantWith<Allocator>(_));
+        allocator.emplace(cetl::get<Allocator>(std::move(maybe_allocator)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        receive(HashA);
+        receive(HashB);
+        EXPECT_THAT(allocator->getAllocatedCount(), 1);
+        EXPECT_THAT(allocator->findNodeId(HashB), Eq(cetl::nullopt));
+
+        expectPuts(1);
+        expectResponses(1);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(responses_, ElementsAre(std::make_tuple(TimePoint{2s}, HashA, 10)));
+
+        // Only lower 48 bits of the hash are significant.
+        EXPECT_THAT(allocator->findNodeId(HashA | 0xFFFF000000000000ULL), Optional(10));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        allocator.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
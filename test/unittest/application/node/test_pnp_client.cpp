@@ -0,0 +1,254 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/pnp_client.hpp>
+#include <libcyphal/common/crc.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Ge;
+using testing::Le;
+using testing::Ne;
+using testing::Invoke;
+using testing::Return;
+using testing::AllOf;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::SizeIs;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPnpClient : public testing::Test
+{
+protected:
+    using Client             = node::PnpClient;
+    using Message            = Client::Message;
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Message::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_message_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+
+        constexpr MessageRxParams rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_rx_session_mock_, getParams()).WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                msg_rx_cb_fn_ = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(msg_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock_);
+            }));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock_, getParams()).WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(msg_tx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock_);
+            }));
+    }
+
+    void TearDown() override
+    {
+        test_message_ = Message{mr_alloc_};
+
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    /// Captures times of all published requests.
+    ///
+    void expectRequests(const std::uint64_t unique_id_hash)
+    {
+        EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+            .WillRepeatedly(Invoke([this, unique_id_hash](const auto&, const auto fragments) {
+                //
+                Message message{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(message, fragments));
+                EXPECT_THAT(message.unique_id_hash, unique_id_hash);
+                EXPECT_THAT(message.allocated_node_id, IsEmpty());
+                request_times_.push_back(now());
+                return cetl::nullopt;
+            }));
+    }
+
+    /// Delivers allocation response with the given hash and node ID.
+    ///
+    void respond(const std::uint64_t          unique_id_hash,
+                 const NodeId                 allocated_node_id,
+                 const cetl::optional<NodeId> publisher_node_id)
+    {
+        test_message_.unique_id_hash = unique_id_hash;
+        test_message_.allocated_node_id.clear();
+        test_message_.allocated_node_id.emplace_back();
+        test_message_.allocated_node_id.back().value = allocated_node_id;
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer                   transfer{{{{0, Priority::Nominal}, now()}, publisher_node_id},
+                                                     ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                scheduler_{};
+    TrackingMemoryResource                         mr_;
+    cetl::pmr::polymorphic_allocator<void>         mr_alloc_{&mr_};
+    StrictMock<TransportMock>                      transport_mock_;
+    StrictMock<MessageRxSessionMock>               msg_rx_session_mock_;
+    StrictMock<MessageTxSessionMock>               msg_tx_session_mock_;
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>           storage_mock_;
+    Message                                        test_message_{mr_alloc_};
+    std::vector<TimePoint>                         request_times_;
+    // NOLINTEND
+
+};  // TestPnpClient
+
+// MARK: - Tests:
+
+TEST_F(TestPnpClient, unique_id_hash)
+{
+    const Client::UniqueId unique_id{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const Client::UniqueId other_id{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17};
+
+    const libcyphal::common::CRC64WE crc64{unique_id.data(), unique_id.data() + unique_id.size()};
+    EXPECT_THAT(Client::computeUniqueIdHash(unique_id), crc64.get() & 0xFFFFFFFFFFFFULL);
+    EXPECT_THAT(Client::computeUniqueIdHash(unique_id), Ne(Client::computeUniqueIdHash(other_id)));
+
+    // The fixture expects sessions to be made.
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+    auto         maybe_client = Client::make(presentation, unique_id);
+    ASSERT_THAT(maybe_client, VariantWith<Client>(_));
+    EXPECT_THAT(cetl::get<Client>(maybe_client).getUniqueIdHash(), Client::computeUniqueIdHash(unique_id));
+}
+
+TEST_F(TestPnpClient, backoff_and_allocation)
+{
+    const Client::UniqueId unique_id{0xA5, 0x5A};
+    expectRequests(Client::computeUniqueIdHash(unique_id));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Client> client;
+    std::vector<NodeId>    allocations;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_client = Client::make(presentation, unique_id);
+        ASSERT_THAT(maybe_client, VariantWith<Client>(_));
+        client.emplace(cetl::get<Client>(std::move(maybe_client)));
+        client->setAllocationCallback([&](const auto& arg) {
+            //
+            EXPECT_THAT(arg.approx_now, TimePoint{40s});
+            allocations.push_back(arg.node_id);
+        });
+    });
+    scheduler_.scheduleAt(40s, [&](const auto&) {
+        //
+        // Delay before N-th request is in the [D/2, D] range, where D = min(1s * 2^N, 16s).
+        ASSERT_THAT(request_times_, SizeIs(AllOf(Ge(5), Le(7))));
+        TimePoint prev_time{1s};
+        Duration  upper{1s};
+        for (const auto request_time : request_times_)
+        {
+            EXPECT_THAT(request_time - prev_time, AllOf(Ge(upper / 2), Le(upper)));
+            prev_time = request_time;
+            upper     = std::min<Duration>(upper * 2, 16s);
+        }
+
+        // Responses to other nodes (or from anonymous nodes) are ignored.
+        respond(client->getUniqueIdHash() ^ 1U, 41, NodeId{1});
+        respond(client->getUniqueIdHash(), 41, cetl::nullopt);
+        EXPECT_THAT(client->getAllocatedNodeId(), Eq(cetl::nullopt));
+
+        respond(client->getUniqueIdHash(), 42, NodeId{1});
+        respond(client->getUniqueIdHash(), 43, NodeId{1});
+        EXPECT_THAT(client->getAllocatedNodeId(), Optional(42));
+        request_times_.clear();
+    });
+    scheduler_.scheduleAt(99s, [&](const auto&) {
+        //
+        // No more requests after allocation.
+        EXPECT_THAT(request_times_, IsEmpty());
+        EXPECT_THAT(allocations, ElementsAre(42));
+        client.reset();
+    });
+    scheduler_.spinFor(100s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,357 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/port_binder.hpp>
+#include <libcyphal/application/registry/change_notifier.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/node/Heartbeat_1_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPortBinder : public testing::Test
+{
+protected:
+    using Message            = uavcan::node::Heartbeat_1_0;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Message::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_message_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectPublication(MessageTxSessionMock& msg_tx_session_mock, const PortId subject_id)
+    {
+        const MessageTxParams tx_params{subject_id};
+        EXPECT_CALL(msg_tx_session_mock, getParams()).WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([this, &msg_tx_session_mock](const auto&) {                  //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+            }));
+    }
+
+    void expectSubscription(MessageRxSessionMock&                           msg_rx_session_mock,
+                            IMessageRxSession::OnReceiveCallback::Function& msg_rx_cb_fn,
+                            const PortId                                    subject_id)
+    {
+        const MessageRxParams rx_params{Message::_traits_::ExtentBytes, subject_id};
+        EXPECT_CALL(msg_rx_session_mock, getParams()).WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&msg_rx_cb_fn](auto&& cb_fn) {  //
+                msg_rx_cb_fn = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([this, &msg_rx_session_mock](const auto&) {                  //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+            }));
+    }
+
+    void receive(const IMessageRxSession::OnReceiveCallback::Function& msg_rx_cb_fn, const TransferId transfer_id)
+    {
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer transfer{{{{transfer_id, Priority::Nominal}, now()}, NodeId{42}},
+                                   ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn({transfer});
+    }
+
+    registry::IRegister::Value makeUInt16Value(const std::uint16_t value) const
+    {
+        registry::IRegister::Value reg_value{mr_alloc_};
+        reg_value.set_natural16().value.push_back(value);
+        return reg_value;
+    }
+
+    static cetl::optional<std::uint16_t> getPortId(const registry::Registry& rgy, const registry::IRegister::Name name)
+    {
+        const auto value_and_flags = rgy.get(name);
+        if (!value_and_flags)
+        {
+            return cetl::nullopt;
+        }
+        const auto* const natural16 = value_and_flags->value.get_natural16_if();
+        if ((natural16 == nullptr) || (natural16->value.size() != 1))
+        {
+            return cetl::nullopt;
+        }
+        return natural16->value[0];
+    }
+
+    static std::string getPortType(const registry::Registry& rgy, const registry::IRegister::Name name)
+    {
+        const auto value_and_flags = rgy.get(name);
+        if (!value_and_flags)
+        {
+            return {};
+        }
+        const auto* const str = value_and_flags->value.get_string_if();
+        if (str == nullptr)
+        {
+            return {};
+        }
+        return std::string{str->value.begin(), str->value.end()};
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    StrictMock<TransportMock>              transport_mock_;
+    NiceMock<ScatteredBufferStorageMock>   storage_mock_;
+    Message                                test_message_{mr_alloc_};
+    // NOLINTEND
+
+};  // TestPortBinder
+
+// MARK: - Tests:
+
+TEST_F(TestPortBinder, publisher_rebind)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock_a;
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock_b;
+
+    Presentation             presentation{mr_, scheduler_, transport_mock_};
+    registry::Registry       rgy{mr_};
+    registry::ChangeNotifier notifier{scheduler_, rgy};
+    node::PortBinder         binder{presentation, rgy, notifier};
+
+    expectPublication(msg_tx_session_mock_a, 100);
+
+    node::PublisherPort<Message> port{binder, "health", 100};
+    port.setPriority(Priority::High);
+    EXPECT_TRUE(port.isExposed());
+    EXPECT_THAT(port.getSubjectId(), Optional(100));
+    EXPECT_THAT(getPortId(rgy, "uavcan.pub.health.id"), Optional(100));
+    EXPECT_THAT(getPortType(rgy, "uavcan.pub.health.type"), "uavcan.node.Heartbeat.1.0");
+    EXPECT_TRUE(rgy.get("uavcan.pub.health.id")->flags._mutable);
+    EXPECT_TRUE(rgy.get("uavcan.pub.health.id")->flags.persistent);
+    EXPECT_FALSE(rgy.get("uavcan.pub.health.type")->flags._mutable);
+
+    std::vector<PortId> published;
+    const auto          recordSend = [&published](const PortId subject_id) {
+        return [&published, subject_id](const auto& metadata, const auto) {
+            //
+            EXPECT_THAT(metadata.base.priority, Priority::High);
+            published.push_back(subject_id);
+            return cetl::nullopt;
+        };
+    };
+    EXPECT_CALL(msg_tx_session_mock_a, send(_, _)).WillRepeatedly(Invoke(recordSend(100)));
+    EXPECT_CALL(msg_tx_session_mock_b, send(_, _)).WillRepeatedly(Invoke(recordSend(200)));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_FALSE(port.publish(now() + 1s, test_message_).has_value());
+
+        // Only natural16[1] values are accepted.
+        EXPECT_THAT(rgy.set("uavcan.pub.health.id", registry::IRegister::Value{mr_alloc_}),
+                    Optional(registry::SetError::Semantics));
+        EXPECT_THAT(rgy.set("uavcan.pub.health.type", makeUInt16Value(1)), Optional(registry::SetError::Mutability));
+
+        // Change is applied on the next spin - the port is still bound to the old subject.
+        expectPublication(msg_tx_session_mock_b, 200);
+        EXPECT_THAT(rgy.set("uavcan.pub.health.id", makeUInt16Value(200)), Eq(cetl::nullopt));
+        EXPECT_THAT(port.getSubjectId(), Optional(100));
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(port.getSubjectId(), Optional(200));
+        EXPECT_FALSE(port.publish(now() + 1s, test_message_).has_value());
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Failed rebind keeps the previous subject, and reverts the register.
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(MessageTxParams{300})))  //
+            .WillOnce(Return(libcyphal::ArgumentError{}));
+        EXPECT_THAT(rgy.set("uavcan.pub.health.id", makeUInt16Value(300)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(port.getSubjectId(), Optional(200));
+        EXPECT_THAT(getPortId(rgy, "uavcan.pub.health.id"), Optional(200));
+        EXPECT_FALSE(port.publish(now() + 1s, test_message_).has_value());
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("uavcan.pub.health.id", makeUInt16Value(node::PortBinder::UnsetPortId)),
+                    Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(3s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(port.getSubjectId(), Eq(cetl::nullopt));
+        EXPECT_THAT(port.publish(now() + 1s, test_message_), Optional(VariantWith<libcyphal::ArgumentError>(_)));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published, ElementsAre(100, 200, 200));
+}
+
+TEST_F(TestPortBinder, subscriber_rebind)
+{
+    constexpr PortId UnsetPortId = node::PortBinder::UnsetPortId;
+
+    StrictMock<MessageRxSessionMock>               msg_rx_session_mock_a;
+    StrictMock<MessageRxSessionMock>               msg_rx_session_mock_b;
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn_a;
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn_b;
+
+    Presentation             presentation{mr_, scheduler_, transport_mock_};
+    registry::Registry       rgy{mr_};
+    registry::ChangeNotifier notifier{scheduler_, rgy};
+    node::PortBinder         binder{presentation, rgy, notifier};
+
+    // Not bound until the id register is set.
+    node::SubscriberPort<Message> port{binder, "health"};
+    EXPECT_THAT(port.getSubjectId(), Eq(cetl::nullopt));
+    EXPECT_THAT(getPortId(rgy, "uavcan.sub.health.id"), Optional(UnsetPortId));
+    EXPECT_THAT(getPortType(rgy, "uavcan.sub.health.type"), "uavcan.node.Heartbeat.1.0");
+
+    std::vector<std::uint32_t> received;
+    port.setOnReceiveCallback([&received](const auto& arg) {
+        //
+        received.push_back(arg.message.uptime);
+    });
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        expectSubscription(msg_rx_session_mock_a, msg_rx_cb_fn_a, 100);
+        EXPECT_THAT(rgy.set("uavcan.sub.health.id", makeUInt16Value(100)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(port.getSubjectId(), Optional(100));
+        test_message_.uptime = 1;
+        receive(msg_rx_cb_fn_a, 0);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        expectSubscription(msg_rx_session_mock_b, msg_rx_cb_fn_b, 200);
+        EXPECT_THAT(rgy.set("uavcan.sub.health.id", makeUInt16Value(200)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        // The same callback is in use for the new subject.
+        EXPECT_THAT(port.getSubjectId(), Optional(200));
+        test_message_.uptime = 2;
+        receive(msg_rx_cb_fn_b, 0);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(received, ElementsAre(1, 2));
+}
+
+TEST_F(TestPortBinder, duplicate_and_long_names)
+{
+    Presentation             presentation{mr_, scheduler_, transport_mock_};
+    registry::Registry       rgy{mr_};
+    registry::ChangeNotifier notifier{scheduler_, rgy};
+    node::PortBinder         binder{presentation, rgy, notifier};
+
+    const node::PublisherPort<Message> port1{binder, "health"};
+    const node::PublisherPort<Message> port2{binder, "health"};
+    EXPECT_TRUE(port1.isExposed());
+    EXPECT_FALSE(port2.isExposed());
+
+    // Too long port name is truncated, but the suffixes are preserved.
+    constexpr std::size_t               NameCapacity = libcyphal::config::Application::Node::PortBinder_NameCapacity();
+    const std::string                   long_name(NameCapacity, 'x');
+    const node::SubscriberPort<Message> port3{binder, long_name.c_str()};
+    EXPECT_TRUE(port3.isExposed());
+    EXPECT_THAT(rgy.size(), 4);
+
+    const auto id_name   = "uavcan.sub." + std::string(NameCapacity - 14, 'x') + ".id";
+    const auto type_name = "uavcan.sub." + std::string(NameCapacity - 16, 'x') + ".type";
+    EXPECT_THAT(id_name.size(), NameCapacity);
+    EXPECT_THAT(rgy.get(id_name.c_str()), Optional(_));
+    EXPECT_THAT(rgy.get(type_name.c_str()), Optional(_));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,299 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/port_list_publisher.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/presentation/server.hpp>
+#include <libcyphal/presentation/subscriber.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::SizeIs;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPortListPublisher : public testing::Test
+{
+protected:
+    using PortListPublisher  = node::PortListPublisher;
+    using Message            = PortListPublisher::Message;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrReqRxSpec = RequestRxSessionMock::RefWrapper::Spec;
+    using UniquePtrResTxSpec = ResponseTxSessionMock::RefWrapper::Spec;
+
+    /// Simplified (decoded) view of a published port list.
+    ///
+    struct Published
+    {
+        TimePoint                  time;
+        Priority                   priority;
+        std::vector<std::uint16_t> publishers;
+        std::vector<std::uint16_t> subscribers;
+        std::vector<std::uint16_t> clients;
+        std::vector<std::uint16_t> servers;
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(list_tx_session_mock_, getParams()).WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, list_tx_session_mock_);
+            }));
+
+        EXPECT_CALL(list_tx_session_mock_, send(_, _))  //
+            .WillRepeatedly(Invoke([this](const auto& metadata, const auto fragments) {
+                //
+                const auto message = std::make_unique<Message>(mr_alloc_);
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(*message, fragments));
+                published_.push_back(Published{now(),
+                                               metadata.base.priority,
+                                               toSubjectIds(message->publishers),
+                                               toSubjectIds(message->subscribers),
+                                               toServiceIds(message->clients),
+                                               toServiceIds(message->servers)});
+                return cetl::nullopt;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    static std::vector<std::uint16_t> toSubjectIds(const uavcan::node::port::SubjectIDList_0_1& list)
+    {
+        using TypeOf = uavcan::node::port::SubjectIDList_0_1::_traits_::TypeOf;
+
+        std::vector<std::uint16_t> ids;
+        if (const auto* const sparse_list = cetl::get_if<TypeOf::sparse_list>(&list.union_value))
+        {
+            for (const auto& subject_id : *sparse_list)
+            {
+                ids.push_back(subject_id.value);
+            }
+        }
+        else if (const auto* const mask = cetl::get_if<TypeOf::mask>(&list.union_value))
+        {
+            for (std::size_t i = 0; i < mask->size(); ++i)
+            {
+                if ((*mask)[i])
+                {
+                    ids.push_back(static_cast<std::uint16_t>(i));
+                }
+            }
+        }
+        return ids;
+    }
+
+    static std::vector<std::uint16_t> toServiceIds(const uavcan::node::port::ServiceIDList_0_1& list)
+    {
+        std::vector<std::uint16_t> ids;
+        for (std::size_t i = 0; i < list.mask.size(); ++i)
+        {
+            if (list.mask[i])
+            {
+                ids.push_back(static_cast<std::uint16_t>(i));
+            }
+        }
+        return ids;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    StrictMock<TransportMock>              transport_mock_;
+    StrictMock<MessageTxSessionMock>       list_tx_session_mock_;
+    std::vector<Published>                 published_;
+    // NOLINTEND
+
+};  // TestPortListPublisher
+
+// MARK: - Tests:
+
+TEST_F(TestPortListPublisher, make)
+{
+    constexpr PortId ListSubjectId = Message::_traits_::FixedPortId;
+
+    StrictMock<MessageTxSessionMock>  msg_tx_session_mock;
+    StrictMock<MessageRxSessionMock>  msg_rx_session_mock;
+    StrictMock<RequestRxSessionMock>  req_rx_session_mock;
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr MessageTxParams msg_tx_params{147};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(msg_tx_params));
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(msg_tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                               //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    constexpr MessageRxParams msg_rx_params{8, 148};
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(msg_rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_)).Times(1);
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(msg_rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                               //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+    constexpr RequestRxParams req_rx_params{8, 430};
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_)).WillRepeatedly(Return());
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(req_rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                               //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    constexpr ResponseTxParams res_tx_params{req_rx_params.service_id};
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(res_tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                                 //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Publisher<void>>   publisher;
+    cetl::optional<Subscriber<void>>  subscriber;
+    cetl::optional<RawServiceServer>  server;
+    cetl::optional<PortListPublisher> port_list;
+    std::size_t                       allocated_bytes = 0;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Ports made before the port list publisher should be reported as well.
+        auto maybe_pub = presentation.makePublisher<void>(msg_tx_params.subject_id);
+        ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+        publisher.emplace(cetl::get<Publisher<void>>(std::move(maybe_pub)));
+
+        auto maybe_port_list = PortListPublisher::make(presentation);
+        ASSERT_THAT(maybe_port_list, VariantWith<PortListPublisher>(_));
+        port_list.emplace(cetl::get<PortListPublisher>(std::move(maybe_port_list)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        auto maybe_sub = presentation.makeSubscriber(msg_rx_params.subject_id, msg_rx_params.extent_bytes);
+        ASSERT_THAT(maybe_sub, VariantWith<Subscriber<void>>(_));
+        subscriber.emplace(cetl::get<Subscriber<void>>(std::move(maybe_sub)));
+
+        auto maybe_server = presentation.makeServer(req_rx_params.service_id, req_rx_params.extent_bytes);
+        ASSERT_THAT(maybe_server, VariantWith<RawServiceServer>(_));
+        server.emplace(cetl::get<RawServiceServer>(std::move(maybe_server)));
+    });
+    scheduler_.scheduleAt(11s + 1ms, [&](const auto&) {
+        //
+        // Moved publisher should continue publishing with the same schedule.
+        PortListPublisher moved{std::move(*port_list)};
+        port_list.reset();
+        port_list.emplace(std::move(moved));
+    });
+    scheduler_.scheduleAt(11s + 2ms, [&](const auto&) {
+        //
+        allocated_bytes = mr_.total_allocated_bytes;
+    });
+    scheduler_.scheduleAt(21s + 1ms, [&](const auto&) {
+        //
+        // Nothing has changed, so the cached payload was published again (without re-serialization).
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+
+        EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+        server.reset();
+
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+        publisher.reset();
+    });
+    scheduler_.scheduleAt(31s + 1ms, [&](const auto&) {
+        //
+        EXPECT_CALL(list_tx_session_mock_, deinit()).Times(1);
+        port_list.reset();
+
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+        subscriber.reset();
+    });
+    scheduler_.spinFor(60s);
+
+    ASSERT_THAT(published_, SizeIs(4));
+    EXPECT_THAT(published_[0].time, TimePoint{1s});
+    EXPECT_THAT(published_[0].priority, Priority::Optional);
+    EXPECT_THAT(published_[0].publishers, ElementsAre(147, ListSubjectId));
+    EXPECT_THAT(published_[0].subscribers, IsEmpty());
+    EXPECT_THAT(published_[0].clients, IsEmpty());
+    EXPECT_THAT(published_[0].servers, IsEmpty());
+
+    EXPECT_THAT(published_[1].time, TimePoint{11s});
+    EXPECT_THAT(published_[1].publishers, ElementsAre(147, ListSubjectId));
+    EXPECT_THAT(published_[1].subscribers, ElementsAre(148));
+    EXPECT_THAT(published_[1].servers, ElementsAre(430));
+
+    EXPECT_THAT(published_[2].time, TimePoint{21s});
+    EXPECT_THAT(published_[2].subscribers, ElementsAre(148));
+    EXPECT_THAT(published_[2].servers, ElementsAre(430));
+
+    EXPECT_THAT(published_[3].time, TimePoint{31s});
+    EXPECT_THAT(published_[3].publishers, ElementsAre(ListSubjectId));
+    EXPECT_THAT(published_[3].subscribers, ElementsAre(148));
+    EXPECT_THAT(published_[3].servers, IsEmpty());
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
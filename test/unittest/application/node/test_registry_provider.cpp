@@ -16,6 +16,7 @@
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/application/node/registry_provider.hpp>
 #include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
 #include <libcyphal/errors.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/transport/svc_sessions.hpp>
@@ -30,11 +31,15 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
 #include <limits>
+#include <list>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -309,6 +314,138 @@ TEST_F(TestRegistryProvider, make_access_req)
     scheduler_.spinFor(10s);
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestRegistryProvider, steady_state_allocations)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    SvcServerContext list_svc_cnxt;
+    list_svc_cnxt.expectSvcServerSessions<ListService>(mr_, transport_mock_);
+    SvcServerContext access_svc_cnxt;
+    access_svc_cnxt.expectSvcServerSessions<AccessService>(mr_, transport_mock_);
+
+    // Many scalar registers - their values are filled in place into the reused response.
+    // Each getter also remembers amount of allocated memory at the moment the register is read.
+    constexpr std::size_t Count = 100;
+    std::size_t           allocated_before_read{0};
+    const auto            make_getter = [this, &allocated_before_read](const std::size_t index) {
+        //
+        return [this, &allocated_before_read, index] {
+            //
+            allocated_before_read = mr_.total_allocated_bytes;
+            return static_cast<std::uint16_t>(index);
+        };
+    };
+    Registry registry{mr_};
+    using Reg = decltype(registry.route("", make_getter(0)));
+
+    std::vector<std::string> names;
+    std::list<Reg>           regs;
+    names.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        names.push_back("reg." + std::to_string(i));
+        regs.push_back(registry.route(names.back(), make_getter(i)));
+    }
+
+    cetl::optional<node::RegistryProvider> registry_provider;
+
+    ListService::Request                 list_request{};
+    NiceMock<ScatteredBufferStorageMock> list_storage_mock;
+    EXPECT_CALL(list_storage_mock, size())
+        .WillRepeatedly(Return(ListService::Request::_traits_::SerializationBufferSizeBytes));
+    EXPECT_CALL(list_storage_mock, copy(0, _, _))                      //
+        .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+            //
+            std::array<std::uint8_t, ListService::Request::_traits_::SerializationBufferSizeBytes> buffer{};
+            const auto result = serialize(list_request, buffer);
+            const auto size   = std::min(result.value(), len);
+            (void) std::memmove(dst, buffer.data(), size);
+            return size;
+        }));
+    ScatteredBufferStorageMock::Wrapper list_storage{&list_storage_mock};
+    ServiceRxTransfer                   list_rx_transfer{{{{123, Priority::Fast}, {}}, NodeId{0x31}},
+                                                         ScatteredBuffer{std::move(list_storage)}};
+
+    AccessService::Request               access_request{mr_alloc_};
+    NiceMock<ScatteredBufferStorageMock> access_storage_mock;
+    EXPECT_CALL(access_storage_mock, size())
+        .WillRepeatedly(Return(AccessService::Request::_traits_::SerializationBufferSizeBytes));
+    EXPECT_CALL(access_storage_mock, copy(0, _, _))                    //
+        .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+            //
+            std::array<std::uint8_t, AccessService::Request::_traits_::SerializationBufferSizeBytes> buffer{};
+            const auto result = serialize(access_request, buffer);
+            const auto size   = std::min(result.value(), len);
+            (void) std::memmove(dst, buffer.data(), size);
+            return size;
+        }));
+    ScatteredBufferStorageMock::Wrapper access_storage{&access_storage_mock};
+    ServiceRxTransfer                   access_rx_transfer{{{{123, Priority::Fast}, {}}, NodeId{0x31}},
+                                                           ScatteredBuffer{std::move(access_storage)}};
+
+    // Access requests are deserialized (with allocation of the name) before the handler is called,
+    // and after the register is read, the only allocation is made by the presentation layer -
+    // the buffer for serialization of the (big) response. So the handler itself shouldn't allocate.
+    constexpr std::size_t AccessResponseSize = AccessService::Response::_traits_::SerializationBufferSizeBytes;
+    constexpr std::size_t AccessSerializationBytes =
+        (AccessResponseSize <= libcyphal::config::Presentation::SmallPayloadSize()) ? 0 : AccessResponseSize;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_registry_provider = node::RegistryProvider::make(presentation, registry);
+        ASSERT_THAT(maybe_registry_provider, VariantWith<node::RegistryProvider>(_));
+        registry_provider.emplace(cetl::get<node::RegistryProvider>(std::move(maybe_registry_provider)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Warm up - the reused responses get enough capacity.
+        EXPECT_CALL(list_svc_cnxt.res_tx_session_mock, send(_, _))  //
+            .Times(Count)
+            .WillRepeatedly(Return(cetl::nullopt));
+        EXPECT_CALL(access_svc_cnxt.res_tx_session_mock, send(_, _))  //
+            .Times(Count)
+            .WillRepeatedly(Return(cetl::nullopt));
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            list_request.index = static_cast<std::uint16_t>(i);
+            list_svc_cnxt.req_rx_cb_fn({list_rx_transfer});
+
+            access_request.name = makeRegisterName(mr_alloc_, names[i]);
+            access_svc_cnxt.req_rx_cb_fn({access_rx_transfer});
+        }
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_CALL(list_svc_cnxt.res_tx_session_mock, send(_, _))  //
+            .Times(Count)
+            .WillRepeatedly(Return(cetl::nullopt));
+        EXPECT_CALL(access_svc_cnxt.res_tx_session_mock, send(_, _))  //
+            .Times(Count)
+            .WillRepeatedly(Invoke([&](const auto&, const auto) {
+                //
+                EXPECT_THAT(mr_.total_allocated_bytes - allocated_before_read, AccessSerializationBytes);
+                return cetl::nullopt;
+            }));
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            // List requests and responses are small (so on stack), hence nothing is allocated at all.
+            list_request.index               = static_cast<std::uint16_t>(i);
+            const auto list_allocated_before = mr_.total_allocated_bytes;
+            list_svc_cnxt.req_rx_cb_fn({list_rx_transfer});
+            EXPECT_THAT(mr_.total_allocated_bytes, list_allocated_before);
+
+            access_request.name = makeRegisterName(mr_alloc_, names[i]);
+            access_svc_cnxt.req_rx_cb_fn({access_rx_transfer});
+        }
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        registry_provider.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
 TEST_F(TestRegistryProvider, make_failure)
 {
     Presentation presentation{mr_, scheduler_, transport_mock_};
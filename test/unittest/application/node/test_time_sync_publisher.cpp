@@ -0,0 +1,204 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/time_sync_publisher.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/transport.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTimeSyncPublisher : public testing::Test
+{
+protected:
+    using Publisher          = node::TimeSyncPublisher;
+    using Message            = Publisher::Message;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using TxCompleteCallback = ITransport::MessageTxCompleteCallback;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock_, getParams()).WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(msg_tx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock_);
+            }));
+
+        EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+            .WillRepeatedly(Invoke([this](const auto&, const auto fragments) {
+                //
+                Message message{mr_alloc_};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(message, fragments));
+                published_.push_back(message.previous_transmission_timestamp_microsecond);
+                return cetl::nullopt;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    /// Emulates transport with TX completion support - the latest non-empty callback is kept.
+    ///
+    void expectTxCompleteSupport()
+    {
+        EXPECT_CALL(transport_mock_, setMessageTxCompleteCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto&& function) {           //
+                tx_complete_fn_ = std::move(function);
+                return true;
+            }));
+    }
+
+    void reportTxComplete(const PortId subject_id, const std::uint8_t media_index, const TimePoint timestamp)
+    {
+        tx_complete_fn_(TxCompleteCallback::Arg{subject_id, media_index, timestamp});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler        scheduler_{};
+    TrackingMemoryResource                 mr_;
+    cetl::pmr::polymorphic_allocator<void> mr_alloc_{&mr_};
+    StrictMock<TransportMock>              transport_mock_;
+    StrictMock<MessageTxSessionMock>       msg_tx_session_mock_;
+    TxCompleteCallback::Function           tx_complete_fn_;
+    std::vector<std::uint64_t>             published_;
+    // NOLINTEND
+
+};  // TestTimeSyncPublisher
+
+// MARK: - Tests:
+
+TEST_F(TestTimeSyncPublisher, media_tx_timestamps)
+{
+    expectTxCompleteSupport();
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Publisher> publisher;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_publisher = Publisher::make(presentation);
+        ASSERT_THAT(maybe_publisher, VariantWith<Publisher>(_));
+        publisher.emplace(cetl::get<Publisher>(std::move(maybe_publisher)));
+        EXPECT_TRUE(publisher->hasTxTimestamping());
+        ASSERT_TRUE(tx_complete_fn_);
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        // Foreign subjects are ignored; the earliest (redundant media) report wins.
+        reportTxComplete(7509, 0, TimePoint{1s + 200us});
+        reportTxComplete(Message::_traits_::FixedPortId, 1, TimePoint{1s + 300us});
+        reportTxComplete(Message::_traits_::FixedPortId, 0, TimePoint{1s + 400us});
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        reportTxComplete(Message::_traits_::FixedPortId, 0, TimePoint{2s + 150us});
+    });
+    // No report for the 3rd message, so the 4th one should have unknown (zero) previous timestamp.
+    scheduler_.scheduleAt(4s + 1ms, [&](const auto&) {
+        //
+        EXPECT_CALL(transport_mock_, setMessageTxCompleteCallback(_))  //
+            .WillOnce(Invoke([this](auto&& function) {                 //
+                EXPECT_FALSE(function);
+                tx_complete_fn_ = {};
+                return true;
+            }));
+        publisher.reset();
+        EXPECT_FALSE(tx_complete_fn_);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published_, ElementsAre(0U, 1000300U, 2000150U, 0U));
+}
+
+TEST_F(TestTimeSyncPublisher, approximated_tx_timestamps)
+{
+    // Transport (and its media) doesn't support TX completion notifications.
+    EXPECT_CALL(transport_mock_, setMessageTxCompleteCallback(_)).WillRepeatedly(Return(false));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Publisher> publisher;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_publisher = Publisher::make(presentation, {500ms});
+        ASSERT_THAT(maybe_publisher, VariantWith<Publisher>(_));
+        publisher.emplace(cetl::get<Publisher>(std::move(maybe_publisher)));
+        EXPECT_FALSE(publisher->hasTxTimestamping());
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        publisher.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(published_, ElementsAre(0U, 1000000U, 1500000U));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
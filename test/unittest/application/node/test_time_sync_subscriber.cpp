@@ -0,0 +1,297 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/time_sync_subscriber.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/time_provider.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Ge;
+using testing::Le;
+using testing::AllOf;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Local clock which is fully controlled by the test.
+///
+class LocalClock final : public libcyphal::ITimeProvider
+{
+public:
+    LocalClock()  = default;
+    ~LocalClock() = default;
+
+    LocalClock(const LocalClock&)                = delete;
+    LocalClock(LocalClock&&) noexcept            = delete;
+    LocalClock& operator=(const LocalClock&)     = delete;
+    LocalClock& operator=(LocalClock&&) noexcept = delete;
+
+    TimePoint now() const noexcept override
+    {
+        return now_;
+    }
+
+    // NOLINTNEXTLINE
+    TimePoint now_{};
+
+};  // LocalClock
+
+class TestTimeSyncSubscriber : public testing::Test
+{
+protected:
+    using Clock              = node::TimeSyncClock;
+    using Subscriber         = node::TimeSyncSubscriber;
+    using Message            = Subscriber::Message;
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())  //
+            .WillRepeatedly(Return(ProtocolParams{32, 0, 0}));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+        EXPECT_CALL(storage_mock_, copy(0, _, _))                          //
+            .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+                //
+                std::vector<std::uint8_t> buffer(Message::_traits_::SerializationBufferSizeBytes);
+                const auto result = serialize(test_message_, nunavut::support::bitspan{buffer.data(), buffer.size()});
+                const auto size   = std::min(result.value(), len);
+                (void) std::memmove(dst, buffer.data(), size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    void expectSubscription()
+    {
+        constexpr MessageRxParams rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_rx_session_mock_, getParams()).WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {              //
+                msg_rx_cb_fn_ = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(msg_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock_);
+            }));
+    }
+
+    /// Delivers synchronization message of the given master.
+    ///
+    void receive(const NodeId        master_node_id,
+                 const TransferId    transfer_id,
+                 const TimePoint     rx_timestamp,
+                 const std::uint64_t prev_tx_us)
+    {
+        test_message_.previous_transmission_timestamp_microsecond = prev_tx_us;
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer transfer{{{{transfer_id, Priority::Nominal}, rx_timestamp}, master_node_id},
+                                   ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                scheduler_{};
+    TrackingMemoryResource                         mr_;
+    cetl::pmr::polymorphic_allocator<void>         mr_alloc_{&mr_};
+    StrictMock<TransportMock>                      transport_mock_;
+    StrictMock<MessageRxSessionMock>               msg_rx_session_mock_;
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>           storage_mock_;
+    Message                                        test_message_{mr_alloc_};
+    LocalClock                                     local_clock_;
+    // NOLINTEND
+
+};  // TestTimeSyncSubscriber
+
+// MARK: - Tests:
+
+TEST_F(TestTimeSyncSubscriber, clock_step_and_reset)
+{
+    Clock clock{local_clock_};
+
+    // Follows local clock until the very first measurement.
+    local_clock_.now_ = TimePoint{5s};
+    EXPECT_FALSE(clock.isSynchronized());
+    EXPECT_THAT(clock.now(), TimePoint{5s});
+
+    clock.update(TimePoint{5s}, TimePoint{100s});
+    EXPECT_TRUE(clock.isSynchronized());
+    EXPECT_THAT(clock.now(), TimePoint{100s});
+    local_clock_.now_ = TimePoint{6s};
+    EXPECT_THAT(clock.now(), TimePoint{101s});
+
+    // Small error is corrected smoothly - by half of it (Kp = 1/2) and with some rate correction.
+    clock.update(TimePoint{6s}, TimePoint{101s + 100us});
+    EXPECT_THAT(clock.getLastError(), 100us);
+    EXPECT_THAT(clock.toSynchronized(TimePoint{6s}), TimePoint{101s + 50us});
+    EXPECT_THAT(clock.getRatePpb(), 25000);
+
+    // Big error makes the clock to step.
+    clock.update(TimePoint{7s}, TimePoint{200s});
+    EXPECT_THAT(clock.toSynchronized(TimePoint{7s}), TimePoint{200s});
+
+    clock.reset();
+    EXPECT_FALSE(clock.isSynchronized());
+    EXPECT_THAT(clock.getRatePpb(), 0);
+    EXPECT_THAT(clock.now(), TimePoint{6s});
+}
+
+TEST_F(TestTimeSyncSubscriber, clock_converges_with_drift)
+{
+    Clock clock{local_clock_};
+
+    // Local clock runs 100 ppm faster than the master one, and has a big offset.
+    const auto to_local = [](const TimePoint master) {
+        const auto since_epoch = master.time_since_epoch();
+        return TimePoint{5s} + since_epoch + since_epoch / 10000;
+    };
+
+    for (int i = 1; i <= 60; ++i)
+    {
+        const TimePoint master_time{std::chrono::seconds{i}};
+        clock.update(to_local(master_time), master_time);
+    }
+    EXPECT_THAT(clock.getRatePpb(), AllOf(Ge(-105000), Le(-95000)));
+    EXPECT_THAT(clock.getLastError(), AllOf(Ge(-2us), Le(2us)));
+
+    // Free running (without new measurements) for a while stays well below 100us.
+    for (int i = 61; i <= 70; ++i)
+    {
+        const TimePoint master_time{std::chrono::seconds{i}};
+        local_clock_.now_ = to_local(master_time);
+        EXPECT_THAT(clock.now() - master_time, AllOf(Ge(-10us), Le(10us))) << "i=" << i;
+    }
+}
+
+TEST_F(TestTimeSyncSubscriber, measurements_and_master_selection)
+{
+    expectSubscription();
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+    Clock        clock{local_clock_};
+
+    cetl::optional<Subscriber> subscriber;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_subscriber = Subscriber::make(presentation, clock);
+        ASSERT_THAT(maybe_subscriber, VariantWith<Subscriber>(_));
+        subscriber.emplace(cetl::get<Subscriber>(std::move(maybe_subscriber)));
+        EXPECT_THAT(subscriber->getMasterNodeId(), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Master 10: the first message has no previous timestamp;
+        // the second one refers to the first one, but it is not consecutive (by transfer ID).
+        receive(10, 29, TimePoint{2s}, 0);
+        receive(10, 31, TimePoint{3s}, 50'000'000);
+        EXPECT_THAT(subscriber->getMasterNodeId(), Optional(10));
+        EXPECT_FALSE(clock.isSynchronized());
+
+        // Consecutive (with transfer ID wrap around) message gives the first measurement.
+        receive(10, 0, TimePoint{4s}, 51'000'000);
+        EXPECT_TRUE(clock.isSynchronized());
+        EXPECT_THAT(clock.toSynchronized(TimePoint{3s}), TimePoint{51s});
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Master with lower node ID takes over (and the clock is reset).
+        receive(5, 7, TimePoint{5s}, 0);
+        EXPECT_THAT(subscriber->getMasterNodeId(), Optional(5));
+        EXPECT_FALSE(clock.isSynchronized());
+
+        // The previous master is ignored now.
+        receive(10, 3, TimePoint{5s + 100ms}, 52'000'000);
+        EXPECT_FALSE(clock.isSynchronized());
+
+        receive(5, 8, TimePoint{6s}, 700'000'000);
+        EXPECT_THAT(clock.toSynchronized(TimePoint{5s}), TimePoint{700s});
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Master 5 has been silent for too long, so another one is selected.
+        receive(10, 9, TimePoint{9s + 1ms}, 57'000'000);
+        EXPECT_THAT(subscriber->getMasterNodeId(), Optional(10));
+        EXPECT_FALSE(clock.isSynchronized());
+
+        // Anonymous publishers are ignored.
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer anonymous{{{{10, Priority::Nominal}, TimePoint{9s + 2ms}}, cetl::nullopt},
+                                    ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({anonymous});
+        EXPECT_FALSE(clock.isSynchronized());
+
+        receive(10, 10, TimePoint{10s}, 58'000'000);
+        EXPECT_THAT(clock.toSynchronized(TimePoint{9s + 1ms}), TimePoint{58s});
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        subscriber.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
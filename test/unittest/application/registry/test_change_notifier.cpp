@@ -0,0 +1,303 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/change_notifier.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the unit tests.
+
+using testing::Eq;
+using testing::IsEmpty;
+using testing::ElementsAre;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestChangeNotifier : public testing::Test
+{
+protected:
+    using Changes = std::vector<std::tuple<TimePoint, std::string>>;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    IRegister::Value makeUInt16Value(const std::uint16_t value) const
+    {
+        IRegister::Value reg_value{alloc_};
+        reg_value.set_natural16().value.push_back(value);
+        return reg_value;
+    }
+
+    static ChangeNotifier::ObserverCallback::Function makeRecorder(Changes& changes)
+    {
+        return [&changes](const auto& arg) {
+            //
+            const auto name = arg.reg.getName();
+            changes.emplace_back(arg.approx_now, std::string{name.data(), name.size()});
+        };
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler  scheduler_{};
+    TrackingMemoryResource           mr_;
+    IRegister::Value::allocator_type alloc_{&mr_};
+    // NOLINTEND
+
+};  // TestChangeNotifier
+
+// MARK: - Tests:
+
+TEST_F(TestChangeNotifier, exact_and_prefix_observers)
+{
+    Registry rgy{mr_};
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    const auto getter = [this] { return makeUInt16Value(0); };
+    auto       r_pub1 = rgy.route("uavcan.pub.a.id", getter, setter);
+    auto       r_pub2 = rgy.route("uavcan.pub.b.id", getter, setter);
+    auto       r_sub1 = rgy.route("uavcan.sub.a.id", getter, setter);
+    auto       r_ro   = rgy.route("uavcan.pub.c.id", getter);
+
+    ChangeNotifier notifier{scheduler_, rgy};
+
+    Changes    all_changes;
+    Changes    pub_changes;
+    Changes    sub_changes;
+    const auto all_observer = notifier.observePrefix("", makeRecorder(all_changes));
+    const auto pub_observer = notifier.observePrefix("uavcan.pub.", makeRecorder(pub_changes));
+    const auto sub_observer = notifier.observe("uavcan.sub.a.id", makeRecorder(sub_changes));
+    EXPECT_THAT(pub_observer.getName(), Eq("uavcan.pub."));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // A burst of changes is batched into a single round on the next spin,
+        // and repeated changes of the same register are coalesced.
+        EXPECT_THAT(rgy.set("uavcan.pub.a.id", makeUInt16Value(1)), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.set("uavcan.pub.a.id", makeUInt16Value(2)), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.set("uavcan.sub.a.id", makeUInt16Value(3)), Eq(cetl::nullopt));
+        EXPECT_TRUE(notifier.isPending());
+        EXPECT_THAT(all_changes, IsEmpty());
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_FALSE(notifier.isPending());
+
+        // Failed sets are not reported.
+        EXPECT_THAT(rgy.set("uavcan.pub.c.id", makeUInt16Value(4)), Eq(SetError::Mutability));
+        EXPECT_THAT(rgy.set("uavcan.pub.x.id", makeUInt16Value(4)), Eq(SetError::Existence));
+        EXPECT_FALSE(notifier.isPending());
+
+        EXPECT_THAT(rgy.set("uavcan.pub.b.id", makeUInt16Value(5)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(pub_changes,
+                ElementsAre(std::make_tuple(TimePoint{1s}, "uavcan.pub.a.id"),
+                            std::make_tuple(TimePoint{2s}, "uavcan.pub.b.id")));
+    EXPECT_THAT(sub_changes, ElementsAre(std::make_tuple(TimePoint{1s}, "uavcan.sub.a.id")));
+    EXPECT_THAT(all_changes.size(), 3);
+}
+
+TEST_F(TestChangeNotifier, nested_prefixes)
+{
+    Registry rgy{mr_};
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    const auto getter = [this] { return makeUInt16Value(0); };
+    auto       r_a_id = rgy.route("uavcan.pub.a.id", getter, setter);
+    auto       r_pa   = rgy.route("uavcan.pa", getter, setter);
+
+    ChangeNotifier notifier{scheduler_, rgy};
+
+    std::vector<std::string> calls;
+    const auto               make_observer = [&calls](const std::string& label) {
+        //
+        return [&calls, label](const auto& arg) {
+            //
+            const auto name = arg.reg.getName();
+            calls.push_back(label + ":" + std::string{name.data(), name.size()});
+        };
+    };
+    const auto o1 = notifier.observePrefix("uavcan.", make_observer("o1"));
+    const auto o2 = notifier.observePrefix("uavcan.pub.a.id", make_observer("o2"));
+    const auto o3 = notifier.observePrefix("uavcan.pub.b", make_observer("o3"));
+    const auto o4 = notifier.observePrefix("uavcan.pub.", make_observer("o4"));
+    const auto o5 = notifier.observe("uavcan.pub.a.id", make_observer("o5"));
+    const auto o6 = notifier.observePrefix("uavcan.pub.", make_observer("o6"));
+    const auto o7 = notifier.observePrefix("uavcan.p", make_observer("o7"));
+    const auto o8 = notifier.observe("uavcan.pub.", make_observer("o8"));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("uavcan.pub.a.id", makeUInt16Value(1)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("uavcan.pa", makeUInt16Value(2)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    // Exact observers first, then prefix ones - from the longest prefix to the shortest one.
+    EXPECT_THAT(calls,
+                ElementsAre("o5:uavcan.pub.a.id",
+                            "o2:uavcan.pub.a.id",
+                            "o4:uavcan.pub.a.id",
+                            "o6:uavcan.pub.a.id",
+                            "o7:uavcan.pub.a.id",
+                            "o1:uavcan.pub.a.id",
+                            "o7:uavcan.pa",
+                            "o1:uavcan.pa"));
+}
+
+TEST_F(TestChangeNotifier, no_changes_without_notifier)
+{
+    Registry rgy{mr_};
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("a", [this] { return makeUInt16Value(0); }, setter);
+    auto       r_b    = rgy.route("b", [this] { return makeUInt16Value(0); }, setter);
+
+    // Changes made while there is no notifier are not tracked at all.
+    EXPECT_THAT(rgy.set("a", makeUInt16Value(1)), Eq(cetl::nullopt));
+    {
+        ChangeNotifier notifier{scheduler_, rgy};
+        EXPECT_THAT(rgy.set("a", makeUInt16Value(2)), Eq(cetl::nullopt));
+        EXPECT_TRUE(notifier.isPending());
+    }
+
+    ChangeNotifier notifier{scheduler_, rgy};
+
+    Changes    changes;
+    const auto observer = notifier.observePrefix("", makeRecorder(changes));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("b", makeUInt16Value(3)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(changes, ElementsAre(std::make_tuple(TimePoint{1s}, "b")));
+}
+
+TEST_F(TestChangeNotifier, observer_lifetime)
+{
+    Registry rgy{mr_};
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("a", [this] { return makeUInt16Value(0); }, setter);
+
+    ChangeNotifier notifier{scheduler_, rgy};
+
+    Changes changes;
+    auto    observer = notifier.observe("a", makeRecorder(changes));
+    {
+        Changes    other_changes;
+        const auto other_observer = notifier.observe("a", makeRecorder(other_changes));
+
+        scheduler_.scheduleAt(1s, [&](const auto&) {
+            //
+            EXPECT_THAT(rgy.set("a", makeUInt16Value(1)), Eq(cetl::nullopt));
+        });
+        scheduler_.spinFor(1s + 1ms);
+        EXPECT_THAT(other_changes, ElementsAre(std::make_tuple(TimePoint{1s}, "a")));
+    }
+
+    // Moved observer stays active; destroyed one is not called anymore.
+    const auto moved_observer{std::move(observer)};
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("a", makeUInt16Value(2)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(changes,
+                ElementsAre(std::make_tuple(TimePoint{1s}, "a"),  //
+                            std::make_tuple(TimePoint{2s}, "a")));
+}
+
+TEST_F(TestChangeNotifier, set_from_observer)
+{
+    Registry rgy{mr_};
+
+    std::uint16_t value_a = 0;
+    std::uint16_t value_b = 0;
+    auto          r_a     = rgy.route(
+        "a",
+        [this, &value_a] { return makeUInt16Value(value_a); },
+        [&value_a](const IRegister::Value& value) -> cetl::optional<SetError> {
+            value_a = value.get_natural16_if()->value.front();
+            return cetl::nullopt;
+        });
+    auto r_b = rgy.route(
+        "b",
+        [this, &value_b] { return makeUInt16Value(value_b); },
+        [&value_b](const IRegister::Value& value) -> cetl::optional<SetError> {
+            value_b = value.get_natural16_if()->value.front();
+            return cetl::nullopt;
+        });
+
+    ChangeNotifier notifier{scheduler_, rgy};
+
+    // "b" follows "a" - changes made from within an observer are reported as well.
+    Changes    changes;
+    const auto follower = notifier.observe("a", [&](const auto& arg) {
+        //
+        EXPECT_THAT(rgy.set("b", arg.reg.get().value), Eq(cetl::nullopt));
+    });
+    const auto observer = notifier.observe("b", makeRecorder(changes));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("a", makeUInt16Value(7)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(value_b, 7);
+    ASSERT_THAT(changes.size(), 1);
+    EXPECT_THAT(std::get<1>(changes.front()), "b");
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,428 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "platform/storage_key_value_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/deferred_saver.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::SizeIs;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
+
+class TestDeferredSaver : public testing::Test
+{
+protected:
+    using StorageError = libcyphal::platform::storage::Error;
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    IRegister::Value makeUInt8Value(const std::uint8_t value) const
+    {
+        IRegister::Value reg_value{alloc_};
+        reg_value.set_natural8().value.push_back(value);
+        return reg_value;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler  scheduler_{};
+    TrackingMemoryResource           mr_;
+    IRegister::Value::allocator_type alloc_{&mr_};
+    // NOLINTEND
+
+};  // TestDeferredSaver
+
+// MARK: - Tests:
+
+TEST_F(TestDeferredSaver, coalesces_burst_of_writes)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    std::uint8_t value_a = 0;
+    const auto   setter  = [&value_a](const IRegister::Value& value) -> cetl::optional<SetError> {
+        value_a = value.get_natural8_if()->value.front();
+        return cetl::nullopt;
+    };
+    auto r_a = rgy.route("A", [this, &value_a] { return makeUInt8Value(value_a); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 100ms};
+    EXPECT_FALSE(saver.isPending());
+
+    std::vector<std::tuple<TimePoint, std::uint8_t>> puts;
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _))  //
+        .WillRepeatedly(Invoke([&](const auto, const auto data) {
+            puts.emplace_back(now(), data[data.size() - 1]);
+            return cetl::nullopt;
+        }));
+
+    // A burst of 3 writes (within the delay) results in a single save of the latest value.
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(1)), Eq(cetl::nullopt));
+        EXPECT_TRUE(saver.isPending());
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(2)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 50ms, [&](const auto&) {
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(3)), Eq(cetl::nullopt));
+    });
+    // Another write after the save.
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        EXPECT_FALSE(saver.isPending());
+        EXPECT_FALSE(r_a.isDirty());
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(4)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(puts,
+                ElementsAre(std::make_tuple(TimePoint{1s + 100ms}, 3),  //
+                            std::make_tuple(TimePoint{2s + 100ms}, 4)));
+    EXPECT_THAT(saver.lastError(), Eq(cetl::nullopt));
+}
+
+TEST_F(TestDeferredSaver, flush_and_failures)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("A", [this] { return makeUInt8Value(7); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 100ms};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+        EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _)).WillOnce(Return(StorageError::IO));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(saver.lastError(), Optional(StorageError::IO));
+        EXPECT_TRUE(r_a.isDirty());
+
+        // Explicit flush retries the failed one immediately.
+        EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _)).WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(saver.flush(), Eq(cetl::nullopt));
+        EXPECT_FALSE(r_a.isDirty());
+        EXPECT_THAT(saver.lastError(), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Flush before the deferred save makes the latter a no-op.
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+        EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _)).WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(saver.flush(), Eq(cetl::nullopt));
+        EXPECT_FALSE(saver.isPending());
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestDeferredSaver, chunked_by_time_budget)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("A", [this] { return makeUInt8Value(1); }, setter, {true});
+    auto       r_b    = rgy.route("B", [this] { return makeUInt8Value(2); }, setter, {true});
+    auto       r_c    = rgy.route("C", [this] { return makeUInt8Value(3); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 100ms, 10ms};
+
+    std::vector<std::tuple<TimePoint, cetl::optional<StorageError>>> completions;
+    saver.setCompletionCallback([&completions](const auto& arg) {
+        //
+        completions.emplace_back(arg.approx_now, arg.error);
+    });
+
+    // Every `put` takes 6ms, so only 2 registers fit into the 10ms budget of a chunk.
+    std::vector<TimePoint> put_times;
+    EXPECT_CALL(key_value_mock, put(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto, const auto) {
+            put_times.push_back(now());
+            scheduler_.setNow(now() + 6ms);
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.set("B", makeUInt8Value(0)), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.set("C", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(put_times,
+                ElementsAre(TimePoint{1s + 100ms},    // 1st chunk
+                            TimePoint{1s + 106ms},    // 1st chunk
+                            TimePoint{1s + 112ms}));  // 2nd chunk
+    EXPECT_THAT(completions, ElementsAre(std::make_tuple(TimePoint{1s + 118ms}, cetl::nullopt)));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_FALSE(r_b.isDirty());
+    EXPECT_FALSE(r_c.isDirty());
+}
+
+TEST_F(TestDeferredSaver, modified_during_round)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("A", [this] { return makeUInt8Value(1); }, setter, {true});
+    auto       r_b    = rgy.route("B", [this] { return makeUInt8Value(2); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 100ms, 1ms};
+
+    std::vector<TimePoint> completions;
+    saver.setCompletionCallback([&completions](const auto& arg) { completions.push_back(arg.approx_now); });
+
+    // Every `put` takes 1ms, so there is one register per chunk. The first stored register is modified again
+    // while the second one is being stored (already passed by the round) - so, it needs another round.
+    std::vector<std::string> put_names;
+    EXPECT_CALL(key_value_mock, put(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto key, const auto) {
+            put_names.emplace_back(key.data(), key.size());
+            if (put_names.size() == 2)
+            {
+                const IRegister::Name first_name{put_names.front().data(), put_names.front().size()};
+                EXPECT_THAT(rgy.set(first_name, makeUInt8Value(0)), Eq(cetl::nullopt));
+            }
+            scheduler_.setNow(now() + 1ms);
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.set("B", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    ASSERT_THAT(put_names, SizeIs(3));
+    EXPECT_THAT(put_names[2], put_names[0]);
+    EXPECT_THAT(completions, ElementsAre(TimePoint{1s + 102ms}, TimePoint{1s + 203ms}));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_FALSE(r_b.isDirty());
+    EXPECT_FALSE(saver.isPending());
+}
+
+TEST_F(TestDeferredSaver, retries_failed_round)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("A", [this] { return makeUInt8Value(1); }, setter, {true});
+    auto       r_b    = rgy.route("B", [this] { return makeUInt8Value(2); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 100ms};
+
+    std::vector<std::tuple<TimePoint, cetl::optional<StorageError>>> completions;
+    saver.setCompletionCallback([&completions](const auto& arg) {
+        //
+        completions.emplace_back(arg.approx_now, arg.error);
+    });
+
+    // The very first `put` fails (f.e. a transient I/O error), but there are no further modifications,
+    // so it's up to the saver to retry (by default in 1s).
+    std::vector<TimePoint> put_times;
+    EXPECT_CALL(key_value_mock, put(_, _))  //
+        .WillOnce(Invoke([&](const auto, const auto) -> cetl::optional<StorageError> {
+            put_times.push_back(now());
+            return StorageError::IO;
+        }))
+        .WillRepeatedly(Invoke([&](const auto, const auto) -> cetl::optional<StorageError> {
+            put_times.push_back(now());
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.set("B", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 500ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(saver.isPending());
+        EXPECT_THAT(saver.lastError(), Optional(StorageError::IO));
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(put_times, ElementsAre(TimePoint{1s + 100ms}, TimePoint{2s + 100ms}, TimePoint{2s + 100ms}));
+    EXPECT_THAT(completions,
+                ElementsAre(std::make_tuple(TimePoint{1s + 100ms}, cetl::optional<StorageError>{StorageError::IO}),
+                            std::make_tuple(TimePoint{2s + 100ms}, cetl::nullopt)));
+    EXPECT_THAT(saver.lastError(), Eq(cetl::nullopt));
+    EXPECT_FALSE(saver.isPending());
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_FALSE(r_b.isDirty());
+}
+
+TEST_F(TestDeferredSaver, retry_backoff)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("A", [this] { return makeUInt8Value(1); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 100ms};
+    saver.setRetryPolicy(1s, 3s);
+
+    // 4 failures in a row - the retry delay doubles (1s, 2s) until it's capped (3s).
+    std::vector<TimePoint> put_times;
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _))  //
+        .WillRepeatedly(Invoke([&](const auto, const auto) -> cetl::optional<StorageError> {
+            put_times.push_back(now());
+            if (put_times.size() <= 4)
+            {
+                return StorageError::Capacity;
+            }
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(20s);
+
+    EXPECT_THAT(put_times,
+                ElementsAre(TimePoint{1s + 100ms},
+                            TimePoint{2s + 100ms},
+                            TimePoint{4s + 100ms},
+                            TimePoint{7s + 100ms},
+                            TimePoint{10s + 100ms}));
+    EXPECT_THAT(saver.lastError(), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+
+    // Successful round resets the backoff; zero retry delay disables retries.
+    saver.setRetryPolicy(0s, 0s);
+    put_times.clear();
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _))  //
+        .WillOnce(Invoke([&](const auto, const auto) -> cetl::optional<StorageError> {
+            put_times.push_back(now());
+            return StorageError::IO;
+        }));
+    EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+    scheduler_.spinFor(20s);
+
+    EXPECT_THAT(put_times, ElementsAre(TimePoint{20s + 100ms}));
+    EXPECT_THAT(saver.lastError(), Optional(StorageError::IO));
+    EXPECT_FALSE(saver.isPending());
+    EXPECT_TRUE(r_a.isDirty());
+}
+
+TEST_F(TestDeferredSaver, modified_during_retry_backoff)
+{
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto       r_a    = rgy.route("A", [this] { return makeUInt8Value(1); }, setter, {true});
+
+    DeferredSaver saver{scheduler_, key_value_mock, rgy, 2s};
+    saver.setRetryPolicy(10s, 10s);
+
+    // The 1st and the 3rd `put`s fail.
+    std::vector<TimePoint> put_times;
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, _))  //
+        .WillRepeatedly(Invoke([&](const auto, const auto) -> cetl::optional<StorageError> {
+            put_times.push_back(now());
+            if ((put_times.size() == 1) || (put_times.size() == 3))
+            {
+                return StorageError::IO;
+            }
+            return cetl::nullopt;
+        }));
+
+    // Failed round at 3s schedules a retry at 13s, but a fresh modification at 4s
+    // brings it forward to the regular delay - so the new value is saved at 6s.
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        EXPECT_TRUE(saver.isPending());
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    // Failed round at 12s schedules a retry at 13s, which is sooner than the regular delay
+    // for a modification at 12.5s - so the retry time is kept.
+    scheduler_.scheduleAt(10s, [&](const auto&) {
+        //
+        EXPECT_FALSE(saver.isPending());
+        saver.setRetryPolicy(1s, 1s);
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(12s + 500ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(saver.isPending());
+        EXPECT_THAT(rgy.set("A", makeUInt8Value(0)), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(30s);
+
+    EXPECT_THAT(put_times, ElementsAre(TimePoint{3s}, TimePoint{6s}, TimePoint{12s}, TimePoint{13s}));
+    EXPECT_THAT(saver.lastError(), Eq(cetl::nullopt));
+    EXPECT_FALSE(saver.isPending());
+    EXPECT_FALSE(r_a.isDirty());
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
+
+}  // namespace
@@ -0,0 +1,294 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "platform/storage_key_value_mock.hpp"
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/flat_registry.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/common/crc.hpp>
+#include <libcyphal/platform/storage.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+
+namespace
+{
+
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::UnorderedElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
+
+// NOLINTNEXTLINE(*-avoid-c-arrays)
+constexpr FlatRegisterDecl TestDecls[] = {
+    {"uavcan.node.id", FlatValueKind::Natural16, 1, {true, true}},
+    {"uavcan.node.description", FlatValueKind::String, 16, {true, true}},
+    {"app.gains", FlatValueKind::Real32, 3, {true, false}},
+    {"app.enabled", FlatValueKind::Bit, 1, {true, true}},
+    {"app.offset", FlatValueKind::Integer64, 1, {true, true}},
+    {"app.version", FlatValueKind::Natural8, 2, {false, false}},
+};
+constexpr auto TestTable = makeFlatTable(TestDecls);
+static_assert(TestTable.isValid(), "");
+static_assert(TestTable.size() == 6, "");
+static_assert(TestTable[0].key < TestTable[1].key, "Entries should be sorted by key at compile time.");
+
+// NOLINTNEXTLINE(*-avoid-c-arrays)
+constexpr FlatRegisterDecl DuplicateDecls[] = {
+    {"a", FlatValueKind::Bit, 1, {}},
+    {"b", FlatValueKind::Bit, 1, {}},
+    {"a", FlatValueKind::Natural8, 1, {}},
+};
+static_assert(!makeFlatTable(DuplicateDecls).isValid(), "Duplicate names should be detected at compile time.");
+
+using TestRegistry = FlatRegistry<TestTable.size(), TestTable.storageSize()>;
+
+class TestFlatRegistry : public testing::Test
+{
+protected:
+    using StorageError = libcyphal::platform::storage::Error;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    IRegister::Value makeEmptyValue() const
+    {
+        return IRegister::Value{alloc_};
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource           mr_;
+    IRegister::Value::allocator_type alloc_{&mr_};
+    // NOLINTEND
+
+};  // TestFlatRegistry
+
+// MARK: - Tests:
+
+TEST_F(TestFlatRegistry, table_prepared_at_compile_time)
+{
+    std::uint64_t prev_key = 0;
+    std::size_t   prev_end = 0;
+    for (std::size_t index = 0; index < TestTable.size(); ++index)
+    {
+        const auto& entry = TestTable[index];
+
+        // Compile-time hash should be the same as the runtime one (used by the regular registry).
+        const std::string name{entry.name, entry.name_size};
+        EXPECT_THAT(entry.key, libcyphal::common::CRC64WE(name.data(), name.data() + name.size()).get()) << name;
+        EXPECT_THAT(TestTable.find(name), index);
+
+        EXPECT_TRUE((index == 0) || (entry.key > prev_key));
+        EXPECT_THAT(entry.offset % TestTable.elementSize(entry.kind), 0) << "Should be naturally aligned.";
+        EXPECT_TRUE(entry.offset >= prev_end) << "Should not overlap.";
+        prev_key = entry.key;
+        prev_end = entry.offset + (entry.capacity * TestTable.elementSize(entry.kind));
+    }
+    EXPECT_THAT(TestTable.storageSize(), prev_end);
+    EXPECT_THAT(TestTable.find("app"), TestTable.size());
+    EXPECT_THAT(TestTable.find(""), TestTable.size());
+}
+
+TEST_F(TestFlatRegistry, size_and_index)
+{
+    TestRegistry rgy{mr_, TestTable};
+
+    EXPECT_THAT(rgy.size(), 6);
+
+    // The set of registers is fixed.
+    auto r_extra = makeRegister(mr_, "extra", [this] { return makeEmptyValue(); });
+    EXPECT_FALSE(rgy.append(r_extra));
+    EXPECT_FALSE(r_extra.isLinked());
+
+    std::set<std::string> names;
+    for (std::size_t index = 0; index < rgy.size(); ++index)
+    {
+        const auto name = rgy.index(index);
+        names.emplace(name.data(), name.size());
+        EXPECT_THAT(rgy.find(name), index);
+    }
+    EXPECT_THAT(rgy.index(rgy.size()), IsEmpty());
+    EXPECT_THAT(names,
+                UnorderedElementsAre("uavcan.node.id",
+                                     "uavcan.node.description",
+                                     "app.gains",
+                                     "app.enabled",
+                                     "app.offset",
+                                     "app.version"));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestFlatRegistry, get_set)
+{
+    TestRegistry rgy{mr_, TestTable};
+
+    // Initial values.
+    {
+        const auto node_id = rgy.get("uavcan.node.id");
+        ASSERT_TRUE(node_id);
+        EXPECT_TRUE(node_id->flags._mutable);
+        EXPECT_TRUE(node_id->flags.persistent);
+        ASSERT_TRUE(node_id->value.get_natural16_if());
+        EXPECT_THAT(node_id->value.get_natural16_if()->value, ElementsAre(0));
+
+        const auto description = rgy.get("uavcan.node.description");
+        ASSERT_TRUE(description);
+        ASSERT_TRUE(description->value.get_string_if());
+        EXPECT_THAT(description->value.get_string_if()->value, IsEmpty());
+
+        const auto version = rgy.get("app.version");
+        ASSERT_TRUE(version);
+        EXPECT_FALSE(version->flags._mutable);
+        EXPECT_FALSE(version->flags.persistent);
+
+        EXPECT_FALSE(rgy.get("unknown"));
+    }
+
+    // Set via the registry interface.
+    {
+        auto value = makeEmptyValue();
+        value.set_natural16().value.push_back(42);
+        EXPECT_THAT(rgy.set("uavcan.node.id", value), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.read<std::uint16_t>(rgy.find("uavcan.node.id")), 42);
+
+        auto gains = makeEmptyValue();
+        auto& gains_array = gains.set_real32().value;
+        gains_array.push_back(1.5F);
+        gains_array.push_back(2.5F);
+        gains_array.push_back(3.5F);
+        EXPECT_THAT(rgy.set("app.gains", gains), Eq(cetl::nullopt));
+        const auto gains_index = rgy.find("app.gains");
+        EXPECT_THAT(rgy.read<float>(gains_index, 0), 1.5F);
+        EXPECT_THAT(rgy.read<float>(gains_index, 2), 3.5F);
+
+        auto description = makeEmptyValue();
+        auto& description_str = description.set_string().value;
+        description_str.push_back('a');
+        description_str.push_back('b');
+        description_str.push_back('c');
+        EXPECT_THAT(rgy.set("uavcan.node.description", description), Eq(cetl::nullopt));
+        EXPECT_THAT(rgy.readString(rgy.find("uavcan.node.description")), "abc");
+
+        auto enabled = makeEmptyValue();
+        enabled.set_bit().value.push_back(true);
+        EXPECT_THAT(rgy.set("app.enabled", enabled), Eq(cetl::nullopt));
+        EXPECT_TRUE(rgy.read<bool>(rgy.find("app.enabled")));
+    }
+
+    // Set failures.
+    {
+        auto value = makeEmptyValue();
+        value.set_natural16().value.push_back(7);
+        EXPECT_THAT(rgy.set("unknown", value), Optional(SetError::Existence));
+        EXPECT_THAT(rgy.set("app.version", value), Optional(SetError::Mutability));
+
+        // Wrong kind.
+        EXPECT_THAT(rgy.set("app.offset", value), Optional(SetError::Semantics));
+        EXPECT_THAT(rgy.set("uavcan.node.id", makeEmptyValue()), Optional(SetError::Semantics));
+
+        // Wrong number of elements.
+        auto& pair = value.set_natural16().value;
+        pair.push_back(1);
+        pair.push_back(2);
+        EXPECT_THAT(rgy.set("uavcan.node.id", value), Optional(SetError::Semantics));
+        auto& long_str = value.set_string().value;
+        for (std::size_t i = 0; i < 17; ++i)
+        {
+            long_str.push_back('x');
+        }
+        EXPECT_THAT(rgy.set("uavcan.node.description", value), Optional(SetError::Semantics));
+
+        // Nothing has changed.
+        EXPECT_THAT(rgy.read<std::uint16_t>(rgy.find("uavcan.node.id")), 42);
+        EXPECT_THAT(rgy.readString(rgy.find("uavcan.node.description")), "abc");
+    }
+
+    // Application side access.
+    {
+        const auto offset_index = rgy.find("app.offset");
+        rgy.write<std::int64_t>(offset_index, -123456789012LL);
+        const auto offset = rgy.get("app.offset");
+        ASSERT_TRUE(offset);
+        ASSERT_TRUE(offset->value.get_integer64_if());
+        EXPECT_THAT(offset->value.get_integer64_if()->value, ElementsAre(-123456789012LL));
+
+        // Immutable for the registry users, but not for the application.
+        const auto version_index = rgy.find("app.version");
+        rgy.write<std::uint8_t>(version_index, 1, 0);
+        rgy.write<std::uint8_t>(version_index, 2, 1);
+        const auto version = rgy.get("app.version");
+        ASSERT_TRUE(version);
+        EXPECT_THAT(version->value.get_natural8_if()->value, ElementsAre(1, 2));
+
+        const auto description_index = rgy.find("uavcan.node.description");
+        EXPECT_TRUE(rgy.writeString(description_index, "my node"));
+        EXPECT_FALSE(rgy.writeString(description_index, "this one is way too long"));
+        EXPECT_THAT(rgy.readString(description_index), "my node");
+    }
+}
+
+TEST_F(TestFlatRegistry, save_load)
+{
+    StrictMock<libcyphal::platform::storage::KeyValueMock> kv_mock;
+
+    TestRegistry rgy{mr_, TestTable};
+    rgy.write<std::uint16_t>(rgy.find("uavcan.node.id"), 42);
+
+    // Only persistent mutable registers are saved.
+    std::set<std::string> saved_names;
+    EXPECT_CALL(kv_mock, put(_, _)).WillRepeatedly(Invoke([&saved_names](const auto key, const auto) {
+        saved_names.emplace(key.data(), key.size());
+        return cetl::nullopt;
+    }));
+    EXPECT_THAT(save(kv_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_THAT(saved_names,
+                UnorderedElementsAre("uavcan.node.id", "uavcan.node.description", "app.enabled", "app.offset"));
+
+    // Natural16 value `[43]` stored for the node id only.
+    EXPECT_CALL(kv_mock, get(_, _)).WillRepeatedly(Return(StorageError::Existence));
+    EXPECT_CALL(kv_mock, get(IRegister::Name{"uavcan.node.id"}, _))  //
+        .WillOnce(Invoke([](const auto, auto data) {
+            // Natural16 tag, u16 length of 1, then the value.
+            constexpr std::uint8_t            Tag = IRegister::Value::VariantType::IndexOf::natural16;
+            const std::array<std::uint8_t, 5> serialized{Tag, 1, 0, 43, 0};
+            std::copy(serialized.begin(), serialized.end(), data.begin());
+            return serialized.size();
+        }));
+    EXPECT_THAT(load(kv_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_THAT(rgy.read<std::uint16_t>(rgy.find("uavcan.node.id")), 43);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
+
+}  // namespace
@@ -168,6 +168,82 @@ TEST_F(TestRegister, makeRegister_set_failure)
     EXPECT_THAT(r_int32.set(makeInt32Value({13})), Optional(SetError::Semantics));
 }
 
+TEST_F(TestRegister, makeRegister_scalar_getters)
+{
+    std::uint16_t     nat16 = 42;
+    cetl::string_view str   = "abc";
+
+    auto r_nat16 = makeRegister(mr_, "nat16", [&nat16] { return nat16; });
+    auto r_str   = makeRegister(
+        mr_,
+        "str",
+        [&str] { return str; },
+        [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; });
+    auto r_real = makeRegister(mr_, "real", [] { return 0.5F; });
+
+    const auto nat16_result = r_nat16.get();
+    EXPECT_FALSE(nat16_result.flags._mutable);
+    ASSERT_TRUE(nat16_result.value.is_natural16());
+    EXPECT_THAT(nat16_result.value.get_natural16().value, ElementsAre(42));
+
+    const auto str_result = r_str.get();
+    EXPECT_TRUE(str_result.flags._mutable);
+    ASSERT_TRUE(str_result.value.is_string());
+    EXPECT_THAT(makeStringView(str_result.value.get_string().value), "abc");
+
+    const auto real_result = r_real.get();
+    ASSERT_TRUE(real_result.value.is_real32());
+    EXPECT_THAT(real_result.value.get_real32().value, ElementsAre(0.5F));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestRegister, makeRegister_getInto_reuses_value)
+{
+    std::uint16_t     nat16 = 42;
+    cetl::string_view str   = "abc";
+
+    auto r_nat16 = makeRegister(mr_, "nat16", [&nat16] { return nat16; });
+    auto r_str   = makeRegister(mr_, "str", [&str] { return str; }, {true});
+    auto r_bits  = makeRegister(mr_, "bits", [this] { return makeBitValue({true, false}); });
+
+    IRegister::Value value{alloc_};
+
+    // The very first get allocates the array, but the following ones just refill it.
+    {
+        const auto flags = r_nat16.getInto(value);
+        EXPECT_FALSE(flags._mutable);
+        EXPECT_FALSE(flags.persistent);
+        ASSERT_TRUE(value.is_natural16());
+        EXPECT_THAT(value.get_natural16().value, ElementsAre(42));
+    }
+    const auto allocated_bytes = mr_.total_allocated_bytes;
+    for (std::uint16_t i = 0; i < 100; ++i)
+    {
+        nat16 = i;
+        (void) r_nat16.getInto(value);
+        EXPECT_THAT(value.get_natural16().value, ElementsAre(i));
+    }
+    EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+
+    // Another alternative - has to be emplaced (and so allocated) again.
+    {
+        const auto flags = r_str.getInto(value);
+        EXPECT_TRUE(flags.persistent);
+        ASSERT_TRUE(value.is_string());
+        EXPECT_THAT(makeStringView(value.get_string().value), "abc");
+    }
+    const auto str_allocated_bytes = mr_.total_allocated_bytes;
+    str = "xy";
+    (void) r_str.getInto(value);
+    EXPECT_THAT(makeStringView(value.get_string().value), "xy");
+    EXPECT_THAT(mr_.total_allocated_bytes, str_allocated_bytes);
+
+    // Whole value getters are still supported.
+    (void) r_bits.getInto(value);
+    ASSERT_TRUE(value.is_bit());
+    EXPECT_THAT(value.get_bit().value, ElementsAre(true, false));
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
 
 }  // namespace
@@ -21,6 +21,11 @@
 #include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
 
 namespace
 {
@@ -35,6 +40,10 @@ using testing::IsEmpty;
 using testing::Optional;
 using testing::StrictMock;
 using testing::ElementsAre;
+using testing::Not;
+using testing::SizeIs;
+using testing::Contains;
+using testing::UnorderedElementsAre;
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
 
@@ -175,6 +184,51 @@ TEST_F(TestRegistry, lifetime)
     EXPECT_THAT(rgy.get("bool"), Eq(cetl::nullopt));
 }
 
+TEST_F(TestRegistry, index_many)
+{
+    Registry rgy{mr_};
+
+    const auto getter = [this] { return IRegister::Value{alloc_}; };
+    using Reg         = decltype(rgy.route("", getter));
+
+    constexpr std::size_t    Count = 100;
+    std::vector<std::string> names;
+    std::list<Reg>           regs;
+    names.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        names.push_back("reg." + std::to_string(i));
+        regs.push_back(rgy.route(names.back(), getter));
+        EXPECT_TRUE(regs.back().isLinked());
+        EXPECT_THAT(rgy.size(), i + 1);
+    }
+
+    // Every register should be reachable by its index exactly once.
+    std::set<std::string> indexed_names;
+    for (std::size_t i = 0; i < rgy.size(); ++i)
+    {
+        const auto name = rgy.index(i);
+        EXPECT_THAT(name, Not(IsEmpty()));
+        indexed_names.emplace(name.data(), name.size());
+    }
+    EXPECT_THAT(indexed_names, SizeIs(Count));
+    EXPECT_THAT(rgy.index(Count), IsEmpty());
+
+    // Removal of registers should keep indices dense.
+    regs.erase(std::next(regs.begin(), 10), std::next(regs.begin(), 60));
+    EXPECT_THAT(rgy.size(), Count - 50);
+    indexed_names.clear();
+    for (std::size_t i = 0; i < rgy.size(); ++i)
+    {
+        const auto name = rgy.index(i);
+        indexed_names.emplace(name.data(), name.size());
+    }
+    EXPECT_THAT(indexed_names, SizeIs(Count - 50));
+    EXPECT_THAT(indexed_names, Not(Contains("reg.10")));
+    EXPECT_THAT(indexed_names, Contains("reg.60"));
+    EXPECT_THAT(rgy.index(Count - 50), IsEmpty());
+}
+
 TEST_F(TestRegistry, empty_set)
 {
     Registry rgy{mr_};
@@ -528,6 +582,273 @@ TEST_F(TestRegistry, save_failures)
     EXPECT_THAT(save(key_value_mock, rgy_mock), Optional(StorageError::IO));
 }
 
+TEST_F(TestRegistry, load_save_with_value_storage)
+{
+    using RegistryMock = StrictMock<IntrospectableRegistryMock>;
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    RegistryMock rgy_mock;
+    KeyValueMock key_value_mock;
+
+    EXPECT_CALL(rgy_mock, size()).WillRepeatedly(Return(2));
+    EXPECT_CALL(rgy_mock, index(0)).WillRepeatedly(Return("A"));
+    EXPECT_CALL(rgy_mock, index(1)).WillRepeatedly(Return("B"));
+
+    // Save via the memory resource overloads.
+    {
+        const auto is_reg_A = [](const IRegister::Name reg_name) { return reg_name == "A"; };
+
+        EXPECT_CALL(key_value_mock, drop(IRegister::Name{"A"}))  //
+            .WillOnce(Return(cetl::nullopt));
+        EXPECT_CALL(rgy_mock, get(IRegister::Name{"B"}))  //
+            .WillOnce(Return(IRegister::ValueAndFlags{makeUInt8Value({0x42, 0xFE}), {true, true}}));
+        EXPECT_CALL(key_value_mock, put(IRegister::Name{"B"}, ElementsAre(11, 2, 0, 0x42, 0xFE)))  //
+            .WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(save(key_value_mock, rgy_mock, mr_, is_reg_A), Eq(cetl::nullopt));
+
+        EXPECT_CALL(rgy_mock, get(IRegister::Name{"A"}))  // Emulate that 'A' is gone - should be skipped.
+            .WillOnce(Return(cetl::nullopt));
+        EXPECT_CALL(rgy_mock, get(IRegister::Name{"B"}))  //
+            .WillOnce(Return(IRegister::ValueAndFlags{makeUInt8Value({0x43}), {true, true}}));
+        EXPECT_CALL(key_value_mock, put(IRegister::Name{"B"}, ElementsAre(11, 1, 0, 0x43)))  //
+            .WillOnce(Return(StorageError::IO));
+        EXPECT_THAT(save(key_value_mock, rgy_mock, mr_), Optional(StorageError::IO));
+    }
+    // Load via the value storage overload.
+    {
+        IRegister::Value value_storage{alloc_};
+
+        EXPECT_CALL(rgy_mock, get(IRegister::Name{"A"}))  // non-persistent - should be skipped.
+            .WillOnce(Return(IRegister::ValueAndFlags{makeUInt8Value({0x01}), {true, false}}));
+        EXPECT_CALL(rgy_mock, get(IRegister::Name{"B"}))  //
+            .WillOnce(Return(IRegister::ValueAndFlags{makeUInt8Value({0x02}), {true, true}}));
+        EXPECT_CALL(key_value_mock, get(IRegister::Name{"B"}, _))  //
+            .WillOnce(Return(0UL));
+        EXPECT_CALL(rgy_mock, set(IRegister::Name{"B"}, RegisterValueEq(makeEmptyValue())))  //
+            .WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(load(key_value_mock, rgy_mock, value_storage), Eq(cetl::nullopt));
+        EXPECT_TRUE(value_storage.is_empty());
+    }
+}
+
+TEST_F(TestRegistry, dirty_tracking)
+{
+    Registry rgy{mr_};
+
+    std::vector<std::string> dirty_names;
+    rgy.setDirtyCallback([&dirty_names](const auto& arg) {
+        //
+        const auto name = arg.reg.getName();
+        dirty_names.emplace_back(name.data(), name.size());
+    });
+
+    auto r_ro = rgy.route("ro", [this] { return makeUInt8Value({1}); });
+    auto r_rw = rgy.route(
+        "rw",
+        [this] { return makeUInt8Value({2}); },
+        [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; });
+    auto r_bad = rgy.route(
+        "bad",
+        [this] { return makeUInt8Value({3}); },
+        [](const auto&) -> cetl::optional<SetError> { return SetError::Semantics; });
+    EXPECT_FALSE(r_ro.isDirty());
+    EXPECT_FALSE(r_rw.isDirty());
+    EXPECT_FALSE(r_bad.isDirty());
+
+    // Only successful sets make registers dirty.
+    EXPECT_THAT(rgy.set("ro", makeUInt8Value({})), Optional(SetError::Mutability));
+    EXPECT_THAT(rgy.set("bad", makeUInt8Value({})), Optional(SetError::Semantics));
+    EXPECT_THAT(rgy.set("none", makeUInt8Value({})), Optional(SetError::Existence));
+    EXPECT_THAT(dirty_names, IsEmpty());
+    EXPECT_FALSE(r_ro.isDirty());
+    EXPECT_FALSE(r_bad.isDirty());
+
+    EXPECT_THAT(rgy.set("rw", makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_TRUE(r_rw.isDirty());
+    EXPECT_THAT(dirty_names, ElementsAre("rw"));
+
+    // Direct set on a register also makes it dirty (but is not reported by the registry).
+    r_rw.markClean();
+    EXPECT_THAT(r_rw.set(makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_TRUE(r_rw.isDirty());
+    EXPECT_THAT(dirty_names, ElementsAre("rw"));
+
+    // Explicit marking.
+    EXPECT_TRUE(rgy.markDirty("ro"));
+    EXPECT_FALSE(rgy.markDirty("none"));
+    EXPECT_TRUE(r_ro.isDirty());
+    EXPECT_THAT(dirty_names, ElementsAre("rw", "ro"));
+
+    std::vector<std::string> traversed;
+    EXPECT_FALSE(rgy.traverseDirty([&traversed](IRegister& reg) {
+        //
+        traversed.emplace_back(reg.getName().data(), reg.getName().size());
+        return false;
+    }));
+    EXPECT_THAT(traversed, UnorderedElementsAre("ro", "rw"));
+
+    rgy.setDirtyCallback({});
+    EXPECT_THAT(rgy.set("rw", makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_THAT(dirty_names, ElementsAre("rw", "ro"));
+}
+
+TEST_F(TestRegistry, saveDirty)
+{
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto r_a = rgy.route("A", [this] { return makeUInt8Value({0x42}); }, setter, {true});
+    auto r_b = rgy.route("B", [this] { return makeUInt8Value({0x43}); }, setter, {true});
+    auto r_c = rgy.route("C", [this] { return makeUInt8Value({0x44}); }, setter);  // not persistent
+    auto r_d = rgy.route("D", [this] { return makeUInt8Value({0x45}); }, {true});  // immutable
+
+    // Nothing is dirty - nothing to save.
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+
+    // Only persistent mutable dirty registers are stored; all of them become clean.
+    EXPECT_THAT(rgy.set("A", makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_THAT(rgy.set("C", makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_TRUE(rgy.markDirty("D"));
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"A"}, ElementsAre(11, 1, 0, 0x42)))  //
+        .WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_FALSE(r_b.isDirty());
+    EXPECT_FALSE(r_c.isDirty());
+    EXPECT_FALSE(r_d.isDirty());
+
+    // Failed register stays dirty, and is retried next time.
+    EXPECT_THAT(rgy.set("A", makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_THAT(rgy.set("B", makeUInt8Value({})), Eq(cetl::nullopt));
+    EXPECT_CALL(key_value_mock, put(_, _)).WillOnce(Return(StorageError::Capacity));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Optional(StorageError::Capacity));
+    EXPECT_TRUE(r_a.isDirty() || r_b.isDirty());
+    EXPECT_CALL(key_value_mock, put(_, _)).WillRepeatedly(Return(cetl::nullopt));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_FALSE(r_b.isDirty());
+}
+
+TEST_F(TestRegistry, load_marks_clean)
+{
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto setter = [](const auto&) -> cetl::optional<SetError> { return cetl::nullopt; };
+    auto r_a = rgy.route("A", [this] { return makeUInt8Value({0x42}); }, setter, {true});
+    auto r_b = rgy.route("B", [this] { return makeUInt8Value({0x43}); }, setter, {true});
+
+    // Both registers are modified before the load, but only "A" is present in the storage.
+    EXPECT_TRUE(rgy.markDirty("A"));
+    EXPECT_TRUE(rgy.markDirty("B"));
+    EXPECT_FALSE(rgy.markClean("C"));
+
+    EXPECT_CALL(key_value_mock, get(IRegister::Name{"A"}, _))  //
+        .WillOnce(Invoke([](const auto&, auto data) {
+            const std::array<std::uint8_t, 4> serialized{11, 1, 0, 0x13};
+            std::copy(serialized.begin(), serialized.end(), data.begin());
+            return serialized.size();
+        }));
+    EXPECT_CALL(key_value_mock, get(IRegister::Name{"B"}, _))  //
+        .WillOnce(Return(StorageError::Existence));
+    EXPECT_THAT(load(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_TRUE(r_b.isDirty());
+
+    // So, only "B" is saved afterward.
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"B"}, ElementsAre(11, 1, 0, 0x43)))  //
+        .WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_b.isDirty());
+}
+
+TEST_F(TestRegistry, save_steady_state_allocations)
+{
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    constexpr std::size_t      Count = 100;
+    std::vector<std::uint16_t> values(Count, 0);
+
+    const auto make_getter = [&values](const std::size_t index) {
+        //
+        return [&values, index] { return values[index]; };
+    };
+    const auto make_setter = [&values](const std::size_t index) {
+        //
+        return [&values, index](const IRegister::Value& value) -> cetl::optional<SetError> {
+            //
+            const auto* const natural16 = value.get_natural16_if();
+            if ((natural16 == nullptr) || natural16->value.empty())
+            {
+                return SetError::Semantics;
+            }
+            values[index] = natural16->value[0];
+            return cetl::nullopt;
+        };
+    };
+    using Reg = decltype(rgy.route("", make_getter(0), make_setter(0), {true}));
+
+    std::vector<std::string> names;
+    std::list<Reg>           regs;
+    names.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        values[i] = static_cast<std::uint16_t>(i);
+        names.push_back("reg." + std::to_string(i));
+        regs.push_back(rgy.route(names.back(), make_getter(i), make_setter(i), {true}));
+    }
+
+    // The storage itself is not on the tracked memory resource.
+    std::map<std::string, std::vector<std::uint8_t>> storage;
+    EXPECT_CALL(key_value_mock, put(_, _))  //
+        .WillRepeatedly(Invoke([&storage](const auto key, const auto data) {
+            //
+            storage[std::string{key.data(), key.size()}].assign(data.begin(), data.end());
+            return cetl::nullopt;
+        }));
+    EXPECT_CALL(key_value_mock, get(_, _))  //
+        .WillRepeatedly(Invoke([&storage](const auto key, const auto data)  //
+                               -> libcyphal::Expected<std::size_t, StorageError> {
+            //
+            const auto it = storage.find(std::string{key.data(), key.size()});
+            if (it == storage.end())
+            {
+                return StorageError::Existence;
+            }
+            std::copy(it->second.begin(), it->second.end(), data.begin());
+            return it->second.size();
+        }));
+
+    // Warm up the reused value storage.
+    IRegister::Value value_storage{alloc_};
+    const auto       never_reset = [](const IRegister::Name) { return false; };
+    EXPECT_THAT(save(key_value_mock, rgy, value_storage, never_reset), Eq(cetl::nullopt));
+    EXPECT_THAT(storage, SizeIs(Count));
+
+    // Saving doesn't allocate anymore - regardless of the number of registers.
+    const auto allocated_bytes = mr_.total_allocated_bytes;
+    values[0]                  = 0x1234;
+    EXPECT_THAT(save(key_value_mock, rgy, value_storage, never_reset), Eq(cetl::nullopt));
+    EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+    EXPECT_THAT(storage.at("reg.0"), ElementsAre(_, 1, 0x34, 0x12));
+
+    // Loading (re)assigns all stored registers, including those which already have the same value.
+    std::fill(values.begin(), values.end(), 0);
+    EXPECT_THAT(load(key_value_mock, rgy, value_storage), Eq(cetl::nullopt));
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        EXPECT_THAT(values[i], i == 0 ? 0x1234 : i) << i;
+    }
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
 
 }  // namespace
@@ -58,6 +58,7 @@ public:
     using Self::getParentNode;
     using Self::getNextInOrderNode;
     using Self::getBalanceFactor;
+    using Self::getSubtreeSize;
     using Self::search;
     using Self::remove;
     using Self::traverseInOrder;
@@ -80,6 +81,7 @@ private:
     UNUSED E up;
     UNUSED E lr;
     UNUSED E bf;
+    UNUSED E sz;
 };
 using MyTree = cavl::Tree<My>;
 static_assert(std::is_same<My::TreeType, MyTree>::value, "");
@@ -213,6 +215,30 @@ NODISCARD const N<T>* findBrokenBalanceFactor(const N<T>* const n)  // NOLINT(mi
     return nullptr;
 }
 
+template <typename T>
+NODISCARD const N<T>* findBrokenSubtreeSize(const N<T>* const n)  // NOLINT(misc-no-recursion)
+{
+    if (n != nullptr)
+    {
+        const auto* const left  = n->getChildNode(false);
+        const auto* const right = n->getChildNode(true);
+        const std::size_t left_size  = (left != nullptr) ? left->getSubtreeSize() : 0U;
+        const std::size_t right_size = (right != nullptr) ? right->getSubtreeSize() : 0U;
+        if (n->getSubtreeSize() != (1U + left_size + right_size))
+        {
+            return n;
+        }
+        for (const bool v : {true, false})
+        {
+            if (auto* const p = findBrokenSubtreeSize<T>(n->getChildNode(v)))
+            {
+                return p;
+            }
+        }
+    }
+    return nullptr;
+}
+
 template <typename T>
 NODISCARD auto toGraphviz(const cavl::Tree<T>& tr) -> std::string
 {
@@ -285,6 +311,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
         EXPECT_TRUE(!tr.empty());
         EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
         EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+        EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
         EXPECT_TRUE(checkOrdering<N>(tr) < std::numeric_limits<std::size_t>::max());
     };
     // Insert out of order to cover more branches in the insertion method.
@@ -302,6 +329,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     std::cout << toGraphviz(tr) << std::endl;
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(31, checkOrdering<N>(tr));
     // Check composition -- ensure that every element is in the tree and it is there exactly once.
     {
@@ -374,6 +402,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[26], t[28], {Zzzzz, t[27]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(30, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[24]->isRoot());
@@ -399,6 +428,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[28], t[26], {t[27], t[30]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(29, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[25]->isRoot());
@@ -425,6 +455,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[28], t[30], {Zzzzz, t[29]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(28, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[26]->isRoot());
@@ -450,6 +481,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[22], t[21], {Zzzzz, t[23]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(27, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[20]->isRoot());
@@ -475,6 +507,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[30], t[28], {t[29], t[31]}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(26, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[27]->isRoot());
@@ -500,6 +533,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[30], t[29], {Zzzzz, t[31]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(25, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[28]->isRoot());
@@ -539,6 +573,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[16], Zzzzz, {t[8], t[21]}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(24, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[29]->isRoot());
@@ -563,6 +598,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[10], t[12], {Zzzz, t[11]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(23, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[8]->isRoot());
@@ -587,6 +623,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[12], t[10], {t[11], t[14]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(22, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[9]->isRoot());
@@ -610,6 +647,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[2], t[4], {Zzzz, t[3]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(21, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[1]->isRoot());
@@ -637,6 +675,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[10], t[21]}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(20, checkOrdering<N>(tr));
     EXPECT_TRUE(t[17]->isRoot());
     EXPECT_FALSE(t[16]->isRoot());
@@ -661,6 +700,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[23], t[30], {Zzzzz, Zzzzz}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(19, checkOrdering<N>(tr));
     EXPECT_TRUE(t[17]->isRoot());
     EXPECT_FALSE(t[22]->isRoot());
@@ -705,6 +745,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[17], static_cast<N*>(tr));  // Same root.
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(7, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[10], t[21]}, 00));
     EXPECT_TRUE(checkLinkage<N>(t[10], t[17], {t[+4], t[12]}, 00));
@@ -735,6 +776,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[17], static_cast<N*>(tr));  // Same root.
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(5, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[12], t[30]}, 00));
     EXPECT_TRUE(checkLinkage<N>(t[12], t[17], {t[+4], Zzzzz}, -1));
@@ -765,6 +807,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[17], static_cast<N*>(tr));  // Same root.
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(3, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[+4], t[30]}, 00));
     EXPECT_TRUE(checkLinkage<N>(t[30], t[17], {Zzzzz, Zzzzz}, 00));
@@ -792,6 +835,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[30], static_cast<N*>(tr));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(2, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[30], Zzzzz, {t[+4], Zzzzz}, -1));
     EXPECT_TRUE(checkLinkage<N>(t[+4], t[30], {Zzzzz, Zzzzz}, 00));
@@ -814,6 +858,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[+4], static_cast<N*>(tr));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(1, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[+4], Zzzzz, {Zzzzz, Zzzzz}, 00));
     EXPECT_EQ(t.at(4), tr.min());
@@ -883,7 +928,12 @@ TEST(TestCavl, randomized)
                   }));
         EXPECT_EQ(nullptr, findBrokenBalanceFactor<My>(root));
         EXPECT_EQ(nullptr, findBrokenAncestry<My>(root));
+        EXPECT_EQ(nullptr, findBrokenSubtreeSize<My>(root));
         EXPECT_EQ(size, checkOrdering<My>(root));
+        EXPECT_EQ(size, root.size());
+        std::size_t index = 0;
+        root.traverseInOrder([&](const My& node) { EXPECT_EQ(&node, root[index++]); });
+        EXPECT_EQ(nullptr, root[index]);
         std::array<bool, 256> new_mask{};
         root.traverseInOrder([&](const My& node) { new_mask.at(node.getValue()) = true; });
         EXPECT_EQ(mask, new_mask);  // Otherwise, the contents of the tree does not match our expectations.
@@ -1000,6 +1050,7 @@ public:
     using Self::getParentNode;
     using Self::getNextInOrderNode;
     using Self::getBalanceFactor;
+    using Self::getSubtreeSize;
     using Self::search;
     using Self::remove;
     using Self::traverseInOrder;
@@ -1024,6 +1075,7 @@ private:
     UNUSED E up;
     UNUSED E lr;
     UNUSED E bf;
+    UNUSED E sz;
 };
 using VTree = cavl::Tree<V>;
 static_assert(std::is_same<V::TreeType, VTree>::value, "");
@@ -0,0 +1,168 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <libcyphal/common/intrusive_list.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::common::IntrusiveList;
+using libcyphal::common::IntrusiveListNode;
+
+using testing::IsEmpty;
+using testing::ElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class MyNode final : public IntrusiveListNode<MyNode>
+{
+public:
+    explicit MyNode(const int value)
+        : value_{value}
+    {
+    }
+    ~MyNode() = default;
+
+    MyNode(MyNode&& other) noexcept      = default;
+    MyNode(const MyNode&)                = delete;
+    MyNode& operator=(const MyNode&)     = delete;
+    MyNode& operator=(MyNode&&) noexcept = delete;
+
+    int value() const noexcept
+    {
+        return value_;
+    }
+
+private:
+    int value_;
+
+};  // MyNode
+
+std::vector<int> valuesOf(const IntrusiveList<MyNode>& list)
+{
+    std::vector<int> values;
+    list.traverse([&values](const MyNode& node) { values.push_back(node.value()); });
+    return values;
+}
+
+TEST(TestIntrusiveList, push_pop_remove)
+{
+    IntrusiveList<MyNode> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THAT(list.front(), nullptr);
+    EXPECT_THAT(list.popFront(), nullptr);
+
+    MyNode n1{1};
+    MyNode n2{2};
+    MyNode n3{3};
+    list.pushBack(n1);
+    list.pushBack(n2);
+    list.pushBack(n3);
+    EXPECT_THAT(list.size(), 3);
+    EXPECT_TRUE(list.contains(n2));
+    EXPECT_THAT(valuesOf(list), ElementsAre(1, 2, 3));
+
+    // Remove from the middle, and then the same node again (no effect).
+    list.remove(n2);
+    list.remove(n2);
+    EXPECT_FALSE(list.contains(n2));
+    EXPECT_THAT(list.size(), 2);
+    EXPECT_THAT(valuesOf(list), ElementsAre(1, 3));
+
+    // Node of another list is not affected.
+    IntrusiveList<MyNode> other_list;
+    other_list.pushBack(n2);
+    list.remove(n2);
+    EXPECT_TRUE(other_list.contains(n2));
+    EXPECT_THAT(valuesOf(other_list), ElementsAre(2));
+
+    EXPECT_THAT(list.popFront(), &n1);
+    EXPECT_THAT(list.popFront(), &n3);
+    EXPECT_TRUE(list.empty());
+    EXPECT_THAT(valuesOf(list), IsEmpty());
+
+    // Re-added node goes to the end.
+    list.pushBack(n3);
+    list.pushBack(n1);
+    EXPECT_THAT(valuesOf(list), ElementsAre(3, 1));
+}
+
+TEST(TestIntrusiveList, node_lifetime)
+{
+    IntrusiveList<MyNode> list;
+
+    MyNode n1{1};
+    list.pushBack(n1);
+    {
+        MyNode n2{2};
+        list.pushBack(n2);
+        MyNode n3{3};
+        list.pushBack(n3);
+        EXPECT_THAT(valuesOf(list), ElementsAre(1, 2, 3));
+    }
+    EXPECT_THAT(list.size(), 1);
+    EXPECT_THAT(valuesOf(list), ElementsAre(1));
+
+    // Moved node takes place of the original one.
+    MyNode n4{4};
+    list.pushBack(n4);
+    MyNode n5{5};
+    list.pushBack(n5);
+    const MyNode moved_n4{std::move(n4)};
+    EXPECT_FALSE(list.contains(n4));
+    EXPECT_TRUE(list.contains(moved_n4));
+    EXPECT_THAT(list.size(), 3);
+    EXPECT_THAT(valuesOf(list), ElementsAre(1, 4, 5));
+
+    // Moving of an unlinked node is fine as well.
+    MyNode       n6{6};
+    const MyNode moved_n6{std::move(n6)};
+    EXPECT_FALSE(list.contains(moved_n6));
+}
+
+TEST(TestIntrusiveList, traverse_and_clear)
+{
+    MyNode n1{1};
+    MyNode n2{2};
+    MyNode n3{3};
+    {
+        IntrusiveList<MyNode> list;
+        list.pushBack(n1);
+        list.pushBack(n2);
+        list.pushBack(n3);
+
+        // The visited node may be removed.
+        list.traverse([&list](MyNode& node) {
+            //
+            if (node.value() != 2)
+            {
+                list.remove(node);
+            }
+        });
+        EXPECT_THAT(valuesOf(list), ElementsAre(2));
+
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_FALSE(list.contains(n2));
+
+        list.pushBack(n1);
+        list.pushBack(n2);
+    }
+    // The list has been destroyed before its nodes - they are unlinked, so it's fine to reuse them.
+    IntrusiveList<MyNode> list;
+    list.pushBack(n2);
+    list.pushBack(n1);
+    EXPECT_THAT(valuesOf(list), ElementsAre(2, 1));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
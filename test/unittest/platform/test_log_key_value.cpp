@@ -0,0 +1,466 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "platform/log_key_value.hpp"
+#include "temp_directory.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/common/crc.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using example::platform::storage::LogKeyValue;
+using Error = libcyphal::platform::storage::Error;
+
+using testing::Eq;
+using testing::Gt;
+using testing::Lt;
+using testing::NotNull;
+using testing::Optional;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Size of the file magic - the size of an empty (or a fully compacted empty) log.
+constexpr std::size_t MagicSize = 8;
+
+class TestLogKeyValue : public testing::Test
+{
+protected:
+    using Bytes = std::vector<std::uint8_t>;
+
+    void SetUp() override
+    {
+        ASSERT_THAT(temp_dir_.path().empty(), false);
+    }
+
+    std::unique_ptr<LogKeyValue> open(const LogKeyValue::Options& options = {}) const
+    {
+        auto maybe_storage = LogKeyValue::make(path_, options);
+        EXPECT_THAT(maybe_storage, VariantWith<std::unique_ptr<LogKeyValue>>(NotNull()));
+        if (auto* const storage = cetl::get_if<std::unique_ptr<LogKeyValue>>(&maybe_storage))
+        {
+            return std::move(*storage);
+        }
+        return nullptr;
+    }
+
+    static cetl::optional<Error> put(LogKeyValue& storage, const std::string& key, const Bytes& value)
+    {
+        return storage.put(key, {value.data(), value.size()});
+    }
+
+    /// Gets value of the key, or an error.
+    ///
+    static libcyphal::Expected<Bytes, Error> get(const LogKeyValue& storage, const std::string& key)
+    {
+        Bytes      buffer(256);
+        const auto result = storage.get(key, {buffer.data(), buffer.size()});
+        if (const auto* const error = cetl::get_if<Error>(&result))
+        {
+            return *error;
+        }
+        buffer.resize(cetl::get<std::size_t>(result));
+        return buffer;
+    }
+
+    std::size_t fileSizeOnDisk() const
+    {
+        struct stat file_stat{};
+        EXPECT_THAT(::stat(path_.c_str(), &file_stat), 0);
+        return static_cast<std::size_t>(file_stat.st_size);
+    }
+
+    /// Flips all bits of the byte at the given offset from the end of the log file.
+    ///
+    void corruptByteFromEnd(const std::size_t offset_from_end) const
+    {
+        std::fstream file{path_, std::ios::in | std::ios::out | std::ios::binary};
+        file.seekg(-static_cast<std::streamoff>(offset_from_end), std::ios::end);
+        char byte = 0;
+        file.read(&byte, 1);
+        file.seekp(-static_cast<std::streamoff>(offset_from_end), std::ios::end);
+        byte = static_cast<char>(~byte);
+        file.write(&byte, 1);
+    }
+
+    /// Appends a raw record (with valid CRC) to the end of the log file.
+    ///
+    void appendRawRecord(const std::uint8_t kind, const std::string& key, const Bytes& value) const
+    {
+        Bytes record(16);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            record[8 + i] = static_cast<std::uint8_t>(value.size() >> (i * 8U));
+        }
+        record[12] = static_cast<std::uint8_t>(key.size());
+        record[13] = static_cast<std::uint8_t>(key.size() >> 8U);
+        record[14] = kind;
+        record.insert(record.end(), key.cbegin(), key.cend());
+        record.insert(record.end(), value.cbegin(), value.cend());
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const libcyphal::common::CRC64WE crc{&record[8], record.data() + record.size()};
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            record[i] = static_cast<std::uint8_t>(crc.get() >> (i * 8U));
+        }
+
+        std::ofstream file{path_, std::ios::binary | std::ios::app};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        file.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::TempDirectory temp_dir_{"org.opencyphal.test_log_key_value"};
+    const std::string        path_{temp_dir_.makePath("registry.log")};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestLogKeyValue, put_get_drop)
+{
+    const auto storage = open();
+    ASSERT_THAT(storage, NotNull());
+    EXPECT_THAT(storage->fileSize(), MagicSize);
+    EXPECT_THAT(storage->liveSize(), 0);
+
+    EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+    EXPECT_THAT(put(*storage, "b", {4, 5}), Eq(cetl::nullopt));
+    EXPECT_THAT(put(*storage, "empty", {}), Eq(cetl::nullopt));
+    EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+    EXPECT_THAT(get(*storage, "b"), VariantWith<Bytes>(ElementsAre(4, 5)));
+    EXPECT_THAT(get(*storage, "empty"), VariantWith<Bytes>(ElementsAre()));
+    EXPECT_THAT(get(*storage, "c"), VariantWith<Error>(Error::Existence));
+    EXPECT_THAT(storage->fileSize(), fileSizeOnDisk());
+    EXPECT_THAT(storage->liveSize(), storage->fileSize() - MagicSize);
+
+    // Smaller buffer gets only a prefix of the value.
+    std::array<std::uint8_t, 2> small_buffer{};
+    EXPECT_THAT(storage->get("a", small_buffer), VariantWith<std::size_t>(2));
+    EXPECT_THAT(small_buffer, ElementsAre(1, 2));
+
+    // Overwrite with a value of different size.
+    EXPECT_THAT(put(*storage, "a", {6, 7, 8, 9}), Eq(cetl::nullopt));
+    EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(6, 7, 8, 9)));
+
+    EXPECT_THAT(storage->drop("b"), Eq(cetl::nullopt));
+    EXPECT_THAT(get(*storage, "b"), VariantWith<Error>(Error::Existence));
+    EXPECT_THAT(storage->drop("b"), Optional(Error::Existence));
+    EXPECT_THAT(storage->drop("c"), Optional(Error::Existence));
+    EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(6, 7, 8, 9)));
+
+    // Too long key.
+    EXPECT_THAT(put(*storage, std::string(0x10000, 'k'), {1}), Optional(Error::API));
+}
+
+TEST_F(TestLogKeyValue, put_same_value_is_skipped)
+{
+    const auto storage = open();
+    ASSERT_THAT(storage, NotNull());
+
+    EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+    const auto file_size = storage->fileSize();
+
+    EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+    EXPECT_THAT(storage->fileSize(), file_size);
+    EXPECT_THAT(fileSizeOnDisk(), file_size);
+
+    // Same size but different content is not skipped.
+    EXPECT_THAT(put(*storage, "a", {1, 2, 4}), Eq(cetl::nullopt));
+    EXPECT_THAT(storage->fileSize(), Gt(file_size));
+    EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 4)));
+}
+
+TEST_F(TestLogKeyValue, reopen_replays_log)
+{
+    std::size_t live_size = 0;
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(put(*storage, "a", {1}), Eq(cetl::nullopt));
+        EXPECT_THAT(put(*storage, "b", {2, 2}), Eq(cetl::nullopt));
+        EXPECT_THAT(put(*storage, "c", {3, 3, 3}), Eq(cetl::nullopt));
+        EXPECT_THAT(put(*storage, "a", {4, 4, 4, 4}), Eq(cetl::nullopt));
+        EXPECT_THAT(storage->drop("b"), Eq(cetl::nullopt));
+        live_size = storage->liveSize();
+    }
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(4, 4, 4, 4)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Error>(Error::Existence));
+        EXPECT_THAT(get(*storage, "c"), VariantWith<Bytes>(ElementsAre(3, 3, 3)));
+        EXPECT_THAT(storage->liveSize(), live_size);
+        EXPECT_THAT(storage->fileSize(), fileSizeOnDisk());
+
+        // New records are appended after the replayed ones.
+        EXPECT_THAT(put(*storage, "b", {5}), Eq(cetl::nullopt));
+    }
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(4, 4, 4, 4)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Bytes>(ElementsAre(5)));
+    }
+}
+
+TEST_F(TestLogKeyValue, truncated_tail_is_discarded)
+{
+    std::size_t good_size = 0;
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+        good_size = storage->fileSize();
+        EXPECT_THAT(put(*storage, "b", {4, 5, 6}), Eq(cetl::nullopt));
+    }
+
+    // Emulate a power loss in the middle of the last append.
+    ASSERT_THAT(::truncate(path_.c_str(), static_cast<off_t>(fileSizeOnDisk() - 2)), 0);
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Error>(Error::Existence));
+        EXPECT_THAT(storage->fileSize(), good_size);
+        EXPECT_THAT(fileSizeOnDisk(), good_size);
+
+        EXPECT_THAT(put(*storage, "c", {7}), Eq(cetl::nullopt));
+    }
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+        EXPECT_THAT(get(*storage, "c"), VariantWith<Bytes>(ElementsAre(7)));
+    }
+}
+
+TEST_F(TestLogKeyValue, corrupted_tail_is_discarded)
+{
+    std::size_t good_size = 0;
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+        good_size = storage->fileSize();
+        EXPECT_THAT(put(*storage, "b", {4, 5, 6}), Eq(cetl::nullopt));
+    }
+
+    // The last record has full size, but its value doesn't match the CRC anymore.
+    corruptByteFromEnd(1);
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Error>(Error::Existence));
+        EXPECT_THAT(storage->fileSize(), good_size);
+        EXPECT_THAT(fileSizeOnDisk(), good_size);
+    }
+}
+
+TEST_F(TestLogKeyValue, unknown_record_kind_is_discarded)
+{
+    std::size_t good_size = 0;
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+        good_size = storage->fileSize();
+    }
+
+    // A record of unknown kind has valid CRC, but is still treated as corruption -
+    // neither it nor anything after it (even a good record) is replayed.
+    appendRawRecord(0x7F, "a", {});
+    appendRawRecord(0, "b", {4, 5});
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Error>(Error::Existence));
+        EXPECT_THAT(storage->fileSize(), good_size);
+        EXPECT_THAT(fileSizeOnDisk(), good_size);
+    }
+}
+
+TEST_F(TestLogKeyValue, good_raw_record_is_replayed)
+{
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+    }
+
+    // Just to make sure that the raw records are built correctly.
+    appendRawRecord(0, "b", {4, 5});
+    const auto storage = open();
+    ASSERT_THAT(storage, NotNull());
+    EXPECT_THAT(get(*storage, "b"), VariantWith<Bytes>(ElementsAre(4, 5)));
+}
+
+TEST_F(TestLogKeyValue, compaction_triggered)
+{
+    LogKeyValue::Options options{};
+    options.sync_on_put              = false;
+    options.compaction_min_size      = 256;
+    options.compaction_garbage_ratio = 1;
+
+    {
+        const auto storage = open(options);
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+        for (std::uint8_t i = 0; i < 100; ++i)
+        {
+            EXPECT_THAT(put(*storage, "x", {i}), Eq(cetl::nullopt));
+            EXPECT_THAT(storage->fileSize(), Lt(2 * options.compaction_min_size));
+        }
+        EXPECT_THAT(storage->fileSize(), fileSizeOnDisk());
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+        EXPECT_THAT(get(*storage, "x"), VariantWith<Bytes>(ElementsAre(99)));
+        EXPECT_THAT(storage->sync(), Eq(cetl::nullopt));
+    }
+    {
+        const auto storage = open(options);
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+        EXPECT_THAT(get(*storage, "x"), VariantWith<Bytes>(ElementsAre(99)));
+    }
+}
+
+TEST_F(TestLogKeyValue, compaction_explicit)
+{
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(put(*storage, "a", {1}), Eq(cetl::nullopt));
+        EXPECT_THAT(put(*storage, "a", {2}), Eq(cetl::nullopt));
+        EXPECT_THAT(put(*storage, "b", {3, 3}), Eq(cetl::nullopt));
+        EXPECT_THAT(put(*storage, "c", {4}), Eq(cetl::nullopt));
+        EXPECT_THAT(storage->drop("c"), Eq(cetl::nullopt));
+        EXPECT_THAT(storage->fileSize(), Gt(MagicSize + storage->liveSize()));
+
+        const auto live_size = storage->liveSize();
+        EXPECT_THAT(storage->compact(), Eq(cetl::nullopt));
+        EXPECT_THAT(storage->liveSize(), live_size);
+        EXPECT_THAT(storage->fileSize(), MagicSize + live_size);
+        EXPECT_THAT(fileSizeOnDisk(), MagicSize + live_size);
+        EXPECT_THAT(::access((path_ + ".compact").c_str(), F_OK), -1);
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(2)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Bytes>(ElementsAre(3, 3)));
+        EXPECT_THAT(get(*storage, "c"), VariantWith<Error>(Error::Existence));
+
+        // The compacted log is still writable.
+        EXPECT_THAT(put(*storage, "c", {5}), Eq(cetl::nullopt));
+    }
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(2)));
+        EXPECT_THAT(get(*storage, "b"), VariantWith<Bytes>(ElementsAre(3, 3)));
+        EXPECT_THAT(get(*storage, "c"), VariantWith<Bytes>(ElementsAre(5)));
+    }
+}
+
+TEST_F(TestLogKeyValue, leftover_compaction_file_is_removed)
+{
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+        EXPECT_THAT(put(*storage, "a", {1, 2, 3}), Eq(cetl::nullopt));
+    }
+
+    // Emulate a compaction which was interrupted before the rename.
+    const auto compaction_path = path_ + ".compact";
+    {
+        std::ofstream file{compaction_path, std::ios::binary};
+        file << "partial garbage";
+    }
+
+    const auto storage = open();
+    ASSERT_THAT(storage, NotNull());
+    EXPECT_THAT(::access(compaction_path.c_str(), F_OK), -1);
+    EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1, 2, 3)));
+}
+
+TEST_F(TestLogKeyValue, make_bad_magic)
+{
+    {
+        std::ofstream file{path_, std::ios::binary};
+        file << "garbage!and more";
+    }
+
+    auto maybe_storage = LogKeyValue::make(path_);
+    EXPECT_THAT(maybe_storage, VariantWith<Error>(Error::Internal));
+}
+
+TEST_F(TestLogKeyValue, make_truncated_magic)
+{
+    // The log creation was interrupted while stamping the magic - the log is just reinitialized.
+    {
+        std::ofstream file{path_, std::ios::binary};
+        file << "CYKV";
+    }
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+        EXPECT_THAT(storage->fileSize(), MagicSize);
+        EXPECT_THAT(fileSizeOnDisk(), MagicSize);
+
+        EXPECT_THAT(put(*storage, "a", {1}), Eq(cetl::nullopt));
+    }
+    {
+        const auto storage = open();
+        ASSERT_THAT(storage, NotNull());
+        EXPECT_THAT(get(*storage, "a"), VariantWith<Bytes>(ElementsAre(1)));
+    }
+}
+
+TEST_F(TestLogKeyValue, make_bad_path)
+{
+    auto maybe_storage = LogKeyValue::make(temp_dir_.makePath("no_such_dir/registry.log"));
+    EXPECT_THAT(maybe_storage, VariantWith<Error>(Error::IO));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
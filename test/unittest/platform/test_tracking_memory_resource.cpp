@@ -0,0 +1,222 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "memory_resource_mock.hpp"
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/platform/tracking_memory_resource.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+using Resource       = libcyphal::platform::TrackingMemoryResource;
+using LiveAllocation = Resource::LiveAllocation;
+
+using testing::_;
+using testing::Eq;
+using testing::Ge;
+using testing::Gt;
+using testing::Each;
+using testing::SizeIs;
+using testing::Invoke;
+using testing::IsNull;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrEq;
+using testing::StrictMock;
+using testing::UnorderedElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTrackingMemoryResource : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestTrackingMemoryResource, getHistogramBucket)
+{
+    static_assert(Resource::getHistogramBucket(0) == 0, "");
+    static_assert(Resource::getHistogramBucket(8) == 0, "");
+    static_assert(Resource::getHistogramBucket(9) == 1, "");
+    static_assert(Resource::getHistogramBucket(16) == 1, "");
+    static_assert(Resource::getHistogramBucket(100) == 4, "");
+    static_assert(Resource::getHistogramBucket(5000) == 10, "");
+    static_assert(Resource::getHistogramBucket(~std::size_t{0}) == Resource::HistogramSize - 1, "");
+}
+
+TEST_F(TestTrackingMemoryResource, statistics)
+{
+    Resource resource{"test.general", mr_};
+    EXPECT_THAT(resource.getTag(), StrEq("test.general"));
+    EXPECT_THAT(&resource.getUpstream(), Eq(&mr_));
+
+    auto stats = resource.getStatistics();
+    EXPECT_THAT(stats.allocations_count, 0);
+    EXPECT_THAT(stats.in_use_bytes, 0);
+    EXPECT_THAT(stats.high_water_bytes, 0);
+
+    void* const ptr8    = resource.allocate(8);
+    void* const ptr100  = resource.allocate(100);
+    void* const ptr5000 = resource.allocate(5000);
+    ASSERT_THAT(ptr8, NotNull());
+    ASSERT_THAT(ptr100, NotNull());
+    ASSERT_THAT(ptr5000, NotNull());
+    EXPECT_THAT(mr_.allocations.size(), 3);
+
+    stats = resource.getStatistics();
+    EXPECT_THAT(stats.allocations_count, 3);
+    EXPECT_THAT(stats.deallocations_count, 0);
+    EXPECT_THAT(stats.failures_count, 0);
+    EXPECT_THAT(stats.total_allocated_bytes, 5108);
+    EXPECT_THAT(stats.in_use_bytes, 5108);
+    EXPECT_THAT(stats.high_water_bytes, 5108);
+    EXPECT_THAT(stats.histogram[0], 1);
+    EXPECT_THAT(stats.histogram[4], 1);
+    EXPECT_THAT(stats.histogram[10], 1);
+
+    resource.deallocate(ptr5000, 5000);
+    resource.deallocate(ptr100, 100);
+
+    stats = resource.getStatistics();
+    EXPECT_THAT(stats.deallocations_count, 2);
+    EXPECT_THAT(stats.in_use_bytes, 8);
+    EXPECT_THAT(stats.high_water_bytes, 5108);
+
+    resource.resetHighWaterMark();
+    EXPECT_THAT(resource.getStatistics().high_water_bytes, 8);
+
+    resource.deallocate(ptr8, 8);
+
+    stats = resource.getStatistics();
+    EXPECT_THAT(stats.allocations_count, 3);
+    EXPECT_THAT(stats.deallocations_count, 3);
+    EXPECT_THAT(stats.total_allocated_bytes, 5108);
+    EXPECT_THAT(stats.in_use_bytes, 0);
+    EXPECT_THAT(stats.high_water_bytes, 8);
+}
+
+TEST_F(TestTrackingMemoryResource, allocate_failure)
+{
+    StrictMock<MemoryResourceMock> upstream_mock;
+    EXPECT_CALL(upstream_mock, do_allocate(_, _)).WillOnce(Return(nullptr));
+
+    Resource resource{"test.failing", upstream_mock};
+
+    EXPECT_THAT(resource.allocate(16), IsNull());
+
+    const auto stats = resource.getStatistics();
+    EXPECT_THAT(stats.allocations_count, 0);
+    EXPECT_THAT(stats.failures_count, 1);
+    EXPECT_THAT(stats.in_use_bytes, 0);
+    EXPECT_THAT(stats.histogram[1], 0);
+}
+
+TEST_F(TestTrackingMemoryResource, track_leaks)
+{
+    Resource resource{"test.leaks", mr_, Resource::Options{true}};
+    EXPECT_THAT(resource.getLiveAllocationsCount(), 0);
+
+    void* const ptr1 = resource.allocate(10);
+    void* const ptr2 = resource.allocate(20, alignof(std::max_align_t));
+    ASSERT_THAT(ptr1, NotNull());
+    ASSERT_THAT(ptr2, NotNull());
+    EXPECT_THAT(resource.getLiveAllocationsCount(), 2);
+
+    // Live headers are extra, but the statistics count only the user sizes.
+    EXPECT_THAT(mr_.total_allocated_bytes, Ge(30));
+    EXPECT_THAT(resource.getStatistics().in_use_bytes, 30);
+
+    std::vector<std::size_t> sizes;
+    std::vector<const void*> pointers;
+    resource.visitLiveAllocations([&](const LiveAllocation& live) {
+        //
+        sizes.push_back(live.size);
+        pointers.push_back(live.pointer);
+    });
+    EXPECT_THAT(sizes, UnorderedElementsAre(10, 20));
+    EXPECT_THAT(pointers, UnorderedElementsAre(ptr1, ptr2));
+
+    resource.deallocate(ptr1, 10);
+    EXPECT_THAT(resource.getLiveAllocationsCount(), 1);
+
+    sizes.clear();
+    resource.visitLiveAllocations([&sizes](const LiveAllocation& live) { sizes.push_back(live.size); });
+    EXPECT_THAT(sizes, UnorderedElementsAre(20));
+
+    resource.deallocate(ptr2, 20, alignof(std::max_align_t));
+    EXPECT_THAT(resource.getLiveAllocationsCount(), 0);
+    EXPECT_THAT(resource.getStatistics().in_use_bytes, 0);
+}
+
+TEST_F(TestTrackingMemoryResource, track_leaks_byte_alignment)
+{
+    // The upstream honors just the requested alignment - so byte aligned blocks are at odd addresses.
+    std::vector<std::size_t>       upstream_alignments;
+    StrictMock<MemoryResourceMock> upstream_mock;
+    EXPECT_CALL(upstream_mock, do_allocate(_, _))
+        .WillRepeatedly(Invoke([&](const std::size_t size_bytes, const std::size_t alignment) -> void* {
+            //
+            upstream_alignments.push_back(alignment);
+            auto* const ptr = static_cast<cetl::byte*>(mr_.allocate(size_bytes + 1));
+            return (alignment == 1) ? ptr + 1 : ptr;
+        }));
+    EXPECT_CALL(upstream_mock, do_deallocate(_, _, _))
+        .WillRepeatedly(Invoke([&](void* const ptr, const std::size_t size_bytes, const std::size_t alignment) {
+            //
+            upstream_alignments.push_back(alignment);
+            auto* const raw_ptr = static_cast<cetl::byte*>(ptr);
+            mr_.deallocate((alignment == 1) ? raw_ptr - 1 : raw_ptr, size_bytes + 1);
+        }));
+
+    Resource resource{"test.bytes", upstream_mock, Resource::Options{true}};
+
+    void* const ptr = resource.allocate(7, 1);
+    ASSERT_THAT(ptr, NotNull());
+    std::vector<std::size_t> sizes;
+    resource.visitLiveAllocations([&sizes](const LiveAllocation& live) { sizes.push_back(live.size); });
+    EXPECT_THAT(sizes, UnorderedElementsAre(7));
+
+    resource.deallocate(ptr, 7, 1);
+    EXPECT_THAT(resource.getLiveAllocationsCount(), 0);
+
+    // Both allocation and deallocation of the (header prefixed) block use alignment of the header.
+    EXPECT_THAT(upstream_alignments, SizeIs(2));
+    EXPECT_THAT(upstream_alignments, Each(Gt(1U)));
+    EXPECT_THAT(upstream_alignments.front(), upstream_alignments.back());
+}
+
+TEST_F(TestTrackingMemoryResource, is_equal)
+{
+    Resource resource1{"test.1", mr_};
+    Resource resource2{"test.2", mr_};
+
+    EXPECT_TRUE(resource1.is_equal(resource1));
+    EXPECT_FALSE(resource1.is_equal(resource2));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
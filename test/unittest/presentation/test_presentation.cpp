@@ -16,6 +16,7 @@
 #include <libcyphal/presentation/client.hpp>
 #include <libcyphal/presentation/client_impl.hpp>
 #include <libcyphal/presentation/common_helpers.hpp>
+#include <libcyphal/presentation/port_observer.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/presentation/publisher.hpp>
 #include <libcyphal/presentation/publisher_impl.hpp>
@@ -37,6 +38,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -58,6 +60,11 @@ using testing::IsEmpty;
 using testing::StrictMock;
 using testing::VariantWith;
 
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 namespace Custom
@@ -171,6 +178,22 @@ nunavut::support::SerializeResult deserialize(T& obj, nunavut::support::const_bi
 
 }  // namespace Custom
 
+class PortObserverMock final : public IPortObserver
+{
+public:
+    PortObserverMock()          = default;
+    virtual ~PortObserverMock() = default;
+
+    PortObserverMock(const PortObserverMock&)                = delete;
+    PortObserverMock(PortObserverMock&&) noexcept            = delete;
+    PortObserverMock& operator=(const PortObserverMock&)     = delete;
+    PortObserverMock& operator=(PortObserverMock&&) noexcept = delete;
+
+    MOCK_METHOD(void, onPortAdded, (const PortKind kind, const PortId port_id), (noexcept, override));
+    MOCK_METHOD(void, onPortRemoved, (const PortKind kind, const PortId port_id), (noexcept, override));
+
+};  // PortObserverMock
+
 class TestPresentation : public testing::Test
 {
 protected:
@@ -798,6 +821,138 @@ TEST_F(TestPresentation, makeClient_with_failure)
     }
 }
 
+TEST_F(TestPresentation, setPortObserver)
+{
+    using PortKind = IPortObserver::PortKind;
+
+    StrictMock<MessageTxSessionMock>  msg_tx_session_mock;
+    StrictMock<MessageRxSessionMock>  msg_rx_session_mock;
+    StrictMock<ResponseRxSessionMock> res_rx_session_mock1;
+    StrictMock<ResponseRxSessionMock> res_rx_session_mock2;
+    StrictMock<RequestTxSessionMock>  req_tx_session_mock1;
+    StrictMock<RequestTxSessionMock>  req_tx_session_mock2;
+    StrictMock<RequestRxSessionMock>  req_rx_session_mock;
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr MessageTxParams  tx_params{147};
+    constexpr MessageRxParams  rx_params{8, 148};
+    constexpr ResponseRxParams res_rx_params1{8, 149, 0x31};
+    constexpr ResponseRxParams res_rx_params2{8, 149, 0x32};
+    constexpr RequestRxParams  req_rx_params{8, 150};
+
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_)).Times(1);
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+    EXPECT_CALL(res_rx_session_mock1, getParams()).WillOnce(Return(res_rx_params1));
+    EXPECT_CALL(res_rx_session_mock1, setTransferIdTimeout(_)).WillOnce(Return());
+    EXPECT_CALL(res_rx_session_mock1, setOnReceiveCallback(_)).WillOnce(Return());
+    EXPECT_CALL(res_rx_session_mock2, getParams()).WillOnce(Return(res_rx_params2));
+    EXPECT_CALL(res_rx_session_mock2, setTransferIdTimeout(_)).WillOnce(Return());
+    EXPECT_CALL(res_rx_session_mock2, setOnReceiveCallback(_)).WillOnce(Return());
+    EXPECT_CALL(transport_mock_, makeResponseRxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                 //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, res_rx_session_mock1);
+        }))
+        .WillOnce(Invoke([&](const auto&) {  //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, res_rx_session_mock2);
+        }));
+    EXPECT_CALL(transport_mock_, makeRequestTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, req_tx_session_mock1);
+        }))
+        .WillOnce(Invoke([&](const auto&) {  //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, req_tx_session_mock2);
+        }));
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_)).WillRepeatedly(Return());
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(req_rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                               //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(ResponseTxParams{req_rx_params.service_id})))
+        .WillOnce(Invoke([&](const auto&) {  //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    Presentation                 presentation{mr_, scheduler_, transport_mock_};
+    StrictMock<PortObserverMock> observer;
+
+    cetl::optional<Publisher<void>>  publisher;
+    cetl::optional<Subscriber<void>> subscriber;
+    cetl::optional<RawServiceClient> client1;
+    cetl::optional<RawServiceClient> client2;
+    cetl::optional<RawServiceServer> server;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_pub = presentation.makePublisher<void>(tx_params.subject_id);
+        ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+        publisher.emplace(cetl::get<Publisher<void>>(std::move(maybe_pub)));
+
+        // Already existing ports are replayed to the new observer.
+        EXPECT_CALL(observer, onPortAdded(PortKind::Publisher, tx_params.subject_id)).Times(1);
+        presentation.setPortObserver(&observer);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(observer, onPortAdded(PortKind::Subscriber, rx_params.subject_id)).Times(1);
+        auto maybe_sub = presentation.makeSubscriber(rx_params.subject_id, rx_params.extent_bytes);
+        ASSERT_THAT(maybe_sub, VariantWith<Subscriber<void>>(_));
+        subscriber.emplace(cetl::get<Subscriber<void>>(std::move(maybe_sub)));
+
+        // Clients of the same service (but to different servers) are reported only once.
+        EXPECT_CALL(observer, onPortAdded(PortKind::Client, res_rx_params1.service_id)).Times(1);
+        auto maybe_client1 = presentation.makeClient(res_rx_params1.server_node_id, res_rx_params1.service_id, 8);
+        ASSERT_THAT(maybe_client1, VariantWith<RawServiceClient>(_));
+        client1.emplace(cetl::get<RawServiceClient>(std::move(maybe_client1)));
+        auto maybe_client2 = presentation.makeClient(res_rx_params2.server_node_id, res_rx_params2.service_id, 8);
+        ASSERT_THAT(maybe_client2, VariantWith<RawServiceClient>(_));
+        client2.emplace(cetl::get<RawServiceClient>(std::move(maybe_client2)));
+
+        EXPECT_CALL(observer, onPortAdded(PortKind::Server, req_rx_params.service_id)).Times(1);
+        auto maybe_server = presentation.makeServer(req_rx_params.service_id, req_rx_params.extent_bytes);
+        ASSERT_THAT(maybe_server, VariantWith<RawServiceServer>(_));
+        server.emplace(cetl::get<RawServiceServer>(std::move(maybe_server)));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(observer, onPortRemoved(PortKind::Server, req_rx_params.service_id)).Times(1);
+        server.reset();
+
+        EXPECT_CALL(res_rx_session_mock1, deinit()).Times(1);
+        EXPECT_CALL(req_tx_session_mock1, deinit()).Times(1);
+        client1.reset();
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        EXPECT_CALL(res_rx_session_mock2, deinit()).Times(1);
+        EXPECT_CALL(req_tx_session_mock2, deinit()).Times(1);
+        EXPECT_CALL(observer, onPortRemoved(PortKind::Client, res_rx_params2.service_id)).Times(1);
+        client2.reset();
+
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(observer, onPortRemoved(PortKind::Publisher, tx_params.subject_id)).Times(1);
+        publisher.reset();
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        presentation.setPortObserver(nullptr);
+
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+        subscriber.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
 TEST_F(TestPresentation, tryDeserialize_coverage)
 {
     using namespace libcyphal::presentation::detail;  // NOLINT
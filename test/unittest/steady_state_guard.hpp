@@ -0,0 +1,113 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_STEADY_STATE_GUARD_HPP_INCLUDED
+#define LIBCYPHAL_STEADY_STATE_GUARD_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/platform/guard_memory_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace libcyphal
+{
+namespace platform
+{
+
+// MARK: - GTest Printers:
+
+inline void PrintTo(const GuardMemoryResource::Violation& violation, std::ostream* os)
+{
+    *os << "\n{size=" << violation.size_bytes << ", align=" << violation.alignment
+        << ", refused=" << violation.refused << "}";
+}
+
+}  // namespace platform
+
+/// Test utility which verifies that a steady state (after a warm-up phase) is free of allocations.
+///
+/// Usage:
+/// 1. Pass `resource()` to the system under test instead of the designated memory resource.
+/// 2. Warm up the system (create sessions, exchange a few transfers to let all lazy allocations happen).
+/// 3. Call `arm()`, exercise the steady state, and verify (with `EXPECT_THAT`) that `violations()` are empty.
+///
+/// Allocations while armed are recorded, and by default are also refused - so that
+/// the system under test observes them as ordinary out-of-memory failures.
+/// The guard is also installed as the default PMR resource while armed, so stray allocations are caught too.
+///
+class SteadyStateGuard final
+{
+public:
+    using Violation = platform::GuardMemoryResource::Violation;
+    using Options   = platform::GuardMemoryResource::Options;
+
+    explicit SteadyStateGuard(cetl::pmr::memory_resource& upstream, const Options options = {})
+        : resource_{upstream, options}
+    {
+        resource_.setViolationHandler([this](const Violation& violation) {
+            //
+            violations_.push_back(violation);
+        });
+    }
+
+    ~SteadyStateGuard()
+    {
+        disarm();
+    }
+
+    SteadyStateGuard(const SteadyStateGuard&)                = delete;
+    SteadyStateGuard(SteadyStateGuard&&) noexcept            = delete;
+    SteadyStateGuard& operator=(const SteadyStateGuard&)     = delete;
+    SteadyStateGuard& operator=(SteadyStateGuard&&) noexcept = delete;
+
+    cetl::pmr::memory_resource& resource() noexcept
+    {
+        return resource_;
+    }
+
+    /// Arms the guard - call it once the warm-up phase is completed.
+    ///
+    void arm()
+    {
+        violations_.clear();
+        if (!resource_.isArmed())
+        {
+            prev_default_ = cetl::pmr::set_default_resource(&resource_);
+        }
+        resource_.arm();
+    }
+
+    /// Disarms the guard - f.e. before tearing down the system under test.
+    ///
+    void disarm()
+    {
+        if (resource_.isArmed())
+        {
+            resource_.disarm();
+            (void) cetl::pmr::set_default_resource(prev_default_);
+        }
+    }
+
+    const std::vector<Violation>& violations() const noexcept
+    {
+        return violations_;
+    }
+
+private:
+    // MARK: Data members:
+
+    platform::GuardMemoryResource resource_;
+    std::vector<Violation>        violations_;
+    cetl::pmr::memory_resource*   prev_default_{nullptr};
+
+};  // SteadyStateGuard
+
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_STEADY_STATE_GUARD_HPP_INCLUDED
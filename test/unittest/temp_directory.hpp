@@ -0,0 +1,121 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TEMP_DIRECTORY_HPP_INCLUDED
+#define LIBCYPHAL_TEMP_DIRECTORY_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+
+#include <ftw.h>
+#include <stdlib.h>  // NOLINT(*-deprecated-headers) `mkdtemp` is POSIX, and so not in `<cstdlib>`.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if (__cplusplus >= CETL_CPP_STANDARD_17)
+#    include <filesystem>
+#    include <system_error>
+#endif
+
+namespace libcyphal
+{
+
+/// Creates a uniquely named directory in the system temporary directory, and recursively removes it on destruction.
+///
+/// Unique naming allows concurrent runs of tests (or benchmarks) which work with real files.
+///
+class TempDirectory final
+{
+public:
+    explicit TempDirectory(const std::string& prefix)
+    {
+        std::string       path_template = getSystemTempPath() + "/" + prefix + ".XXXXXX";
+        std::vector<char> buffer{path_template.cbegin(), path_template.cend()};
+        buffer.push_back('\0');
+        if (::mkdtemp(buffer.data()) != nullptr)
+        {
+            path_ = buffer.data();
+        }
+    }
+
+    ~TempDirectory()
+    {
+        if (!path_.empty())
+        {
+            removeAll(path_);
+        }
+    }
+
+    TempDirectory(const TempDirectory&)                = delete;
+    TempDirectory(TempDirectory&&) noexcept            = delete;
+    TempDirectory& operator=(const TempDirectory&)     = delete;
+    TempDirectory& operator=(TempDirectory&&) noexcept = delete;
+
+    /// Gets path of the directory, or an empty string if the directory could not be created.
+    ///
+    const std::string& path() const noexcept
+    {
+        return path_;
+    }
+
+    /// Makes path of a file (or a subdirectory) with the given name inside of the directory.
+    ///
+    std::string makePath(const std::string& name) const
+    {
+        return path_ + "/" + name;
+    }
+
+private:
+    static std::string getSystemTempPath()
+    {
+#if (__cplusplus >= CETL_CPP_STANDARD_17)
+        std::error_code ec;
+        const auto      temp_path = std::filesystem::temp_directory_path(ec);
+        if (!ec)
+        {
+            return temp_path.string();
+        }
+#else
+        // The same environment variables (and fallback) as `std::filesystem::temp_directory_path` on POSIX.
+        for (const char* const name : {"TMPDIR", "TMP", "TEMP", "TEMPDIR"})
+        {
+            const char* const value = std::getenv(name);  // NOLINT(concurrency-mt-unsafe)
+            if ((value != nullptr) && (*value != '\0'))
+            {
+                return value;
+            }
+        }
+#endif
+        return "/tmp";
+    }
+
+    static void removeAll(const std::string& path)
+    {
+#if (__cplusplus >= CETL_CPP_STANDARD_17)
+        std::error_code ec;
+        (void) std::filesystem::remove_all(path, ec);
+#else
+        (void) ::nftw(
+            path.c_str(),
+            [](const char* const entry_path, const struct stat*, int, struct FTW*) {
+                //
+                return std::remove(entry_path);
+            },
+            16,
+            FTW_DEPTH | FTW_PHYS);  // NOLINT(hicpp-signed-bitwise)
+#endif
+    }
+
+    // MARK: Data members:
+
+    std::string path_;
+
+};  // TempDirectory
+
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TEMP_DIRECTORY_HPP_INCLUDED
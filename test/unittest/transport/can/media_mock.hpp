@@ -59,6 +59,8 @@ public:
 
     MOCK_METHOD(cetl::pmr::memory_resource&, getTxMemoryResource, (), (override));
 
+    MOCK_METHOD(bool, setTxCompleteCallback, (TxCompleteCallback::Function && function), (override));
+
 };  // MediaMock
 
 }  // namespace can
@@ -0,0 +1,393 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "media_mock.hpp"
+#include "steady_state_guard.hpp"
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <canard.h>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::SteadyStateGuard;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+using libcyphal::verification_utilities::makeIotaArray;
+using libcyphal::verification_utilities::makeSpansFrom;
+
+using testing::_;
+using testing::Eq;
+using testing::Ge;
+using testing::Le;
+using testing::Each;
+using testing::Field;
+using testing::Invoke;
+using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::ReturnRef;
+using testing::StrictMock;
+using testing::VariantWith;
+
+using Violation = SteadyStateGuard::Violation;
+using Schedule  = libcyphal::IExecutor::Callback::Schedule;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr int WarmUpTransfers = 4;
+constexpr int SteadyTransfers = 100;
+
+/// Verifies that hot paths of the CAN transport (publish, receive, respond, request, idle executor spin)
+/// don't allocate from the transport general memory once the warm-up phase is completed.
+///
+/// TX frames are allocated by design from the media TX memory (which is not guarded here),
+/// and so are received transfer payloads - by libcanard from the general memory (see `subscribe` test).
+///
+class TestCanSteadyState : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(media_mock_, getMtu()).WillRepeatedly(Return(CANARD_MTU_CAN_CLASSIC));
+        EXPECT_CALL(media_mock_, getTxMemoryResource()).WillRepeatedly(ReturnRef(tx_mr_));
+        EXPECT_CALL(media_mock_, setFilters(_)).WillRepeatedly(Return(cetl::nullopt));
+        EXPECT_CALL(media_mock_, push(_, _, _))  //
+            .WillRepeatedly([this](auto, auto, auto&) {
+                ++pushed_frames_;
+                return IMedia::PushResult::Success{true /* is_accepted */};
+            });
+        EXPECT_CALL(media_mock_, pop(_))  //
+            .WillRepeatedly([this](auto payload) -> IMedia::PopResult::Type {
+                if (rx_frame_size_ == 0)
+                {
+                    return cetl::nullopt;
+                }
+                std::copy_n(rx_frame_.begin(), rx_frame_size_, payload.begin());
+                return IMedia::PopResult::Metadata{now(), rx_can_id_, std::exchange(rx_frame_size_, 0)};
+            });
+        EXPECT_CALL(media_mock_, registerPushCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto function) {
+                // Emulate media which is always ready to accept next frame (every 1ms).
+                return scheduler_.registerAndScheduleNamedCallback("tx",
+                                                                   Schedule::Repeat{now(), 1ms},
+                                                                   std::move(function));
+            }));
+        EXPECT_CALL(media_mock_, registerPopCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto function) {
+                return scheduler_.registerNamedCallback("rx", std::move(function));
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+        EXPECT_THAT(tx_mr_.total_allocated_bytes, tx_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    UniquePtr<ICanTransport> makeTransport(cetl::pmr::memory_resource& mr, const NodeId local_node_id)
+    {
+        std::array<IMedia*, 1> media_array{&media_mock_};
+
+        auto maybe_transport = can::makeTransport(mr, scheduler_, media_array, 16);
+        EXPECT_THAT(maybe_transport, VariantWith<UniquePtr<ICanTransport>>(NotNull()));
+        auto transport = cetl::get<UniquePtr<ICanTransport>>(std::move(maybe_transport));
+
+        EXPECT_THAT(transport->setLocalNodeId(local_node_id), Eq(cetl::nullopt));
+        return transport;
+    }
+
+    /// Emulates reception of a single-frame transfer (with the given payload byte) by the media.
+    ///
+    void receiveSingleFrame(const CanId can_id, const TransferId transfer_id, const cetl::byte payload_byte)
+    {
+        rx_can_id_     = can_id;
+        rx_frame_[0]   = payload_byte;
+        rx_frame_[1]   = b(static_cast<std::uint8_t>(0b111'00000U | (transfer_id & CANARD_TRANSFER_ID_MAX)));
+        rx_frame_size_ = 2;
+        scheduler_.scheduleNamedCallback("rx", now());
+        scheduler_.spinFor(10ms);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                scheduler_{};
+    TrackingMemoryResource                         mr_;
+    TrackingMemoryResource                         tx_mr_;
+    StrictMock<MediaMock>                          media_mock_{};
+    std::size_t                                    pushed_frames_{0};
+    CanId                                          rx_can_id_{0};
+    std::array<cetl::byte, CANARD_MTU_CAN_CLASSIC> rx_frame_{};
+    std::size_t                                    rx_frame_size_{0};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestCanSteadyState, publish)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard.resource(), 0x13);
+
+    auto maybe_session = transport->makeMessageTxSession({0x23});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    // Single frame payload, and a multi-frame one split into two fragments (so it has to be made contiguous).
+    const auto payload_single = makeIotaArray<CANARD_MTU_CAN_CLASSIC - 1>(b('0'));
+    const auto payload_head   = makeIotaArray<16>(b('a'));
+    const auto payload_tail   = makeIotaArray<20>(b('A'));
+
+    TransferId transfer_id = 0;
+    const auto publish     = [&] {
+        const TransferTxMetadata metadata1{{transfer_id++, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(session->send(metadata1, makeSpansFrom(payload_single)), Eq(cetl::nullopt));
+
+        const TransferTxMetadata metadata2{{transfer_id++, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(session->send(metadata2, makeSpansFrom(payload_head, payload_tail)), Eq(cetl::nullopt));
+
+        scheduler_.spinFor(10ms);
+    };
+
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        publish();
+    }
+
+    guard.arm();
+    const auto pushed_before = pushed_frames_;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        publish();
+    }
+    guard.disarm();
+
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(pushed_frames_ - pushed_before, Ge(SteadyTransfers * 2));
+}
+
+TEST_F(TestCanSteadyState, subscribe)
+{
+    // libcanard allocates a payload buffer (up to the extent) per each received transfer from the general memory,
+    // so the guard here only records (doesn't refuse) allocations, and the test verifies that these are the only
+    // ones, and that all of them are released once transfers are dropped.
+    SteadyStateGuard guard{mr_, {false /* refuse_when_armed */}};
+
+    auto transport = makeTransport(guard.resource(), 0x13);
+
+    constexpr std::size_t extent_bytes  = 8;
+    auto                  maybe_session = transport->makeMessageRxSession({extent_bytes, 0x23});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    std::size_t received_count = 0;
+    session->setOnReceiveCallback([&received_count](const auto&) {
+        //
+        ++received_count;
+    });
+
+    TransferId transfer_id = 0;
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        receiveSingleFrame(0x0C'60'23'45, transfer_id++, b(42));
+    }
+    ASSERT_THAT(received_count, WarmUpTransfers);
+
+    guard.arm();
+    const auto allocated_bytes_before = mr_.allocated_bytes;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        receiveSingleFrame(0x0C'60'23'45, transfer_id++, b(42));
+    }
+    guard.disarm();
+
+    EXPECT_THAT(received_count, WarmUpTransfers + SteadyTransfers);
+    EXPECT_THAT(guard.violations(), SizeIs(SteadyTransfers));
+    EXPECT_THAT(guard.violations(), Each(Field(&Violation::size_bytes, Le(extent_bytes))));
+    EXPECT_THAT(mr_.allocated_bytes, allocated_bytes_before);
+}
+
+TEST_F(TestCanSteadyState, respond)
+{
+    // See `subscribe` test about libcanard payload buffers of received requests.
+    SteadyStateGuard guard{mr_, {false /* refuse_when_armed */}};
+
+    auto transport = makeTransport(guard.resource(), 0x31);
+
+    constexpr std::size_t extent_bytes     = 8;
+    auto                  maybe_rx_session = transport->makeRequestRxSession({extent_bytes, 0x17B});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_rx_session));
+
+    auto maybe_tx_session = transport->makeResponseTxSession({0x17B});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IResponseTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IResponseTxSession>>(std::move(maybe_tx_session));
+
+    const auto response_head = makeIotaArray<3>(b('a'));
+    const auto response_tail = makeIotaArray<3>(b('A'));
+
+    std::size_t responded_count = 0;
+    rx_session->setOnReceiveCallback([&](const auto& arg) {
+        //
+        const auto&             request = arg.transfer.metadata;
+        const ServiceTxMetadata metadata{{request.rx_meta.base, now() + 1s}, request.remote_node_id};
+        EXPECT_THAT(tx_session->send(metadata, makeSpansFrom(response_head, response_tail)), Eq(cetl::nullopt));
+        ++responded_count;
+    });
+
+    // Request frames from node 0x13 to the local node 0x31 (see Cyphal/CAN Specification).
+    constexpr CanId request_can_id = 0b011'1'1'0'101111011'0110001'0010011;
+
+    TransferId transfer_id = 0;
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        receiveSingleFrame(request_can_id, transfer_id++, b(42));
+    }
+    ASSERT_THAT(responded_count, WarmUpTransfers);
+
+    guard.arm();
+    const auto allocated_bytes_before = mr_.allocated_bytes;
+    const auto pushed_before          = pushed_frames_;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        receiveSingleFrame(request_can_id, transfer_id++, b(42));
+    }
+    guard.disarm();
+
+    EXPECT_THAT(responded_count, WarmUpTransfers + SteadyTransfers);
+    EXPECT_THAT(pushed_frames_ - pushed_before, Ge(SteadyTransfers));
+    EXPECT_THAT(guard.violations(), SizeIs(SteadyTransfers));
+    EXPECT_THAT(guard.violations(), Each(Field(&Violation::size_bytes, Le(extent_bytes))));
+    EXPECT_THAT(mr_.allocated_bytes, allocated_bytes_before);
+}
+
+TEST_F(TestCanSteadyState, request)
+{
+    // See `subscribe` test about libcanard payload buffers of received responses.
+    SteadyStateGuard guard{mr_, {false /* refuse_when_armed */}};
+
+    auto transport = makeTransport(guard.resource(), 0x13);
+
+    auto maybe_tx_session = transport->makeRequestTxSession({0x17B, 0x31});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IRequestTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IRequestTxSession>>(std::move(maybe_tx_session));
+
+    constexpr std::size_t extent_bytes     = 8;
+    auto                  maybe_rx_session = transport->makeResponseRxSession({extent_bytes, 0x17B, 0x31});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IResponseRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IResponseRxSession>>(std::move(maybe_rx_session));
+
+    std::size_t received_count = 0;
+    rx_session->setOnReceiveCallback([&received_count](const auto&) {
+        //
+        ++received_count;
+    });
+
+    const auto request_head = makeIotaArray<3>(b('a'));
+    const auto request_tail = makeIotaArray<3>(b('A'));
+
+    // Response frames from the server node 0x31 to the local node 0x13 (see Cyphal/CAN Specification).
+    constexpr CanId response_can_id = 0b011'1'0'0'101111011'0010011'0110001;
+
+    TransferId transfer_id = 0;
+    const auto call        = [&] {
+        const TransferTxMetadata metadata{{transfer_id, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(tx_session->send(metadata, makeSpansFrom(request_head, request_tail)), Eq(cetl::nullopt));
+        scheduler_.spinFor(10ms);
+
+        receiveSingleFrame(response_can_id, transfer_id++, b(42));
+    };
+
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        call();
+    }
+    ASSERT_THAT(received_count, WarmUpTransfers);
+
+    guard.arm();
+    const auto allocated_bytes_before = mr_.allocated_bytes;
+    const auto pushed_before          = pushed_frames_;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        call();
+    }
+    guard.disarm();
+
+    EXPECT_THAT(received_count, WarmUpTransfers + SteadyTransfers);
+    EXPECT_THAT(pushed_frames_ - pushed_before, Ge(SteadyTransfers));
+    EXPECT_THAT(guard.violations(), SizeIs(SteadyTransfers));
+    EXPECT_THAT(guard.violations(), Each(Field(&Violation::size_bytes, Le(extent_bytes))));
+    EXPECT_THAT(mr_.allocated_bytes, allocated_bytes_before);
+}
+
+TEST_F(TestCanSteadyState, idle)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard.resource(), 0x13);
+
+    auto maybe_msg_rx_session = transport->makeMessageRxSession({8, 0x23});
+    ASSERT_THAT(maybe_msg_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto maybe_svc_rx_session = transport->makeRequestRxSession({8, 0x17B});
+    ASSERT_THAT(maybe_svc_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    scheduler_.spinFor(10ms);
+
+    // Nothing to transmit or receive - spinning of the executor (and so of the media callbacks) doesn't allocate.
+    guard.arm();
+    scheduler_.spinFor(10s);
+    guard.disarm();
+
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(pushed_frames_, 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -35,7 +35,9 @@
 #include <functional>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -1231,6 +1233,47 @@ TEST_F(TestCanTransport, setFilters_with_transient_handler)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestCanTransport, setMessageTxCompleteCallback)
+{
+    StrictMock<MediaMock> media_mock2{};
+    EXPECT_CALL(media_mock2, getMtu()).WillRepeatedly(Return(CANARD_MTU_CAN_CLASSIC));
+    EXPECT_CALL(media_mock2, getTxMemoryResource()).WillRepeatedly(ReturnRef(tx_mr_));
+
+    auto transport = makeTransport(mr_, &media_mock2);
+
+    // The second media doesn't support TX completion notifications.
+    IMedia::TxCompleteCallback::Function media_fn;
+    EXPECT_CALL(media_mock_, setTxCompleteCallback(_))  //
+        .WillOnce(Invoke([&](auto&& function) {         //
+            media_fn = std::move(function);
+            return true;
+        }))
+        .WillOnce(Invoke([&](auto&& function) {
+            // Transport destructor should disable the notifications.
+            EXPECT_FALSE(function);
+            media_fn = {};
+            return true;
+        }));
+    EXPECT_CALL(media_mock2, setTxCompleteCallback(_)).Times(2).WillRepeatedly(Return(false));
+
+    std::vector<std::tuple<PortId, std::uint8_t, TimePoint>> reports;
+    EXPECT_TRUE(transport->setMessageTxCompleteCallback([&](const auto& arg) {  //
+        reports.emplace_back(arg.subject_id, arg.media_index, arg.timestamp);
+    }));
+    ASSERT_TRUE(media_fn);
+
+    // Only message frames are reported (service ones have bit 25 set).
+    using TxArg = IMedia::TxCompleteCallback::Arg;
+    media_fn(TxArg{TimePoint{10ms}, (4UL << 26U) | (0x123UL << 8U) | 42UL});
+    media_fn(TxArg{TimePoint{20ms}, (4UL << 26U) | (1UL << 25U) | (0x123UL << 14U) | (13UL << 7U) | 42UL});
+    media_fn(TxArg{TimePoint{30ms}, (2UL << 26U) | (1UL << 24U) | (0x1FFFUL << 8U) | 7UL});
+    EXPECT_THAT(reports,
+                ElementsAre(std::make_tuple(0x123, 0, TimePoint{10ms}), std::make_tuple(0x1FFF, 0, TimePoint{30ms})));
+
+    transport.reset();
+    EXPECT_FALSE(media_fn);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
@@ -9,12 +9,14 @@
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/config.hpp>
 #include <libcyphal/transport/contiguous_payload.hpp>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstddef>
 #include <vector>
 
 namespace
@@ -24,6 +26,7 @@ using namespace libcyphal::transport;  // NOLINT This our main concern here in t
 
 using cetl::byte;
 using libcyphal::verification_utilities::b;
+using libcyphal::verification_utilities::makeIotaArray;
 
 using testing::_;
 using testing::IsNull;
@@ -33,6 +36,8 @@ using testing::Return;
 using testing::StrictMock;
 using testing::ElementsAre;
 
+constexpr std::size_t SmallBufferSize = libcyphal::config::Transport::ContiguousPayload_SmallBufferSize();
+
 class TestContiguousPayload : public testing::Test
 {
 protected:
@@ -86,8 +91,26 @@ TEST_F(TestContiguousPayload, ctor_data_size)
         const std::vector<byte> v(payload.data(), payload.data() + payload.size());  // NOLINT
         EXPECT_THAT(v, ElementsAre(b(1), b(2), b(3), b(4), b(5)));
     }
-    EXPECT_THAT(mr_.total_allocated_bytes, 5);
-    EXPECT_THAT(mr_.total_deallocated_bytes, 5);
+    // Small payloads are concatenated in the internal buffer.
+    EXPECT_THAT(mr_.total_allocated_bytes, 0);
+    EXPECT_THAT(mr_.total_deallocated_bytes, 0);
+
+    // Double fragments, which don't fit into the small buffer.
+    {
+        const auto                                  data_large = makeIotaArray<SmallBufferSize>(b(1));
+        const std::array<byte, 2>                   data45     = {b(4), b(5)};
+        const std::array<cetl::span<const byte>, 2> fragments  = {data_large, data45};
+
+        const detail::ContiguousPayload payload{mr_, fragments};
+
+        EXPECT_THAT(payload.size(), SmallBufferSize + 2);
+        EXPECT_THAT(payload.data(), NotNull());
+        const std::vector<byte> v(payload.data(), payload.data() + payload.size());  // NOLINT
+        EXPECT_THAT(v.front(), b(1));
+        EXPECT_THAT(v.back(), b(5));
+    }
+    EXPECT_THAT(mr_.total_allocated_bytes, SmallBufferSize + 2);
+    EXPECT_THAT(mr_.total_deallocated_bytes, SmallBufferSize + 2);
 }
 
 TEST_F(TestContiguousPayload, ctor_empty_cases)
@@ -144,14 +167,31 @@ TEST_F(TestContiguousPayload, ctor_no_memory_error)
     EXPECT_CALL(mr_mock, do_allocate(_, _))  //
         .WillOnce(Return(nullptr));
 
-    const std::array<byte, 3>                   data123   = {b(1), b(2), b(3)};
-    const std::array<byte, 2>                   data45    = {b(4), b(5)};
-    const std::array<cetl::span<const byte>, 2> fragments = {data123, data45};
+    const auto                                  data_large = makeIotaArray<SmallBufferSize>(b(1));
+    const std::array<byte, 2>                   data45     = {b(4), b(5)};
+    const std::array<cetl::span<const byte>, 2> fragments  = {data_large, data45};
 
     const detail::ContiguousPayload payload{mr_mock, fragments};
 
-    EXPECT_THAT(payload.size(), 5);
+    EXPECT_THAT(payload.size(), SmallBufferSize + 2);
     EXPECT_THAT(payload.data(), IsNull());
 }
 
+TEST_F(TestContiguousPayload, ctor_no_alloc_for_small_fragmented_payload)
+{
+    StrictMock<MemoryResourceMock> mr_mock;
+
+    const auto                                  data_small = makeIotaArray<SmallBufferSize - 2>(b(1));
+    const std::array<byte, 2>                   data45     = {b(4), b(5)};
+    const std::array<cetl::span<const byte>, 2> fragments  = {data_small, data45};
+
+    const detail::ContiguousPayload payload{mr_mock, fragments};
+
+    EXPECT_THAT(payload.size(), SmallBufferSize);
+    EXPECT_THAT(payload.data(), NotNull());
+    const std::vector<byte> v(payload.data(), payload.data() + payload.size());  // NOLINT
+    EXPECT_THAT(v.front(), b(1));
+    EXPECT_THAT(v.back(), b(5));
+}
+
 }  // namespace
@@ -60,6 +60,10 @@ public:
                 makeResponseTxSession,
                 (const ResponseTxParams& params),
                 (override));
+    MOCK_METHOD(bool,
+                setMessageTxCompleteCallback,
+                (MessageTxCompleteCallback::Function && function),
+                (override));
 
 };  // TransportMock
 
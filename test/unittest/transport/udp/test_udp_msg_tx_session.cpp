@@ -13,6 +13,7 @@
 #include "virtual_time_scheduler.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/config.hpp>
 #include <libcyphal/errors.hpp>
 #include <libcyphal/executor.hpp>
 #include <libcyphal/transport/errors.hpp>
@@ -386,8 +387,10 @@ TEST_F(TestUdpMsgTxSession, send_when_no_memory_for_contiguous_payload)
     auto transport = makeTransport({mr_mock});
 
     // Emulate that there is no memory available for the expected contiguous payload.
-    const auto payload1 = makeIotaArray<1>(b('0'));
-    const auto payload2 = makeIotaArray<2>(b('1'));
+    // Note that small payloads are concatenated on stack, so the 1st fragment alone fills the small buffer.
+    constexpr auto SmallBufferSize = libcyphal::config::Transport::ContiguousPayload_SmallBufferSize();
+    const auto     payload1        = makeIotaArray<SmallBufferSize>(b('0'));
+    const auto     payload2        = makeIotaArray<2>(b('1'));
     EXPECT_CALL(mr_mock, do_allocate(sizeof(payload1) + sizeof(payload2), _))  //
         .WillOnce(Return(nullptr));
 
@@ -0,0 +1,407 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "media_mock.hpp"
+#include "steady_state_guard.hpp"
+#include "tracking_memory_resource.hpp"
+#include "tx_rx_sockets_mock.hpp"
+#include "udp_gtest_helpers.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/transport/udp/udp_transport.hpp>
+#include <libcyphal/transport/udp/udp_transport_impl.hpp>
+#include <libcyphal/types.hpp>
+#include <udpard.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::SteadyStateGuard;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::udp;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+using libcyphal::verification_utilities::makeIotaArray;
+using libcyphal::verification_utilities::makeSpansFrom;
+
+using testing::_;
+using testing::Eq;
+using testing::Ge;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::ReturnRef;
+using testing::StrictMock;
+using testing::AnyNumber;
+using testing::VariantWith;
+
+using Schedule = libcyphal::IExecutor::Callback::Schedule;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr int WarmUpTransfers = 4;
+constexpr int SteadyTransfers = 100;
+
+/// Verifies that hot paths of the UDP transport (publish, receive, respond, request, idle executor spin)
+/// don't allocate from the transport general (and session) memory once the warm-up phase is completed.
+///
+/// TX queue items and RX fragment handles are allocated by design from the "fragment" memory,
+/// RX datagrams - from the "payload" one, and TX datagrams - from the media TX memory;
+/// these are not guarded here, but verified to be released at the end of each steady phase.
+///
+class TestUdpSteadyState : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(media_mock_, makeTxSocket())  //
+            .WillRepeatedly(Invoke([this] {
+                return libcyphal::detail::makeUniquePtr<TxSocketMock::RefWrapper::Spec>(mr_, tx_socket_mock_);
+            }));
+        EXPECT_CALL(media_mock_, makeRxSocket(_))  //
+            .WillRepeatedly(Invoke([this](auto& endpoint) {
+                rx_socket_mock_.setEndpoint(endpoint);
+                return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, rx_socket_mock_);
+            }));
+        EXPECT_CALL(media_mock_, getTxMemoryResource()).WillRepeatedly(ReturnRef(tx_mr_));
+
+        EXPECT_CALL(tx_socket_mock_, getMtu()).WillRepeatedly(Return(UDPARD_MTU_DEFAULT));
+        EXPECT_CALL(tx_socket_mock_, send(_, _, _, _))  //
+            .WillRepeatedly([this](auto, auto, auto, auto) {
+                ++sent_datagrams_;
+                return ITxSocket::SendResult::Success{true /* is_accepted */};
+            });
+        EXPECT_CALL(tx_socket_mock_, registerCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto function) {
+                // Emulate TX socket which is always ready to accept next datagram (every 1ms).
+                return scheduler_.registerAndScheduleNamedCallback("tx_socket",
+                                                                   Schedule::Repeat{now(), 1ms},
+                                                                   std::move(function));
+            }));
+        EXPECT_CALL(tx_socket_mock_, deinit()).Times(AnyNumber());
+
+        EXPECT_CALL(rx_socket_mock_, receive())  //
+            .WillRepeatedly([this]() -> IRxSocket::ReceiveResult::Type {
+                //
+                return std::exchange(rx_datagram_, cetl::nullopt);
+            });
+        EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto function) {
+                return scheduler_.registerNamedCallback("rx_socket", std::move(function));
+            }));
+        EXPECT_CALL(rx_socket_mock_, deinit()).Times(AnyNumber());
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+        EXPECT_THAT(tx_mr_.total_allocated_bytes, tx_mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(fragment_mr_.allocations, IsEmpty());
+        EXPECT_THAT(fragment_mr_.total_allocated_bytes, fragment_mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(payload_mr_.allocations, IsEmpty());
+        EXPECT_THAT(payload_mr_.total_allocated_bytes, payload_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    UniquePtr<IUdpTransport> makeTransport(SteadyStateGuard& guard, const NodeId local_node_id)
+    {
+        std::array<IMedia*, 1> media_array{&media_mock_};
+
+        // Session memory is not specified, so it falls back to the (guarded) general memory.
+        const MemoryResourcesSpec mem_res_spec{guard.resource(), nullptr, &fragment_mr_, &payload_mr_};
+
+        auto maybe_transport = udp::makeTransport(mem_res_spec, scheduler_, media_array, 16);
+        EXPECT_THAT(maybe_transport, VariantWith<UniquePtr<IUdpTransport>>(NotNull()));
+        auto transport = cetl::get<UniquePtr<IUdpTransport>>(std::move(maybe_transport));
+
+        EXPECT_THAT(transport->setLocalNodeId(local_node_id), Eq(cetl::nullopt));
+        return transport;
+    }
+
+    /// Emulates reception of a single-frame transfer (with 2-bytes payload) by the media RX socket.
+    ///
+    void receiveSingleFrame(const NodeId     src_node_id,
+                            const NodeId     dst_node_id,
+                            const TransferId transfer_id,
+                            const PortId     port_id,
+                            const bool       is_service = false,
+                            const bool       is_request = false)
+    {
+        auto frame         = UdpardFrame(src_node_id, dst_node_id, transfer_id, 2, &payload_mr_, Priority::High);
+        frame.payload()[0] = b(42);
+        frame.payload()[1] = b(147);
+        frame.setPortId(port_id, is_service, is_request);
+        std::uint32_t tx_crc = UdpardFrame::InitialTxCrc;
+
+        rx_datagram_ = IRxSocket::ReceiveResult::Metadata{now(), std::move(frame).release(tx_crc)};
+        scheduler_.scheduleNamedCallback("rx_socket", now());
+        scheduler_.spinFor(10ms);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler   scheduler_{};
+    TrackingMemoryResource            mr_;
+    TrackingMemoryResource            tx_mr_;
+    TrackingMemoryResource            fragment_mr_;
+    TrackingMemoryResource            payload_mr_;
+    StrictMock<MediaMock>             media_mock_{};
+    StrictMock<RxSocketMock>          rx_socket_mock_{"RxS1"};
+    StrictMock<TxSocketMock>          tx_socket_mock_{"TxS1"};
+    std::size_t                       sent_datagrams_{0};
+    IRxSocket::ReceiveResult::Success rx_datagram_{};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestUdpSteadyState, publish)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard, 0x13);
+
+    auto maybe_session = transport->makeMessageTxSession({0x23});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+
+    // Single fragment payload, and a payload split into two fragments (so it has to be made contiguous).
+    const auto payload_single = makeIotaArray<7>(b('0'));
+    const auto payload_head   = makeIotaArray<16>(b('a'));
+    const auto payload_tail   = makeIotaArray<20>(b('A'));
+
+    TransferId transfer_id = 0;
+    const auto publish     = [&] {
+        const TransferTxMetadata metadata1{{transfer_id++, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(session->send(metadata1, makeSpansFrom(payload_single)), Eq(cetl::nullopt));
+
+        const TransferTxMetadata metadata2{{transfer_id++, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(session->send(metadata2, makeSpansFrom(payload_head, payload_tail)), Eq(cetl::nullopt));
+
+        scheduler_.spinFor(10ms);
+    };
+
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        publish();
+    }
+
+    guard.arm();
+    const auto sent_before = sent_datagrams_;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        publish();
+    }
+    guard.disarm();
+
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(sent_datagrams_ - sent_before, SteadyTransfers * 2);
+    EXPECT_THAT(fragment_mr_.allocated_bytes, 0);
+    EXPECT_THAT(tx_mr_.allocated_bytes, 0);
+}
+
+TEST_F(TestUdpSteadyState, subscribe)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard, 0x31);
+
+    auto maybe_session = transport->makeMessageRxSession({8, 0x23});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    std::size_t received_count = 0;
+    session->setOnReceiveCallback([&received_count](const auto&) {
+        //
+        ++received_count;
+    });
+
+    // The first transfer from a remote node lazily allocates its RX session state (from the session memory).
+    TransferId transfer_id = 0;
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        receiveSingleFrame(0x13, UDPARD_NODE_ID_UNSET, transfer_id++, 0x23);
+    }
+    ASSERT_THAT(received_count, WarmUpTransfers);
+
+    guard.arm();
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        receiveSingleFrame(0x13, UDPARD_NODE_ID_UNSET, transfer_id++, 0x23);
+    }
+    guard.disarm();
+
+    EXPECT_THAT(received_count, WarmUpTransfers + SteadyTransfers);
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(fragment_mr_.allocated_bytes, 0);
+    EXPECT_THAT(payload_mr_.allocated_bytes, 0);
+}
+
+TEST_F(TestUdpSteadyState, respond)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard, 0x31);
+
+    auto maybe_rx_session = transport->makeRequestRxSession({8, 0x17B});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_rx_session));
+
+    auto maybe_tx_session = transport->makeResponseTxSession({0x17B});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IResponseTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IResponseTxSession>>(std::move(maybe_tx_session));
+
+    const auto response_head = makeIotaArray<3>(b('a'));
+    const auto response_tail = makeIotaArray<3>(b('A'));
+
+    std::size_t responded_count = 0;
+    rx_session->setOnReceiveCallback([&](const auto& arg) {
+        //
+        const auto&             request = arg.transfer.metadata;
+        const ServiceTxMetadata metadata{{request.rx_meta.base, now() + 1s}, request.remote_node_id};
+        EXPECT_THAT(tx_session->send(metadata, makeSpansFrom(response_head, response_tail)), Eq(cetl::nullopt));
+        ++responded_count;
+    });
+
+    // Requests from node 0x13 to the local node 0x31.
+    TransferId transfer_id = 0;
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        receiveSingleFrame(0x13, 0x31, transfer_id++, 0x17B, true /*is_service*/, true /*is_request*/);
+    }
+    ASSERT_THAT(responded_count, WarmUpTransfers);
+
+    guard.arm();
+    const auto sent_before = sent_datagrams_;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        receiveSingleFrame(0x13, 0x31, transfer_id++, 0x17B, true /*is_service*/, true /*is_request*/);
+    }
+    guard.disarm();
+
+    EXPECT_THAT(responded_count, WarmUpTransfers + SteadyTransfers);
+    EXPECT_THAT(sent_datagrams_ - sent_before, Ge(SteadyTransfers));
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(fragment_mr_.allocated_bytes, 0);
+    EXPECT_THAT(payload_mr_.allocated_bytes, 0);
+}
+
+TEST_F(TestUdpSteadyState, request)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard, 0x13);
+
+    auto maybe_tx_session = transport->makeRequestTxSession({0x17B, 0x31});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IRequestTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IRequestTxSession>>(std::move(maybe_tx_session));
+
+    auto maybe_rx_session = transport->makeResponseRxSession({8, 0x17B, 0x31});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IResponseRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IResponseRxSession>>(std::move(maybe_rx_session));
+
+    std::size_t received_count = 0;
+    rx_session->setOnReceiveCallback([&received_count](const auto&) {
+        //
+        ++received_count;
+    });
+
+    const auto request_head = makeIotaArray<3>(b('a'));
+    const auto request_tail = makeIotaArray<3>(b('A'));
+
+    // Requests to the server node 0x31, and its responses back to the local node 0x13.
+    TransferId transfer_id = 0;
+    const auto call        = [&] {
+        const TransferTxMetadata metadata{{transfer_id, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(tx_session->send(metadata, makeSpansFrom(request_head, request_tail)), Eq(cetl::nullopt));
+        scheduler_.spinFor(10ms);
+
+        receiveSingleFrame(0x31, 0x13, transfer_id++, 0x17B, true /*is_service*/, false /*is_request*/);
+    };
+
+    for (int i = 0; i < WarmUpTransfers; ++i)
+    {
+        call();
+    }
+    ASSERT_THAT(received_count, WarmUpTransfers);
+
+    guard.arm();
+    const auto sent_before = sent_datagrams_;
+    for (int i = 0; i < SteadyTransfers; ++i)
+    {
+        call();
+    }
+    guard.disarm();
+
+    EXPECT_THAT(received_count, WarmUpTransfers + SteadyTransfers);
+    EXPECT_THAT(sent_datagrams_ - sent_before, SteadyTransfers);
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(fragment_mr_.allocated_bytes, 0);
+    EXPECT_THAT(payload_mr_.allocated_bytes, 0);
+    EXPECT_THAT(tx_mr_.allocated_bytes, 0);
+}
+
+TEST_F(TestUdpSteadyState, idle)
+{
+    SteadyStateGuard guard{mr_};
+
+    auto transport = makeTransport(guard, 0x13);
+
+    auto maybe_msg_rx_session = transport->makeMessageRxSession({8, 0x23});
+    ASSERT_THAT(maybe_msg_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto maybe_svc_rx_session = transport->makeRequestRxSession({8, 0x17B});
+    ASSERT_THAT(maybe_svc_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    scheduler_.spinFor(10ms);
+
+    // Nothing to transmit or receive - spinning of the executor (and so of the socket callbacks) doesn't allocate.
+    guard.arm();
+    scheduler_.spinFor(10s);
+    guard.disarm();
+
+    EXPECT_THAT(guard.violations(), IsEmpty());
+    EXPECT_THAT(sent_datagrams_, 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -19,6 +19,7 @@
 #include <libcyphal/transport/svc_sessions.hpp>
 #include <libcyphal/transport/types.hpp>
 #include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tracking_memory_resources.hpp>
 #include <libcyphal/transport/udp/tx_rx_sockets.hpp>
 #include <libcyphal/transport/udp/udp_transport.hpp>
 #include <libcyphal/transport/udp/udp_transport_impl.hpp>
@@ -34,7 +35,9 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -51,6 +54,7 @@ using libcyphal::verification_utilities::makeSpansFrom;
 
 using testing::_;
 using testing::Eq;
+using testing::Gt;
 using testing::Ref;
 using testing::Truly;
 using testing::Invoke;
@@ -61,11 +65,13 @@ using testing::NotNull;
 using testing::Optional;
 using testing::ReturnRef;
 using testing::StrictMock;
+using testing::ElementsAre;
 using testing::VariantWith;
 
 // https://github.com/llvm/llvm-project/issues/53444
 // NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
 using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
 using std::literals::chrono_literals::operator""us;
 // NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
 
@@ -353,6 +359,45 @@ TEST_F(TestUpdTransport, makeMessageRxSession)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestUpdTransport, makeMessageRxSession_with_tracking_memory_resources)
+{
+    TrackingMemoryResources resources{mr_};
+
+    auto transport = makeTransport(resources.makeSpec());
+    EXPECT_THAT(resources.general.getStatistics().in_use_bytes, Gt(0));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerCallback(std::move(function));
+            }));
+
+        auto maybe_rx_session = transport->makeMessageRxSession({42, 123});
+        ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+
+        auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+        EXPECT_CALL(rx_socket_mock_, deinit());
+        session.reset();
+        testing::Mock::VerifyAndClearExpectations(&rx_socket_mock_);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        transport.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    resources.visit([](const TrackingMemoryResources::Resource& resource) {
+        //
+        const auto stats = resource.getStatistics();
+        EXPECT_THAT(stats.in_use_bytes, 0) << resource.getTag();
+        EXPECT_THAT(stats.deallocations_count, stats.allocations_count) << resource.getTag();
+        EXPECT_THAT(stats.failures_count, 0) << resource.getTag();
+    });
+    EXPECT_THAT(resources.general.getStatistics().high_water_bytes, Gt(0));
+}
+
 TEST_F(TestUpdTransport, makeMessageRxSession_invalid_subject_id)
 {
     auto transport = makeTransport({mr_});
@@ -855,6 +900,35 @@ TEST_F(TestUpdTransport, no_adhoc_tx_sockets_creation_when_there_is_nothing_to_s
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestUpdTransport, setMessageTxCompleteCallback)
+{
+    auto transport = makeTransport({mr_});
+
+    // TX socket is made on demand, so that the callback could be set up.
+    ITxSocket::TxCompleteCallback::Function socket_fn;
+    EXPECT_CALL(tx_socket_mock_, setTxCompleteCallback(_))  //
+        .WillOnce(Invoke([&](auto&& function) {             //
+            socket_fn = std::move(function);
+            return true;
+        }));
+
+    std::vector<std::tuple<PortId, std::uint8_t, TimePoint>> reports;
+    EXPECT_TRUE(transport->setMessageTxCompleteCallback([&](const auto& arg) {  //
+        reports.emplace_back(arg.subject_id, arg.media_index, arg.timestamp);
+    }));
+    ASSERT_TRUE(socket_fn);
+
+    // Only message multicast groups are reported (service ones have bit 16 set).
+    using TxArg = ITxSocket::TxCompleteCallback::Arg;
+    socket_fn(TxArg{TimePoint{10ms}, {0xEF000123, 9382}});
+    socket_fn(TxArg{TimePoint{20ms}, {0xEF01002A, 9382}});
+    socket_fn(TxArg{TimePoint{30ms}, {0xEF001FFF, 9382}});
+    EXPECT_THAT(reports,
+                ElementsAre(std::make_tuple(0x123, 0, TimePoint{10ms}), std::make_tuple(0x1FFF, 0, TimePoint{30ms})));
+
+    EXPECT_CALL(tx_socket_mock_, deinit());
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
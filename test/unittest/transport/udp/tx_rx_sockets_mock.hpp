@@ -52,6 +52,10 @@ public:
         {
             return reference().registerCallback(std::move(function));
         }
+        bool setTxCompleteCallback(TxCompleteCallback::Function&& function) override
+        {
+            return reference().setTxCompleteCallback(std::move(function));
+        }
 
     };  // RefWrapper
 
@@ -91,6 +95,8 @@ public:
 
     MOCK_METHOD(IExecutor::Callback::Any, registerCallback, (IExecutor::Callback::Function && function), (override));
 
+    MOCK_METHOD(bool, setTxCompleteCallback, (TxCompleteCallback::Function && function), (override));
+
     MOCK_METHOD(void, deinit, (), (noexcept));  // NOLINT(*-exception-escape)
 
 private:
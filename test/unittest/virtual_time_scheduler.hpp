@@ -102,6 +102,13 @@ public:
         return named_cb_interfaces_.find(name) != named_cb_interfaces_.end();
     }
 
+    /// Moves the virtual time, f.e. to emulate a long-running operation from within a callback.
+    ///
+    void setNow(const TimePoint now) noexcept
+    {
+        now_ = now;
+    }
+
     // MARK: - ITimeProvider
 
     TimePoint now() const noexcept override